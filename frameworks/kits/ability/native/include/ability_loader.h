@@ -21,8 +21,10 @@
 #include "extension.h"
 #include "ohos_application.h"
 #include <functional>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace OHOS {
 namespace AppExecFwk {
@@ -82,6 +84,19 @@ public:
      */
     AbilityRuntime::Extension *GetExtensionByName(const std::string &abilityName);
 
+    /**
+     * @brief Register a library whose abilities, extensions and slices register themselves once it is opened. The
+     *        library is opened the first time a class that is not registered yet is asked for.
+     *
+     * @param libraryPath The path of the library.
+     */
+    void RegisterLibrary(const std::string &libraryPath);
+
+    /**
+     * @brief Close the libraries opened, the ones not opened yet are dropped.
+     */
+    void CloseLibraries();
+
 #ifdef ABILITY_WINDOW_SUPPORT
     void RegisterAbilitySlice(const std::string &sliceName, const CreateSlice &createFunc);
     AbilitySlice *GetAbilitySliceByName(const std::string &sliceName);
@@ -94,8 +109,23 @@ private:
     AbilityLoader(AbilityLoader &&) = delete;
     AbilityLoader &operator=(AbilityLoader &&) = delete;
 
+    template<typename CreateFunc>
+    CreateFunc FindCreateFunc(const std::unordered_map<std::string, CreateFunc> &registry, const std::string &name);
+    void OpenLibrary(const std::string &libraryPath);
+
+    // guards the registries and the libraries, never held while a library is opened, as it registers itself
+    std::mutex mutex_;
+    // held while the pending libraries are opened, so that a lookup waits for the one opening its class
+    std::mutex openMutex_;
     std::unordered_map<std::string, CreateAblity> abilities_;
     std::unordered_map<std::string, CreateExtension> extensions_;
+#ifdef ABILITY_WINDOW_SUPPORT
+    std::unordered_map<std::string, CreateSlice> slices_;
+#endif
+    // opened in the order they are registered, so that a library opens after the ones before it
+    std::vector<std::string> libraryPaths_;
+    size_t nextLibrary_ = 0;
+    std::vector<void *> libraryHandles_;
 };
 /**
  * @brief Registers the class name of an {@link Ability} child class.
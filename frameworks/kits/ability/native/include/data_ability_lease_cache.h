@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_OHOS_DATA_ABILITY_LEASE_CACHE_H
+#define FOUNDATION_APPEXECFWK_OHOS_DATA_ABILITY_LEASE_CACHE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "ability_scheduler_interface.h"
+#include "event_handler.h"
+#include "iremote_object.h"
+#include "uri.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @class DataAbilityLeaseCache
+ * Keeps the data abilities acquired from the ability manager for a while once they are released, so that a
+ * DataAbilityHelper without a Uri does not acquire and release the data ability around every operation.
+ */
+class DataAbilityLeaseCache final {
+public:
+    static DataAbilityLeaseCache &GetInstance();
+
+    /**
+     * @brief Acquires the data ability of a Uri, from the cache if it holds a lease on it.
+     *
+     * @param uri Indicates the path of the data to operate.
+     * @param tryBind Specifies whether the exit of the Data ability process causes the exit of the client process.
+     * @param callerToken Indicates the token of the caller.
+     *
+     * @return Returns the data ability proxy, nullptr on failure.
+     */
+    sptr<AAFwk::IAbilityScheduler> Acquire(const Uri &uri, bool tryBind, const sptr<IRemoteObject> &callerToken);
+
+    /**
+     * @brief Releases a data ability acquired by Acquire. The lease is given back to the ability manager once idle
+     * for a while, a data ability not leased is released at once.
+     *
+     * @param dataAbilityProxy Indicates the data ability proxy.
+     * @param callerToken Indicates the token of the caller.
+     *
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    int Release(const sptr<AAFwk::IAbilityScheduler> &dataAbilityProxy, const sptr<IRemoteObject> &callerToken);
+
+private:
+    struct Lease {
+        sptr<AAFwk::IAbilityScheduler> dataAbilityProxy;
+        sptr<IRemoteObject> callerToken;
+        int32_t refCount = 0;
+    };
+
+    DataAbilityLeaseCache() = default;
+    ~DataAbilityLeaseCache() = default;
+
+    bool PostIdleRelease(const std::string &key);
+    void ReleaseIdleLease(const std::string &key);
+    void OnDataAbilityDied(const wptr<IRemoteObject> &remote);
+    static std::string GetLeaseKey(const Uri &uri, bool tryBind, const sptr<IRemoteObject> &callerToken);
+
+    std::mutex mutex_;
+    std::map<std::string, Lease> leases_;
+    std::shared_ptr<EventHandler> eventHandler_;
+    sptr<IRemoteObject::DeathRecipient> deathRecipient_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_OHOS_DATA_ABILITY_LEASE_CACHE_H
@@ -14,6 +14,9 @@
  */
 
 #include "ability_loader.h"
+
+#include <dlfcn.h>
+
 #include "hilog_wrapper.h"
 
 namespace OHOS {
@@ -32,6 +35,7 @@ AbilityLoader &AbilityLoader::GetInstance()
  */
 void AbilityLoader::RegisterAbility(const std::string &abilityName, const CreateAblity &createFunc)
 {
+    std::lock_guard<std::mutex> lock(mutex_);
     abilities_.emplace(abilityName, createFunc);
     HILOG_DEBUG("AbilityLoader::RegisterAbility:%{public}s", abilityName.c_str());
 }
@@ -44,6 +48,7 @@ void AbilityLoader::RegisterAbility(const std::string &abilityName, const Create
  */
 void AbilityLoader::RegisterExtension(const std::string &abilityName, const CreateExtension &createFunc)
 {
+    std::lock_guard<std::mutex> lock(mutex_);
     extensions_.emplace(abilityName, createFunc);
     HILOG_DEBUG("AbilityLoader::RegisterExtension:%{public}s", abilityName.c_str());
 }
@@ -57,9 +62,9 @@ void AbilityLoader::RegisterExtension(const std::string &abilityName, const Crea
  */
 Ability *AbilityLoader::GetAbilityByName(const std::string &abilityName)
 {
-    auto it = abilities_.find(abilityName);
-    if (it != abilities_.end()) {
-        return it->second();
+    CreateAblity createFunc = FindCreateFunc(abilities_, abilityName);
+    if (createFunc) {
+        return createFunc();
     } else {
         HILOG_ERROR("AbilityLoader::GetAbilityByName failed:%{public}s", abilityName.c_str());
     }
@@ -75,27 +80,104 @@ Ability *AbilityLoader::GetAbilityByName(const std::string &abilityName)
  */
 AbilityRuntime::Extension *AbilityLoader::GetExtensionByName(const std::string &abilityName)
 {
-    auto it = extensions_.find(abilityName);
-    if (it != extensions_.end()) {
-        return it->second();
+    CreateExtension createFunc = FindCreateFunc(extensions_, abilityName);
+    if (createFunc) {
+        return createFunc();
     } else {
         HILOG_ERROR("AbilityLoader::GetExtensionByName failed:%{public}s", abilityName.c_str());
     }
     return nullptr;
 }
 
+/**
+ * @brief Register a library whose abilities, extensions and slices register themselves once it is opened. The
+ *        library is opened the first time a class that is not registered yet is asked for.
+ *
+ * @param libraryPath The path of the library.
+ */
+void AbilityLoader::RegisterLibrary(const std::string &libraryPath)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    libraryPaths_.emplace_back(libraryPath);
+    HILOG_DEBUG("AbilityLoader::RegisterLibrary:%{public}s", libraryPath.c_str());
+}
+
+/**
+ * @brief Close the libraries opened, the ones not opened yet are dropped.
+ */
+void AbilityLoader::CloseLibraries()
+{
+    std::vector<void *> libraryHandles;
+    {
+        std::lock_guard<std::mutex> openLock(openMutex_);
+        std::lock_guard<std::mutex> lock(mutex_);
+        libraryHandles.swap(libraryHandles_);
+        libraryPaths_.clear();
+        nextLibrary_ = 0;
+    }
+    for (auto handle : libraryHandles) {
+        dlclose(handle);
+    }
+}
+
+template<typename CreateFunc>
+CreateFunc AbilityLoader::FindCreateFunc(const std::unordered_map<std::string, CreateFunc> &registry,
+    const std::string &name)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = registry.find(name);
+        if (it != registry.end()) {
+            return it->second;
+        }
+    }
+
+    // open the pending libraries until one registers the class, another thread may have opened it meanwhile
+    std::lock_guard<std::mutex> openLock(openMutex_);
+    std::string libraryPath;
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = registry.find(name);
+            if (it != registry.end()) {
+                return it->second;
+            }
+            if (nextLibrary_ >= libraryPaths_.size()) {
+                return nullptr;
+            }
+            libraryPath = libraryPaths_[nextLibrary_++];
+        }
+        OpenLibrary(libraryPath);
+    }
+}
+
+void AbilityLoader::OpenLibrary(const std::string &libraryPath)
+{
+    // the library registers while it is opened, which may register libraries too
+    void *handle = dlopen(libraryPath.c_str(), RTLD_NOW | RTLD_GLOBAL);
+    if (handle == nullptr) {
+        HILOG_ERROR("AbilityLoader::OpenLibrary Fail to dlopen %{public}s, [%{public}s]",
+            libraryPath.c_str(), dlerror());
+        return;
+    }
+    HILOG_INFO("AbilityLoader::OpenLibrary Success to dlopen %{public}s", libraryPath.c_str());
+    std::lock_guard<std::mutex> lock(mutex_);
+    libraryHandles_.emplace_back(handle);
+}
+
 #ifdef ABILITY_WINDOW_SUPPORT
 void AbilityLoader::RegisterAbilitySlice(const std::string &sliceName, const CreateSlice &createFunc)
 {
+    std::lock_guard<std::mutex> lock(mutex_);
     slices_.emplace(sliceName, createFunc);
     HILOG_INFO(HILOG_MODULE_APP, "RegisterAbilitySlice %s", sliceName.c_str());
 }
 
 AbilitySlice *AbilityLoader::GetAbilitySliceByName(const std::string &sliceName)
 {
-    auto it = slices_.find(sliceName);
-    if (it != slices_.end()) {
-        return it->second();
+    CreateSlice createFunc = FindCreateFunc(slices_, sliceName);
+    if (createFunc) {
+        return createFunc();
     } else {
         HILOG_ERROR(HILOG_MODULE_APP, "GetAbilitySliceByName failed: %s", sliceName.c_str());
         return nullptr;
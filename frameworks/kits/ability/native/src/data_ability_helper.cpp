@@ -20,6 +20,7 @@
 #include "abs_shared_result_set.h"
 #include "bytrace.h"
 #include "data_ability_observer_interface.h"
+#include "data_ability_lease_cache.h"
 #include "data_ability_operation.h"
 #include "data_ability_predicates.h"
 #include "data_ability_result.h"
@@ -400,7 +401,7 @@ std::vector<std::string> DataAbilityHelper::GetFileTypes(Uri &uri, const std::st
     sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = dataAbilityProxy_;
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::GetFileTypes before AcquireDataAbility.");
-        dataAbilityProxy = AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+        dataAbilityProxy = DataAbilityLeaseCache::GetInstance().Acquire(uri, tryBind_, token_);
         HILOG_INFO("DataAbilityHelper::GetFileTypes after AcquireDataAbility.");
         if (dataAbilityProxy == nullptr) {
             HILOG_ERROR("DataAbilityHelper::GetFileTypes failed dataAbility == nullptr");
@@ -416,7 +417,7 @@ std::vector<std::string> DataAbilityHelper::GetFileTypes(Uri &uri, const std::st
     HILOG_INFO("DataAbilityHelper::GetFileTypes after dataAbilityProxy->GetFileTypes.");
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::GetFileTypes before ReleaseDataAbility.");
-        int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+        int err = DataAbilityLeaseCache::GetInstance().Release(dataAbilityProxy, token_);
         HILOG_INFO("DataAbilityHelper::GetFileTypes after ReleaseDataAbility.");
         if (err != ERR_OK) {
             HILOG_ERROR("DataAbilityHelper::GetFileTypes failed to ReleaseDataAbility err = %{public}d", err);
@@ -450,7 +451,7 @@ int DataAbilityHelper::OpenFile(Uri &uri, const std::string &mode)
     sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = dataAbilityProxy_;
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::OpenFile before AcquireDataAbility.");
-        dataAbilityProxy = AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+        dataAbilityProxy = DataAbilityLeaseCache::GetInstance().Acquire(uri, tryBind_, token_);
         HILOG_INFO("DataAbilityHelper::OpenFile after AcquireDataAbility.");
         if (dataAbilityProxy == nullptr) {
             HILOG_ERROR("DataAbilityHelper::OpenFile failed dataAbility == nullptr");
@@ -466,7 +467,7 @@ int DataAbilityHelper::OpenFile(Uri &uri, const std::string &mode)
     HILOG_INFO("DataAbilityHelper::OpenFile after dataAbilityProxy->OpenFile.");
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::OpenFile before ReleaseDataAbility.");
-        int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+        int err = DataAbilityLeaseCache::GetInstance().Release(dataAbilityProxy, token_);
         HILOG_INFO("DataAbilityHelper::OpenFile after ReleaseDataAbility.");
         if (err != ERR_OK) {
             HILOG_ERROR("DataAbilityHelper::OpenFile failed to ReleaseDataAbility err = %{public}d", err);
@@ -500,7 +501,7 @@ int DataAbilityHelper::OpenRawFile(Uri &uri, const std::string &mode)
     sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = dataAbilityProxy_;
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::OpenRawFile before AcquireDataAbility.");
-        dataAbilityProxy = AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+        dataAbilityProxy = DataAbilityLeaseCache::GetInstance().Acquire(uri, tryBind_, token_);
         HILOG_INFO("DataAbilityHelper::OpenRawFile after AcquireDataAbility.");
         if (dataAbilityProxy == nullptr) {
             HILOG_ERROR("DataAbilityHelper::OpenRawFile failed dataAbility == nullptr");
@@ -515,7 +516,7 @@ int DataAbilityHelper::OpenRawFile(Uri &uri, const std::string &mode)
     HILOG_INFO("DataAbilityHelper::OpenRawFile after dataAbilityProxy->OpenRawFile.");
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::OpenRawFile before ReleaseDataAbility.");
-        int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+        int err = DataAbilityLeaseCache::GetInstance().Release(dataAbilityProxy, token_);
         HILOG_INFO("DataAbilityHelper::OpenRawFile after ReleaseDataAbility.");
         if (err != ERR_OK) {
             HILOG_ERROR("DataAbilityHelper::OpenRawFile failed to ReleaseDataAbility err = %{public}d", err);
@@ -546,7 +547,7 @@ int DataAbilityHelper::Insert(Uri &uri, const NativeRdb::ValuesBucket &value)
     sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = dataAbilityProxy_;
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::Insert before AcquireDataAbility.");
-        dataAbilityProxy = AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+        dataAbilityProxy = DataAbilityLeaseCache::GetInstance().Acquire(uri, tryBind_, token_);
         HILOG_INFO("DataAbilityHelper::Insert after AcquireDataAbility.");
         if (dataAbilityProxy == nullptr) {
             HILOG_ERROR("DataAbilityHelper::Insert failed dataAbility == nullptr");
@@ -561,7 +562,7 @@ int DataAbilityHelper::Insert(Uri &uri, const NativeRdb::ValuesBucket &value)
     HILOG_INFO("DataAbilityHelper::Insert after dataAbilityProxy->Insert.");
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::Insert before ReleaseDataAbility.");
-        int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+        int err = DataAbilityLeaseCache::GetInstance().Release(dataAbilityProxy, token_);
         HILOG_INFO("DataAbilityHelper::Insert after ReleaseDataAbility.");
         if (err != ERR_OK) {
             HILOG_ERROR("DataAbilityHelper::Insert failed to ReleaseDataAbility err = %{public}d", err);
@@ -584,7 +585,7 @@ std::shared_ptr<AppExecFwk::PacMap> DataAbilityHelper::Call(
     sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = dataAbilityProxy_;
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::Call before AcquireDataAbility.");
-        dataAbilityProxy = AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+        dataAbilityProxy = DataAbilityLeaseCache::GetInstance().Acquire(uri, tryBind_, token_);
         HILOG_INFO("DataAbilityHelper::Call after AcquireDataAbility.");
         if (dataAbilityProxy == nullptr) {
             HILOG_ERROR("DataAbilityHelper::Call failed dataAbility == nullptr");
@@ -599,7 +600,7 @@ std::shared_ptr<AppExecFwk::PacMap> DataAbilityHelper::Call(
     HILOG_INFO("DataAbilityHelper::Call after dataAbilityProxy->Insert.");
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::Call before ReleaseDataAbility.");
-        int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+        int err = DataAbilityLeaseCache::GetInstance().Release(dataAbilityProxy, token_);
         HILOG_INFO("DataAbilityHelper::Call after ReleaseDataAbility.");
         if (err != ERR_OK) {
             HILOG_ERROR("DataAbilityHelper::Call failed to ReleaseDataAbility err = %{public}d", err);
@@ -632,7 +633,7 @@ int DataAbilityHelper::Update(
     sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = dataAbilityProxy_;
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::Update before AcquireDataAbility.");
-        dataAbilityProxy = AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+        dataAbilityProxy = DataAbilityLeaseCache::GetInstance().Acquire(uri, tryBind_, token_);
         HILOG_INFO("DataAbilityHelper::Update after AcquireDataAbility.");
         if (dataAbilityProxy == nullptr) {
             HILOG_ERROR("DataAbilityHelper::Update failed dataAbility == nullptr");
@@ -647,7 +648,7 @@ int DataAbilityHelper::Update(
     HILOG_INFO("DataAbilityHelper::Update after dataAbilityProxy->Update.");
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::Update before ReleaseDataAbility.");
-        int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+        int err = DataAbilityLeaseCache::GetInstance().Release(dataAbilityProxy, token_);
         HILOG_INFO("DataAbilityHelper::Update after ReleaseDataAbility.");
         if (err != ERR_OK) {
             HILOG_ERROR("DataAbilityHelper::Update failed to ReleaseDataAbility err = %{public}d", err);
@@ -678,7 +679,7 @@ int DataAbilityHelper::Delete(Uri &uri, const NativeRdb::DataAbilityPredicates &
     sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = dataAbilityProxy_;
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::Delete before AcquireDataAbility.");
-        dataAbilityProxy = AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+        dataAbilityProxy = DataAbilityLeaseCache::GetInstance().Acquire(uri, tryBind_, token_);
         HILOG_INFO("DataAbilityHelper::Delete after AcquireDataAbility.");
         if (dataAbilityProxy == nullptr) {
             HILOG_ERROR("DataAbilityHelper::Delete failed dataAbility == nullptr");
@@ -693,7 +694,7 @@ int DataAbilityHelper::Delete(Uri &uri, const NativeRdb::DataAbilityPredicates &
     HILOG_INFO("DataAbilityHelper::Delete after dataAbilityProxy->Delete.");
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::Delete before ReleaseDataAbility.");
-        int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+        int err = DataAbilityLeaseCache::GetInstance().Release(dataAbilityProxy, token_);
         HILOG_INFO("DataAbilityHelper::Delete after ReleaseDataAbility.");
         if (err != ERR_OK) {
             HILOG_ERROR("DataAbilityHelper::Delete failed to ReleaseDataAbility err = %{public}d", err);
@@ -727,7 +728,7 @@ std::shared_ptr<NativeRdb::AbsSharedResultSet> DataAbilityHelper::Query(
     sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = dataAbilityProxy_;
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::Query before AcquireDataAbility.");
-        dataAbilityProxy = AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+        dataAbilityProxy = DataAbilityLeaseCache::GetInstance().Acquire(uri, tryBind_, token_);
         HILOG_INFO("DataAbilityHelper::Query after AcquireDataAbility.");
         if (dataAbilityProxy == nullptr) {
             HILOG_ERROR("DataAbilityHelper::Query failed dataAbility == nullptr");
@@ -742,7 +743,7 @@ std::shared_ptr<NativeRdb::AbsSharedResultSet> DataAbilityHelper::Query(
     HILOG_INFO("DataAbilityHelper::Query after dataAbilityProxy->Query.");
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::Query before ReleaseDataAbility.");
-        int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+        int err = DataAbilityLeaseCache::GetInstance().Release(dataAbilityProxy, token_);
         HILOG_INFO("DataAbilityHelper::Query after ReleaseDataAbility.");
         if (err != ERR_OK) {
             HILOG_ERROR("DataAbilityHelper::Query failed to ReleaseDataAbility err = %{public}d", err);
@@ -773,7 +774,7 @@ std::string DataAbilityHelper::GetType(Uri &uri)
     sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = dataAbilityProxy_;
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::GetType before AcquireDataAbility.");
-        dataAbilityProxy = AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+        dataAbilityProxy = DataAbilityLeaseCache::GetInstance().Acquire(uri, tryBind_, token_);
         HILOG_INFO("DataAbilityHelper::GetType after AcquireDataAbility.");
         if (dataAbilityProxy == nullptr) {
             HILOG_ERROR("DataAbilityHelper::GetType failed dataAbility == nullptr");
@@ -788,7 +789,7 @@ std::string DataAbilityHelper::GetType(Uri &uri)
     HILOG_INFO("DataAbilityHelper::GetType after dataAbilityProxy->GetType.");
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::GetType before ReleaseDataAbility.");
-        int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+        int err = DataAbilityLeaseCache::GetInstance().Release(dataAbilityProxy, token_);
         HILOG_INFO("DataAbilityHelper::GetType after ReleaseDataAbility.");
         if (err != ERR_OK) {
             HILOG_ERROR("DataAbilityHelper::GetType failed to ReleaseDataAbility err = %{public}d", err);
@@ -820,7 +821,7 @@ bool DataAbilityHelper::Reload(Uri &uri, const PacMap &extras)
     sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = dataAbilityProxy_;
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::Reload before AcquireDataAbility.");
-        dataAbilityProxy = AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+        dataAbilityProxy = DataAbilityLeaseCache::GetInstance().Acquire(uri, tryBind_, token_);
         HILOG_INFO("DataAbilityHelper::Reload after AcquireDataAbility.");
         if (dataAbilityProxy == nullptr) {
             HILOG_ERROR("DataAbilityHelper::Reload failed dataAbility == nullptr");
@@ -835,7 +836,7 @@ bool DataAbilityHelper::Reload(Uri &uri, const PacMap &extras)
     HILOG_INFO("DataAbilityHelper::Reload after dataAbilityProxy->Reload.");
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::Reload before ReleaseDataAbility.");
-        int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+        int err = DataAbilityLeaseCache::GetInstance().Release(dataAbilityProxy, token_);
         HILOG_INFO("DataAbilityHelper::Reload after ReleaseDataAbility.");
         if (err != ERR_OK) {
             HILOG_ERROR("DataAbilityHelper::Reload failed to ReleaseDataAbility err = %{public}d", err);
@@ -866,7 +867,7 @@ int DataAbilityHelper::BatchInsert(Uri &uri, const std::vector<NativeRdb::Values
     sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = dataAbilityProxy_;
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::BatchInsert before AcquireDataAbility.");
-        dataAbilityProxy = AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+        dataAbilityProxy = DataAbilityLeaseCache::GetInstance().Acquire(uri, tryBind_, token_);
         HILOG_INFO("DataAbilityHelper::BatchInsert after AcquireDataAbility.");
         if (dataAbilityProxy == nullptr) {
             HILOG_ERROR("DataAbilityHelper::BatchInsert failed dataAbility == nullptr");
@@ -881,7 +882,7 @@ int DataAbilityHelper::BatchInsert(Uri &uri, const std::vector<NativeRdb::Values
     HILOG_INFO("DataAbilityHelper::BatchInsert after dataAbilityProxy->BatchInsert.");
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::BatchInsert before ReleaseDataAbility.");
-        int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+        int err = DataAbilityLeaseCache::GetInstance().Release(dataAbilityProxy, token_);
         HILOG_INFO("DataAbilityHelper::BatchInsert after ReleaseDataAbility.");
         if (err != ERR_OK) {
             HILOG_ERROR("DataAbilityHelper::BatchInsert failed to ReleaseDataAbility err = %{public}d", err);
@@ -894,14 +895,13 @@ int DataAbilityHelper::BatchInsert(Uri &uri, const std::vector<NativeRdb::Values
 bool DataAbilityHelper::CheckUriParam(const Uri &uri)
 {
     HILOG_INFO("DataAbilityHelper::CheckUriParam start.");
-    Uri checkUri(uri.ToString());
-    if (!CheckOhosUri(checkUri)) {
+    if (!CheckOhosUri(uri)) {
         HILOG_ERROR("DataAbilityHelper::CheckUriParam failed. CheckOhosUri uri failed");
         return false;
     }
 
     // do not directly use uri_ here, otherwise, it will probably crash.
-    std::vector<std::string> segments;
+    std::string dataAbility;
     {
         std::lock_guard<std::mutex> guard(lock_);
         if (!uri_) {
@@ -914,13 +914,17 @@ bool DataAbilityHelper::CheckUriParam(const Uri &uri)
             return false;
         }
 
+        std::vector<std::string_view> segments;
         uri_->GetPathSegments(segments);
+        if (!segments.empty()) {
+            dataAbility = segments[0];
+        }
     }
 
-    std::vector<std::string> checkSegments;
-    checkUri.GetPathSegments(checkSegments);
+    std::vector<std::string_view> checkSegments;
+    uri.GetPathSegments(checkSegments);
 
-    if (checkSegments.empty() || segments.empty() || checkSegments[0] != segments[0]) {
+    if (checkSegments.empty() || dataAbility.empty() || checkSegments[0] != dataAbility) {
         HILOG_ERROR("DataAbilityHelper::CheckUriParam failed. dataability in uri doesn't equal the one in uri_.");
         return false;
     }
@@ -932,20 +936,19 @@ bool DataAbilityHelper::CheckUriParam(const Uri &uri)
 bool DataAbilityHelper::CheckOhosUri(const Uri &uri)
 {
     HILOG_INFO("DataAbilityHelper::CheckOhosUri start.");
-    Uri checkUri(uri.ToString());
-    if (checkUri.GetScheme() != SchemeOhos) {
+    if (uri.GetSchemeView() != SchemeOhos) {
         HILOG_ERROR("DataAbilityHelper::CheckOhosUri failed. uri is not a dataability one.");
         return false;
     }
 
-    std::vector<std::string> segments;
-    checkUri.GetPathSegments(segments);
+    std::vector<std::string_view> segments;
+    uri.GetPathSegments(segments);
     if (segments.empty()) {
         HILOG_ERROR("DataAbilityHelper::CheckOhosUri failed. There is no segments in the uri.");
         return false;
     }
 
-    if (checkUri.GetPath() == "") {
+    if (uri.GetPathView().empty()) {
         HILOG_ERROR("DataAbilityHelper::CheckOhosUri failed. The path in the uri is empty.");
         return false;
     }
@@ -972,8 +975,6 @@ void DataAbilityHelper::RegisterObserver(const Uri &uri, const sptr<AAFwk::IData
         return;
     }
 
-    Uri tmpUri(uri.ToString());
-
     std::lock_guard<std::mutex> lock_l(oplock_);
     sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = nullptr;
     if (uri_ == nullptr) {
@@ -981,10 +982,10 @@ void DataAbilityHelper::RegisterObserver(const Uri &uri, const sptr<AAFwk::IData
         if (dataability == registerMap_.end()) {
             dataAbilityProxy = AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
             registerMap_.emplace(dataObserver, dataAbilityProxy);
-            uriMap_.emplace(dataObserver, tmpUri.GetPath());
+            uriMap_.emplace(dataObserver, uri.GetPath());
         } else {
             auto path = uriMap_.find(dataObserver);
-            if (path->second != tmpUri.GetPath()) {
+            if (path->second != uri.GetPathView()) {
                 HILOG_ERROR("DataAbilityHelper::RegisterObserver failed input uri's path is not equal the one the "
                          "observer used");
                 return;
@@ -1024,7 +1025,6 @@ void DataAbilityHelper::UnregisterObserver(const Uri &uri, const sptr<AAFwk::IDa
         return;
     }
 
-    Uri tmpUri(uri.ToString());
     std::lock_guard<std::mutex> lock_l(oplock_);
     sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = nullptr;
     if (uri_ == nullptr) {
@@ -1033,7 +1033,7 @@ void DataAbilityHelper::UnregisterObserver(const Uri &uri, const sptr<AAFwk::IDa
             return;
         }
         auto path = uriMap_.find(dataObserver);
-        if (path->second != tmpUri.GetPath()) {
+        if (path->second != uri.GetPathView()) {
             HILOG_ERROR("DataAbilityHelper::UnregisterObserver failed input uri's path is not equal the one the "
                      "observer used");
             return;
@@ -1079,7 +1079,7 @@ void DataAbilityHelper::NotifyChange(const Uri &uri)
 
     sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = dataAbilityProxy_;
     if (dataAbilityProxy == nullptr) {
-        dataAbilityProxy = AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+        dataAbilityProxy = DataAbilityLeaseCache::GetInstance().Acquire(uri, tryBind_, token_);
         if (dataAbilityProxy == nullptr) {
             HILOG_ERROR("DataAbilityHelper::NotifyChange failed dataAbility == nullptr");
             return;
@@ -1089,7 +1089,7 @@ void DataAbilityHelper::NotifyChange(const Uri &uri)
     dataAbilityProxy->ScheduleNotifyChange(uri);
 
     if (uri_ == nullptr) {
-        int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+        int err = DataAbilityLeaseCache::GetInstance().Release(dataAbilityProxy, token_);
         if (err != ERR_OK) {
             HILOG_ERROR("DataAbilityHelper::NotifyChange failed to ReleaseDataAbility err = %{public}d", err);
         }
@@ -1122,7 +1122,7 @@ Uri DataAbilityHelper::NormalizeUri(Uri &uri)
     sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = dataAbilityProxy_;
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::NormalizeUri before AcquireDataAbility.");
-        dataAbilityProxy = AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+        dataAbilityProxy = DataAbilityLeaseCache::GetInstance().Acquire(uri, tryBind_, token_);
         HILOG_INFO("DataAbilityHelper::NormalizeUri after AcquireDataAbility.");
         if (dataAbilityProxy == nullptr) {
             HILOG_ERROR("DataAbilityHelper::NormalizeUri failed dataAbility == nullptr");
@@ -1137,7 +1137,7 @@ Uri DataAbilityHelper::NormalizeUri(Uri &uri)
     HILOG_INFO("DataAbilityHelper::NormalizeUri after dataAbilityProxy->NormalizeUri.");
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::NormalizeUri before ReleaseDataAbility.");
-        int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+        int err = DataAbilityLeaseCache::GetInstance().Release(dataAbilityProxy, token_);
         HILOG_INFO("DataAbilityHelper::NormalizeUri after ReleaseDataAbility.");
         if (err != ERR_OK) {
             HILOG_ERROR("DataAbilityHelper::NormalizeUri failed to ReleaseDataAbility err = %{public}d", err);
@@ -1170,7 +1170,7 @@ Uri DataAbilityHelper::DenormalizeUri(Uri &uri)
     sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = dataAbilityProxy_;
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::DenormalizeUri before AcquireDataAbility.");
-        dataAbilityProxy = AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+        dataAbilityProxy = DataAbilityLeaseCache::GetInstance().Acquire(uri, tryBind_, token_);
         HILOG_INFO("DataAbilityHelper::DenormalizeUri after AcquireDataAbility.");
         if (dataAbilityProxy == nullptr) {
             HILOG_ERROR("DataAbilityHelper::DenormalizeUri failed dataAbility == nullptr");
@@ -1185,7 +1185,7 @@ Uri DataAbilityHelper::DenormalizeUri(Uri &uri)
     HILOG_INFO("DataAbilityHelper::DenormalizeUri after dataAbilityProxy->DenormalizeUri.");
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::DenormalizeUri before ReleaseDataAbility.");
-        int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+        int err = DataAbilityLeaseCache::GetInstance().Release(dataAbilityProxy, token_);
         HILOG_INFO("DataAbilityHelper::DenormalizeUri after ReleaseDataAbility.");
         if (err != ERR_OK) {
             HILOG_ERROR("DataAbilityHelper::DenormalizeUri failed to ReleaseDataAbility err = %{public}d", err);
@@ -1208,7 +1208,7 @@ std::vector<std::shared_ptr<DataAbilityResult>> DataAbilityHelper::ExecuteBatch(
     sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = dataAbilityProxy_;
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::ExecuteBatch before AcquireDataAbility.");
-        dataAbilityProxy = AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+        dataAbilityProxy = DataAbilityLeaseCache::GetInstance().Acquire(uri, tryBind_, token_);
         HILOG_INFO("DataAbilityHelper::ExecuteBatch after AcquireDataAbility.");
         if (dataAbilityProxy == nullptr) {
             HILOG_ERROR("DataAbilityHelper::ExecuteBatch failed dataAbility == nullptr");
@@ -1221,7 +1221,7 @@ std::vector<std::shared_ptr<DataAbilityResult>> DataAbilityHelper::ExecuteBatch(
     HILOG_INFO("DataAbilityHelper::ExecuteBatch after dataAbilityProxy->ExecuteBatch.");
     if (uri_ == nullptr) {
         HILOG_INFO("DataAbilityHelper::ExecuteBatch before ReleaseDataAbility.");
-        int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+        int err = DataAbilityLeaseCache::GetInstance().Release(dataAbilityProxy, token_);
         HILOG_INFO("DataAbilityHelper::ExecuteBatch after ReleaseDataAbility.");
         if (err != ERR_OK) {
             HILOG_ERROR("DataAbilityHelper::ExecuteBatch failed to ReleaseDataAbility err = %{public}d", err);
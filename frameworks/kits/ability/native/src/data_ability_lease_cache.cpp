@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "data_ability_lease_cache.h"
+
+#include <vector>
+
+#include "ability_manager_client.h"
+#include "data_ability_helper.h"
+#include "event_runner.h"
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+// how long a released data ability stays acquired, waiting for the next operation
+const int64_t DATA_ABILITY_LEASE_IDLE_TIME = 5000; // ms
+const std::string DATA_ABILITY_LEASE_TASK = "DataAbilityLease_";
+}
+using IAbilityScheduler = OHOS::AAFwk::IAbilityScheduler;
+using AbilityManagerClient = OHOS::AAFwk::AbilityManagerClient;
+
+DataAbilityLeaseCache &DataAbilityLeaseCache::GetInstance()
+{
+    static DataAbilityLeaseCache instance;
+    return instance;
+}
+
+/**
+ * @brief Acquires the data ability of a Uri, from the cache if it holds a lease on it.
+ *
+ * @param uri Indicates the path of the data to operate.
+ * @param tryBind Specifies whether the exit of the Data ability process causes the exit of the client process.
+ * @param callerToken Indicates the token of the caller.
+ *
+ * @return Returns the data ability proxy, nullptr on failure.
+ */
+sptr<IAbilityScheduler> DataAbilityLeaseCache::Acquire(
+    const Uri &uri, bool tryBind, const sptr<IRemoteObject> &callerToken)
+{
+    std::string key = GetLeaseKey(uri, tryBind, callerToken);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = leases_.find(key);
+        if (iter != leases_.end()) {
+            if (iter->second.refCount++ == 0 && eventHandler_ != nullptr) {
+                eventHandler_->RemoveTask(DATA_ABILITY_LEASE_TASK + key);
+            }
+            return iter->second.dataAbilityProxy;
+        }
+    }
+
+    sptr<IAbilityScheduler> dataAbilityProxy =
+        AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind, callerToken);
+    if (dataAbilityProxy == nullptr) {
+        HILOG_ERROR("DataAbilityLeaseCache::Acquire failed dataAbility == nullptr");
+        return nullptr;
+    }
+
+    sptr<IAbilityScheduler> leasedProxy = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = leases_.find(key);
+        if (iter == leases_.end()) {
+            Lease &lease = leases_[key];
+            lease.dataAbilityProxy = dataAbilityProxy;
+            lease.callerToken = callerToken;
+            lease.refCount = 1;
+            if (deathRecipient_ == nullptr) {
+                deathRecipient_ = new (std::nothrow) DataAbilityDeathRecipient(
+                    std::bind(&DataAbilityLeaseCache::OnDataAbilityDied, this, std::placeholders::_1));
+            }
+            if (deathRecipient_ != nullptr && dataAbilityProxy->AsObject() != nullptr) {
+                dataAbilityProxy->AsObject()->AddDeathRecipient(deathRecipient_);
+            }
+            HILOG_INFO("DataAbilityLeaseCache::Acquire new lease, count: %{public}zu", leases_.size());
+            return dataAbilityProxy;
+        }
+        // leased by another thread meanwhile
+        if (iter->second.refCount++ == 0 && eventHandler_ != nullptr) {
+            eventHandler_->RemoveTask(DATA_ABILITY_LEASE_TASK + key);
+        }
+        leasedProxy = iter->second.dataAbilityProxy;
+    }
+    AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, callerToken);
+    return leasedProxy;
+}
+
+/**
+ * @brief Releases a data ability acquired by Acquire. The lease is given back to the ability manager once idle
+ * for a while, a data ability not leased is released at once.
+ *
+ * @param dataAbilityProxy Indicates the data ability proxy.
+ * @param callerToken Indicates the token of the caller.
+ *
+ * @return Returns ERR_OK on success, others on failure.
+ */
+int DataAbilityLeaseCache::Release(const sptr<IAbilityScheduler> &dataAbilityProxy,
+    const sptr<IRemoteObject> &callerToken)
+{
+    std::string idleKey;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = leases_.begin();
+        while (iter != leases_.end() && iter->second.dataAbilityProxy != dataAbilityProxy) {
+            iter++;
+        }
+        if (iter != leases_.end()) {
+            Lease &lease = iter->second;
+            if (lease.refCount > 0 && --lease.refCount == 0 && !PostIdleRelease(iter->first)) {
+                idleKey = iter->first;
+            }
+            if (idleKey.empty()) {
+                return ERR_OK;
+            }
+        }
+    }
+    if (!idleKey.empty()) {
+        ReleaseIdleLease(idleKey);
+        return ERR_OK;
+    }
+    // the lease is gone with its data ability, or the data ability was never leased
+    return AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, callerToken);
+}
+
+bool DataAbilityLeaseCache::PostIdleRelease(const std::string &key)
+{
+    if (eventHandler_ == nullptr) {
+        std::shared_ptr<EventRunner> runner = EventRunner::Create("DataAbilityLease");
+        if (runner == nullptr) {
+            HILOG_ERROR("DataAbilityLeaseCache::PostIdleRelease failed, runner is nullptr");
+            return false;
+        }
+        eventHandler_ = std::make_shared<EventHandler>(runner);
+    }
+    std::function<void()> releaseFunc = std::bind(&DataAbilityLeaseCache::ReleaseIdleLease, this, key);
+    return eventHandler_->PostTask(releaseFunc, DATA_ABILITY_LEASE_TASK + key, DATA_ABILITY_LEASE_IDLE_TIME);
+}
+
+void DataAbilityLeaseCache::ReleaseIdleLease(const std::string &key)
+{
+    Lease lease;
+    sptr<IRemoteObject::DeathRecipient> deathRecipient = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = leases_.find(key);
+        if (iter == leases_.end() || iter->second.refCount > 0) {
+            return;
+        }
+        lease = iter->second;
+        leases_.erase(iter);
+        deathRecipient = deathRecipient_;
+    }
+    if (deathRecipient != nullptr && lease.dataAbilityProxy->AsObject() != nullptr) {
+        lease.dataAbilityProxy->AsObject()->RemoveDeathRecipient(deathRecipient);
+    }
+    int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(lease.dataAbilityProxy, lease.callerToken);
+    if (err != ERR_OK) {
+        HILOG_ERROR("DataAbilityLeaseCache::ReleaseIdleLease failed to ReleaseDataAbility err = %{public}d", err);
+    }
+}
+
+void DataAbilityLeaseCache::OnDataAbilityDied(const wptr<IRemoteObject> &remote)
+{
+    sptr<IRemoteObject> object = remote.promote();
+    if (object == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto iter = leases_.begin(); iter != leases_.end();) {
+        if (iter->second.dataAbilityProxy->AsObject() != object) {
+            iter++;
+            continue;
+        }
+        // the ability manager drops the records of a dead data ability by itself
+        HILOG_INFO("DataAbilityLeaseCache::OnDataAbilityDied drop lease, refCount: %{public}d",
+            iter->second.refCount);
+        if (eventHandler_ != nullptr) {
+            eventHandler_->RemoveTask(DATA_ABILITY_LEASE_TASK + iter->first);
+        }
+        iter = leases_.erase(iter);
+    }
+}
+
+std::string DataAbilityLeaseCache::GetLeaseKey(const Uri &uri, bool tryBind, const sptr<IRemoteObject> &callerToken)
+{
+    // the data ability is named by the first path segment, as the ability manager looks it up
+    std::vector<std::string_view> pathSegments;
+    uri.GetPathSegments(pathSegments);
+    std::string key(uri.GetAuthorityView());
+    key.append("/");
+    if (!pathSegments.empty()) {
+        key.append(pathSegments.front());
+    }
+    key.append(tryBind ? "#bind#" : "#");
+    key.append(std::to_string(reinterpret_cast<uintptr_t>(callerToken.GetRefPtr())));
+    return key;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
@@ -217,6 +217,58 @@ int FormProviderClient::NotifyFormUpdate(
     }
 }
 
+/**
+ * @brief Notify provider when the forms need update, with one result for all of them.
+ *
+ * @param formIds The id list of forms.
+ * @param want Indicates the structure containing form info.
+ * @param callerToken Caller ability token.
+ * @return Returns ERR_OK on success, others on failure.
+ */
+int FormProviderClient::NotifyFormsUpdate(
+    const std::vector<int64_t> &formIds,
+    const Want &want,
+    const sptr<IRemoteObject> &callerToken)
+{
+    HILOG_INFO("%{public}s called.", __func__);
+
+    // The error code for business operation.
+    int errorCode = ERR_OK;
+    do {
+        std::shared_ptr<Ability> ownerAbility = GetOwner();
+        if (ownerAbility == nullptr) {
+            HILOG_ERROR("%{public}s error, owner ability is nullptr.", __func__);
+            errorCode = ERR_APPEXECFWK_FORM_NO_SUCH_ABILITY;
+            break;
+        }
+
+        if (!CheckIsSystemApp()) {
+            HILOG_ERROR("%{public}s warn, caller permission denied.", __func__);
+            errorCode = ERR_APPEXECFWK_FORM_PERMISSION_DENY;
+            break;
+        }
+
+        HILOG_INFO("%{public}s come, formIds size=%{public}zu, abilityName:%{public}s",
+            __func__, formIds.size(), ownerAbility->GetAbilityName().c_str());
+        for (int64_t formId : formIds) {
+            ownerAbility->OnUpdate(formId);
+        }
+    } while (false);
+
+    // The error code for disconnect.
+    int disconnectErrorCode = HandleDisconnect(want, callerToken);
+    if (errorCode != ERR_OK) {
+        // If errorCode is not ERR_OK，return errorCode.
+        return errorCode;
+    } else {
+        // If errorCode is ERR_OK，return disconnectErrorCode.
+        if (disconnectErrorCode != ERR_OK) {
+            HILOG_ERROR("%{public}s, disconnect error.", __func__);
+        }
+        return disconnectErrorCode;
+    }
+}
+
 /**
  * @brief Event notify when change the form visible.
  *
@@ -241,6 +241,52 @@ void FormExtensionProviderClient::NotifyFormExtensionUpdate(const int64_t formId
     HILOG_INFO("%{public}s called end.", __func__);
 }
 
+/**
+ * @brief Notify provider when the forms need update, with one result for all of them.
+ *
+ * @param formIds The id list of forms.
+ * @param want Indicates the structure containing form info.
+ * @param callerToken Caller form extension token.
+ * @return Returns ERR_OK on success, others on failure.
+ */
+int FormExtensionProviderClient::NotifyFormsUpdate(const std::vector<int64_t> &formIds, const Want &want,
+    const sptr<IRemoteObject> &callerToken)
+{
+    HILOG_INFO("%{public}s called.", __func__);
+    std::pair<int, int> errorCode = CheckParam(want, callerToken);
+    if (errorCode.first != ERR_OK) {
+        HILOG_ERROR("%{public}s CheckParam failed", __func__);
+        return errorCode.second;
+    }
+
+    std::shared_ptr<EventHandler> mainHandler = std::make_shared<EventHandler>(EventRunner::GetMainEventRunner());
+    std::function<void()> notifyFormExtensionsUpdateFunc = [client = sptr<FormExtensionProviderClient>(this),
+        formIds, want, callerToken]() {
+        client->NotifyFormExtensionsUpdate(formIds, want, callerToken);
+    };
+    mainHandler->PostSyncTask(notifyFormExtensionsUpdateFunc);
+    return ERR_OK;
+}
+
+void FormExtensionProviderClient::NotifyFormExtensionsUpdate(const std::vector<int64_t> &formIds,
+    const Want &want, const sptr<IRemoteObject> &callerToken)
+{
+    HILOG_INFO("%{public}s called.", __func__);
+    int errorCode = ERR_OK;
+    std::shared_ptr<FormExtension> ownerFormExtension = GetOwner();
+    if (ownerFormExtension == nullptr) {
+        HILOG_ERROR("%{public}s error, ownerFormExtension is nullptr.", __func__);
+        errorCode = ERR_APPEXECFWK_FORM_NO_SUCH_ABILITY;
+    } else {
+        for (int64_t formId : formIds) {
+            ownerFormExtension->OnUpdate(formId);
+        }
+    }
+
+    HandleResultCode(errorCode, want, callerToken);
+    HILOG_INFO("%{public}s called end.", __func__);
+}
+
 /**
  * @brief Event notify when change the form visible.
  *
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <stdint.h>
+#include <string>
+
+#include "ability_manager_client.h"
+#include "ability_scheduler_proxy.h"
+#include "ability_thread.h"
+#include "data_ability_helper.h"
+
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+const std::string DATA_ABILITY_URI = "dataability:///com.example.persondata/person/10";
+int64_t g_amsCallCount = 0;
+sptr<AbilityThread> g_dataAbility = nullptr;
+
+void SetUp()
+{
+    // stands in for the data ability, with no ability loaded it answers every call at once
+    if (g_dataAbility == nullptr) {
+        g_dataAbility = new AbilityThread();
+    }
+}
+}  // namespace
+
+namespace OHOS {
+namespace AAFwk {
+// stands in for the ability manager, which is one IPC away
+sptr<IAbilityScheduler> AbilityManagerClient::AcquireDataAbility(
+    const Uri &uri, bool tryBind, const sptr<IRemoteObject> &callerToken)
+{
+    g_amsCallCount++;
+    return new (std::nothrow) AbilitySchedulerProxy(g_dataAbility->AsObject());
+}
+
+ErrCode AbilityManagerClient::ReleaseDataAbility(
+    sptr<IAbilityScheduler> dataAbilityScheduler, const sptr<IRemoteObject> &callerToken)
+{
+    g_amsCallCount++;
+    return ERR_OK;
+}
+}  // namespace AAFwk
+}  // namespace OHOS
+
+namespace {
+void BenchmarkAcquirePerOperation(benchmark::State &state)
+{
+    SetUp();
+    Uri uri(DATA_ABILITY_URI);
+    g_amsCallCount = 0;
+    for (auto _ : state) {
+        // what a helper without a Uri did before the lease cache
+        auto client = AAFwk::AbilityManagerClient::GetInstance();
+        sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = client->AcquireDataAbility(uri, false, nullptr);
+        benchmark::DoNotOptimize(dataAbilityProxy->GetType(uri));
+        client->ReleaseDataAbility(dataAbilityProxy, nullptr);
+    }
+    state.counters["amsCallsPerOperation"] =
+        benchmark::Counter(static_cast<double>(g_amsCallCount) / state.iterations());
+}
+
+void BenchmarkLeasedOperation(benchmark::State &state)
+{
+    SetUp();
+    Uri uri(DATA_ABILITY_URI);
+    sptr<IRemoteObject> token = new AbilityThread();
+    std::shared_ptr<DataAbilityHelper> dataAbilityHelper = DataAbilityHelper::Creator(token);
+    g_amsCallCount = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dataAbilityHelper->GetType(uri));
+    }
+    state.counters["amsCallsPerOperation"] =
+        benchmark::Counter(static_cast<double>(g_amsCallCount) / state.iterations());
+}
+}  // namespace
+
+BENCHMARK(BenchmarkAcquirePerOperation);
+BENCHMARK(BenchmarkLeasedOperation);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ability_manager_client.h"
+#include "ability_scheduler_proxy.h"
+#define private public
+#include "data_ability_lease_cache.h"
+#undef private
+#include "mock_ability_scheduler_for_observer.h"
+
+namespace {
+int g_acquireCount = 0;
+int g_releaseCount = 0;
+OHOS::sptr<OHOS::AppExecFwk::MockAbilitySchedulerStub> g_dataAbility = nullptr;
+}
+
+namespace OHOS {
+namespace AAFwk {
+sptr<IAbilityScheduler> AbilityManagerClient::AcquireDataAbility(
+    const Uri &uri, bool tryBind, const sptr<IRemoteObject> &callerToken)
+{
+    g_acquireCount++;
+    // a new proxy every time, like the one read from the reply of the ability manager
+    return new (std::nothrow) AbilitySchedulerProxy(g_dataAbility->AsObject());
+}
+
+ErrCode AbilityManagerClient::ReleaseDataAbility(
+    sptr<IAbilityScheduler> dataAbilityScheduler, const sptr<IRemoteObject> &callerToken)
+{
+    g_releaseCount++;
+    return ERR_OK;
+}
+}  // namespace AAFwk
+}  // namespace OHOS
+
+namespace OHOS {
+namespace AppExecFwk {
+using namespace testing::ext;
+
+class DataAbilityLeaseCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void DataAbilityLeaseCacheTest::SetUpTestCase()
+{}
+
+void DataAbilityLeaseCacheTest::TearDownTestCase()
+{}
+
+void DataAbilityLeaseCacheTest::SetUp()
+{
+    g_dataAbility = new (std::nothrow) MockAbilitySchedulerStub();
+    g_acquireCount = 0;
+    g_releaseCount = 0;
+}
+
+void DataAbilityLeaseCacheTest::TearDown()
+{
+    DataAbilityLeaseCache::GetInstance().leases_.clear();
+    g_dataAbility = nullptr;
+}
+
+/**
+ * @tc.number: AaFwk_DataAbilityLeaseCache_Acquire_0100
+ * @tc.name: Acquire
+ * @tc.desc: Operations on one data ability share one lease, given back to the ability manager once idle.
+ */
+HWTEST_F(DataAbilityLeaseCacheTest, AaFwk_DataAbilityLeaseCache_Acquire_0100, Function | MediumTest | Level1)
+{
+    DataAbilityLeaseCache &leaseCache = DataAbilityLeaseCache::GetInstance();
+    Uri uri("dataability:///com.example.persondata/person/10");
+    Uri otherPathUri("dataability:///com.example.persondata/person");
+
+    for (int i = 0; i < 10; i++) {
+        sptr<AAFwk::IAbilityScheduler> dataAbilityProxy =
+            leaseCache.Acquire(i % 2 ? uri : otherPathUri, false, nullptr);
+        ASSERT_NE(nullptr, dataAbilityProxy);
+        EXPECT_EQ(ERR_OK, leaseCache.Release(dataAbilityProxy, nullptr));
+    }
+    EXPECT_EQ(1, g_acquireCount);
+    EXPECT_EQ(0, g_releaseCount);
+
+    std::string key = DataAbilityLeaseCache::GetLeaseKey(uri, false, nullptr);
+    ASSERT_EQ(1U, leaseCache.leases_.count(key));
+    EXPECT_EQ(0, leaseCache.leases_[key].refCount);
+    leaseCache.ReleaseIdleLease(key);
+    EXPECT_EQ(0U, leaseCache.leases_.size());
+    EXPECT_EQ(1, g_releaseCount);
+}
+
+/**
+ * @tc.number: AaFwk_DataAbilityLeaseCache_Acquire_0200
+ * @tc.name: Acquire
+ * @tc.desc: A lease in use is not given back, and the data abilities of other callers are leased apart.
+ */
+HWTEST_F(DataAbilityLeaseCacheTest, AaFwk_DataAbilityLeaseCache_Acquire_0200, Function | MediumTest | Level1)
+{
+    DataAbilityLeaseCache &leaseCache = DataAbilityLeaseCache::GetInstance();
+    Uri uri("dataability:///com.example.persondata/person/10");
+    sptr<IRemoteObject> callerToken = new (std::nothrow) MockAbilitySchedulerStub();
+
+    sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = leaseCache.Acquire(uri, false, nullptr);
+    sptr<AAFwk::IAbilityScheduler> callerProxy = leaseCache.Acquire(uri, false, callerToken);
+    sptr<AAFwk::IAbilityScheduler> bindProxy = leaseCache.Acquire(uri, true, nullptr);
+    EXPECT_EQ(3, g_acquireCount);
+    EXPECT_EQ(3U, leaseCache.leases_.size());
+
+    std::string key = DataAbilityLeaseCache::GetLeaseKey(uri, false, nullptr);
+    leaseCache.ReleaseIdleLease(key);
+    EXPECT_EQ(3U, leaseCache.leases_.size());
+    EXPECT_EQ(0, g_releaseCount);
+
+    EXPECT_EQ(ERR_OK, leaseCache.Release(dataAbilityProxy, nullptr));
+    leaseCache.ReleaseIdleLease(key);
+    EXPECT_EQ(2U, leaseCache.leases_.size());
+    EXPECT_EQ(1, g_releaseCount);
+}
+
+/**
+ * @tc.number: AaFwk_DataAbilityLeaseCache_OnDataAbilityDied_0100
+ * @tc.name: OnDataAbilityDied
+ * @tc.desc: The lease of a dead data ability is dropped, its proxy is released like one never leased.
+ */
+HWTEST_F(DataAbilityLeaseCacheTest, AaFwk_DataAbilityLeaseCache_OnDataAbilityDied_0100, Function | MediumTest | Level1)
+{
+    DataAbilityLeaseCache &leaseCache = DataAbilityLeaseCache::GetInstance();
+    Uri uri("dataability:///com.example.persondata/person/10");
+
+    sptr<AAFwk::IAbilityScheduler> dataAbilityProxy = leaseCache.Acquire(uri, false, nullptr);
+    ASSERT_NE(nullptr, dataAbilityProxy);
+    leaseCache.OnDataAbilityDied(g_dataAbility->AsObject());
+    EXPECT_EQ(0U, leaseCache.leases_.size());
+
+    leaseCache.Release(dataAbilityProxy, nullptr);
+    EXPECT_EQ(1, g_releaseCount);
+    EXPECT_NE(nullptr, leaseCache.Acquire(uri, false, nullptr));
+    EXPECT_EQ(2, g_acquireCount);
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
@@ -743,5 +743,138 @@ HWTEST_F(PacMapTest, AppExecFwk_PacMap_Marshalling_0300, Function | MediumTest |
     EXPECT_EQ(true, unmarshingMap != nullptr);
     GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0300 end";
 }
+/**
+ * @tc.number: AppExecFwk_PacMap_Marshalling_0400
+ * @tc.name: Marshalling and Unmarshalling
+ * @tc.desc: Verify Unmarshalling() still accepts the JSON string form written by earlier versions.
+ */
+HWTEST_F(PacMapTest, AppExecFwk_PacMap_Marshalling_0400, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0400 start";
+
+    Parcel parcel;
+    FillData(*pacmap_.get());
+    FillData2(*pacmap2_.get(), *pacmap_.get());
+    parcel.WriteString("PACMAP");
+    parcel.WriteString(pacmap2_->ToString());
+
+    PacMap *unmarshingMap = PacMap::Unmarshalling(parcel);
+    EXPECT_EQ(true, unmarshingMap != nullptr);
+    if (unmarshingMap != nullptr) {
+        EXPECT_EQ(true, pacmap2_->Equals(unmarshingMap));
+        delete unmarshingMap;
+        unmarshingMap = nullptr;
+    }
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0400 end";
+}
+/**
+ * @tc.number: AppExecFwk_PacMap_Marshalling_0500
+ * @tc.name: Marshalling and Unmarshalling
+ * @tc.desc: Verify floating-point values keep full precision across Marshalling() and the copy constructor.
+ */
+HWTEST_F(PacMapTest, AppExecFwk_PacMap_Marshalling_0500, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0500 start";
+
+    double value = 1.0 / 3.0;
+    pacmap_->PutDoubleValue("key_double", value);
+    PacMap copyMap(*pacmap_.get());
+    EXPECT_EQ(value, copyMap.GetDoubleValue("key_double"));
+
+    Parcel parcel;
+    EXPECT_EQ(true, pacmap_->Marshalling(parcel));
+    PacMap *unmarshingMap = PacMap::Unmarshalling(parcel);
+    EXPECT_EQ(true, unmarshingMap != nullptr);
+    if (unmarshingMap != nullptr) {
+        EXPECT_EQ(value, unmarshingMap->GetDoubleValue("key_double"));
+        delete unmarshingMap;
+        unmarshingMap = nullptr;
+    }
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0500 end";
+}
+/**
+ * @tc.number: AppExecFwk_PacMap_DeepCopy_0200
+ * @tc.name: DeepCopy
+ * @tc.desc: Verify a copied nested PacMap does not share data with the source.
+ */
+HWTEST_F(PacMapTest, AppExecFwk_PacMap_DeepCopy_0200, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_DeepCopy_0200 start";
+
+    FillData(*pacmap_.get());
+    FillData2(*pacmap2_.get(), *pacmap_.get());
+    PacMap otherMap = pacmap2_->DeepCopy();
+    EXPECT_EQ(true, pacmap2_->Equals(otherMap));
+
+    otherMap.Remove("key_map");
+    otherMap.PutPacMap("key_map", PacMap());
+    EXPECT_EQ(false, pacmap2_->Equals(otherMap));
+    EXPECT_EQ(true, pacmap_->Equals(pacmap2_->GetPacMap("key_map")));
+
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_DeepCopy_0200 end";
+}
+/**
+ * @tc.number: AppExecFwk_PacMap_Marshalling_0600
+ * @tc.name: Marshalling and Unmarshalling
+ * @tc.desc: Verify the JSON form is written unless the binary form is enabled, and both forms round trip.
+ */
+HWTEST_F(PacMapTest, AppExecFwk_PacMap_Marshalling_0600, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0600 start";
+
+    bool binary = PacMap::IsBinaryMarshalling();
+    FillData(*pacmap_.get());
+    FillData2(*pacmap2_.get(), *pacmap_.get());
+    for (bool isBinary : { false, true }) {
+        PacMap::SetBinaryMarshalling(isBinary);
+        Parcel tagParcel;
+        EXPECT_EQ(true, pacmap2_->Marshalling(tagParcel));
+        EXPECT_EQ(isBinary ? "PACMAP_BIN" : "PACMAP", tagParcel.ReadString());
+
+        Parcel parcel;
+        EXPECT_EQ(true, pacmap2_->Marshalling(parcel));
+        PacMap *unmarshingMap = PacMap::Unmarshalling(parcel);
+        EXPECT_EQ(true, unmarshingMap != nullptr);
+        if (unmarshingMap != nullptr) {
+            EXPECT_EQ(true, pacmap2_->Equals(unmarshingMap));
+            delete unmarshingMap;
+            unmarshingMap = nullptr;
+        }
+    }
+    PacMap::SetBinaryMarshalling(binary);
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0600 end";
+}
+/**
+ * @tc.number: AppExecFwk_PacMap_Marshalling_0700
+ * @tc.name: Marshalling and DeepCopy
+ * @tc.desc: Verify both parcel forms keep the same values as a copy, char and empty arrays included.
+ */
+HWTEST_F(PacMapTest, AppExecFwk_PacMap_Marshalling_0700, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0700 start";
+
+    bool binary = PacMap::IsBinaryMarshalling();
+    // both arrays sort before the int value
+    pacmap_->PutCharValueArray("key_char_array", { 'a', 'b' });
+    pacmap_->PutIntValueArray("key_empty_array", {});
+    pacmap_->PutIntValue("key_int", PAC_MPA_TEST_INT);
+    PacMap copyMap(*pacmap_.get());
+    EXPECT_EQ(3, copyMap.GetSize());
+
+    for (bool isBinary : { false, true }) {
+        PacMap::SetBinaryMarshalling(isBinary);
+        Parcel parcel;
+        EXPECT_EQ(true, pacmap_->Marshalling(parcel));
+        PacMap *unmarshingMap = PacMap::Unmarshalling(parcel);
+        EXPECT_EQ(true, unmarshingMap != nullptr);
+        if (unmarshingMap != nullptr) {
+            EXPECT_EQ(true, copyMap.Equals(unmarshingMap));
+            delete unmarshingMap;
+            unmarshingMap = nullptr;
+        }
+    }
+    PacMap::SetBinaryMarshalling(binary);
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0700 end";
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_EXTENSION_MANIFEST_CACHE_H
+#define FOUNDATION_APPEXECFWK_EXTENSION_MANIFEST_CACHE_H
+
+#include <functional>
+#include <map>
+#include <string>
+
+namespace OHOS {
+namespace AppExecFwk {
+using ExtensionParams = std::map<std::string, std::string>;
+using GetExtensionParams = std::function<ExtensionParams(const std::string &libraryPath)>;
+
+/**
+ * @brief The params of the extension libraries, persisted across starts so that a library is only loaded to read
+ *        its params again once it changed.
+ */
+class ExtensionManifestCache {
+public:
+    /**
+     * @brief Create the cache.
+     *
+     * @param cacheFile The file the manifest is persisted in.
+     * @param getParams How the params are read from a library the manifest has no params of.
+     */
+    ExtensionManifestCache(const std::string &cacheFile, const GetExtensionParams &getParams);
+    ~ExtensionManifestCache() = default;
+
+    /**
+     *
+     * @brief Load the manifest persisted by an earlier start.
+     *
+     * @return if the manifest is loaded, return true. else return false.
+     *
+     */
+    bool Load();
+
+    /**
+     *
+     * @brief Get the params of an extension library, from the manifest unless the library changed since.
+     *
+     * @param libraryPath The path of the library.
+     *
+     * @return the params, empty if the library is no extension.
+     *
+     */
+    ExtensionParams GetParams(const std::string &libraryPath);
+
+    /**
+     *
+     * @brief Persist the manifest if it changed, without the libraries not asked for since it was loaded.
+     *
+     * @return if the manifest is up to date in its file, return true. else return false.
+     *
+     */
+    bool Save();
+
+private:
+    struct ManifestEntry {
+        int64_t modifyTime = 0;
+        int64_t size = 0;
+        ExtensionParams params;
+        bool isUsed = false;
+    };
+
+    std::string cacheFile_;
+    GetExtensionParams getParams_;
+    std::map<std::string, ManifestEntry> entries_;
+    bool isChanged_ = false;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_EXTENSION_MANIFEST_CACHE_H
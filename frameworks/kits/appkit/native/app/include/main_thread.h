@@ -390,7 +390,7 @@ private:
     void LoadAndRegisterExtension(const std::string &libName, const std::string &extensionName,
         const std::unique_ptr<Runtime>& runtime);
 
-    void LoadAllExtensions(const std::string &filePath);
+    void LoadAllExtensions(const std::string &filePath, const std::string &cacheDir);
 
     /**
      *
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extension_manifest_cache.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <sys/stat.h>
+#include <vector>
+
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+// one line per library: path, modify time, size, then its params as key=value, separated by tabs
+const std::string MANIFEST_VERSION = "extension_manifest_v1";
+const std::string MANIFEST_TEMP_SUFFIX = ".tmp";
+constexpr char MANIFEST_SEPARATOR = '\t';
+constexpr char PARAM_SEPARATOR = '=';
+constexpr size_t MANIFEST_FIXED_FIELDS = 3;
+constexpr int64_t NANOSECONDS = 1000000000;
+
+bool IsPersistable(const std::string &value)
+{
+    return value.find(MANIFEST_SEPARATOR) == std::string::npos && value.find('\n') == std::string::npos;
+}
+}  // namespace
+
+ExtensionManifestCache::ExtensionManifestCache(const std::string &cacheFile, const GetExtensionParams &getParams)
+    : cacheFile_(cacheFile), getParams_(getParams)
+{}
+
+bool ExtensionManifestCache::Load()
+{
+    std::ifstream file(cacheFile_);
+    if (!file.is_open()) {
+        HILOG_INFO("ExtensionManifestCache::Load no manifest %{public}s", cacheFile_.c_str());
+        return false;
+    }
+    std::string line;
+    if (!std::getline(file, line) || line != MANIFEST_VERSION) {
+        HILOG_WARN("ExtensionManifestCache::Load unknown manifest %{public}s", cacheFile_.c_str());
+        isChanged_ = true;
+        return false;
+    }
+    while (std::getline(file, line)) {
+        std::vector<std::string> fields;
+        std::istringstream lineStream(line);
+        std::string field;
+        while (std::getline(lineStream, field, MANIFEST_SEPARATOR)) {
+            fields.emplace_back(field);
+        }
+        if (fields.size() < MANIFEST_FIXED_FIELDS) {
+            isChanged_ = true;
+            continue;
+        }
+        ManifestEntry entry;
+        entry.modifyTime = std::strtoll(fields[1].c_str(), nullptr, 10);
+        entry.size = std::strtoll(fields[2].c_str(), nullptr, 10);
+        for (size_t index = MANIFEST_FIXED_FIELDS; index < fields.size(); index++) {
+            auto position = fields[index].find(PARAM_SEPARATOR);
+            if (position != std::string::npos) {
+                entry.params.emplace(fields[index].substr(0, position), fields[index].substr(position + 1));
+            }
+        }
+        entries_[fields[0]] = entry;
+    }
+    HILOG_INFO("ExtensionManifestCache::Load %{public}zu libraries", entries_.size());
+    return true;
+}
+
+ExtensionParams ExtensionManifestCache::GetParams(const std::string &libraryPath)
+{
+    struct stat fileStat;
+    if (stat(libraryPath.c_str(), &fileStat) != 0) {
+        HILOG_ERROR("ExtensionManifestCache::GetParams stat %{public}s failed", libraryPath.c_str());
+        return ExtensionParams();
+    }
+    int64_t modifyTime = static_cast<int64_t>(fileStat.st_mtim.tv_sec) * NANOSECONDS + fileStat.st_mtim.tv_nsec;
+    int64_t size = static_cast<int64_t>(fileStat.st_size);
+    auto iter = entries_.find(libraryPath);
+    if (iter != entries_.end() && iter->second.modifyTime == modifyTime && iter->second.size == size) {
+        iter->second.isUsed = true;
+        return iter->second.params;
+    }
+
+    // new or changed, the library is loaded to read its params, no params are kept too
+    HILOG_INFO("ExtensionManifestCache::GetParams read %{public}s", libraryPath.c_str());
+    ManifestEntry entry;
+    entry.modifyTime = modifyTime;
+    entry.size = size;
+    entry.isUsed = true;
+    if (getParams_) {
+        entry.params = getParams_(libraryPath);
+    }
+    entries_[libraryPath] = entry;
+    isChanged_ = true;
+    return entry.params;
+}
+
+bool ExtensionManifestCache::Save()
+{
+    for (auto iter = entries_.begin(); iter != entries_.end();) {
+        if (iter->second.isUsed) {
+            ++iter;
+            continue;
+        }
+        iter = entries_.erase(iter);
+        isChanged_ = true;
+    }
+    if (!isChanged_) {
+        return true;
+    }
+
+    std::string tempFile = cacheFile_ + MANIFEST_TEMP_SUFFIX;
+    {
+        std::ofstream file(tempFile, std::ios::trunc);
+        if (!file.is_open()) {
+            HILOG_ERROR("ExtensionManifestCache::Save open %{public}s failed", tempFile.c_str());
+            return false;
+        }
+        file << MANIFEST_VERSION << '\n';
+        for (const auto &item : entries_) {
+            bool isPersistable = IsPersistable(item.first);
+            for (const auto &param : item.second.params) {
+                isPersistable = isPersistable && IsPersistable(param.first) && IsPersistable(param.second) &&
+                    param.first.find(PARAM_SEPARATOR) == std::string::npos;
+            }
+            if (!isPersistable) {
+                continue;
+            }
+            file << item.first << MANIFEST_SEPARATOR << item.second.modifyTime << MANIFEST_SEPARATOR <<
+                item.second.size;
+            for (const auto &param : item.second.params) {
+                file << MANIFEST_SEPARATOR << param.first << PARAM_SEPARATOR << param.second;
+            }
+            file << '\n';
+        }
+        file.flush();
+        if (!file.good()) {
+            HILOG_ERROR("ExtensionManifestCache::Save write %{public}s failed", tempFile.c_str());
+            file.close();
+            std::remove(tempFile.c_str());
+            return false;
+        }
+    }
+    // replaced as a whole, so that a start never reads a manifest half written
+    if (std::rename(tempFile.c_str(), cacheFile_.c_str()) != 0) {
+        HILOG_ERROR("ExtensionManifestCache::Save rename to %{public}s failed", cacheFile_.c_str());
+        std::remove(tempFile.c_str());
+        return false;
+    }
+    isChanged_ = false;
+    return true;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
@@ -15,6 +15,7 @@
 
 #include "main_thread.h"
 
+#include <cstdlib>
 #include <new>
 #include <regex>
 
@@ -29,6 +30,7 @@
 #include "configuration_convertor.h"
 #include "context_deal.h"
 #include "context_impl.h"
+#include "extension_manifest_cache.h"
 #include "extension_module_loader.h"
 #include "hilog_wrapper.h"
 #ifdef SUPPORT_GRAPHICS
@@ -80,6 +82,7 @@ const std::string JSCRASH_TYPE = "3";
 const std::string JSVM_TYPE = "ARK";
 constexpr char EXTENSION_PARAMS_TYPE[] = "type";
 constexpr char EXTENSION_PARAMS_NAME[] = "name";
+constexpr char EXTENSION_MANIFEST_FILE[] = "extension_manifest";
 }
 
 #define ACEABILITY_LIBRARY_LOADER
@@ -941,7 +944,7 @@ void MainThread::HandleLaunchApplication(const AppLaunchData &appLaunchData, con
             return AbilityRuntime::StaticSubscriberExtension::Create(application->GetRuntime());
         });
 #ifdef __aarch64__
-        LoadAllExtensions("system/lib64/extensionability");
+        LoadAllExtensions("system/lib64/extensionability", contextImpl->GetCacheDir());
         LoadAndRegisterExtension("system/lib64/libdatashare_ext_ability_module.z.so", "DataShareExtAbility",
             application_->GetRuntime());
         LoadAndRegisterExtension("system/lib64/libworkschedextension.z.so", "WorkSchedulerExtension",
@@ -953,7 +956,7 @@ void MainThread::HandleLaunchApplication(const AppLaunchData &appLaunchData, con
         LoadAndRegisterExtension("system/lib64/libfile_extension_ability_module.z.so", "FileExtAbility",
             application_->GetRuntime());
 #else
-        LoadAllExtensions("system/lib/extensionability");
+        LoadAllExtensions("system/lib/extensionability", contextImpl->GetCacheDir());
         LoadAndRegisterExtension("system/lib/libdatashare_ext_ability_module.z.so", "DataShareExtAbility",
             application_->GetRuntime());
         LoadAndRegisterExtension("system/lib/libworkschedextension.z.so", "WorkSchedulerExtension",
@@ -1047,7 +1050,7 @@ void MainThread::LoadAndRegisterExtension(const std::string &libName,
     });
 }
 
-void MainThread::LoadAllExtensions(const std::string &filePath)
+void MainThread::LoadAllExtensions(const std::string &filePath, const std::string &cacheDir)
 {
     HILOG_INFO("LoadAllExtensions.filePath:%{public}s", filePath.c_str());
     if (application_ == nullptr) {
@@ -1061,11 +1064,16 @@ void MainThread::LoadAllExtensions(const std::string &filePath)
         HILOG_ERROR("no extension files.");
         return;
     }
+    // the libraries are only loaded to read their params when the manifest of an earlier start has none
+    ExtensionManifestCache manifestCache(cacheDir + pathSeparator_ + EXTENSION_MANIFEST_FILE,
+        [](const std::string &libraryPath) {
+            return AbilityRuntime::ExtensionModuleLoader::GetLoader(libraryPath.c_str()).GetParams();
+        });
+    manifestCache.Load();
     std::map<int32_t, std::string> extensionTypeMap;
     for (auto file : extensionFiles) {
         HILOG_INFO("Begin load extension file:%{public}s", file.c_str());
-        std::map<std::string, std::string> params =
-            AbilityRuntime::ExtensionModuleLoader::GetLoader(file.c_str()).GetParams();
+        std::map<std::string, std::string> params = manifestCache.GetParams(file);
         if (params.empty()) {
             HILOG_ERROR("no extension params.");
             continue;
@@ -1076,7 +1084,12 @@ void MainThread::LoadAllExtensions(const std::string &filePath)
             HILOG_ERROR("no extension type.");
             continue;
         }
-        int32_t type = std::stoi(it->second);
+        char *end = nullptr;
+        int32_t type = static_cast<int32_t>(std::strtol(it->second.c_str(), &end, 10));
+        if (end == it->second.c_str() || *end != '\0') {
+            HILOG_ERROR("bad extension type.");
+            continue;
+        }
 
         it = params.find(EXTENSION_PARAMS_NAME);
         if (it == params.end()) {
@@ -1091,6 +1104,7 @@ void MainThread::LoadAllExtensions(const std::string &filePath)
             return AbilityRuntime::ExtensionModuleLoader::GetLoader(file.c_str()).Create(application->GetRuntime());
         });
     }
+    manifestCache.Save();
     application_->SetExtensionTypeMap(extensionTypeMap);
 }
 
@@ -1663,21 +1677,13 @@ void MainThread::LoadAbilityLibrary(const std::vector<std::string> &libraryPaths
         return;
     }
 
-    void *handleAbilityLib = nullptr;
+    // not opened before an ability or extension they register is needed
     for (auto fileEntry : fileEntries_) {
         if (!fileEntry.empty()) {
-            handleAbilityLib = dlopen(fileEntry.c_str(), RTLD_NOW | RTLD_GLOBAL);
-            if (handleAbilityLib == nullptr) {
-                HILOG_ERROR("MainThread::LoadAbilityLibrary Fail to dlopen %{public}s, [%{public}s]",
-                    fileEntry.c_str(),
-                    dlerror());
-                exit(-1);
-            }
-            HILOG_INFO("MainThread::LoadAbilityLibrary Success to dlopen %{public}s", fileEntry.c_str());
-            handleAbilityLib_.emplace_back(handleAbilityLib);
+            AbilityLoader::GetInstance().RegisterLibrary(fileEntry);
         }
     }
-    HILOG_INFO("MainThread::LoadAbilityLibrary called end.");
+    HILOG_INFO("MainThread::LoadAbilityLibrary called end, %{public}zu libraries deferred.", fileEntries_.size());
 #endif  // ABILITY_LIBRARY_LOADER
 }
 
@@ -1712,6 +1718,7 @@ void MainThread::CloseAbilityLibrary()
     }
     handleAbilityLib_.clear();
     fileEntries_.clear();
+    AbilityLoader::GetInstance().CloseLibraries();
 }
 
 bool MainThread::ScanDir(const std::string &dirPath, std::vector<std::string> &files)
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <dirent.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "extension_manifest_cache.h"
+#include "extension_module_loader.h"
+
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+#ifdef __aarch64__
+const std::string EXTENSION_DIR = "/system/lib64/extensionability";
+#else
+const std::string EXTENSION_DIR = "/system/lib/extensionability";
+#endif
+const std::string MANIFEST_FILE = "/data/test/extension_manifest_benchmark";
+
+std::vector<std::string> ScanExtensions()
+{
+    std::vector<std::string> files;
+    DIR *dirp = opendir(EXTENSION_DIR.c_str());
+    if (dirp == nullptr) {
+        return files;
+    }
+    struct dirent *df = nullptr;
+    while ((df = readdir(dirp)) != nullptr) {
+        std::string name(df->d_name);
+        if (name.size() > 3 && name.compare(name.size() - 3, 3, ".so") == 0) {
+            files.emplace_back(EXTENSION_DIR + "/" + name);
+        }
+    }
+    closedir(dirp);
+    return files;
+}
+
+ExtensionParams LoadParams(const std::string &libraryPath)
+{
+    return AbilityRuntime::ExtensionModuleLoader::GetLoader(libraryPath.c_str()).GetParams();
+}
+
+/**
+ * What a start did before the manifest, open every extension library to read its params. Libraries stay open
+ * after the first iteration, so the later ones understate a cold start.
+ */
+void BenchmarkLoadAllParams(benchmark::State &state)
+{
+    std::vector<std::string> files = ScanExtensions();
+    for (auto _ : state) {
+        for (const auto &file : files) {
+            benchmark::DoNotOptimize(LoadParams(file));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * files.size());
+}
+
+/**
+ * A start with the manifest of an earlier one, the libraries are only stat'ed.
+ */
+void BenchmarkManifestParams(benchmark::State &state)
+{
+    std::vector<std::string> files = ScanExtensions();
+    {
+        ExtensionManifestCache earlierStart(MANIFEST_FILE, LoadParams);
+        for (const auto &file : files) {
+            earlierStart.GetParams(file);
+        }
+        earlierStart.Save();
+    }
+    for (auto _ : state) {
+        ExtensionManifestCache manifestCache(MANIFEST_FILE, LoadParams);
+        manifestCache.Load();
+        for (const auto &file : files) {
+            benchmark::DoNotOptimize(manifestCache.GetParams(file));
+        }
+        manifestCache.Save();
+    }
+    state.SetItemsProcessed(state.iterations() * files.size());
+    unlink(MANIFEST_FILE.c_str());
+}
+}  // namespace
+
+BENCHMARK(BenchmarkLoadAllParams);
+BENCHMARK(BenchmarkManifestParams);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <fstream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "extension_manifest_cache.h"
+
+using namespace testing::ext;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+const std::string TEST_DIR = "/data/test/extension_manifest_cache_test";
+const std::string MANIFEST_FILE = TEST_DIR + "/extension_manifest";
+const std::string LIBRARY_A = TEST_DIR + "/libextension_a.z.so";
+const std::string LIBRARY_B = TEST_DIR + "/libextension_b.z.so";
+}
+
+class ExtensionManifestCacheTest : public testing::Test {
+public:
+    ExtensionManifestCacheTest()
+    {}
+    ~ExtensionManifestCacheTest()
+    {}
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    void WriteLibrary(const std::string &libraryPath, const std::string &content);
+    GetExtensionParams CountingGetParams();
+
+    int32_t readCount_ = 0;
+};
+
+void ExtensionManifestCacheTest::SetUpTestCase(void)
+{
+    mkdir(TEST_DIR.c_str(), S_IRWXU);
+}
+
+void ExtensionManifestCacheTest::TearDownTestCase(void)
+{
+    rmdir(TEST_DIR.c_str());
+}
+
+void ExtensionManifestCacheTest::SetUp(void)
+{
+    readCount_ = 0;
+    WriteLibrary(LIBRARY_A, "a");
+    WriteLibrary(LIBRARY_B, "b");
+}
+
+void ExtensionManifestCacheTest::TearDown(void)
+{
+    unlink(LIBRARY_A.c_str());
+    unlink(LIBRARY_B.c_str());
+    unlink(MANIFEST_FILE.c_str());
+}
+
+void ExtensionManifestCacheTest::WriteLibrary(const std::string &libraryPath, const std::string &content)
+{
+    std::ofstream file(libraryPath, std::ios::trunc);
+    file << content;
+}
+
+GetExtensionParams ExtensionManifestCacheTest::CountingGetParams()
+{
+    return [this](const std::string &libraryPath) {
+        readCount_++;
+        ExtensionParams params;
+        if (libraryPath == LIBRARY_A) {
+            params.emplace("type", "1");
+            params.emplace("name", "ExtensionA");
+        }
+        return params;
+    };
+}
+
+/**
+ * @tc.number: AppExecFwk_ExtensionManifestCache_GetParams_0100
+ * @tc.name: GetParams
+ * @tc.desc: The libraries are read once, a later start gets their params from the manifest.
+ */
+HWTEST_F(ExtensionManifestCacheTest, AppExecFwk_ExtensionManifestCache_GetParams_0100, Function | MediumTest | Level1)
+{
+    ExtensionManifestCache firstStart(MANIFEST_FILE, CountingGetParams());
+    EXPECT_FALSE(firstStart.Load());
+    EXPECT_EQ("ExtensionA", firstStart.GetParams(LIBRARY_A)["name"]);
+    EXPECT_TRUE(firstStart.GetParams(LIBRARY_B).empty());
+    EXPECT_TRUE(firstStart.Save());
+    EXPECT_EQ(2, readCount_);
+
+    ExtensionManifestCache secondStart(MANIFEST_FILE, CountingGetParams());
+    EXPECT_TRUE(secondStart.Load());
+    ExtensionParams params = secondStart.GetParams(LIBRARY_A);
+    EXPECT_EQ("1", params["type"]);
+    EXPECT_EQ("ExtensionA", params["name"]);
+    EXPECT_TRUE(secondStart.GetParams(LIBRARY_B).empty());
+    EXPECT_TRUE(secondStart.Save());
+    EXPECT_EQ(2, readCount_);
+}
+
+/**
+ * @tc.number: AppExecFwk_ExtensionManifestCache_GetParams_0200
+ * @tc.name: GetParams
+ * @tc.desc: A changed library is read again, a library gone is dropped from the manifest.
+ */
+HWTEST_F(ExtensionManifestCacheTest, AppExecFwk_ExtensionManifestCache_GetParams_0200, Function | MediumTest | Level1)
+{
+    ExtensionManifestCache firstStart(MANIFEST_FILE, CountingGetParams());
+    firstStart.GetParams(LIBRARY_A);
+    firstStart.GetParams(LIBRARY_B);
+    EXPECT_TRUE(firstStart.Save());
+
+    WriteLibrary(LIBRARY_A, "a changed");
+    unlink(LIBRARY_B.c_str());
+    ExtensionManifestCache secondStart(MANIFEST_FILE, CountingGetParams());
+    EXPECT_TRUE(secondStart.Load());
+    EXPECT_EQ("ExtensionA", secondStart.GetParams(LIBRARY_A)["name"]);
+    EXPECT_EQ(3, readCount_);
+    EXPECT_TRUE(secondStart.Save());
+
+    std::ifstream manifest(MANIFEST_FILE);
+    std::string content((std::istreambuf_iterator<char>(manifest)), std::istreambuf_iterator<char>());
+    EXPECT_NE(std::string::npos, content.find(LIBRARY_A));
+    EXPECT_EQ(std::string::npos, content.find(LIBRARY_B));
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
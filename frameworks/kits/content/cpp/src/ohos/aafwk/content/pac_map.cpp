@@ -15,6 +15,8 @@
 
 #include "pac_map.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <iomanip>
 #include <iostream>
@@ -57,6 +59,15 @@ namespace {
 const int FLOAT_PRECISION = 7;
 const int DOUBLE_PRECISION = 17;
 const std::regex NUMBER_REGEX("^[-+]?([0-9]+)([.]([0-9]+))?$");
+// the JSON string of the map follows this tag, the form written unless the binary one is enabled
+const std::string PACMAP_JSON_PARCEL_TAG = "PACMAP";
+const std::string PACMAP_BINARY_PARCEL_TAG = "PACMAP_BIN";
+const int MAX_PACMAP_NESTED_DEPTH = 64;
+#ifdef PACMAP_BINARY_PARCEL
+std::atomic<bool> g_binaryMarshalling(true);
+#else
+std::atomic<bool> g_binaryMarshalling(false);
+#endif
 };  // namespace
 
 #define PAC_MAP_PUT_VALUE(id, iid, key, value, mapList) \
@@ -217,6 +228,33 @@ static void PacmapGetArrayVal(OHOS::AAFwk::IInterface *ao, std::vector<valueType
         }                                                                  \
     } while (0);
 
+static bool IsSupportedArray(IArray *array)
+{
+    return Array::IsShortArray(array) || Array::IsIntegerArray(array) || Array::IsLongArray(array) ||
+        Array::IsCharArray(array) || Array::IsByteArray(array) || Array::IsBooleanArray(array) ||
+        Array::IsFloatArray(array) || Array::IsDoubleArray(array) || Array::IsStringArray(array);
+}
+
+/**
+ * @brief Whether a value is kept by the copies and written by Marshalling(), the others are dropped by both.
+ */
+static bool IsSupportedValue(OHOS::AAFwk::IInterface *value)
+{
+    if (value == nullptr) {
+        return false;
+    }
+    if (IArray::Query(value) != nullptr) {
+        return IsSupportedArray(IArray::Query(value));
+    }
+    if (IUserObject::Query(value) != nullptr) {
+        return UserObject::Unbox(IUserObject::Query(value)) != nullptr;
+    }
+    return IPacMap::Query(value) != nullptr || IShort::Query(value) != nullptr ||
+        IInteger::Query(value) != nullptr || ILong::Query(value) != nullptr || IChar::Query(value) != nullptr ||
+        IByte::Query(value) != nullptr || IBoolean::Query(value) != nullptr || IFloat::Query(value) != nullptr ||
+        IDouble::Query(value) != nullptr || IString::Query(value) != nullptr;
+}
+
 using namespace OHOS::AAFwk;
 IINTERFACE_IMPL_1(PacMap, Object, IPacMap);
 /**
@@ -225,9 +263,7 @@ IINTERFACE_IMPL_1(PacMap, Object, IPacMap);
 PacMap::PacMap(const PacMap &other)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    dataList_.clear();
-    std::string str = MapListToString(other.dataList_);
-    StringToMapList(str, dataList_);
+    DeepCopyData(dataList_, other.dataList_);
 }
 
 PacMap::~PacMap()
@@ -241,9 +277,7 @@ PacMap::~PacMap()
 PacMap &PacMap::operator=(const PacMap &other)
 {
     if (&other != this) {
-        dataList_.clear();
-        std::string str = MapListToString(other.dataList_);
-        StringToMapList(str, dataList_);
+        DeepCopyData(dataList_, other.dataList_);
     }
     return *this;
 }
@@ -266,8 +300,7 @@ PacMap PacMap::Clone(void)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
     PacMap pac_map;
-    std::string currentString = MapListToString(dataList_);
-    StringToMapList(currentString, pac_map.dataList_);
+    DeepCopyData(pac_map.dataList_, dataList_);
     return pac_map;
 }
 
@@ -280,16 +313,14 @@ PacMap PacMap::DeepCopy(void)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
     PacMap pac_map;
-    std::string str = MapListToString(dataList_);
-    StringToMapList(str, pac_map.dataList_);
+    DeepCopyData(pac_map.dataList_, dataList_);
     return pac_map;
 }
 
 void PacMap::DeepCopy(PacMap &other)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    dataList_.clear();
-    StringToMapList(MapListToString(other.dataList_), dataList_);
+    DeepCopyData(dataList_, other.dataList_);
 }
 
 /**
@@ -598,8 +629,7 @@ void PacMap::InnerPutStringValueArray(
 void PacMap::PutAll(std::map<std::string, PacMapObject::INTERFACE> &mapData)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    dataList_.clear();
-    StringToMapList(MapListToString(mapData), dataList_);
+    DeepCopyData(dataList_, mapData);
 }
 
 /**
@@ -609,8 +639,7 @@ void PacMap::PutAll(std::map<std::string, PacMapObject::INTERFACE> &mapData)
 void PacMap::PutAll(PacMap &pacMap)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    dataList_.clear();
-    StringToMapList(MapListToString(pacMap.dataList_), dataList_);
+    DeepCopyData(dataList_, pacMap.dataList_);
 }
 
 /**
@@ -878,7 +907,7 @@ std::map<std::string, PacMapObject::INTERFACE> PacMap::GetAll(void)
     std::lock_guard<std::mutex> mLock(mapLock_);
 
     PacMapList tmpMapList;
-    StringToMapList(MapListToString(dataList_), tmpMapList);
+    DeepCopyData(tmpMapList, dataList_);
 
     return tmpMapList;
 }
@@ -891,6 +920,60 @@ void PacMap::ShallowCopyData(PacMapList &desPacMap, const PacMapList &srcPacMap)
     }
 }
 
+/**
+ * @brief Copies the data without a string round trip. Boxed base values are immutable and therefore shared,
+ * arrays, nested PacMaps and user objects are duplicated. Values of unsupported types are dropped, as Marshalling()
+ * drops them.
+ */
+void PacMap::DeepCopyData(PacMapList &desPacMap, const PacMapList &srcPacMap)
+{
+    desPacMap.clear();
+    for (auto it = srcPacMap.begin(); it != srcPacMap.end(); it++) {
+        IInterface *value = it->second.GetRefPtr();
+        if (!IsSupportedValue(value)) {
+            continue;
+        }
+        if (IPacMap::Query(value) != nullptr) {
+            PacMap *pacMap = static_cast<PacMap *>(IPacMap::Query(value));
+            sptr<IPacMap> copy = new (std::nothrow) PacMap(*pacMap);
+            if (copy != nullptr) {
+                desPacMap.emplace(it->first, copy);
+            }
+        } else if (IArray::Query(value) != nullptr) {
+            IArray *array = IArray::Query(value);
+            long size = 0;
+            InterfaceID typeId;
+            array->GetLength(size);
+            array->GetType(typeId);
+            sptr<IArray> copy = new (std::nothrow) Array(size, typeId);
+            if (copy == nullptr) {
+                continue;
+            }
+            for (long i = 0; i < size; i++) {
+                sptr<IInterface> element;
+                array->Get(i, element);
+                copy->Set(i, element);
+            }
+            desPacMap.emplace(it->first, sptr<IInterface>(static_cast<IInterface *>(copy.GetRefPtr())));
+        } else if (IUserObject::Query(value) != nullptr) {
+            std::shared_ptr<UserObjectBase> object = UserObject::Unbox(IUserObject::Query(value));
+            if (object == nullptr) {
+                continue;
+            }
+            UserObjectBase *userObjectIns = UserObjectBaseLoader::GetInstance().GetUserObjectByName(
+                object->GetClassName());
+            if (userObjectIns == nullptr) {
+                continue;
+            }
+            std::shared_ptr<UserObjectBase> userObject(userObjectIns);
+            userObject->DeepCopy(object);
+            InnerPutObject(desPacMap, it->first, userObject);
+        } else {
+            desPacMap.emplace(it->first, it->second);
+        }
+    }
+}
+
 void PacMap::RemoveData(PacMapList &pacMapList, const std::string &key)
 {
     auto it = pacMapList.find(key);
@@ -1141,11 +1224,301 @@ bool PacMap::ReadFromParcel(Parcel &parcel)
  */
 bool PacMap::Marshalling(Parcel &parcel) const
 {
-    if (!parcel.WriteString("PACMAP")) {
+    if (!g_binaryMarshalling.load(std::memory_order_relaxed)) {
+        if (!parcel.WriteString(PACMAP_JSON_PARCEL_TAG)) {
+            return false;
+        }
+        return parcel.WriteString(MapListToString(dataList_));
+    }
+    if (!parcel.WriteString(PACMAP_BINARY_PARCEL_TAG)) {
+        return false;
+    }
+    return WriteMapListToParcel(parcel, dataList_);
+}
+
+void PacMap::SetBinaryMarshalling(bool binary)
+{
+    g_binaryMarshalling.store(binary, std::memory_order_relaxed);
+}
+
+bool PacMap::IsBinaryMarshalling()
+{
+    return g_binaryMarshalling.load(std::memory_order_relaxed);
+}
+
+bool PacMap::WriteMapListToParcel(Parcel &parcel, const PacMapList &mapList) const
+{
+    int32_t size = static_cast<int32_t>(std::count_if(mapList.begin(), mapList.end(),
+        [](const PacMapList::value_type &item) { return IsSupportedValue(item.second.GetRefPtr()); }));
+    if (!parcel.WriteInt32(size)) {
         return false;
     }
-    std::string str = MapListToString(dataList_);
-    return parcel.WriteString(str);
+    for (auto it = mapList.begin(); it != mapList.end(); it++) {
+        if (!IsSupportedValue(it->second.GetRefPtr())) {
+            continue;
+        }
+        if (!parcel.WriteString(it->first) || !WriteValueToParcel(parcel, it->second.GetRefPtr())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PacMap::WriteValueToParcel(Parcel &parcel, IInterface *value) const
+{
+    if (value == nullptr) {
+        return false;
+    }
+    if (IPacMap::Query(value) != nullptr) {
+        PacMap *pacMap = static_cast<PacMap *>(IPacMap::Query(value));
+        return parcel.WriteInt32(PACMAP_DATA_PACMAP) && WriteMapListToParcel(parcel, pacMap->dataList_);
+    } else if (IShort::Query(value) != nullptr) {
+        return parcel.WriteInt32(PACMAP_DATA_SHORT) && parcel.WriteInt16(Short::Unbox(IShort::Query(value)));
+    } else if (IInteger::Query(value) != nullptr) {
+        return parcel.WriteInt32(PACMAP_DATA_INTEGER) && parcel.WriteInt32(Integer::Unbox(IInteger::Query(value)));
+    } else if (ILong::Query(value) != nullptr) {
+        return parcel.WriteInt32(PACMAP_DATA_LONG) && parcel.WriteInt64(Long::Unbox(ILong::Query(value)));
+    } else if (IChar::Query(value) != nullptr) {
+        return parcel.WriteInt32(PACMAP_DATA_CHAR) && parcel.WriteInt32(Char::Unbox(IChar::Query(value)));
+    } else if (IByte::Query(value) != nullptr) {
+        return parcel.WriteInt32(PACMAP_DATA_BYTE) && parcel.WriteInt8(Byte::Unbox(IByte::Query(value)));
+    } else if (IBoolean::Query(value) != nullptr) {
+        return parcel.WriteInt32(PACMAP_DATA_BOOLEAN) && parcel.WriteBool(Boolean::Unbox(IBoolean::Query(value)));
+    } else if (IFloat::Query(value) != nullptr) {
+        return parcel.WriteInt32(PACMAP_DATA_FLOAT) && parcel.WriteFloat(Float::Unbox(IFloat::Query(value)));
+    } else if (IDouble::Query(value) != nullptr) {
+        return parcel.WriteInt32(PACMAP_DATA_DOUBLE) && parcel.WriteDouble(Double::Unbox(IDouble::Query(value)));
+    } else if (IString::Query(value) != nullptr) {
+        return parcel.WriteInt32(PACMAP_DATA_STRING) && parcel.WriteString(String::Unbox(IString::Query(value)));
+    } else if (IArray::Query(value) != nullptr) {
+        return WriteArrayToParcel(parcel, IArray::Query(value));
+    } else if (IUserObject::Query(value) != nullptr) {
+        // user objects keep their ToString()/Parse() contract, as in the JSON form
+        std::shared_ptr<UserObjectBase> object = UserObject::Unbox(IUserObject::Query(value));
+        if (object == nullptr) {
+            return false;
+        }
+        return parcel.WriteInt32(PACMAP_DATA_USEROBJECT) && parcel.WriteString(object->GetClassName()) &&
+            parcel.WriteString(object->ToString());
+    }
+    return false;
+}
+
+bool PacMap::WriteArrayToParcel(Parcel &parcel, IArray *array) const
+{
+    if (Array::IsShortArray(array)) {
+        std::vector<short> arrayData;
+        PacmapGetArrayVal<AAFwk::IShort, AAFwk::Short, short>(array, arrayData);
+        return parcel.WriteInt32(PACMAP_DATA_ARRAY_SHORT) && parcel.WriteInt16Vector(arrayData);
+    } else if (Array::IsIntegerArray(array)) {
+        std::vector<int> arrayData;
+        PacmapGetArrayVal<AAFwk::IInteger, AAFwk::Integer, int>(array, arrayData);
+        return parcel.WriteInt32(PACMAP_DATA_ARRAY_INTEGER) && parcel.WriteInt32Vector(arrayData);
+    } else if (Array::IsLongArray(array)) {
+        std::vector<long> arrayData;
+        PacmapGetArrayVal<AAFwk::ILong, AAFwk::Long, long>(array, arrayData);
+        std::vector<int64_t> parcelData(arrayData.begin(), arrayData.end());
+        return parcel.WriteInt32(PACMAP_DATA_ARRAY_LONG) && parcel.WriteInt64Vector(parcelData);
+    } else if (Array::IsCharArray(array)) {
+        std::vector<zchar> arrayData;
+        PacmapGetArrayVal<AAFwk::IChar, AAFwk::Char, zchar>(array, arrayData);
+        std::vector<int32_t> parcelData(arrayData.begin(), arrayData.end());
+        return parcel.WriteInt32(PACMAP_DATA_ARRAY_CHAR) && parcel.WriteInt32Vector(parcelData);
+    } else if (Array::IsByteArray(array)) {
+        std::vector<byte> arrayData;
+        PacmapGetArrayVal<AAFwk::IByte, AAFwk::Byte, byte>(array, arrayData);
+        std::vector<int8_t> parcelData(arrayData.begin(), arrayData.end());
+        return parcel.WriteInt32(PACMAP_DATA_ARRAY_BYTE) && parcel.WriteInt8Vector(parcelData);
+    } else if (Array::IsBooleanArray(array)) {
+        std::vector<bool> arrayData;
+        PacmapGetArrayVal<AAFwk::IBoolean, AAFwk::Boolean, bool>(array, arrayData);
+        return parcel.WriteInt32(PACMAP_DATA_ARRAY_BOOLEAN) && parcel.WriteBoolVector(arrayData);
+    } else if (Array::IsFloatArray(array)) {
+        std::vector<float> arrayData;
+        PacmapGetArrayVal<AAFwk::IFloat, AAFwk::Float, float>(array, arrayData);
+        return parcel.WriteInt32(PACMAP_DATA_ARRAY_FLOAT) && parcel.WriteFloatVector(arrayData);
+    } else if (Array::IsDoubleArray(array)) {
+        std::vector<double> arrayData;
+        PacmapGetArrayVal<AAFwk::IDouble, AAFwk::Double, double>(array, arrayData);
+        return parcel.WriteInt32(PACMAP_DATA_ARRAY_DOUBLE) && parcel.WriteDoubleVector(arrayData);
+    } else if (Array::IsStringArray(array)) {
+        std::vector<std::string> arrayData;
+        PacmapGetArrayVal<AAFwk::IString, AAFwk::String, std::string>(array, arrayData);
+        return parcel.WriteInt32(PACMAP_DATA_ARRAY_STRING) && parcel.WriteStringVector(arrayData);
+    }
+    return false;
+}
+
+bool PacMap::ReadMapListFromParcel(Parcel &parcel, PacMapList &mapList, int depth)
+{
+    if (depth > MAX_PACMAP_NESTED_DEPTH) {
+        return false;
+    }
+    int32_t size = 0;
+    if (!parcel.ReadInt32(size) || size < 0 || static_cast<size_t>(size) > parcel.GetReadableBytes()) {
+        return false;
+    }
+    for (int32_t i = 0; i < size; i++) {
+        std::string key;
+        int32_t type = PACMAP_DATA_NONE;
+        if (!parcel.ReadString(key) || !parcel.ReadInt32(type)) {
+            return false;
+        }
+        if (!ReadValueFromParcel(parcel, mapList, key, type, depth)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PacMap::ReadValueFromParcel(Parcel &parcel, PacMapList &mapList, const std::string &key, int type, int depth)
+{
+    switch (type) {
+        case PACMAP_DATA_SHORT: {
+            int16_t value = 0;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int16, parcel, value);
+            InnerPutShortValue(mapList, key, value);
+            break;
+        }
+        case PACMAP_DATA_INTEGER: {
+            int32_t value = 0;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, value);
+            InnerPutIntValue(mapList, key, value);
+            break;
+        }
+        case PACMAP_DATA_LONG: {
+            int64_t value = 0;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int64, parcel, value);
+            InnerPutLongValue(mapList, key, value);
+            break;
+        }
+        case PACMAP_DATA_CHAR: {
+            int32_t value = 0;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, value);
+            PAC_MAP_PUT_VALUE(Char, IChar, key, static_cast<zchar>(value), mapList)
+            break;
+        }
+        case PACMAP_DATA_BYTE: {
+            int8_t value = 0;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int8, parcel, value);
+            InnerPutByteValue(mapList, key, value);
+            break;
+        }
+        case PACMAP_DATA_BOOLEAN: {
+            bool value = false;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Bool, parcel, value);
+            InnerPutBooleanValue(mapList, key, value);
+            break;
+        }
+        case PACMAP_DATA_FLOAT: {
+            float value = 0;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Float, parcel, value);
+            InnerPutFloatValue(mapList, key, value);
+            break;
+        }
+        case PACMAP_DATA_DOUBLE: {
+            double value = 0;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Double, parcel, value);
+            InnerPutDoubleValue(mapList, key, value);
+            break;
+        }
+        case PACMAP_DATA_STRING: {
+            std::string value;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, value);
+            InnerPutStringValue(mapList, key, value);
+            break;
+        }
+        case PACMAP_DATA_USEROBJECT: {
+            std::string className;
+            std::string value;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, className);
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, value);
+            // objects of classes that are not registered in this process are skipped
+            UserObjectBase *userObjectIns = UserObjectBaseLoader::GetInstance().GetUserObjectByName(className);
+            if (userObjectIns != nullptr) {
+                if (!value.empty()) {
+                    userObjectIns->Parse(value);
+                }
+                InnerPutObject(mapList, key, std::shared_ptr<UserObjectBase>(userObjectIns));
+            }
+            break;
+        }
+        case PACMAP_DATA_PACMAP: {
+            sptr<PacMap> pacMap = new (std::nothrow) PacMap();
+            if (pacMap == nullptr || !pacMap->ReadMapListFromParcel(parcel, pacMap->dataList_, depth + 1)) {
+                return false;
+            }
+            RemoveData(mapList, key);
+            mapList.emplace(key, sptr<IPacMap>(pacMap.GetRefPtr()));
+            break;
+        }
+        default:
+            return ReadArrayFromParcel(parcel, mapList, key, type);
+    }
+    return true;
+}
+
+bool PacMap::ReadArrayFromParcel(Parcel &parcel, PacMapList &mapList, const std::string &key, int type)
+{
+    switch (type) {
+        case PACMAP_DATA_ARRAY_SHORT: {
+            std::vector<int16_t> value;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int16Vector, parcel, &value);
+            InnerPutShortValueArray(mapList, key, value);
+            break;
+        }
+        case PACMAP_DATA_ARRAY_INTEGER: {
+            std::vector<int32_t> value;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32Vector, parcel, &value);
+            InnerPutIntValueArray(mapList, key, value);
+            break;
+        }
+        case PACMAP_DATA_ARRAY_LONG: {
+            std::vector<int64_t> value;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int64Vector, parcel, &value);
+            InnerPutLongValueArray(mapList, key, std::vector<long>(value.begin(), value.end()));
+            break;
+        }
+        case PACMAP_DATA_ARRAY_CHAR: {
+            std::vector<int32_t> value;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32Vector, parcel, &value);
+            PAC_MAP_ADD_ARRAY(Char, key, value, mapList)
+            break;
+        }
+        case PACMAP_DATA_ARRAY_BYTE: {
+            std::vector<int8_t> value;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int8Vector, parcel, &value);
+            InnerPutByteValueArray(mapList, key, std::vector<AAFwk::byte>(value.begin(), value.end()));
+            break;
+        }
+        case PACMAP_DATA_ARRAY_BOOLEAN: {
+            std::vector<bool> value;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(BoolVector, parcel, &value);
+            InnerPutBooleanValueArray(mapList, key, value);
+            break;
+        }
+        case PACMAP_DATA_ARRAY_FLOAT: {
+            std::vector<float> value;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(FloatVector, parcel, &value);
+            InnerPutFloatValueArray(mapList, key, value);
+            break;
+        }
+        case PACMAP_DATA_ARRAY_DOUBLE: {
+            std::vector<double> value;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(DoubleVector, parcel, &value);
+            InnerPutDoubleValueArray(mapList, key, value);
+            break;
+        }
+        case PACMAP_DATA_ARRAY_STRING: {
+            std::vector<std::string> value;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(StringVector, parcel, &value);
+            InnerPutStringValueArray(mapList, key, value);
+            break;
+        }
+        default:
+            return false;
+    }
+    return true;
 }
 
 /**
@@ -1156,11 +1529,17 @@ bool PacMap::Marshalling(Parcel &parcel) const
 PacMap *PacMap::Unmarshalling(Parcel &parcel)
 {
     std::string value = parcel.ReadString();
-    if (value != "PACMAP") {
+    bool isBinary = (value == PACMAP_BINARY_PARCEL_TAG);
+    if (!isBinary && value != PACMAP_JSON_PARCEL_TAG) {
         return nullptr;
     }
     PacMap *pPacMap = new (std::nothrow) PacMap();
-    if (pPacMap != nullptr && !pPacMap->ReadFromParcel(parcel)) {
+    if (pPacMap == nullptr) {
+        return nullptr;
+    }
+    bool ret = isBinary ? pPacMap->ReadMapListFromParcel(parcel, pPacMap->dataList_, 0) :
+        pPacMap->ReadFromParcel(parcel);
+    if (!ret) {
         delete pPacMap;
         return nullptr;
     }
@@ -1216,10 +1595,9 @@ bool PacMap::ToJson(const PacMapList &mapList, Json::Value &dataObject) const
         } else {
             isOK = GetBaseJsonValue(it, item);
         }
+        // entries that cannot be written are dropped, the copies drop them too
         if (isOK) {
             dataObject[it->first] = item;
-        } else {
-            return false;
         }
     }
     return true;
@@ -1285,99 +1663,83 @@ bool PacMap::GetBaseJsonValue(PacMapList::const_iterator &it, Json::Value &json)
 // Base data: short
 bool PacMap::ToJsonArrayShort(std::vector<short> &array, Json::Value &item, int type) const
 {
-    if (array.size() > 0) {
-        for (size_t i = 0; i < array.size(); i++) {
-            item["data"].append(array[i]);
-        }
-        item["type"] = type;
-        return true;
+    item["data"] = Json::Value(Json::arrayValue);
+    for (size_t i = 0; i < array.size(); i++) {
+        item["data"].append(array[i]);
     }
-    return false;
+    item["type"] = type;
+    return true;
 }
 // Base data: Integer
 bool PacMap::ToJsonArrayInt(std::vector<int> &array, Json::Value &item, int type) const
 {
-    if (array.size() > 0) {
-        for (size_t i = 0; i < array.size(); i++) {
-            item["data"].append(array[i]);
-        }
-        item["type"] = type;
-        return true;
+    item["data"] = Json::Value(Json::arrayValue);
+    for (size_t i = 0; i < array.size(); i++) {
+        item["data"].append(array[i]);
     }
-    return false;
+    item["type"] = type;
+    return true;
 }
 // Base data: long:sting
 bool PacMap::ToJsonArrayLong(std::vector<long> &array, Json::Value &item, int type) const
 {
-    if (array.size() > 0) {
-        for (size_t i = 0; i < array.size(); i++) {
-            item["data"].append(std::to_string(array[i]));
-        }
-        item["type"] = type;
-        return true;
+    item["data"] = Json::Value(Json::arrayValue);
+    for (size_t i = 0; i < array.size(); i++) {
+        item["data"].append(std::to_string(array[i]));
     }
-    return false;
+    item["type"] = type;
+    return true;
 }
 
 // Base data: byte
 bool PacMap::ToJsonArrayByte(std::vector<byte> &array, Json::Value &item, int type) const
 {
-    if (array.size() > 0) {
-        for (size_t i = 0; i < array.size(); i++) {
-            item["data"].append(array[i]);
-        }
-        item["type"] = type;
-        return true;
+    item["data"] = Json::Value(Json::arrayValue);
+    for (size_t i = 0; i < array.size(); i++) {
+        item["data"].append(array[i]);
     }
-    return false;
+    item["type"] = type;
+    return true;
 }
 // Base data: bool
 bool PacMap::ToJsonArrayBoolean(std::vector<bool> &array, Json::Value &item, int type) const
 {
-    if (array.size() > 0) {
-        for (size_t i = 0; i < array.size(); i++) {
-            item["data"].append((int)array[i]);
-        }
-        item["type"] = type;
-        return true;
+    item["data"] = Json::Value(Json::arrayValue);
+    for (size_t i = 0; i < array.size(); i++) {
+        item["data"].append((int)array[i]);
     }
-    return false;
+    item["type"] = type;
+    return true;
 }
 // Base data: Float to string
 bool PacMap::ToJsonArrayFloat(std::vector<float> &array, Json::Value &item, int type) const
 {
-    if (array.size() > 0) {
-        for (size_t i = 0; i < array.size(); i++) {
-            item["data"].append(RawTypeToString<float>(array[i], FLOAT_PRECISION));
-        }
-        item["type"] = type;
-        return true;
+    item["data"] = Json::Value(Json::arrayValue);
+    for (size_t i = 0; i < array.size(); i++) {
+        item["data"].append(RawTypeToString<float>(array[i], FLOAT_PRECISION));
     }
-    return false;
+    item["type"] = type;
+    return true;
 }
 // Base data: Double to string
 bool PacMap::ToJsonArrayDouble(std::vector<double> &array, Json::Value &item, int type) const
 {
-    if (array.size() > 0) {
-        for (size_t i = 0; i < array.size(); i++) {
-            item["data"].append(RawTypeToString<double>(array[i], DOUBLE_PRECISION));
-        }
-        item["type"] = type;
-        return true;
+    item["data"] = Json::Value(Json::arrayValue);
+    for (size_t i = 0; i < array.size(); i++) {
+        item["data"].append(RawTypeToString<double>(array[i], DOUBLE_PRECISION));
     }
-    return false;
+    item["type"] = type;
+    return true;
 }
 // Base data: string
 bool PacMap::ToJsonArrayString(std::vector<std::string> &array, Json::Value &item, int type) const
 {
-    if (array.size() > 0) {
-        for (size_t i = 0; i < array.size(); i++) {
-            item["data"].append(array[i]);
-        }
-        item["type"] = type;
-        return true;
+    item["data"] = Json::Value(Json::arrayValue);
+    for (size_t i = 0; i < array.size(); i++) {
+        item["data"].append(array[i]);
     }
-    return false;
+    item["type"] = type;
+    return true;
 }
 
 bool PacMap::GetArrayJsonValue(PacMapList::const_iterator &it, Json::Value &json) const
@@ -1402,7 +1764,10 @@ bool PacMap::GetArrayJsonValue(PacMapList::const_iterator &it, Json::Value &json
         PacmapGetArrayVal<AAFwk::ILong, AAFwk::Long, long>(it->second.GetRefPtr(), arrayData);
         return ToJsonArrayLong(arrayData, json, PACMAP_DATA_ARRAY_LONG);
     } else if (Array::IsCharArray(array)) {
-        return false;
+        std::vector<zchar> charData;
+        PacmapGetArrayVal<AAFwk::IChar, AAFwk::Char, zchar>(it->second.GetRefPtr(), charData);
+        std::vector<int> arrayData(charData.begin(), charData.end());
+        return ToJsonArrayInt(arrayData, json, PACMAP_DATA_ARRAY_CHAR);
     } else if (Array::IsByteArray(array)) {
         std::vector<byte> arrayData;
         PacmapGetArrayVal<AAFwk::IByte, AAFwk::Byte, byte>(it->second.GetRefPtr(), arrayData);
@@ -39,6 +39,7 @@ PatternsMatcher::PatternsMatcher(const PatternsMatcher &patternsMatcher)
 {
     pattern_ = patternsMatcher.GetPattern();
     type_ = patternsMatcher.GetType();
+    regex_ = std::atomic_load(&patternsMatcher.regex_);
 }
 
 /**
@@ -82,9 +83,17 @@ MatchType PatternsMatcher::GetType() const
  * @param str The desired string to look for.
  * @return Returns either a valid match constant.
  */
-bool PatternsMatcher::match(std::string match)
+bool PatternsMatcher::match(const std::string &str)
 {
-    return MatchPattern(pattern_, match, type_);
+    if (type_ != MatchType::PATTERN || str.empty()) {
+        return MatchPattern(pattern_, str, type_);
+    }
+    std::shared_ptr<const std::regex> regex = std::atomic_load(&regex_);
+    if (regex == nullptr) {
+        regex = std::make_shared<const std::regex>(pattern_);
+        std::atomic_store(&regex_, regex);
+    }
+    return std::regex_match(str, *regex);
 }
 
 /**
@@ -96,7 +105,7 @@ bool PatternsMatcher::match(std::string match)
  *
  * @return Returns either a valid match constant.
  */
-bool PatternsMatcher::MatchPattern(std::string pattern, std::string match, MatchType type)
+bool PatternsMatcher::MatchPattern(const std::string &pattern, const std::string &match, MatchType type)
 {
     if (match.empty()) {
         return false;
@@ -106,7 +115,7 @@ bool PatternsMatcher::MatchPattern(std::string pattern, std::string match, Match
             return pattern == match;
         }
         case MatchType::PREFIX: {
-            return match.find(pattern) == 0;
+            return match.compare(0, pattern.length(), pattern) == 0;
         }
         case MatchType::PATTERN: {
             std::regex regex_(pattern);
@@ -130,7 +139,7 @@ bool PatternsMatcher::MatchPattern(std::string pattern, std::string match, Match
  *
  * @return Returns either a valid match constant.
  */
-bool PatternsMatcher::GlobPattern(std::string pattern, std::string match)
+bool PatternsMatcher::GlobPattern(const std::string &pattern, const std::string &match)
 {
     size_t indexP = 0;
     size_t find_pos = 0;
@@ -196,6 +205,7 @@ bool PatternsMatcher::ReadFromParcel(Parcel &parcel)
     std::u16string readString16;
     READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String16, parcel, readString16);
     pattern_ = Str16ToStr8(readString16);
+    regex_.reset();
 
     // flags_
     int32_t type;
@@ -14,6 +14,9 @@
  */
 
 #include "ohos/aafwk/content/skills.h"
+
+#include <algorithm>
+
 using namespace OHOS;
 using namespace OHOS::AppExecFwk;
 namespace OHOS {
@@ -48,6 +51,9 @@ Skills::Skills(const Skills &skills)
     schemeSpecificParts_ = skills.schemeSpecificParts_;
     // types_
     types_ = skills.types_;
+    hasPartialTypes_ = skills.hasPartialTypes_;
+    // the lookup sets only depend on the lists above
+    matchIndex_ = std::atomic_load(&skills.matchIndex_);
 }
 
 Skills::~Skills()
@@ -92,6 +98,7 @@ std::string Skills::GetEntity(int index) const
  */
 void Skills::AddEntity(const std::string &entity)
 {
+    InvalidateMatchIndex();
     auto it = std::find(entities_.begin(), entities_.end(), entity);
     if (it == entities_.end()) {
         entities_.emplace_back(entity);
@@ -115,6 +122,7 @@ bool Skills::HasEntity(const std::string &entity)
  */
 void Skills::RemoveEntity(const std::string &entity)
 {
+    InvalidateMatchIndex();
     if (!entities_.empty()) {
         auto it = std::find(entities_.begin(), entities_.end(), entity);
         if (it != entities_.end()) {
@@ -153,6 +161,7 @@ std::string Skills::GetAction(int index) const
  */
 void Skills::AddAction(const std::string &action)
 {
+    InvalidateMatchIndex();
     auto it = std::find(actions_.begin(), actions_.end(), action);
     if (it == actions_.end()) {
         actions_.emplace_back(action);
@@ -176,6 +185,7 @@ bool Skills::HasAction(const std::string &action)
  */
 void Skills::RemoveAction(const std::string &action)
 {
+    InvalidateMatchIndex();
     if (!actions_.empty()) {
         auto it = std::find(actions_.begin(), actions_.end(), action);
         if (it != actions_.end()) {
@@ -200,6 +210,7 @@ int Skills::CountActions() const
  */
 std::vector<std::string>::iterator Skills::ActionsIterator()
 {
+    InvalidateMatchIndex();
     return actions_.begin();
 }
 
@@ -224,6 +235,7 @@ std::string Skills::GetAuthority(int index) const
  */
 void Skills::AddAuthority(const std::string &authority)
 {
+    InvalidateMatchIndex();
     auto it = std::find(authorities_.begin(), authorities_.end(), authority);
     if (it == authorities_.end()) {
         authorities_.emplace_back(authority);
@@ -247,6 +259,7 @@ bool Skills::HasAuthority(const std::string &authority)
  */
 void Skills::RemoveAuthority(const std::string &authority)
 {
+    InvalidateMatchIndex();
     if (!authorities_.empty()) {
         auto it = std::find(authorities_.begin(), authorities_.end(), authority);
         if (it != authorities_.end()) {
@@ -295,7 +308,8 @@ void Skills::AddPath(const std::string &path)
  */
 void Skills::AddPath(const PatternsMatcher &patternsMatcher)
 {
-    auto hasPath = std::find_if(paths_.begin(), paths_.end(), [&patternsMatcher](const PatternsMatcher pm) {
+    InvalidateMatchIndex();
+    auto hasPath = std::find_if(paths_.begin(), paths_.end(), [&patternsMatcher](const PatternsMatcher &pm) {
         return (pm.GetPattern() == patternsMatcher.GetPattern()) && (pm.GetType() == patternsMatcher.GetType());
     });
 
@@ -324,7 +338,7 @@ void Skills::AddPath(const std::string &path, const MatchType &matchType)
 bool Skills::HasPath(const std::string &path)
 {
     auto hasPath = std::find_if(
-        paths_.begin(), paths_.end(), [&path](const PatternsMatcher pm) { return pm.GetPattern() == path; });
+        paths_.begin(), paths_.end(), [&path](const PatternsMatcher &pm) { return pm.GetPattern() == path; });
     return hasPath != paths_.end();
 }
 
@@ -335,8 +349,9 @@ bool Skills::HasPath(const std::string &path)
  */
 void Skills::RemovePath(const std::string &path)
 {
+    InvalidateMatchIndex();
     auto hasPath = std::find_if(
-        paths_.begin(), paths_.end(), [&path](const PatternsMatcher pm) { return pm.GetPattern() == path; });
+        paths_.begin(), paths_.end(), [&path](const PatternsMatcher &pm) { return pm.GetPattern() == path; });
 
     if (hasPath != paths_.end()) {
         paths_.erase(hasPath);
@@ -350,7 +365,8 @@ void Skills::RemovePath(const std::string &path)
  */
 void Skills::RemovePath(const PatternsMatcher &patternsMatcher)
 {
-    auto hasPath = std::find_if(paths_.begin(), paths_.end(), [&patternsMatcher](const PatternsMatcher pm) {
+    InvalidateMatchIndex();
+    auto hasPath = std::find_if(paths_.begin(), paths_.end(), [&patternsMatcher](const PatternsMatcher &pm) {
         return (pm.GetPattern() == patternsMatcher.GetPattern()) && (pm.GetType() == patternsMatcher.GetType());
     });
 
@@ -400,6 +416,7 @@ std::string Skills::GetScheme(int index) const
  */
 void Skills::AddScheme(const std::string &scheme)
 {
+    InvalidateMatchIndex();
     auto it = std::find(schemes_.begin(), schemes_.end(), scheme);
     if (it == schemes_.end()) {
         schemes_.emplace_back(scheme);
@@ -423,6 +440,7 @@ bool Skills::HasScheme(const std::string &scheme)
  */
 void Skills::RemoveScheme(const std::string &scheme)
 {
+    InvalidateMatchIndex();
     if (!schemes_.empty()) {
         auto it = std::find(schemes_.begin(), schemes_.end(), scheme);
         if (it != schemes_.end()) {
@@ -460,9 +478,10 @@ std::string Skills::GetSchemeSpecificPart(int index) const
  */
 void Skills::AddSchemeSpecificPart(const std::string &schemeSpecificPart)
 {
+    InvalidateMatchIndex();
     PatternsMatcher patternsMatcher(schemeSpecificPart, MatchType::DEFAULT);
     auto it = std::find_if(
-        schemeSpecificParts_.begin(), schemeSpecificParts_.end(), [&patternsMatcher](const PatternsMatcher pm) {
+        schemeSpecificParts_.begin(), schemeSpecificParts_.end(), [&patternsMatcher](const PatternsMatcher &pm) {
             return (pm.GetPattern() == patternsMatcher.GetPattern()) && (pm.GetType() == patternsMatcher.GetType());
         });
 
@@ -480,7 +499,7 @@ bool Skills::HasSchemeSpecificPart(const std::string &schemeSpecificPart)
 {
     auto it = std::find_if(schemeSpecificParts_.begin(),
         schemeSpecificParts_.end(),
-        [&schemeSpecificPart](const PatternsMatcher pm) { return pm.GetPattern() == schemeSpecificPart; });
+        [&schemeSpecificPart](const PatternsMatcher &pm) { return pm.GetPattern() == schemeSpecificPart; });
     return it != schemeSpecificParts_.end();
 }
 
@@ -491,9 +510,10 @@ bool Skills::HasSchemeSpecificPart(const std::string &schemeSpecificPart)
  */
 void Skills::RemoveSchemeSpecificPart(const std::string &schemeSpecificPart)
 {
+    InvalidateMatchIndex();
     auto it = std::find_if(schemeSpecificParts_.begin(),
         schemeSpecificParts_.end(),
-        [&schemeSpecificPart](const PatternsMatcher pm) { return pm.GetPattern() == schemeSpecificPart; });
+        [&schemeSpecificPart](const PatternsMatcher &pm) { return pm.GetPattern() == schemeSpecificPart; });
 
     if (it != schemeSpecificParts_.end()) {
         schemeSpecificParts_.erase(it);
@@ -552,6 +572,7 @@ void Skills::AddType(const std::string &type, const MatchType &matchType)
  */
 void Skills::AddType(const PatternsMatcher &patternsMatcher)
 {
+    InvalidateMatchIndex();
     const size_t posNext = 1;
     const size_t posOffset = 2;
     std::string type = patternsMatcher.GetPattern();
@@ -563,7 +584,7 @@ void Skills::AddType(const PatternsMatcher &patternsMatcher)
             auto it = std::find_if(types_.begin(),
                 types_.end(),
                 [type = pm.GetPattern(), matchType = pm.GetType()](
-                    const PatternsMatcher pm) { return (pm.GetPattern() == type) && (pm.GetType() == matchType); });
+                    const PatternsMatcher &pm) { return (pm.GetPattern() == type) && (pm.GetType() == matchType); });
             if (it == types_.end()) {
                 types_.emplace_back(pm);
             }
@@ -573,7 +594,7 @@ void Skills::AddType(const PatternsMatcher &patternsMatcher)
             auto it = std::find_if(types_.begin(),
                 types_.end(),
                 [type = pm.GetPattern(), matchType = pm.GetType()](
-                    const PatternsMatcher pm) { return (pm.GetPattern() == type) && (pm.GetType() == matchType); });
+                    const PatternsMatcher &pm) { return (pm.GetPattern() == type) && (pm.GetType() == matchType); });
             if (it == types_.end()) {
                 types_.emplace_back(pm);
             }
@@ -589,7 +610,7 @@ void Skills::AddType(const PatternsMatcher &patternsMatcher)
 bool Skills::HasType(const std::string &type)
 {
     auto it = std::find_if(
-        types_.begin(), types_.end(), [&type](const PatternsMatcher pm) { return pm.GetPattern() == type; });
+        types_.begin(), types_.end(), [&type](const PatternsMatcher &pm) { return pm.GetPattern() == type; });
     return it != types_.end();
 }
 
@@ -600,8 +621,9 @@ bool Skills::HasType(const std::string &type)
  */
 void Skills::RemoveType(const std::string &type)
 {
+    InvalidateMatchIndex();
     auto it = std::find_if(
-        types_.begin(), types_.end(), [&type](const PatternsMatcher pm) { return pm.GetPattern() == type; });
+        types_.begin(), types_.end(), [&type](const PatternsMatcher &pm) { return pm.GetPattern() == type; });
 
     if (it != types_.end()) {
         types_.erase(it);
@@ -615,7 +637,8 @@ void Skills::RemoveType(const std::string &type)
  */
 void Skills::RemoveType(const PatternsMatcher &patternsMatcher)
 {
-    auto it = std::find_if(types_.begin(), types_.end(), [&patternsMatcher](const PatternsMatcher pm) {
+    InvalidateMatchIndex();
+    auto it = std::find_if(types_.begin(), types_.end(), [&patternsMatcher](const PatternsMatcher &pm) {
         return (pm.GetPattern() == patternsMatcher.GetPattern()) && (pm.GetType() == patternsMatcher.GetType());
     });
 
@@ -645,23 +668,217 @@ int Skills::CountTypes() const
     return types_.empty() ? 0 : types_.size();
 }
 
+namespace {
+/**
+ * A string together with its hash, so that one Want value is hashed once however many skills it is
+ * matched against.
+ */
+struct HashedString {
+    HashedString() = default;
+    explicit HashedString(std::string str) : value(std::move(str)), hash(std::hash<std::string>()(value))
+    {}
+
+    std::string value;
+    size_t hash = 0;
+};
+
+/**
+ * Set of strings kept as a flat array sorted by hash. Skills lists are short, so this is faster and
+ * smaller than a node based hash set.
+ */
+class HashedSet {
+public:
+    void Insert(const std::string &value)
+    {
+        entries_.emplace_back(value);
+    }
+
+    void Seal()
+    {
+        std::sort(entries_.begin(), entries_.end(), [](const HashedString &left, const HashedString &right) {
+            return left.hash < right.hash || (left.hash == right.hash && left.value < right.value);
+        });
+        entries_.erase(std::unique(entries_.begin(), entries_.end(),
+            [](const HashedString &left, const HashedString &right) {
+                return left.hash == right.hash && left.value == right.value;
+            }), entries_.end());
+    }
+
+    bool Contains(const HashedString &key) const
+    {
+        auto it = std::lower_bound(entries_.begin(), entries_.end(), key.hash,
+            [](const HashedString &entry, size_t hash) { return entry.hash < hash; });
+        for (; it != entries_.end() && it->hash == key.hash; it++) {
+            if (it->value == key.value) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool Contains(const std::string &value) const
+    {
+        return Contains(HashedString(value));
+    }
+
+    bool Empty() const
+    {
+        return entries_.empty();
+    }
+
+private:
+    std::vector<HashedString> entries_;
+};
+}  // namespace
+
+/**
+ * Lookup sets of one Skills object. Matching used to scan and copy the lists on every call.
+ */
+struct Skills::MatchIndex {
+    explicit MatchIndex(const Skills &skills);
+
+    HashedSet entities;
+    HashedSet actions;
+    HashedSet authorities;
+    HashedSet schemes;
+    HashedSet paths;
+    HashedSet schemeSpecificParts;
+    HashedSet types;
+    // "image/" for every "image/..." type, answers wildcard queries such as "image/*"
+    HashedSet typePrefixes;
+};
+
+Skills::MatchIndex::MatchIndex(const Skills &skills)
+{
+    for (const auto &entity : skills.entities_) {
+        entities.Insert(entity);
+    }
+    for (const auto &action : skills.actions_) {
+        actions.Insert(action);
+    }
+    for (const auto &authority : skills.authorities_) {
+        authorities.Insert(authority);
+    }
+    for (const auto &scheme : skills.schemes_) {
+        schemes.Insert(scheme);
+    }
+    for (const auto &path : skills.paths_) {
+        paths.Insert(path.GetPattern());
+    }
+    for (const auto &schemeSpecificPart : skills.schemeSpecificParts_) {
+        schemeSpecificParts.Insert(schemeSpecificPart.GetPattern());
+    }
+    for (const auto &typeMatcher : skills.types_) {
+        std::string type = typeMatcher.GetPattern();
+        size_t slashpos = type.find('/');
+        if (slashpos != std::string::npos) {
+            typePrefixes.Insert(type.substr(0, slashpos + 1));
+        }
+        types.Insert(type);
+    }
+    for (HashedSet *set : { &entities, &actions, &authorities, &schemes, &paths, &schemeSpecificParts, &types,
+        &typePrefixes }) {
+        set->Seal();
+    }
+}
+
+/**
+ * The parts of a Want that take part in matching, decoded and hashed once per Want. The type, the uri
+ * parts and the entities are only decoded when a skills gets past the action check.
+ */
+struct Skills::MatchTarget {
+    explicit MatchTarget(const Want &want) : want(want), action(want.GetAction())
+    {}
+
+    void DecodeData();
+
+    const Want &want;
+    HashedString action;
+    bool dataDecoded = false;
+    HashedString type;
+    HashedString scheme;
+    HashedString schemeSpecificPart;
+    HashedString authority;
+    HashedString path;
+    std::vector<HashedString> entities;
+};
+
+void Skills::MatchTarget::DecodeData()
+{
+    if (dataDecoded) {
+        return;
+    }
+    type = HashedString(want.GetType());
+    Uri uri = want.GetUri();
+    scheme = HashedString(uri.GetScheme());
+    schemeSpecificPart = HashedString(uri.GetSchemeSpecificPart());
+    authority = HashedString(uri.GetAuthority());
+    path = HashedString(uri.GetPath());
+    for (const auto &entity : want.GetEntities()) {
+        entities.emplace_back(entity);
+    }
+    dataDecoded = true;
+}
+
+std::shared_ptr<const Skills::MatchIndex> Skills::GetMatchIndex() const
+{
+    std::shared_ptr<const MatchIndex> index = std::atomic_load(&matchIndex_);
+    if (index == nullptr) {
+        index = std::make_shared<const MatchIndex>(*this);
+        std::atomic_store(&matchIndex_, index);
+    }
+    return index;
+}
+
+void Skills::InvalidateMatchIndex()
+{
+    std::atomic_store(&matchIndex_, std::shared_ptr<const MatchIndex>());
+}
+
 /**
  * @brief Match this skill against a Want's data.
  *
  * @param want The desired want data to match for.
  */
-bool Skills::Match(const Want &want)
+bool Skills::Match(const Want &want) const
+{
+    MatchTarget target(want);
+    return Match(target);
+}
+
+/**
+ * @brief Match a Want against a list of skills. The Want is decoded once for the whole list.
+ *
+ * @param want The desired want data to match for.
+ * @param skillsList The skills to match against.
+ * @return Returns the indexes in skillsList of the skills that match the want.
+ */
+std::vector<size_t> Skills::MatchAll(const Want &want, const std::vector<Skills> &skillsList)
 {
-    if (want.GetAction() != std::string() && !MatchAction(want.GetAction())) {
+    std::vector<size_t> result;
+    MatchTarget target(want);
+    for (size_t i = 0; i < skillsList.size(); i++) {
+        if (skillsList[i].Match(target)) {
+            result.emplace_back(i);
+        }
+    }
+    return result;
+}
+
+bool Skills::Match(MatchTarget &target) const
+{
+    std::shared_ptr<const MatchIndex> index = GetMatchIndex();
+    if (target.action.value != std::string() && !MatchAction(*index, target)) {
         return false;
     }
 
-    int dataMatch = MatchData(want.GetType(), want.GetScheme(), want.GetUri());
+    target.DecodeData();
+    int dataMatch = MatchData(*index, target);
     if (dataMatch < 0) {
         return false;
     }
 
-    std::string entityMismatch = MatchEntities(want.GetEntities());
+    std::string entityMismatch = MatchEntities(*index, target);
     if (entityMismatch == std::string()) {
         return false;
     }
@@ -674,21 +891,17 @@ bool Skills::Match(const Want &want)
  * the Want must be specified by the skills; if any are not in the
  * skills, the match fails.
  *
- * @param entities The entities included in the want, as returned by
- *                   Want.getEntities().
+ * @param index The lookup sets of this skills.
+ * @param target The decoded want data, holding the entities included in the want.
  *
  * @return If all entities match (success), null; else the name of the
  *         first entity that didn't match.
  */
-std::string Skills::MatchEntities(const std::vector<std::string> &entities)
+std::string Skills::MatchEntities(const MatchIndex &index, const MatchTarget &target) const
 {
-    if (!entities.empty()) {
-        size_t size = entities.size();
-        for (size_t i = 0; i < size; i++) {
-            auto it = std::find(entities_.begin(), entities_.end(), entities[i]);
-            if (it != entities_.end()) {
-                return entities[i];
-            }
+    for (const auto &entity : target.entities) {
+        if (index.entities.Contains(entity)) {
+            return entity.value;
         }
     }
 
@@ -699,85 +912,66 @@ std::string Skills::MatchEntities(const std::vector<std::string> &entities)
  * @brief Match this skills against a Want's action.  If the skills does not
  * specify any actions, the match will always fail.
  *
- * @param action The desired action to look for.
+ * @param index The lookup sets of this skills.
+ * @param target The decoded want data, holding the desired action to look for.
  *
  * @return True if the action is listed in the skills.
  */
-bool Skills::MatchAction(const std::string &action)
+bool Skills::MatchAction(const MatchIndex &index, const MatchTarget &target) const
 {
-    return HasAction(action);
+    return index.actions.Contains(target.action);
 }
 
 /**
  * @brief Match this skills against a Want's data (type, scheme and path).
  *
- * @param type The desired data type to look for.
- * @param scheme The desired data scheme to look for.
- * @param data The full data string to match against.
+ * @param index The lookup sets of this skills.
+ * @param target The decoded want data to match against.
  *
  * @return Returns either a valid match constant.
  */
-int Skills::MatchData(const std::string &type, const std::string &scheme, Uri data)
+int Skills::MatchData(const MatchIndex &index, const MatchTarget &target) const
 {
-    std::vector<std::string> types;
-    for (auto it = types_.begin(); it != types_.end(); it++) {
-        types.emplace_back(it->GetPattern());
-    }
-    std::vector<std::string> schemes = schemes_;
-
     int match = RESULT_EMPTY;
 
-    if (types.empty() && schemes.empty()) {
-        return (type == std::string() ? (RESULT_EMPTY + RESULT_NORMAL) : DISMATCH_DATA);
+    if (index.types.Empty() && index.schemes.Empty()) {
+        return (target.type.value == std::string() ? (RESULT_EMPTY + RESULT_NORMAL) : DISMATCH_DATA);
     }
 
-    if (!schemes.empty()) {
-        auto it = std::find(schemes.begin(), schemes.end(), scheme);
-        if (it != schemes.end()) {
-            match = RESULT_SCHEME;
-        } else {
+    if (!index.schemes.Empty()) {
+        if (!index.schemes.Contains(target.scheme)) {
             return DISMATCH_DATA;
         }
 
-        std::vector<PatternsMatcher> schemeSpecificParts = schemeSpecificParts_;
-        if (schemeSpecificParts.size() >= 0) {
-            match = HasSchemeSpecificPart(data.GetSchemeSpecificPart()) ? RESULT_SCHEME_SPECIFIC_PART : DISMATCH_DATA;
-        }
+        match = index.schemeSpecificParts.Contains(target.schemeSpecificPart) ? RESULT_SCHEME_SPECIFIC_PART :
+            DISMATCH_DATA;
         if (match != RESULT_SCHEME_SPECIFIC_PART) {
-            std::vector<std::string> authorities = authorities_;
-            if (authorities.size() >= 0) {
-                bool authMatch = HasAuthority(data.GetAuthority());
-                if (authMatch == true) {
-                    std::vector<PatternsMatcher> paths = paths_;
-                    if (paths.size() <= 0) {
-                        match = authMatch;
-                    } else if (HasPath(data.GetPath())) {
-                        match = RESULT_PATH;
-                    } else {
-                        return DISMATCH_DATA;
-                    }
-                } else {
-                    return DISMATCH_DATA;
-                }
+            if (!index.authorities.Contains(target.authority)) {
+                return DISMATCH_DATA;
+            }
+            if (index.paths.Empty()) {
+                match = true;
+            } else if (index.paths.Contains(target.path)) {
+                match = RESULT_PATH;
+            } else {
+                return DISMATCH_DATA;
             }
-        }
-        if (match == DISMATCH_DATA) {
-            return DISMATCH_DATA;
         }
     } else {
+        const std::string &scheme = target.scheme.value;
         if (scheme != std::string() && scheme != "content" && scheme != "file") {
             return DISMATCH_DATA;
         }
     }
 
-    if (!types.empty()) {
-        if (FindMimeType(type)) {
+    if (!index.types.Empty()) {
+        if (FindMimeType(index, target)) {
             match = RESULT_TYPE;
         } else {
             return DISMATCH_TYPE;
         }
     } else {
-        if (type != std::string()) {
+        if (target.type.value != std::string()) {
             return DISMATCH_TYPE;
         }
     }
@@ -785,79 +979,42 @@ int Skills::MatchData(const std::string &type, const std::string &scheme, Uri da
     return match + RESULT_NORMAL;
 }
 
-bool Skills::FindMimeType(const std::string &type)
+bool Skills::FindMimeType(const MatchIndex &index, const MatchTarget &target) const
 {
-    const int posNext = 1;
-    const int posOffset = 2;
-    std::vector<PatternsMatcher> types = types_;
+    const size_t posNext = 1;
+    const size_t posOffset = 2;
+    const std::string &type = target.type.value;
 
     if (type == std::string()) {
         return false;
     }
-    auto it = types.begin();
-    for (; it != types.end(); it++) {
-        if (it->GetPattern() == type) {
-            break;
-        }
-    }
-    if (it != types.end()) {
+    if (index.types.Contains(target.type)) {
         return true;
     }
 
     size_t typeLength = type.length();
     if (typeLength == LENGTH_FOR_FINDMINETYPE && type == "*/*") {
-        return !types.empty();
+        return !index.types.Empty();
     }
 
-    auto hasType =
-        std::find_if(types.begin(), types.end(), [](const PatternsMatcher pm) { return pm.GetPattern() == "*"; });
-    if (hasPartialTypes_ && hasType != types.end()) {
+    if (hasPartialTypes_ && index.types.Contains("*")) {
         return true;
     }
 
-    auto typeIt = type.find(0, 1, '/');
-    size_t slashpos = type.size() - typeIt;
-    if (slashpos > 0) {
-        std::string typeSubstr = type.substr(0, slashpos);
-
-        auto hasType = std::find_if(types.begin(), types.end(), [&typeSubstr](const PatternsMatcher pm) {
-            return pm.GetPattern() == typeSubstr;
-        });
-        if (hasPartialTypes_ && hasType != types.end()) {
+    size_t slashpos = type.find('/');
+    if (slashpos != std::string::npos && slashpos > 0) {
+        if (hasPartialTypes_ && index.types.Contains(type.substr(0, slashpos))) {
             return true;
         }
 
         if (typeLength == slashpos + posOffset && type.at(slashpos + posNext) == '*') {
-            size_t numTypes = types.size();
-            for (size_t i = 0; i < numTypes; i++) {
-                std::string value = types.at(i).GetPattern();
-                if (RegionMatches(type, 0, value, 0, slashpos + posNext)) {
-                    return true;
-                }
-            }
+            return index.typePrefixes.Contains(type.substr(0, slashpos + posNext));
         }
     }
 
     return false;
 }
 
-bool Skills::RegionMatches(const std::string &type, int toffset, const std::string &other, int ooffset, int len)
-{
-    int to = toffset;
-    int po = ooffset;
-    // Note: toffset, ooffset, or len might be near -1>>>1.
-    if ((ooffset < 0) || (toffset < 0) || (toffset > (long)type.size() - len) ||
-        (ooffset > (long)other.length() - len)) {
-        return false;
-    }
-    while (len-- > 0) {
-        if (type.at(to++) != other.at(po++)) {
-            return false;
-        }
-    }
-    return true;
-}
-
 /**
  * @brief Obtains the want params data.
  *
@@ -969,6 +1126,7 @@ Skills *Skills::Unmarshalling(Parcel &parcel)
 
 bool Skills::ReadFromParcel(Parcel &parcel)
 {
+    InvalidateMatchIndex();
     int32_t empty;
     int32_t size = 0;
     PatternsMatcher *pm = nullptr;
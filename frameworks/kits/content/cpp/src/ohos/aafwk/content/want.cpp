@@ -16,6 +16,7 @@
 #include "want.h"
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
 #include <cstdlib>
 #include <regex>
@@ -44,6 +45,20 @@ namespace OHOS {
 namespace AAFwk {
 namespace {
 const std::regex NUMBER_REGEX("^[-+]?([0-9]+)([.]([0-9]+))?$");
+
+// Leads a compact parcel, never a valid String16 length of the legacy format.
+constexpr int32_t PARCEL_FORMAT_COMPACT = -0x57414E54;
+constexpr uint32_t COMPACT_HAS_URI = 1 << 0;
+constexpr uint32_t COMPACT_HAS_ENTITIES = 1 << 1;
+constexpr uint32_t COMPACT_HAS_ELEMENT = 1 << 2;
+constexpr uint32_t COMPACT_HAS_PARAMS = 1 << 3;
+constexpr uint32_t COMPACT_HAS_PICKER = 1 << 4;
+
+#ifdef WANT_COMPACT_PARCEL
+std::atomic<bool> g_compactMarshalling(true);
+#else
+std::atomic<bool> g_compactMarshalling(false);
+#endif
 };  // namespace
 const std::string Want::ACTION_PLAY("action.system.play");
 const std::string Want::ACTION_HOME("action.system.home");
@@ -1521,6 +1536,10 @@ void Want::ClearWant(Want *want)
  */
 bool Want::Marshalling(Parcel &parcel) const
 {
+    if (g_compactMarshalling.load(std::memory_order_relaxed)) {
+        return MarshallingCompact(parcel);
+    }
+
     // write action
     if (!parcel.WriteString16(Str8ToStr16(GetAction()))) {
         return false;
@@ -1540,14 +1559,9 @@ bool Want::Marshalling(Parcel &parcel) const
         }
     }
 
-    // write entities
-    std::vector<std::u16string> entityU16;
-    std::vector<std::string> entities = GetEntities();
-    for (std::vector<std::string>::size_type i = 0; i < entities.size(); i++) {
-        entityU16.push_back(Str8ToStr16(entities[i]));
-    }
-
-    if (entityU16.size() == 0) {
+    // write entities, same layout as WriteString16Vector
+    const std::vector<std::string> &entities = operation_.entities_;
+    if (entities.empty()) {
         if (!parcel.WriteInt32(VALUE_NULL)) {
             return false;
         }
@@ -1555,9 +1569,14 @@ bool Want::Marshalling(Parcel &parcel) const
         if (!parcel.WriteInt32(VALUE_OBJECT)) {
             return false;
         }
-        if (!parcel.WriteString16Vector(entityU16)) {
+        if (!parcel.WriteInt32(entities.size())) {
             return false;
         }
+        for (const auto &entity : entities) {
+            if (!parcel.WriteString16(Str8ToStr16(entity))) {
+                return false;
+            }
+        }
     }
 
     // write flags
@@ -1566,9 +1585,9 @@ bool Want::Marshalling(Parcel &parcel) const
     }
 
     // write element
-    ElementName emptyElement;
     ElementName element = GetElement();
-    if (element == emptyElement) {
+    if (operation_.deviceId_.empty() && operation_.bundleName_.empty() && operation_.abilityName_.empty() &&
+        operation_.moduleName_.empty()) {
         if (!parcel.WriteInt32(VALUE_NULL)) {
             return false;
         }
@@ -1633,8 +1652,104 @@ Want *Want::Unmarshalling(Parcel &parcel)
     return want;
 }
 
+void Want::SetCompactMarshalling(bool compact)
+{
+    g_compactMarshalling.store(compact, std::memory_order_relaxed);
+}
+
+bool Want::IsCompactMarshalling()
+{
+    return g_compactMarshalling.load(std::memory_order_relaxed);
+}
+
+bool Want::MarshallingCompact(Parcel &parcel) const
+{
+    std::string uri = operation_.uri_.ToString();
+    uint32_t mask = 0;
+    if (!uri.empty()) {
+        mask |= COMPACT_HAS_URI;
+    }
+    if (!operation_.entities_.empty()) {
+        mask |= COMPACT_HAS_ENTITIES;
+    }
+    if (!operation_.deviceId_.empty() || !operation_.abilityName_.empty() || !operation_.moduleName_.empty()) {
+        mask |= COMPACT_HAS_ELEMENT;
+    }
+    if (!parameters_.IsEmpty()) {
+        mask |= COMPACT_HAS_PARAMS;
+    }
+    if (picker_ != nullptr) {
+        mask |= COMPACT_HAS_PICKER;
+    }
+
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, PARCEL_FORMAT_COMPACT);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, mask);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, operation_.action_);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, operation_.flags_);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, operation_.bundleName_);
+    if (mask & COMPACT_HAS_URI) {
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, uri);
+    }
+    if (mask & COMPACT_HAS_ENTITIES) {
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(StringVector, parcel, operation_.entities_);
+    }
+    if (mask & COMPACT_HAS_ELEMENT) {
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, operation_.deviceId_);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, operation_.abilityName_);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, operation_.moduleName_);
+    }
+    if ((mask & COMPACT_HAS_PARAMS) && !parameters_.DoMarshalling(parcel, true)) {
+        return false;
+    }
+    if ((mask & COMPACT_HAS_PICKER) && !picker_->Marshalling(parcel)) {
+        return false;
+    }
+    return true;
+}
+
+bool Want::ReadFromParcelCompact(Parcel &parcel)
+{
+    uint32_t mask = 0;
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, mask);
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, operation_.action_);
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, operation_.flags_);
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, operation_.bundleName_);
+    if (mask & COMPACT_HAS_URI) {
+        std::string uri;
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, uri);
+        SetUri(uri);
+    }
+    if (mask & COMPACT_HAS_ENTITIES) {
+        if (!parcel.ReadStringVector(&operation_.entities_)) {
+            return false;
+        }
+    }
+    if (mask & COMPACT_HAS_ELEMENT) {
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, operation_.deviceId_);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, operation_.abilityName_);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, operation_.moduleName_);
+    }
+    if ((mask & COMPACT_HAS_PARAMS) && !parameters_.ReadFromParcel(parcel, true)) {
+        return false;
+    }
+    if (mask & COMPACT_HAS_PICKER) {
+        picker_ = Want::Unmarshalling(parcel);
+        if (picker_ == nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool Want::ReadFromParcel(Parcel &parcel)
 {
+    size_t position = parcel.GetReadPosition();
+    int32_t format = 0;
+    if (parcel.ReadInt32(format) && format == PARCEL_FORMAT_COMPACT) {
+        return ReadFromParcelCompact(parcel);
+    }
+    parcel.RewindRead(position);
+
     int empty;
     std::string value;
     std::vector<std::string> entities;
@@ -15,6 +15,8 @@
 
 #include "want_params.h"
 
+#include <algorithm>
+
 #include "ability_base_log_wrapper.h"
 #include "ohos/aafwk/base/base_interfaces.h"
 #include "ohos/aafwk/base/base_object.h"
@@ -28,6 +30,7 @@
 #include "ohos/aafwk/base/string_wrapper.h"
 #include "ohos/aafwk/base/zchar_wrapper.h"
 #include "ohos/aafwk/content/array_wrapper.h"
+#include "ohos/aafwk/content/want_params_storage.h"
 #include "ohos/aafwk/content/want_params_wrapper.h"
 #include "parcel.h"
 #include "securec.h"
@@ -135,53 +138,148 @@ std::string WantParams::GetStringByType(const sptr<IInterface> iIt, int typeId)
 }
 template<typename T1, typename T2, typename T3>
 static void SetNewArray(const AAFwk::InterfaceID &id, AAFwk::IArray *orgIArray, sptr<AAFwk::IArray> &ao);
+
+WantParams::Storage::Storage(const Storage &other)
+    : entries(other.entries), unsupportedData(other.unsupportedData), arrayCount(other.arrayCount)
+{
+    // Boxed scalars and strings are immutable and can be shared, arrays are not.
+    for (auto &entry : entries) {
+        if (entry.value.type != VALUE_TYPE_ARRAY) {
+            continue;
+        }
+        sptr<IArray> destAO = nullptr;
+        if (NewArrayData(IArray::Query(entry.value.object), destAO)) {
+            entry.value.object = destAO;
+        }
+    }
+}
+
+std::vector<WantParams::Entry>::iterator WantParams::Storage::LowerBound(const std::string &key)
+{
+    return std::lower_bound(entries.begin(), entries.end(), key,
+        [](const Entry &entry, const std::string &value) { return entry.key < value; });
+}
+
+std::vector<WantParams::Entry>::const_iterator WantParams::Storage::Find(const std::string &key) const
+{
+    auto it = std::lower_bound(entries.cbegin(), entries.cend(), key,
+        [](const Entry &entry, const std::string &value) { return entry.key < value; });
+    if (it != entries.cend() && it->key == key) {
+        return it;
+    }
+    return entries.cend();
+}
+
+void WantParams::Storage::Put(const std::string &key, Value &&value)
+{
+    if (value.type == VALUE_TYPE_ARRAY) {
+        arrayCount++;
+    }
+    if (entries.empty() || entries.back().key < key) {
+        // keys arrive in order when unmarshalling
+        entries.push_back(Entry { key, std::move(value) });
+        return;
+    }
+    auto it = LowerBound(key);
+    if (it != entries.end() && it->key == key) {
+        if (it->value.type == VALUE_TYPE_ARRAY) {
+            arrayCount--;
+        }
+        it->value = std::move(value);
+    } else {
+        entries.insert(it, Entry { key, std::move(value) });
+    }
+}
+
+bool WantParams::Storage::Erase(const std::string &key)
+{
+    auto it = LowerBound(key);
+    if (it == entries.end() || it->key != key) {
+        return false;
+    }
+    if (it->value.type == VALUE_TYPE_ARRAY) {
+        arrayCount--;
+    }
+    entries.erase(it);
+    return true;
+}
+
 /**
  * @description: A constructor used to create an WantParams instance by using the parameters of an existing
- * WantParams object.
+ * WantParams object. The storage is shared until either side is modified.
  * @param wantParams  Indicates the existing WantParams object.
  */
-WantParams::WantParams(const WantParams &wantParams)
+WantParams::WantParams(const WantParams &wantParams) : storage_(ShareStorage(wantParams.storage_))
+{}
+
+// inner use function
+std::shared_ptr<WantParams::Storage> WantParams::ShareStorage(const std::shared_ptr<Storage> &storage)
 {
-    params_.clear();
-    NewParams(wantParams, *this);
+    if (storage == nullptr) {
+        return nullptr;
+    }
+    if (storage->arrayCount > 0) {
+        return std::make_shared<Storage>(*storage);
+    }
+    storage->shared.store(true, std::memory_order_relaxed);
+    return storage;
 }
+
 // inner use function
-bool WantParams::NewParams(const WantParams &source, WantParams &dest)
-{
-    // Deep copy
-    for (auto it = source.params_.begin(); it != source.params_.end(); it++) {
-        sptr<IInterface> o = it->second;
-        if (IString::Query(o) != nullptr) {
-            dest.params_[it->first] = String::Box(String::Unbox(IString::Query(o)));
-        } else if (IBoolean::Query(o) != nullptr) {
-            dest.params_[it->first] = Boolean::Box(Boolean::Unbox(IBoolean::Query(o)));
-        } else if (IByte::Query(o) != nullptr) {
-            dest.params_[it->first] = Byte::Box(Byte::Unbox(IByte::Query(o)));
-        } else if (IChar::Query(o) != nullptr) {
-            dest.params_[it->first] = Char::Box(Char::Unbox(IChar::Query(o)));
-        } else if (IShort::Query(o) != nullptr) {
-            dest.params_[it->first] = Short::Box(Short::Unbox(IShort::Query(o)));
-        } else if (IInteger::Query(o) != nullptr) {
-            dest.params_[it->first] = Integer::Box(Integer::Unbox(IInteger::Query(o)));
-        } else if (ILong::Query(o) != nullptr) {
-            dest.params_[it->first] = Long::Box(Long::Unbox(ILong::Query(o)));
-        } else if (IFloat::Query(o) != nullptr) {
-            dest.params_[it->first] = Float::Box(Float::Unbox(IFloat::Query(o)));
-        } else if (IDouble::Query(o) != nullptr) {
-            dest.params_[it->first] = Double::Box(Double::Unbox(IDouble::Query(o)));
-        } else if (IWantParams::Query(o) != nullptr) {
-            WantParams newDest(WantParamWrapper::Unbox(IWantParams::Query(o)));
-            dest.params_[it->first] = WantParamWrapper::Box(newDest);
-        } else if (IArray::Query(o) != nullptr) {
-            sptr<IArray> destAO = nullptr;
-            if (!NewArrayData(IArray::Query(o), destAO)) {
-                continue;
-            }
-            dest.params_[it->first] = destAO;
-        }
+WantParams::Storage &WantParams::MutableStorage()
+{
+    if (storage_ == nullptr) {
+        storage_ = std::make_shared<Storage>();
+    } else if (storage_->shared.load(std::memory_order_relaxed)) {
+        storage_ = std::make_shared<Storage>(*storage_);
     }
-    return true;
-}  // namespace AAFwk
+    return *storage_;
+}
+
+// inner use function
+void WantParams::MakeValue(IInterface *object, Value &value)
+{
+    value.object = object;
+    value.type = GetDataType(value.object);
+    switch (value.type) {
+        case VALUE_TYPE_BOOLEAN:
+            value.scalar.boolValue = Boolean::Unbox(IBoolean::Query(object));
+            break;
+        case VALUE_TYPE_BYTE:
+            value.scalar.byteValue = Byte::Unbox(IByte::Query(object));
+            break;
+        case VALUE_TYPE_CHAR:
+            value.scalar.charValue = Char::Unbox(IChar::Query(object));
+            break;
+        case VALUE_TYPE_SHORT:
+            value.scalar.shortValue = Short::Unbox(IShort::Query(object));
+            break;
+        case VALUE_TYPE_INT:
+            value.scalar.intValue = Integer::Unbox(IInteger::Query(object));
+            break;
+        case VALUE_TYPE_LONG:
+            value.scalar.longValue = Long::Unbox(ILong::Query(object));
+            break;
+        case VALUE_TYPE_FLOAT:
+            value.scalar.floatValue = Float::Unbox(IFloat::Query(object));
+            break;
+        case VALUE_TYPE_DOUBLE:
+            value.scalar.doubleValue = Double::Unbox(IDouble::Query(object));
+            break;
+        case VALUE_TYPE_STRING:
+            value.stringValue = String::Unbox(IString::Query(object));
+            break;
+        default:
+            break;
+    }
+}
+
+// inner use function
+void WantParams::SetParamValue(const std::string &key, Value &&value)
+{
+    MutableStorage().Put(key, std::move(value));
+}
+
 // inner use
 bool WantParams::NewArrayData(IArray *source, sptr<IArray> &dest)
 {
@@ -223,22 +321,27 @@ bool WantParams::NewArrayData(IArray *source, sptr<IArray> &dest)
 WantParams &WantParams::operator=(const WantParams &other)
 {
     if (this != &other) {
-        params_.clear();
-        NewParams(other, *this);
+        storage_ = ShareStorage(other.storage_);
     }
     return *this;
 }
 bool WantParams::operator==(const WantParams &other)
 {
-    if (this->params_.size() != other.params_.size()) {
+    if (storage_ == other.storage_) {
+        return true;
+    }
+    if (Size() != other.Size()) {
         return false;
     }
-    for (auto itthis : this->params_) {
-        auto itother = other.params_.find(itthis.first);
-        if (itother == other.params_.end()) {
+    if (IsEmpty()) {
+        return true;
+    }
+    for (const auto &entry : storage_->entries) {
+        auto itother = other.storage_->Find(entry.key);
+        if (itother == other.storage_->entries.cend()) {
             return false;
         }
-        if (!CompareInterface(itother->second, itthis.second, WantParams::GetDataType(itother->second))) {
+        if (!CompareInterface(itother->value.object, entry.value.object, itother->value.type)) {
             return false;
         }
     }
@@ -353,7 +456,9 @@ bool WantParams::CompareInterface(const sptr<IInterface> iIt1, const sptr<IInter
  */
 void WantParams::SetParam(const std::string &key, IInterface *value)
 {
-    params_[key] = value;
+    Value entryValue;
+    MakeValue(value, entryValue);
+    SetParamValue(key, std::move(entryValue));
 }
 
 /**
@@ -363,11 +468,14 @@ void WantParams::SetParam(const std::string &key, IInterface *value)
  */
 sptr<IInterface> WantParams::GetParam(const std::string &key) const
 {
-    auto it = params_.find(key);
-    if (it == params_.cend()) {
+    if (storage_ == nullptr) {
         return nullptr;
     }
-    return it->second;
+    auto it = storage_->Find(key);
+    if (it == storage_->entries.cend()) {
+        return nullptr;
+    }
+    return it->value.object;
 }
 
 /**
@@ -376,9 +484,16 @@ sptr<IInterface> WantParams::GetParam(const std::string &key) const
  * @return Returns the value matching the given key.
  */
 
-const std::map<std::string, sptr<IInterface>> &WantParams::GetParams() const
+std::map<std::string, sptr<IInterface>> WantParams::GetParams() const
 {
-    return params_;
+    std::map<std::string, sptr<IInterface>> params;
+    if (storage_ == nullptr) {
+        return params;
+    }
+    for (const auto &entry : storage_->entries) {
+        params.emplace_hint(params.end(), entry.key, entry.value.object);
+    }
+    return params;
 }
 
 /**
@@ -391,8 +506,11 @@ const std::set<std::string> WantParams::KeySet() const
     std::set<std::string> keySet;
     keySet.clear();
 
-    for (auto it : params_) {
-        keySet.emplace(it.first);
+    if (storage_ == nullptr) {
+        return keySet;
+    }
+    for (const auto &entry : storage_->entries) {
+        keySet.emplace_hint(keySet.end(), entry.key);
     }
 
     return keySet;
@@ -404,7 +522,10 @@ const std::set<std::string> WantParams::KeySet() const
  */
 void WantParams::Remove(const std::string &key)
 {
-    params_.erase(key);
+    if (!HasParam(key)) {
+        return;
+    }
+    MutableStorage().Erase(key);
 }
 
 /**
@@ -414,7 +535,7 @@ void WantParams::Remove(const std::string &key)
  */
 bool WantParams::HasParam(const std::string &key) const
 {
-    return (params_.count(key) > 0);
+    return storage_ != nullptr && storage_->Find(key) != storage_->entries.cend();
 }
 
 /**
@@ -423,7 +544,7 @@ bool WantParams::HasParam(const std::string &key) const
  */
 int WantParams::Size() const
 {
-    return params_.size();
+    return (storage_ == nullptr) ? 0 : storage_->entries.size();
 }
 
 /**
@@ -432,172 +553,100 @@ int WantParams::Size() const
  */
 bool WantParams::IsEmpty() const
 {
-    return (params_.size() == 0);
+    return (Size() == 0);
 }
 
-bool WantParams::WriteToParcelString(Parcel &parcel, sptr<IInterface> &o) const
+static bool WriteStringToParcel(Parcel &parcel, const std::string &value, bool compact)
 {
-    std::string value = String::Unbox(IString::Query(o));
-    if (!parcel.WriteInt32(VALUE_TYPE_STRING)) {
-        return false;
+    if (compact) {
+        return parcel.WriteString(value);
     }
     return parcel.WriteString16(Str8ToStr16(value));
 }
 
-bool WantParams::WriteToParcelBool(Parcel &parcel, sptr<IInterface> &o) const
+static bool ReadStringFromParcel(Parcel &parcel, std::string &value, bool compact)
 {
-    bool value = Boolean::Unbox(IBoolean::Query(o));
-    if (!parcel.WriteInt32(VALUE_TYPE_BOOLEAN)) {
-        return false;
+    if (compact) {
+        return parcel.ReadString(value);
     }
-    return parcel.WriteInt8(value);
-}
-bool WantParams::WriteToParcelWantParams(Parcel &parcel, sptr<IInterface> &o) const
-{
-    WantParams value = WantParamWrapper::Unbox(IWantParams::Query(o));
-    if (!parcel.WriteInt32(VALUE_TYPE_WANTPARAMS)) {
+    std::u16string value16;
+    if (!parcel.ReadString16(value16)) {
         return false;
     }
-    return parcel.WriteString16(Str8ToStr16(static_cast<WantParamWrapper *>(IWantParams::Query(o))->ToString()));
-}
-bool WantParams::WriteToParcelByte(Parcel &parcel, sptr<IInterface> &o) const
-{
-    byte value = Byte::Unbox(IByte::Query(o));
-    if (!parcel.WriteInt32(VALUE_TYPE_BYTE)) {
-        return false;
-    }
-    return parcel.WriteInt8(value);
-}
-
-bool WantParams::WriteToParcelChar(Parcel &parcel, sptr<IInterface> &o) const
-{
-    zchar value = Char::Unbox(IChar::Query(o));
-    if (!parcel.WriteInt32(VALUE_TYPE_CHAR)) {
-        return false;
-    }
-    return parcel.WriteInt32(value);
-}
-
-bool WantParams::WriteToParcelShort(Parcel &parcel, sptr<IInterface> &o) const
-{
-    short value = Short::Unbox(IShort::Query(o));
-    if (!parcel.WriteInt32(VALUE_TYPE_SHORT)) {
-        return false;
-    }
-    return parcel.WriteInt16(value);
-}
-
-bool WantParams::WriteToParcelInt(Parcel &parcel, sptr<IInterface> &o) const
-{
-    int value = Integer::Unbox(IInteger::Query(o));
-    if (!parcel.WriteInt32(VALUE_TYPE_INT)) {
-        return false;
-    }
-    return parcel.WriteInt32(value);
-}
-
-bool WantParams::WriteToParcelLong(Parcel &parcel, sptr<IInterface> &o) const
-{
-    long value = Long::Unbox(ILong::Query(o));
-    if (!parcel.WriteInt32(VALUE_TYPE_LONG)) {
-        return false;
-    }
-    return parcel.WriteInt64(value);
-}
-
-bool WantParams::WriteToParcelFloat(Parcel &parcel, sptr<IInterface> &o) const
-{
-    float value = Float::Unbox(IFloat::Query(o));
-    if (!parcel.WriteInt32(VALUE_TYPE_FLOAT)) {
-        return false;
-    }
-    return parcel.WriteFloat(value);
+    value = Str16ToStr8(value16);
+    return true;
 }
 
-bool WantParams::WriteToParcelDouble(Parcel &parcel, sptr<IInterface> &o) const
+bool WantParams::WriteValueToParcel(Parcel &parcel, const Value &value, bool compact) const
 {
-    double value = Double::Unbox(IDouble::Query(o));
-    if (!parcel.WriteInt32(VALUE_TYPE_DOUBLE)) {
+    if (value.type != VALUE_TYPE_ARRAY && !parcel.WriteInt32(value.type)) {
         return false;
     }
-    return parcel.WriteDouble(value);
-}
-
-bool WantParams::WriteMarshalling(Parcel &parcel, sptr<IInterface> &o) const
-{
-    if (IString::Query(o) != nullptr) {
-        return WriteToParcelString(parcel, o);
-    } else if (IBoolean::Query(o) != nullptr) {
-        return WriteToParcelBool(parcel, o);
-    } else if (IByte::Query(o) != nullptr) {
-        return WriteToParcelByte(parcel, o);
-    } else if (IChar::Query(o) != nullptr) {
-        return WriteToParcelChar(parcel, o);
-    } else if (IShort::Query(o) != nullptr) {
-        return WriteToParcelShort(parcel, o);
-    } else if (IInteger::Query(o) != nullptr) {
-        return WriteToParcelInt(parcel, o);
-    } else if (ILong::Query(o) != nullptr) {
-        return WriteToParcelLong(parcel, o);
-    } else if (IFloat::Query(o) != nullptr) {
-        return WriteToParcelFloat(parcel, o);
-    } else if (IDouble::Query(o) != nullptr) {
-        return WriteToParcelDouble(parcel, o);
-    } else if (IWantParams::Query(o) != nullptr) {
-        return WriteToParcelWantParams(parcel, o);
-    } else {
-        IArray *ao = IArray::Query(o);
-        if (ao != nullptr) {
-            sptr<IArray> array(ao);
-            return WriteArrayToParcel(parcel, array);
-        } else {
+    switch (value.type) {
+        case VALUE_TYPE_STRING:
+            return WriteStringToParcel(parcel, value.stringValue, compact);
+        case VALUE_TYPE_BOOLEAN:
+            return parcel.WriteInt8(value.scalar.boolValue);
+        case VALUE_TYPE_BYTE:
+            return parcel.WriteInt8(value.scalar.byteValue);
+        case VALUE_TYPE_CHAR:
+            return parcel.WriteInt32(value.scalar.charValue);
+        case VALUE_TYPE_SHORT:
+            return parcel.WriteInt16(value.scalar.shortValue);
+        case VALUE_TYPE_INT:
+            return parcel.WriteInt32(value.scalar.intValue);
+        case VALUE_TYPE_LONG:
+            return parcel.WriteInt64(value.scalar.longValue);
+        case VALUE_TYPE_FLOAT:
+            return parcel.WriteFloat(value.scalar.floatValue);
+        case VALUE_TYPE_DOUBLE:
+            return parcel.WriteDouble(value.scalar.doubleValue);
+        case VALUE_TYPE_WANTPARAMS:
+            return parcel.WriteString16(
+                Str8ToStr16(static_cast<WantParamWrapper *>(IWantParams::Query(value.object))->ToString()));
+        case VALUE_TYPE_ARRAY:
+            return WriteArrayToParcel(parcel, IArray::Query(value.object), compact);
+        default:
             return true;
-        }
     }
 }
 
-bool WantParams::DoMarshalling(Parcel &parcel) const
+bool WantParams::DoMarshalling(Parcel &parcel, bool compact) const
 {
-    size_t size = params_.size();
-    if (!cachedUnsupportedData_.empty()) {
-        size += cachedUnsupportedData_.size();
+    if (storage_ == nullptr) {
+        return parcel.WriteInt32(0);
     }
 
+    size_t size = storage_->entries.size() + storage_->unsupportedData.size();
     if (!parcel.WriteInt32(size)) {
         return false;
     }
 
-    auto iter = params_.cbegin();
-    while (iter != params_.cend()) {
-        std::string key = iter->first;
-        sptr<IInterface> o = iter->second;
-        if (!parcel.WriteString16(Str8ToStr16(key))) {
+    for (const auto &entry : storage_->entries) {
+        if (!WriteStringToParcel(parcel, entry.key, compact)) {
             return false;
         }
-        if (!WriteMarshalling(parcel, o)) {
+        if (!WriteValueToParcel(parcel, entry.value, compact)) {
             return false;
         }
-        iter++;
     }
 
-    if (!cachedUnsupportedData_.empty()) {
-        for (const UnsupportedData &data : cachedUnsupportedData_) {
-            if (!parcel.WriteString16(data.key)) {
-                return false;
-            }
-            if (!parcel.WriteInt32(data.type)) {
-                return false;
-            }
-            if (!parcel.WriteInt32(data.size)) {
-                return false;
-            }
-            // Corresponding to Parcel#writeByteArray() in Java.
-            if (!parcel.WriteInt32(data.size)) {
-                return false;
-            }
-            if (!parcel.WriteBuffer(data.buffer, data.size)) {
-                return false;
-            }
+    for (const UnsupportedData &data : storage_->unsupportedData) {
+        if (!WriteStringToParcel(parcel, Str16ToStr8(data.key), compact)) {
+            return false;
+        }
+        if (!parcel.WriteInt32(data.type)) {
+            return false;
+        }
+        if (!parcel.WriteInt32(data.size)) {
+            return false;
+        }
+        // Corresponding to Parcel#writeByteArray() in Java.
+        if (!parcel.WriteInt32(data.size)) {
+            return false;
+        }
+        if (!parcel.WriteBuffer(data.buffer, data.size)) {
+            return false;
         }
     }
     return true;
@@ -691,12 +740,22 @@ static void SetNewArray(const AAFwk::InterfaceID &id, AAFwk::IArray *orgIArray,
     }
 }
 
-bool WantParams::WriteArrayToParcelString(Parcel &parcel, IArray *ao) const
+bool WantParams::WriteArrayToParcelString(Parcel &parcel, IArray *ao, bool compact) const
 {
     if (ao == nullptr) {
         return false;
     }
 
+    if (compact) {
+        std::vector<std::string> array;
+        auto func = [&](IInterface *object) { array.push_back(String::Unbox(IString::Query(object))); };
+        Array::ForEach(ao, func);
+        if (!parcel.WriteInt32(VALUE_TYPE_STRINGARRAY)) {
+            return false;
+        }
+        return parcel.WriteStringVector(array);
+    }
+
     std::vector<std::u16string> array;
     auto func = [&](IInterface *object) {
         std::string s = String::Unbox(IString::Query(object));
@@ -858,10 +917,10 @@ bool WantParams::WriteArrayToParcelWantParams(Parcel &parcel, IArray *ao) const
     return true;
 }
 
-bool WantParams::WriteArrayToParcel(Parcel &parcel, IArray *ao) const
+bool WantParams::WriteArrayToParcel(Parcel &parcel, IArray *ao, bool compact) const
 {
     if (Array::IsStringArray(ao)) {
-        return WriteArrayToParcelString(parcel, ao);
+        return WriteArrayToParcelString(parcel, ao, compact);
     } else if (Array::IsBooleanArray(ao)) {
         return WriteArrayToParcelBool(parcel, ao);
     } else if (Array::IsByteArray(ao)) {
@@ -885,8 +944,17 @@ bool WantParams::WriteArrayToParcel(Parcel &parcel, IArray *ao) const
     }
 }
 
-bool WantParams::ReadFromParcelArrayString(Parcel &parcel, sptr<IArray> &ao)
+bool WantParams::ReadFromParcelArrayString(Parcel &parcel, sptr<IArray> &ao, bool compact)
 {
+    if (compact) {
+        std::vector<std::string> value;
+        if (!parcel.ReadStringVector(&value)) {
+            ABILITYBASE_LOGI("%{public}s read string of array fail.", __func__);
+            return false;
+        }
+        return SetArray<std::string, String>(g_IID_IString, value, ao);
+    }
+
     std::vector<std::u16string> value;
     if (!parcel.ReadString16Vector(&value)) {
         ABILITYBASE_LOGI("%{public}s read string of array fail.", __func__);
@@ -1023,12 +1091,12 @@ bool WantParams::ReadFromParcelArrayWantParams(Parcel &parcel, sptr<IArray> &ao)
     return false;
 }
 
-bool WantParams::ReadArrayToParcel(Parcel &parcel, int type, sptr<IArray> &ao)
+bool WantParams::ReadArrayToParcel(Parcel &parcel, int type, sptr<IArray> &ao, bool compact)
 {
     switch (type) {
         case VALUE_TYPE_STRINGARRAY:
         case VALUE_TYPE_CHARSEQUENCEARRAY:
-            return ReadFromParcelArrayString(parcel, ao);
+            return ReadFromParcelArrayString(parcel, ao, compact);
         case VALUE_TYPE_BOOLEANARRAY:
             return ReadFromParcelArrayBool(parcel, ao);
         case VALUE_TYPE_BYTEARRAY:
@@ -1054,16 +1122,20 @@ bool WantParams::ReadArrayToParcel(Parcel &parcel, int type, sptr<IArray> &ao)
     return true;
 }
 
-bool WantParams::ReadFromParcelString(Parcel &parcel, const std::string &key)
+bool WantParams::ReadFromParcelString(Parcel &parcel, const std::string &key, bool compact)
 {
-    std::u16string value = parcel.ReadString16();
-    std::string strValue(Str16ToStr8(value));
-    sptr<IInterface> intf = String::Box(Str16ToStr8(value));
-    if (intf) {
-        SetParam(key, intf);
-    } else {
+    Value value;
+    if (!ReadStringFromParcel(parcel, value.stringValue, compact) && compact) {
         ABILITYBASE_LOGI("%{public}s read data fail: key=%{public}s", __func__, key.c_str());
+        return false;
+    }
+    value.object = String::Box(value.stringValue);
+    if (value.object == nullptr) {
+        ABILITYBASE_LOGI("%{public}s insert param fail: key=%{public}s", __func__, key.c_str());
+        return true;
     }
+    value.type = VALUE_TYPE_STRING;
+    SetParamValue(key, std::move(value));
     return true;
 }
 
@@ -1252,16 +1324,16 @@ bool WantParams::ReadUnsupportedData(Parcel &parcel, const std::string &key, int
     if (memcpy_s(data.buffer, bufferSize, bufferP, bufferSize) != EOK) {
         return false;
     }
-    cachedUnsupportedData_.emplace_back(std::move(data));
+    MutableStorage().unsupportedData.emplace_back(std::move(data));
     return true;
 }
 
-bool WantParams::ReadFromParcelParam(Parcel &parcel, const std::string &key, int type)
+bool WantParams::ReadFromParcelParam(Parcel &parcel, const std::string &key, int type, bool compact)
 {
     switch (type) {
         case VALUE_TYPE_CHARSEQUENCE:
         case VALUE_TYPE_STRING:
-            return ReadFromParcelString(parcel, key);
+            return ReadFromParcelString(parcel, key, compact);
         case VALUE_TYPE_BOOLEAN:
             return ReadFromParcelBool(parcel, key);
         case VALUE_TYPE_BYTE:
@@ -1293,7 +1365,7 @@ bool WantParams::ReadFromParcelParam(Parcel &parcel, const std::string &key, int
         default: {
             // handle array
             sptr<IArray> ao = nullptr;
-            if (!ReadArrayToParcel(parcel, type, ao)) {
+            if (!ReadArrayToParcel(parcel, type, ao, compact)) {
                 return false;
             }
             sptr<IInterface> intf = ao;
@@ -1306,21 +1378,29 @@ bool WantParams::ReadFromParcelParam(Parcel &parcel, const std::string &key, int
     return true;
 }
 
-bool WantParams::ReadFromParcel(Parcel &parcel)
+bool WantParams::ReadFromParcel(Parcel &parcel, bool compact)
 {
     int32_t size;
     if (!parcel.ReadInt32(size)) {
         ABILITYBASE_LOGI("%{public}s read size fail.", __func__);
         return false;
     }
+    if (size < 0 || static_cast<size_t>(size) > parcel.GetReadableBytes()) {
+        ABILITYBASE_LOGI("%{public}s invalid size: %{public}d", __func__, size);
+        return false;
+    }
+    std::string key;
     for (int32_t i = 0; i < size; i++) {
-        std::u16string key = parcel.ReadString16();
+        if (!ReadStringFromParcel(parcel, key, compact) && compact) {
+            ABILITYBASE_LOGI("%{public}s read key fail.", __func__);
+            return false;
+        }
         int type;
         if (!parcel.ReadInt32(type)) {
             ABILITYBASE_LOGI("%{public}s read type fail.", __func__);
             return false;
         }
-        if (!ReadFromParcelParam(parcel, Str16ToStr8(key), type)) {
+        if (!ReadFromParcelParam(parcel, key, type, compact)) {
             ABILITYBASE_LOGI("%{public}s get i=%{public}d fail.", __func__, i);
             return false;
         }
@@ -1347,37 +1427,38 @@ WantParams *WantParams::Unmarshalling(Parcel &parcel)
         ABILITYBASE_LOGI("%{public}s read length fail.", __func__);
         return nullptr;
     }
-    const uint8_t *dataInBytes = parcel.ReadUnpadBuffer(bufferSize);
-    if (dataInBytes == nullptr) {
-        ABILITYBASE_LOGI("%{public}s read buffer fail.", __func__);
+    if (bufferSize < 0 || static_cast<size_t>(bufferSize) > parcel.GetReadableBytes()) {
+        ABILITYBASE_LOGI("%{public}s invalid bufferSize: %{public}d", __func__, bufferSize);
         return nullptr;
     }
 
-    Parcel tempParcel;
-    if (!tempParcel.WriteBuffer(dataInBytes, bufferSize)) {
-        ABILITYBASE_LOGI("%{public}s tempParcel.WriteBuffer fail.", __func__);
+    // Parse the byte array in place instead of copying it into a temporary parcel first.
+    size_t start = parcel.GetReadPosition();
+    size_t end = start + static_cast<size_t>(bufferSize);
+    WantParams *wantParams = new (std::nothrow) WantParams();
+    if (wantParams == nullptr) {
         return nullptr;
     }
-
-    WantParams *wantParams = new (std::nothrow) WantParams();
-    if (wantParams != nullptr && !wantParams->ReadFromParcel(tempParcel)) {
+    if (!wantParams->ReadFromParcel(parcel) || parcel.GetReadPosition() > end) {
+        ABILITYBASE_LOGI("%{public}s read buffer fail.", __func__);
         delete wantParams;
-        wantParams = nullptr;
+        return nullptr;
     }
+    parcel.RewindRead(end);
     return wantParams;
 }
 
 void WantParams::DumpInfo(int level) const
 {
-    int typeId = VALUE_TYPE_NULL;
-    for (auto it : params_) {
-        typeId = VALUE_TYPE_NULL;
-        typeId = WantParams::GetDataType(it.second);
-        if (typeId != VALUE_TYPE_NULL) {
-            std::string value = WantParams::GetStringByType(it.second, typeId);
-            ABILITYBASE_LOGI("=WantParams[%{public}s]:%{private}s =======", it.first.c_str(), value.c_str());
+    if (storage_ == nullptr) {
+        return;
+    }
+    for (const auto &entry : storage_->entries) {
+        if (entry.value.type != VALUE_TYPE_NULL) {
+            std::string value = WantParams::GetStringByType(entry.value.object, entry.value.type);
+            ABILITYBASE_LOGI("=WantParams[%{public}s]:%{private}s =======", entry.key.c_str(), value.c_str());
         } else {
-            ABILITYBASE_LOGI("=WantParams[%{public}s]:type error =======", it.first.c_str());
+            ABILITYBASE_LOGI("=WantParams[%{public}s]:type error =======", entry.key.c_str());
         }
     }
 }
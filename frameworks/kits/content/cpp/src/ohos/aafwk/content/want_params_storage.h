@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_AAFWK_WANT_PARAMS_STORAGE_H
+#define OHOS_AAFWK_WANT_PARAMS_STORAGE_H
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ohos/aafwk/base/base_def.h"
+#include "ohos/aafwk/content/want_params.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * Tagged value of one WantParams entry. Scalars and strings are kept unboxed so that marshalling and
+ * comparison never need to probe the IInterface type chain again; the boxed object is the compatibility
+ * view handed out by GetParam()/GetParams().
+ */
+struct WantParams::Value {
+    int type = VALUE_TYPE_NULL;
+    union Scalar {
+        bool boolValue;
+        byte byteValue;
+        zchar charValue;
+        short shortValue;
+        int intValue;
+        long longValue;
+        float floatValue;
+        double doubleValue;
+    } scalar = { false };
+    std::string stringValue;
+    sptr<IInterface> object;
+};
+
+struct WantParams::Entry {
+    std::string key;
+    Value value;
+};
+
+/**
+ * Shared backing store of WantParams. Copies of a WantParams share one Storage; the first mutation on a
+ * shared Storage clones it (copy-on-write), so copying a Want is O(1). Boxed arrays can be changed through
+ * GetParam(), so a Storage holding any is deep copied instead of shared.
+ */
+struct WantParams::Storage {
+    Storage() = default;
+    Storage(const Storage &other);
+    Storage &operator=(const Storage &other) = delete;
+
+    std::vector<Entry>::iterator LowerBound(const std::string &key);
+    std::vector<Entry>::const_iterator Find(const std::string &key) const;
+    void Put(const std::string &key, Value &&value);
+    bool Erase(const std::string &key);
+
+    // entries are kept sorted by key
+    std::vector<Entry> entries;
+    std::vector<UnsupportedData> unsupportedData;
+    size_t arrayCount = 0;
+    // set once a second WantParams refers to this Storage and never cleared, so that every owner clones it
+    // before writing, whichever of them goes away first
+    std::atomic<bool> shared {false};
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_WANT_PARAMS_STORAGE_H
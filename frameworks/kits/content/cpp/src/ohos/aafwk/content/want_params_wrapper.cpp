@@ -42,7 +42,8 @@ std::string WantParamWrapper::ToString()
     std::string result;
     if (wantParams_.Size() != 0) {
         result += "{";
-        for (auto it : wantParams_.GetParams()) {
+        auto params = wantParams_.GetParams();
+        for (auto it : params) {
             int typeId = WantParams::GetDataType(it.second);
             result = result + "\"" + it.first + "\":{\"" + std::to_string(typeId) + "\":";
             if (IWantParams::Query(it.second) != nullptr) {
@@ -50,7 +51,7 @@ std::string WantParamWrapper::ToString()
             } else {
                 result = result + "\"" + WantParams::GetStringByType(it.second, typeId) + "\"";
             }
-            if (it == *wantParams_.GetParams().rbegin()) {
+            if (it == *params.rbegin()) {
                 result += "}";
             } else {
                 result += "},";
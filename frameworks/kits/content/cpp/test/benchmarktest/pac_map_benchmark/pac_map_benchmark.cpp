@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ohos/aafwk/content/pac_map.h"
+
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+constexpr int64_t KILOBYTE = 1024;
+constexpr int KEY_TYPES = 4;
+constexpr size_t ARRAY_SIZE = 16;
+constexpr size_t STRING_SIZE = 64;
+
+/**
+ * Fills the map with a mix of scalars, strings and arrays until the raw payload reaches about
+ * targetKb kilobytes.
+ */
+void FillPacMap(PacMap &pacMap, int64_t targetKb)
+{
+    const size_t target = static_cast<size_t>(targetKb * KILOBYTE);
+    const std::string text(STRING_SIZE, 'x');
+    const std::vector<int> ints(ARRAY_SIZE, 1);
+    const std::vector<double> doubles(ARRAY_SIZE, 3.1415926);
+    size_t payload = 0;
+    for (int i = 0; payload < target; i++) {
+        std::string key = "key_" + std::to_string(i);
+        payload += key.size();
+        switch (i % KEY_TYPES) {
+            case 0:
+                pacMap.PutStringValue(key, text);
+                payload += text.size();
+                break;
+            case 1:
+                pacMap.PutIntValueArray(key, ints);
+                payload += ints.size() * sizeof(int);
+                break;
+            case 2:
+                pacMap.PutDoubleValueArray(key, doubles);
+                payload += doubles.size() * sizeof(double);
+                break;
+            default:
+                pacMap.PutDoubleValue(key, i / 3.0);
+                payload += sizeof(double);
+                break;
+        }
+    }
+}
+
+void BenchmarkLegacyCopy(benchmark::State &state)
+{
+    PacMap pacMap;
+    FillPacMap(pacMap, state.range(0));
+    for (auto _ : state) {
+        // the copy constructor used to encode the source to JSON and parse it back
+        PacMap copy;
+        copy.FromString(pacMap.ToString());
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+void BenchmarkCopy(benchmark::State &state)
+{
+    PacMap pacMap;
+    FillPacMap(pacMap, state.range(0));
+    for (auto _ : state) {
+        PacMap copy(pacMap);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+void BenchmarkLegacyRoundTrip(benchmark::State &state)
+{
+    PacMap pacMap;
+    FillPacMap(pacMap, state.range(0));
+    size_t bytes = 0;
+    for (auto _ : state) {
+        Parcel parcel;
+        parcel.WriteString("PACMAP");
+        parcel.WriteString(pacMap.ToString());
+        bytes = parcel.GetDataSize();
+        std::unique_ptr<PacMap> result(PacMap::Unmarshalling(parcel));
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["bytes"] = bytes;
+}
+
+void BenchmarkRoundTrip(benchmark::State &state)
+{
+    PacMap pacMap;
+    FillPacMap(pacMap, state.range(0));
+    PacMap::SetBinaryMarshalling(true);
+    size_t bytes = 0;
+    for (auto _ : state) {
+        Parcel parcel;
+        pacMap.Marshalling(parcel);
+        bytes = parcel.GetDataSize();
+        std::unique_ptr<PacMap> result(PacMap::Unmarshalling(parcel));
+        benchmark::DoNotOptimize(result);
+    }
+    PacMap::SetBinaryMarshalling(false);
+    state.counters["bytes"] = bytes;
+}
+}  // namespace
+
+BENCHMARK(BenchmarkLegacyCopy)->Arg(1)->Arg(16)->Arg(256)->Arg(1024);
+BENCHMARK(BenchmarkCopy)->Arg(1)->Arg(16)->Arg(256)->Arg(1024);
+BENCHMARK(BenchmarkLegacyRoundTrip)->Arg(1)->Arg(16)->Arg(256)->Arg(1024);
+BENCHMARK(BenchmarkRoundTrip)->Arg(1)->Arg(16)->Arg(256)->Arg(1024);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "ohos/aafwk/content/patterns_matcher.h"
+#include "ohos/aafwk/content/skills.h"
+
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+const std::string VIEW_ACTION = "ohos.want.action.viewData";
+constexpr int ACTIONS_PER_SKILLS = 8;
+constexpr int ENTITIES_PER_SKILLS = 4;
+constexpr int TYPES_PER_SKILLS = 4;
+
+std::vector<Skills> MakeSkillsList(int64_t count)
+{
+    std::vector<Skills> skillsList(count);
+    for (int64_t i = 0; i < count; i++) {
+        // every skills handles the common view action, so matching has to look at the data of each one
+        Skills &skills = skillsList[i];
+        skills.AddAction(VIEW_ACTION);
+        for (int j = 0; j < ACTIONS_PER_SKILLS; j++) {
+            skills.AddAction("action.system." + std::to_string((i + j) % count));
+        }
+        for (int j = 0; j < ENTITIES_PER_SKILLS; j++) {
+            skills.AddEntity("entity.system." + std::to_string(j));
+        }
+        for (int j = 0; j < TYPES_PER_SKILLS; j++) {
+            skills.AddType("type" + std::to_string(j) + "/subtype" + std::to_string(i));
+        }
+        skills.AddScheme("https");
+        skills.AddAuthority("www.example" + std::to_string(i) + ".com");
+        skills.AddPath("/index");
+    }
+    return skillsList;
+}
+
+Want MakeWant(int64_t count)
+{
+    Want want;
+    want.SetAction(VIEW_ACTION);
+    want.AddEntity("entity.system.0");
+    want.SetUri("https://www.example" + std::to_string(count / 2) + ".com/index");
+    want.SetType("type0/subtype" + std::to_string(count / 2));
+    return want;
+}
+
+void BenchmarkMatchEach(benchmark::State &state)
+{
+    std::vector<Skills> skillsList = MakeSkillsList(state.range(0));
+    Want want = MakeWant(state.range(0));
+    for (auto _ : state) {
+        size_t matched = 0;
+        for (const auto &skills : skillsList) {
+            matched += skills.Match(want) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(matched);
+    }
+}
+
+void BenchmarkMatchAll(benchmark::State &state)
+{
+    std::vector<Skills> skillsList = MakeSkillsList(state.range(0));
+    Want want = MakeWant(state.range(0));
+    for (auto _ : state) {
+        std::vector<size_t> matched = Skills::MatchAll(want, skillsList);
+        benchmark::DoNotOptimize(matched);
+    }
+}
+
+void BenchmarkRegexMatchPattern(benchmark::State &state)
+{
+    for (auto _ : state) {
+        bool matched = PatternsMatcher::MatchPattern("/user/[0-9]+/profile", "/user/12345/profile",
+            MatchType::PATTERN);
+        benchmark::DoNotOptimize(matched);
+    }
+}
+
+void BenchmarkRegexMatcher(benchmark::State &state)
+{
+    PatternsMatcher matcher("/user/[0-9]+/profile", MatchType::PATTERN);
+    for (auto _ : state) {
+        bool matched = matcher.match("/user/12345/profile");
+        benchmark::DoNotOptimize(matched);
+    }
+}
+}  // namespace
+
+BENCHMARK(BenchmarkMatchEach)->Arg(100)->Arg(1000)->Arg(5000);
+BENCHMARK(BenchmarkMatchAll)->Arg(100)->Arg(1000)->Arg(5000);
+BENCHMARK(BenchmarkRegexMatchPattern);
+BENCHMARK(BenchmarkRegexMatcher);
+
+BENCHMARK_MAIN();
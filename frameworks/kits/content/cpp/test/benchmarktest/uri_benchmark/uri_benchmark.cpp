@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "uri.h"
+
+using namespace OHOS;
+
+namespace {
+const std::vector<std::string> URI_STRINGS = {
+    "dataability:///com.ohos.contactsdataability/contacts/raw_contact?id=1",
+    "dataability:///com.ohos.medialibrary.MediaLibraryDataAbility/file/12#thumbnail",
+    "content://com.example.provider/table/12",
+    "content://user@com.example.provider:8080/table/12/column?sort=asc",
+};
+
+void BenchmarkUriParse(benchmark::State &state)
+{
+    for (auto _ : state) {
+        for (const auto &uriString : URI_STRINGS) {
+            Uri uri(uriString);
+            benchmark::DoNotOptimize(uri);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * URI_STRINGS.size());
+}
+
+void BenchmarkUriGetParts(benchmark::State &state)
+{
+    // what a data ability request reads from its uri, every part once
+    std::vector<Uri> uris(URI_STRINGS.begin(), URI_STRINGS.end());
+    for (auto _ : state) {
+        for (const auto &uri : uris) {
+            benchmark::DoNotOptimize(uri.GetScheme());
+            benchmark::DoNotOptimize(uri.GetAuthority());
+            benchmark::DoNotOptimize(uri.GetPath());
+            benchmark::DoNotOptimize(uri.GetQuery());
+            benchmark::DoNotOptimize(uri.GetFragment());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * uris.size());
+}
+
+void BenchmarkUriGetPartViews(benchmark::State &state)
+{
+    std::vector<Uri> uris(URI_STRINGS.begin(), URI_STRINGS.end());
+    for (auto _ : state) {
+        for (const auto &uri : uris) {
+            benchmark::DoNotOptimize(uri.GetSchemeView());
+            benchmark::DoNotOptimize(uri.GetAuthorityView());
+            benchmark::DoNotOptimize(uri.GetPathView());
+            benchmark::DoNotOptimize(uri.GetQueryView());
+            benchmark::DoNotOptimize(uri.GetFragmentView());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * uris.size());
+}
+
+void BenchmarkUriPathSegments(benchmark::State &state)
+{
+    std::vector<Uri> uris(URI_STRINGS.begin(), URI_STRINGS.end());
+    for (auto _ : state) {
+        for (const auto &uri : uris) {
+            std::vector<std::string_view> segments;
+            uri.GetPathSegments(segments);
+            benchmark::DoNotOptimize(segments);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * uris.size());
+}
+
+void BenchmarkUriMapFind(benchmark::State &state)
+{
+    // like the observer map of the data observer service, keyed by uri
+    std::unordered_map<Uri, int> uriMap;
+    for (int64_t i = 0; i < state.range(0); i++) {
+        uriMap.emplace(Uri("dataability:///com.example.data/table/" + std::to_string(i)), i);
+    }
+    Uri uri("dataability:///com.example.data/table/" + std::to_string(state.range(0) / 2));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(uriMap.find(uri));
+    }
+}
+}  // namespace
+
+BENCHMARK(BenchmarkUriParse);
+BENCHMARK(BenchmarkUriGetParts);
+BENCHMARK(BenchmarkUriGetPartViews);
+BENCHMARK(BenchmarkUriPathSegments);
+BENCHMARK(BenchmarkUriMapFind)->Arg(16)->Arg(256);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+
+#include "ohos/aafwk/content/want.h"
+
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+void FillWant(Want &want, int64_t paramCount)
+{
+    want.SetElementName("", "com.example.benchmark", "MainAbility", "entry");
+    want.SetAction("action.system.home");
+    want.AddEntity("entity.system.home");
+    want.SetUri("dataability:///com.example.benchmark.data/person/10");
+    want.SetFlags(Want::FLAG_AUTH_READ_URI_PERMISSION);
+    for (int64_t i = 0; i < paramCount; i++) {
+        std::string key = "key_" + std::to_string(i);
+        if (i % 2 == 0) {
+            want.SetParam(key, "value_" + std::to_string(i));
+        } else {
+            want.SetParam(key, static_cast<int>(i));
+        }
+    }
+}
+
+void BenchmarkRoundTrip(benchmark::State &state, bool compact)
+{
+    Want::SetCompactMarshalling(compact);
+    Want want;
+    FillWant(want, state.range(0));
+    size_t bytes = 0;
+    for (auto _ : state) {
+        Parcel parcel;
+        want.Marshalling(parcel);
+        bytes = parcel.GetDataSize();
+        std::unique_ptr<Want> result(Want::Unmarshalling(parcel));
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["bytes"] = bytes;
+    Want::SetCompactMarshalling(false);
+}
+
+void BenchmarkLegacyRoundTrip(benchmark::State &state)
+{
+    BenchmarkRoundTrip(state, false);
+}
+
+void BenchmarkCompactRoundTrip(benchmark::State &state)
+{
+    BenchmarkRoundTrip(state, true);
+}
+}  // namespace
+
+BENCHMARK(BenchmarkLegacyRoundTrip)->Arg(0)->Arg(10)->Arg(100);
+BENCHMARK(BenchmarkCompactRoundTrip)->Arg(0)->Arg(10)->Arg(100);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ohos/aafwk/base/bool_wrapper.h"
+#include "ohos/aafwk/base/int_wrapper.h"
+#include "ohos/aafwk/base/string_wrapper.h"
+#include "ohos/aafwk/content/want_params.h"
+
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+constexpr int KEY_TYPES = 3;
+
+void FillParams(WantParams &params, int64_t count)
+{
+    for (int64_t i = 0; i < count; i++) {
+        std::string key = "key_" + std::to_string(i);
+        switch (i % KEY_TYPES) {
+            case 0:
+                params.SetParam(key, String::Box("value_" + std::to_string(i)));
+                break;
+            case 1:
+                params.SetParam(key, Integer::Box(static_cast<int>(i)));
+                break;
+            default:
+                params.SetParam(key, Boolean::Box(i % 2 == 0));
+                break;
+        }
+    }
+}
+
+/**
+ * Reference copy matching the previous storage: a map of boxed values in which every entry is
+ * queried and re-boxed.
+ */
+std::map<std::string, sptr<IInterface>> LegacyDeepCopy(const std::map<std::string, sptr<IInterface>> &source)
+{
+    std::map<std::string, sptr<IInterface>> dest;
+    for (auto it = source.begin(); it != source.end(); it++) {
+        sptr<IInterface> o = it->second;
+        if (IString::Query(o) != nullptr) {
+            dest[it->first] = String::Box(String::Unbox(IString::Query(o)));
+        } else if (IBoolean::Query(o) != nullptr) {
+            dest[it->first] = Boolean::Box(Boolean::Unbox(IBoolean::Query(o)));
+        } else if (IInteger::Query(o) != nullptr) {
+            dest[it->first] = Integer::Box(Integer::Unbox(IInteger::Query(o)));
+        }
+    }
+    return dest;
+}
+
+void BenchmarkLegacyCopy(benchmark::State &state)
+{
+    WantParams params;
+    FillParams(params, state.range(0));
+    std::map<std::string, sptr<IInterface>> source = params.GetParams();
+    for (auto _ : state) {
+        auto copy = LegacyDeepCopy(source);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+void BenchmarkCopy(benchmark::State &state)
+{
+    WantParams params;
+    FillParams(params, state.range(0));
+    for (auto _ : state) {
+        WantParams copy(params);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+void BenchmarkCopyThenModify(benchmark::State &state)
+{
+    WantParams params;
+    FillParams(params, state.range(0));
+    sptr<IInterface> value = String::Box("modified");
+    for (auto _ : state) {
+        WantParams copy(params);
+        copy.SetParam("key_0", value);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+void BenchmarkLegacyLookup(benchmark::State &state)
+{
+    WantParams params;
+    FillParams(params, state.range(0));
+    std::map<std::string, sptr<IInterface>> source = params.GetParams();
+    std::string key = "key_" + std::to_string(state.range(0) / 2);
+    for (auto _ : state) {
+        auto it = source.find(key);
+        benchmark::DoNotOptimize(it);
+    }
+}
+
+void BenchmarkLookup(benchmark::State &state)
+{
+    WantParams params;
+    FillParams(params, state.range(0));
+    std::string key = "key_" + std::to_string(state.range(0) / 2);
+    for (auto _ : state) {
+        sptr<IInterface> value = params.GetParam(key);
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+void BenchmarkMarshalling(benchmark::State &state)
+{
+    WantParams params;
+    FillParams(params, state.range(0));
+    for (auto _ : state) {
+        Parcel parcel;
+        params.Marshalling(parcel);
+        benchmark::DoNotOptimize(parcel);
+    }
+}
+
+void BenchmarkUnmarshalling(benchmark::State &state)
+{
+    WantParams params;
+    FillParams(params, state.range(0));
+    Parcel parcel;
+    params.Marshalling(parcel);
+    for (auto _ : state) {
+        parcel.RewindRead(0);
+        std::unique_ptr<WantParams> result(WantParams::Unmarshalling(parcel));
+        benchmark::DoNotOptimize(result);
+    }
+}
+}  // namespace
+
+BENCHMARK(BenchmarkLegacyCopy)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BenchmarkCopy)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BenchmarkCopyThenModify)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BenchmarkLegacyLookup)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BenchmarkLookup)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BenchmarkMarshalling)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BenchmarkUnmarshalling)->Arg(10)->Arg(100)->Arg(1000);
+
+BENCHMARK_MAIN();
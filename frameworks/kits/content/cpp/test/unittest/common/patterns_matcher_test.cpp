@@ -150,6 +150,9 @@ HWTEST_F(PatternsMatcherBaseTest, AaFwk_PatternsMatcher_Match_0300, Function | M
         EXPECT_EQ(PatternsMatcherIn_->match("abcccccdefgG"), true);
         EXPECT_EQ(PatternsMatcherIn_->match("abcdefg"), false);
         EXPECT_EQ(PatternsMatcherIn_->match("ABCDEFG"), false);
+        PatternsMatcher copy(*PatternsMatcherIn_);
+        EXPECT_EQ(copy.match("abcccccdefgG"), true);
+        EXPECT_EQ(copy.match("abcdefg"), false);
     }
 }
 
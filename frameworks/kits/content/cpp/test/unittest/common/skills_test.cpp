@@ -756,6 +756,61 @@ INSTANTIATE_TEST_CASE_P(SkillsMatchTestP, SkillsMatchTest,
         SkillsMatchType("entity.system.entityA", "action.system.action2", false),
         SkillsMatchType("entity.system.entity1", "action.system.action1", true)));
 
+/**
+ * @tc.number: AaFwk_Skills_match_0200
+ * @tc.name: Match/MatchAll
+ * @tc.desc: Verify MatchAll() agrees with Match() and that changes after a match are seen.
+ */
+HWTEST_F(SkillsBaseTest, AaFwk_Skills_match_0200, Function | MediumTest | Level1)
+{
+    std::vector<Skills> skillsList(SET_COUNT);
+    for (size_t i = 0; i < skillsList.size(); i++) {
+        skillsList[i].AddEntity("entity.system.entity1");
+        skillsList[i].AddAction("action.system.action" + std::to_string(i % 2));
+    }
+
+    Want want;
+    want.AddEntity("entity.system.entity1");
+    want.SetAction("action.system.action1");
+    std::vector<size_t> result = Skills::MatchAll(want, skillsList);
+    EXPECT_EQ(static_cast<size_t>(SET_COUNT / 2), result.size());
+    for (size_t index : result) {
+        EXPECT_EQ(true, skillsList[index].Match(want));
+    }
+
+    skillsList[0].AddAction("action.system.action1");
+    EXPECT_EQ(true, skillsList[0].Match(want));
+    skillsList[0].RemoveEntity("entity.system.entity1");
+    EXPECT_EQ(false, skillsList[0].Match(want));
+}
+
+/**
+ * @tc.number: AaFwk_Skills_match_0300
+ * @tc.name: Match
+ * @tc.desc: Verify type matching with partial and wildcard types.
+ */
+HWTEST_F(SkillsBaseTest, AaFwk_Skills_match_0300, Function | MediumTest | Level1)
+{
+    base_->AddEntity("entity.system.entity1");
+    base_->AddAction("action.system.action1");
+    base_->AddType("image/*");
+    base_->AddType("text/plain");
+
+    Want want;
+    want.AddEntity("entity.system.entity1");
+    want.SetAction("action.system.action1");
+    want.SetType("image/png");
+    EXPECT_EQ(true, base_->Match(want));
+    want.SetType("text/*");
+    EXPECT_EQ(true, base_->Match(want));
+    want.SetType("*/*");
+    EXPECT_EQ(true, base_->Match(want));
+    want.SetType("audio/mpeg");
+    EXPECT_EQ(false, base_->Match(want));
+    want.SetType("audio/*");
+    EXPECT_EQ(false, base_->Match(want));
+}
+
 /**
  * @tc.number: AaFwk_Skills_Skills_0100
  * @tc.name: Skills() and Skills(Skills)
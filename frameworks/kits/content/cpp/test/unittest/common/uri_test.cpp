@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <unordered_map>
+
+#include "uri.h"
+
+using namespace testing::ext;
+using OHOS::Parcel;
+
+namespace OHOS {
+class UriTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void UriTest::SetUpTestCase(void)
+{}
+
+void UriTest::TearDownTestCase(void)
+{}
+
+void UriTest::SetUp(void)
+{}
+
+void UriTest::TearDown(void)
+{}
+
+/**
+ * @tc.number: AaFwk_Uri_Parse_0100
+ * @tc.name: GetScheme/GetAuthority/GetUserInfo/GetHost/GetPort/GetPath/GetQuery/GetFragment
+ * @tc.desc: parse a full hierarchical uri, and then check every part.
+ */
+HWTEST_F(UriTest, AaFwk_Uri_Parse_0100, Function | MediumTest | Level1)
+{
+    Uri uri("http://user:pw@host:80/a//b/c?x=1&y=2#top");
+    EXPECT_EQ("http", uri.GetScheme());
+    EXPECT_EQ("//user:pw@host:80/a//b/c?x=1&y=2", uri.GetSchemeSpecificPart());
+    EXPECT_EQ("user:pw@host:80", uri.GetAuthority());
+    EXPECT_EQ("user:pw", uri.GetUserInfo());
+    EXPECT_EQ("host", uri.GetHost());
+    EXPECT_EQ(80, uri.GetPort());
+    EXPECT_EQ("/a//b/c", uri.GetPath());
+    EXPECT_EQ("x=1&y=2", uri.GetQuery());
+    EXPECT_EQ("top", uri.GetFragment());
+    EXPECT_TRUE(uri.IsHierarchical());
+    EXPECT_TRUE(uri.IsAbsolute());
+    EXPECT_FALSE(uri.IsOpaque());
+    EXPECT_FALSE(uri.IsRelative());
+
+    std::vector<std::string> segments;
+    uri.GetPathSegments(segments);
+    ASSERT_EQ(3U, segments.size());
+    EXPECT_EQ("a", segments[0]);
+    EXPECT_EQ("b", segments[1]);
+    EXPECT_EQ("c", segments[2]);
+}
+
+/**
+ * @tc.number: AaFwk_Uri_Parse_0200
+ * @tc.name: GetPath/GetQuery/GetFragment
+ * @tc.desc: parse opaque, relative and malformed uris, and then check the parts.
+ */
+HWTEST_F(UriTest, AaFwk_Uri_Parse_0200, Function | MediumTest | Level1)
+{
+    Uri opaque("mailto:someone@example.com?subject=hi#f");
+    EXPECT_TRUE(opaque.IsOpaque());
+    EXPECT_EQ("", opaque.GetPath());
+    EXPECT_EQ("", opaque.GetAuthority());
+    EXPECT_EQ("subject=hi", opaque.GetQuery());
+    EXPECT_EQ("f", opaque.GetFragment());
+
+    // a relative uri has no fragment
+    Uri relative("rel/path?q#f");
+    EXPECT_TRUE(relative.IsRelative());
+    EXPECT_EQ("rel/path", relative.GetPath());
+    EXPECT_EQ("q#f", relative.GetQuery());
+    EXPECT_EQ("", relative.GetFragment());
+
+    Uri badPort("http://host:abc/p");
+    EXPECT_EQ("host", badPort.GetHost());
+    EXPECT_EQ(-1, badPort.GetPort());
+
+    Uri fragmentFirst("a://h/p#f?q");
+    EXPECT_EQ("/p", fragmentFirst.GetPath());
+    EXPECT_EQ("", fragmentFirst.GetQuery());
+    EXPECT_EQ("f?q", fragmentFirst.GetFragment());
+
+    Uri empty("");
+    EXPECT_EQ("", empty.GetScheme());
+    EXPECT_EQ(-1, empty.GetPort());
+    EXPECT_FALSE(empty.IsHierarchical());
+    EXPECT_FALSE(empty.IsRelative());
+}
+
+/**
+ * @tc.number: AaFwk_Uri_Scheme_0100
+ * @tc.name: Uri
+ * @tc.desc: construct uris with valid and invalid schemes, and then check the invalid ones are emptied.
+ */
+HWTEST_F(UriTest, AaFwk_Uri_Scheme_0100, Function | MediumTest | Level1)
+{
+    EXPECT_EQ("a-b.c+d", Uri("a-b.c+d://h/p").GetScheme());
+    EXPECT_EQ("", Uri("a|b://h/p").ToString());
+    EXPECT_EQ("", Uri("1a://h/p").ToString());
+    EXPECT_EQ("", Uri("a/b:c").ToString());
+}
+
+/**
+ * @tc.number: AaFwk_Uri_View_0100
+ * @tc.name: GetSchemeView/GetAuthorityView/GetPathView/GetPathSegments
+ * @tc.desc: read the parts as views, and then check they point into the uri string.
+ */
+HWTEST_F(UriTest, AaFwk_Uri_View_0100, Function | MediumTest | Level1)
+{
+    Uri uri("dataability:///com.ohos.contactsdataability/contacts/raw_contact?id=1");
+    const std::string &uriString = uri.ToString();
+    EXPECT_EQ("dataability", uri.GetSchemeView());
+    EXPECT_EQ("", uri.GetAuthorityView());
+    EXPECT_EQ("/com.ohos.contactsdataability/contacts/raw_contact", uri.GetPathView());
+    EXPECT_EQ("id=1", uri.GetQueryView());
+    EXPECT_EQ(uriString.data(), uri.GetSchemeView().data());
+
+    std::vector<std::string_view> segments;
+    uri.GetPathSegments(segments);
+    ASSERT_EQ(3U, segments.size());
+    EXPECT_EQ("com.ohos.contactsdataability", segments[0]);
+    EXPECT_EQ("raw_contact", segments[2]);
+    EXPECT_GE(segments[0].data(), uriString.data());
+    EXPECT_LT(segments[0].data(), uriString.data() + uriString.size());
+}
+
+/**
+ * @tc.number: AaFwk_Uri_Hash_0100
+ * @tc.name: Hash/operator==
+ * @tc.desc: use uris as keys of an unordered map, and then check equal uris find each other.
+ */
+HWTEST_F(UriTest, AaFwk_Uri_Hash_0100, Function | MediumTest | Level1)
+{
+    Uri first("content://com.example.provider/table/12");
+    Uri same("content://com.example.provider/table/12");
+    Uri other("content://com.example.provider/table/13");
+    EXPECT_EQ(first.Hash(), same.Hash());
+    EXPECT_TRUE(first == same);
+    EXPECT_TRUE(first.Equals(same));
+    EXPECT_FALSE(first == other);
+    EXPECT_LT(first.CompareTo(other), 0);
+
+    std::unordered_map<Uri, int> uriMap;
+    uriMap.emplace(first, 1);
+    uriMap.emplace(other, 2);
+    EXPECT_EQ(1U, uriMap.count(same));
+    EXPECT_EQ(2, uriMap.at(other));
+}
+
+/**
+ * @tc.number: AaFwk_Uri_Parcelable_0100
+ * @tc.name: Marshalling/Unmarshalling
+ * @tc.desc: marshalling Uri, and then check the unmarshalled one is parsed again.
+ */
+HWTEST_F(UriTest, AaFwk_Uri_Parcelable_0100, Function | MediumTest | Level1)
+{
+    Uri uri("content://com.example.provider/table/12?x=1");
+    Parcel parcel;
+    ASSERT_TRUE(uri.Marshalling(parcel));
+    std::unique_ptr<Uri> uriOut(Uri::Unmarshalling(parcel));
+    ASSERT_NE(nullptr, uriOut);
+    EXPECT_TRUE(uri == *uriOut);
+    EXPECT_EQ("/table/12", uriOut->GetPathView());
+}
+}  // namespace OHOS
@@ -20,6 +20,7 @@
 #include "ohos/aafwk/base/int_wrapper.h"
 #include "ohos/aafwk/base/long_wrapper.h"
 
+#include "ohos/aafwk/content/array_wrapper.h"
 #include "ohos/aafwk/content/want_params.h"
 
 using namespace testing::ext;
@@ -138,5 +139,89 @@ HWTEST_F(WantParamsBaseTest, AaFwk_WantParams_Parcelable_0400, Function | Medium
     std::string outString(String::Unbox(IString::Query(wantParamsOut_->GetParam(keyStr))));
     EXPECT_STREQ(std::to_string(valueLong).c_str(), outString.c_str());
 }
+/**
+ * @tc.number: AaFwk_WantParams_Copy_0100
+ * @tc.name: WantParams(const WantParams &)/SetParam
+ * @tc.desc: modify a copy of WantParams, and then check the source is unchanged.
+ */
+HWTEST_F(WantParamsBaseTest, AaFwk_WantParams_Copy_0100, Function | MediumTest | Level1)
+{
+    std::string keyStr = "12345667";
+    std::string valueStr = "sdasdfdsffdgfdg";
+    wantParamsIn_->SetParam(keyStr, String::Box(valueStr));
+
+    WantParams copy(*wantParamsIn_);
+    EXPECT_EQ(valueStr, String::Unbox(IString::Query(copy.GetParam(keyStr))));
+
+    copy.SetParam(keyStr, Integer::Box(1));
+    copy.SetParam("newKey", Boolean::Box(true));
+    EXPECT_EQ(valueStr, String::Unbox(IString::Query(wantParamsIn_->GetParam(keyStr))));
+    EXPECT_FALSE(wantParamsIn_->HasParam("newKey"));
+    EXPECT_EQ(1, Integer::Unbox(IInteger::Query(copy.GetParam(keyStr))));
+    EXPECT_EQ(2, copy.Size());
+}
+
+/**
+ * @tc.number: AaFwk_WantParams_Copy_0200
+ * @tc.name: operator=/Remove/GetParams
+ * @tc.desc: remove a key from an assigned WantParams, and then check both views.
+ */
+HWTEST_F(WantParamsBaseTest, AaFwk_WantParams_Copy_0200, Function | MediumTest | Level1)
+{
+    wantParamsIn_->SetParam("b", Integer::Box(2));
+    wantParamsIn_->SetParam("a", Integer::Box(1));
+    wantParamsIn_->SetParam("c", Integer::Box(3));
+    EXPECT_EQ(3, static_cast<int>(wantParamsIn_->GetParams().size()));
+    EXPECT_EQ("a", wantParamsIn_->GetParams().begin()->first);
+
+    WantParams copy;
+    copy = *wantParamsIn_;
+    copy.Remove("b");
+    EXPECT_EQ(2, static_cast<int>(copy.GetParams().size()));
+    EXPECT_EQ(3, static_cast<int>(wantParamsIn_->GetParams().size()));
+    EXPECT_TRUE(wantParamsIn_->HasParam("b"));
+    EXPECT_EQ(2, static_cast<int>(copy.KeySet().size()));
+}
+
+/**
+ * @tc.number: AaFwk_WantParams_Copy_0300
+ * @tc.name: WantParams(const WantParams &)/GetParam
+ * @tc.desc: change an array through a copy of WantParams, and then check the source array is unchanged.
+ */
+HWTEST_F(WantParamsBaseTest, AaFwk_WantParams_Copy_0300, Function | MediumTest | Level1)
+{
+    sptr<IArray> ao = new Array(1, g_IID_IInteger);
+    ao->Set(0, Integer::Box(1));
+    wantParamsIn_->SetParam("array", ao);
+
+    WantParams copy(*wantParamsIn_);
+    IArray *copyArray = IArray::Query(copy.GetParam("array"));
+    ASSERT_NE(nullptr, copyArray);
+    EXPECT_NE(ao.GetRefPtr(), copyArray);
+    copyArray->Set(0, Integer::Box(2));
+
+    sptr<IInterface> value;
+    ao->Get(0, value);
+    EXPECT_EQ(1, Integer::Unbox(IInteger::Query(value)));
+}
+
+/**
+ * @tc.number: AaFwk_WantParams_Copy_0400
+ * @tc.name: WantParams(const WantParams &)/GetParams
+ * @tc.desc: modify a WantParams whose copy is gone, and then check a map got before is unchanged.
+ */
+HWTEST_F(WantParamsBaseTest, AaFwk_WantParams_Copy_0400, Function | MediumTest | Level1)
+{
+    wantParamsIn_->SetParam("a", Integer::Box(1));
+    auto params = wantParamsIn_->GetParams();
+    {
+        WantParams copy(*wantParamsIn_);
+    }
+    wantParamsIn_->SetParam("b", Integer::Box(2));
+    wantParamsIn_->Remove("a");
+    ASSERT_EQ(1U, params.size());
+    EXPECT_EQ(1, Integer::Unbox(IInteger::Query(params["a"])));
+    EXPECT_EQ(1, wantParamsIn_->Size());
+}
 }
 }
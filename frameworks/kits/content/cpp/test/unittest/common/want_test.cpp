@@ -565,6 +565,89 @@ HWTEST_F(WantBaseTest, AaFwk_Want_Parcelable_0500, Function | MediumTest | Level
     }
 }
 
+/**
+ * @tc.number: AaFwk_Want_Parcelable_0900
+ * @tc.name: Marshalling/Unmarshalling
+ * @tc.desc: marshalling Want in the compact format, and then check result.
+ */
+HWTEST_F(WantBaseTest, AaFwk_Want_Parcelable_0900, Function | MediumTest | Level1)
+{
+    std::shared_ptr<Want> wantIn = std::make_shared<Want>();
+    wantIn->SetAction("system.test.action");
+    wantIn->SetFlags(64);
+    wantIn->AddEntity("system.test.entity");
+    wantIn->SetUri("dataability:///system.test.data/person/10");
+    wantIn->SetElementName("system.test.deviceid", "system.test.bundlename", "system.test.abilityname",
+        "system.test.modulename");
+    wantIn->SetParam("string_key", std::string("\u4e2d\u6587 value"));
+    wantIn->SetParam("int_key", 10);
+    std::vector<std::string> stringArrayValue = {"stringtest1", "string@test2"};
+    wantIn->SetParam("string_arraykey", stringArrayValue);
+
+    Want::SetCompactMarshalling(true);
+    Parcel in;
+    EXPECT_TRUE(wantIn->Marshalling(in));
+    Want::SetCompactMarshalling(false);
+    std::shared_ptr<Want> wantOut(Want::Unmarshalling(in));
+    ASSERT_NE(wantOut, nullptr);
+    CompareWant(wantIn, wantOut);
+    EXPECT_EQ(in.GetReadPosition(), in.GetDataSize());
+    EXPECT_EQ(wantOut->GetUriString(), wantIn->GetUriString());
+    EXPECT_EQ(wantOut->GetElement(), wantIn->GetElement());
+    EXPECT_EQ(wantOut->GetStringParam("string_key"), std::string("\u4e2d\u6587 value"));
+    EXPECT_EQ(wantOut->GetIntParam("int_key", 0), 10);
+    EXPECT_EQ(wantOut->GetStringArrayParam("string_arraykey"), stringArrayValue);
+}
+
+/**
+ * @tc.number: AaFwk_Want_Parcelable_1000
+ * @tc.name: Marshalling/Unmarshalling
+ * @tc.desc: marshalling Want with unsupported params in the compact format, and then check result.
+ */
+HWTEST_F(WantBaseTest, AaFwk_Want_Parcelable_1000, Function | MediumTest | Level1)
+{
+    // a parcelable param from a Java peer, kept as it came
+    const int32_t stringType = 9;
+    const int32_t parcelableType = 21;
+    const uint8_t buffer[] = {1, 2, 3, 4, 5, 6, 7, 8};
+    Parcel paramsParcel;
+    paramsParcel.WriteInt32(2);
+    paramsParcel.WriteString16(u"string_key");
+    paramsParcel.WriteInt32(stringType);
+    paramsParcel.WriteString16(u"value");
+    paramsParcel.WriteString16(u"parcelable_key");
+    paramsParcel.WriteInt32(parcelableType);
+    paramsParcel.WriteInt32(sizeof(buffer));
+    paramsParcel.WriteInt32(sizeof(buffer));
+    paramsParcel.WriteBuffer(buffer, sizeof(buffer));
+    Parcel wrapped;
+    wrapped.WriteInt32(paramsParcel.GetDataSize());
+    wrapped.WriteInt32(paramsParcel.GetDataSize());
+    wrapped.WriteBuffer(reinterpret_cast<const void *>(paramsParcel.GetData()), paramsParcel.GetDataSize());
+    std::shared_ptr<WantParams> params(WantParams::Unmarshalling(wrapped));
+    ASSERT_NE(params, nullptr);
+
+    std::shared_ptr<Want> wantIn = std::make_shared<Want>();
+    wantIn->SetAction("system.test.action");
+    wantIn->SetParams(*params);
+    Want::SetCompactMarshalling(true);
+    Parcel in;
+    EXPECT_TRUE(wantIn->Marshalling(in));
+    Want::SetCompactMarshalling(false);
+    std::shared_ptr<Want> wantOut(Want::Unmarshalling(in));
+    ASSERT_NE(wantOut, nullptr);
+    EXPECT_EQ(in.GetReadPosition(), in.GetDataSize());
+    EXPECT_EQ(wantOut->GetAction(), wantIn->GetAction());
+    EXPECT_EQ(wantOut->GetStringParam("string_key"), "value");
+
+    // marshalled in the legacy format again, the unsupported param is the one that came in
+    Parcel out;
+    EXPECT_TRUE(wantOut->GetParams().Marshalling(out));
+    ASSERT_EQ(out.GetDataSize(), wrapped.GetDataSize());
+    EXPECT_EQ(0, memcmp(reinterpret_cast<const void *>(out.GetData()),
+        reinterpret_cast<const void *>(wrapped.GetData()), out.GetDataSize()));
+}
+
 void WantBaseTest::CompareWant(const std::shared_ptr<Want> &want1, const std::shared_ptr<Want> &want2) const
 {
     Operation opt1 = want1->GetOperation();
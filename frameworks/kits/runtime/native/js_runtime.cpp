@@ -28,6 +28,7 @@
 #include "event_handler.h"
 #include "hilog_wrapper.h"
 #include "js_runtime_utils.h"
+#include "js_timer_queue.h"
 
 #ifdef ENABLE_HITRACE
 #include "hitrace/trace.h"
@@ -384,6 +385,7 @@ bool JsRuntime::Initialize(const Options& options)
             "idleTask");
     });
     nativeEngine_->CheckUVLoop();
+    timerQueue_ = std::make_shared<JsTimerQueue>(eventHandler_);
 
     HandleScope handleScope(*this);
 
@@ -434,6 +436,10 @@ void JsRuntime::Deinitialize()
     }
 
     methodRequireNapiRef_.reset();
+    if (timerQueue_ != nullptr) {
+        // the timers hold references to js values, release them while the engine is alive
+        timerQueue_->Clear();
+    }
     nativeEngine_->CancelCheckUVLoop();
     RemoveTask("idleTask");
     nativeEngine_.reset();
@@ -534,9 +540,8 @@ using OHOS::Ace::ContainerScope;
 #endif
 class TimerTask final {
 public:
-    TimerTask(
-        JsRuntime& jsRuntime, std::shared_ptr<NativeReference> jsFunction, const std::string &name, int64_t interval)
-        : jsRuntime_(jsRuntime), jsFunction_(jsFunction), name_(name), interval_(interval)
+    TimerTask(JsRuntime& jsRuntime, std::shared_ptr<NativeReference> jsFunction)
+        : jsRuntime_(jsRuntime), jsFunction_(jsFunction)
     {
 #ifdef SUPPORT_GRAPHICS
         containerScopeId_ = ContainerScope::CurrentId();
@@ -550,9 +555,6 @@ public:
 
     void operator()()
     {
-        if (interval_ > 0) {
-            jsRuntime_.PostTask(*this, name_, interval_);
-        }
 #ifdef SUPPORT_GRAPHICS
         // call js function
         ContainerScope containerScope(containerScopeId_);
@@ -588,8 +590,6 @@ private:
     JsRuntime& jsRuntime_;
     std::shared_ptr<NativeReference> jsFunction_;
     std::vector<std::shared_ptr<NativeReference>> jsArgs_;
-    std::string name_;
-    int64_t interval_ = 0;
 #ifdef SUPPORT_GRAPHICS
     int32_t containerScopeId_ = 0;
 #endif
@@ -598,11 +598,6 @@ private:
 #endif
 };
 
-void JsRuntime::PostTask(const TimerTask& task, const std::string& name, int64_t delayTime)
-{
-    eventHandler_->PostTask(task, name, delayTime);
-}
-
 void JsRuntime::RemoveTask(const std::string& name)
 {
     eventHandler_->RemoveTask(name);
@@ -619,17 +614,16 @@ NativeValue* JsRuntime::SetCallbackTimer(NativeEngine& engine, NativeCallbackInf
     // parse parameter
     std::shared_ptr<NativeReference> jsFunction(engine.CreateReference(info.argv[0], 1));
     int64_t delayTime = *ConvertNativeValueTo<NativeNumber>(info.argv[1]);
-    uint32_t callbackId = callbackId_++;
-    std::string name = "JsRuntimeTimer_";
-    name.append(std::to_string(callbackId));
 
     // create timer task
-    TimerTask task(*this, jsFunction, name, isInterval ? delayTime : 0);
+    TimerTask task(*this, jsFunction);
     for (size_t index = 2; index < info.argc; ++index) {
         task.PushArgs(std::shared_ptr<NativeReference>(engine.CreateReference(info.argv[index], 1)));
     }
 
-    JsRuntime::PostTask(task, name, delayTime);
+    // the timer queue runs it again after every interval, until it is cleared
+    uint32_t callbackId = timerQueue_->SetTimer(delayTime, isInterval ? delayTime : 0,
+        std::make_shared<TimerCallback>(task));
     return engine.CreateNumber(callbackId);
 }
 
@@ -642,11 +636,9 @@ NativeValue* JsRuntime::ClearCallbackTimer(NativeEngine& engine, NativeCallbackI
     }
 
     uint32_t callbackId = *ConvertNativeValueTo<NativeNumber>(info.argv[0]);
-    std::string name = "JsRuntimeTimer_";
-    name.append(std::to_string(callbackId));
 
     // event should be cancelable before executed
-    JsRuntime::RemoveTask(name);
+    timerQueue_->ClearTimer(callbackId);
     return engine.CreateUndefined();
 }
 
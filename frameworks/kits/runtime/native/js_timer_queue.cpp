@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "js_timer_queue.h"
+
+#include <chrono>
+
+#include "event_handler.h"
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace AbilityRuntime {
+namespace {
+constexpr size_t HEAP_ROOT = 0;
+}
+
+JsTimerQueue::JsTimerQueue(const std::shared_ptr<AppExecFwk::EventHandler>& eventHandler)
+    : eventHandler_(eventHandler)
+{}
+
+uint32_t JsTimerQueue::SetTimer(int64_t delayTime, int64_t interval, const std::shared_ptr<TimerCallback>& callback)
+{
+    // ids are given out in turn, skip those still in use once they wrap around
+    uint32_t timerId = nextTimerId_++;
+    while (timers_.find(timerId) != timers_.end()) {
+        timerId = nextTimerId_++;
+    }
+
+    Timer& timer = timers_[timerId];
+    timer.callback = callback;
+    timer.interval = interval;
+    timer.heapIndex = heap_.size();
+    heap_.push_back({ GetCurrentTime() + (delayTime > 0 ? delayTime : 0), nextSequence_++, timerId });
+    SiftUp(heap_.size() - 1);
+    PostWakeUp();
+    return timerId;
+}
+
+bool JsTimerQueue::ClearTimer(uint32_t timerId)
+{
+    auto it = timers_.find(timerId);
+    if (it == timers_.end()) {
+        return false;
+    }
+    // the wake-up posted for it stays, and only finds nothing due
+    RemoveNode(it->second.heapIndex);
+    timers_.erase(it);
+    return true;
+}
+
+void JsTimerQueue::RunDueTimers()
+{
+    // only the timers due when the wake-up starts run, those set meanwhile wait for the next one
+    int64_t now = GetCurrentTime();
+    uint64_t endSequence = nextSequence_;
+    while (!heap_.empty()) {
+        const HeapNode& node = heap_[HEAP_ROOT];
+        if (node.deadline > now || node.sequence >= endSequence) {
+            break;
+        }
+        uint32_t timerId = node.timerId;
+        Timer& timer = timers_[timerId];
+        // the callback may clear its own timer, keep it alive until it returns
+        std::shared_ptr<TimerCallback> callback = timer.callback;
+        if (timer.interval > 0) {
+            heap_[HEAP_ROOT].deadline = GetCurrentTime() + timer.interval;
+            heap_[HEAP_ROOT].sequence = nextSequence_++;
+            SiftDown(HEAP_ROOT);
+        } else {
+            RemoveNode(HEAP_ROOT);
+            timers_.erase(timerId);
+        }
+        if (callback != nullptr && *callback) {
+            (*callback)();
+        }
+    }
+    PostWakeUp();
+}
+
+void JsTimerQueue::Clear()
+{
+    heap_.clear();
+    timers_.clear();
+}
+
+int64_t JsTimerQueue::GetCurrentTime()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool JsTimerQueue::IsEarlier(const HeapNode& left, const HeapNode& right)
+{
+    if (left.deadline != right.deadline) {
+        return left.deadline < right.deadline;
+    }
+    return left.sequence < right.sequence;
+}
+
+void JsTimerQueue::OnWakeUp(int64_t wakeUpTime)
+{
+    if (wakeUpTime == wakeUpTime_) {
+        wakeUpTime_ = INT64_MAX;
+    }
+    RunDueTimers();
+}
+
+void JsTimerQueue::PostWakeUp()
+{
+    if (heap_.empty() || eventHandler_ == nullptr) {
+        return;
+    }
+    int64_t deadline = heap_[HEAP_ROOT].deadline;
+    if (deadline >= wakeUpTime_) {
+        // a wake-up no later is on the way
+        return;
+    }
+    int64_t now = GetCurrentTime();
+    int64_t delayTime = deadline > now ? deadline - now : 0;
+    std::weak_ptr<JsTimerQueue> weakQueue = shared_from_this();
+    auto wakeUp = [weakQueue, deadline]() {
+        auto queue = weakQueue.lock();
+        if (queue != nullptr) {
+            queue->OnWakeUp(deadline);
+        }
+    };
+    if (!eventHandler_->PostTask(wakeUp, delayTime)) {
+        HILOG_ERROR("Failed to post the wake-up of js timers");
+        return;
+    }
+    wakeUpTime_ = deadline;
+}
+
+void JsTimerQueue::SiftUp(size_t index)
+{
+    while (index > HEAP_ROOT) {
+        size_t parent = (index - 1) / 2;
+        if (!IsEarlier(heap_[index], heap_[parent])) {
+            break;
+        }
+        SwapNodes(index, parent);
+        index = parent;
+    }
+}
+
+void JsTimerQueue::SiftDown(size_t index)
+{
+    size_t size = heap_.size();
+    while (true) {
+        size_t earliest = index;
+        size_t left = index * 2 + 1;
+        size_t right = left + 1;
+        if (left < size && IsEarlier(heap_[left], heap_[earliest])) {
+            earliest = left;
+        }
+        if (right < size && IsEarlier(heap_[right], heap_[earliest])) {
+            earliest = right;
+        }
+        if (earliest == index) {
+            break;
+        }
+        SwapNodes(index, earliest);
+        index = earliest;
+    }
+}
+
+void JsTimerQueue::SwapNodes(size_t left, size_t right)
+{
+    std::swap(heap_[left], heap_[right]);
+    timers_[heap_[left].timerId].heapIndex = left;
+    timers_[heap_[right].timerId].heapIndex = right;
+}
+
+void JsTimerQueue::RemoveNode(size_t index)
+{
+    size_t last = heap_.size() - 1;
+    if (index != last) {
+        SwapNodes(index, last);
+    }
+    heap_.pop_back();
+    if (index < heap_.size()) {
+        SiftDown(index);
+        SiftUp(index);
+    }
+}
+}  // namespace AbilityRuntime
+}  // namespace OHOS
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <stdint.h>
+#include <vector>
+
+#include "event_handler.h"
+#include "event_runner.h"
+#include "js_timer_queue.h"
+
+using namespace OHOS::AbilityRuntime;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+const int64_t LONG_DELAY = 100000; // ms, never due within a run
+
+std::shared_ptr<JsTimerQueue> CreateTimerQueue()
+{
+    // the runner is not started, the benchmark runs the due timers by itself
+    return std::make_shared<JsTimerQueue>(std::make_shared<EventHandler>(EventRunner::Create(false)));
+}
+
+void BenchmarkSetAndClearTimers(benchmark::State &state)
+{
+    auto timerQueue = CreateTimerQueue();
+    auto callback = std::make_shared<TimerCallback>([]() {});
+    std::vector<uint32_t> timerIds(state.range(0));
+    for (auto _ : state) {
+        // like a page setting timeouts with spread delays and clearing them before they are due
+        for (int64_t index = 0; index < state.range(0); index++) {
+            timerIds[index] = timerQueue->SetTimer(LONG_DELAY + index, 0, callback);
+        }
+        for (auto timerId : timerIds) {
+            timerQueue->ClearTimer(timerId);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BenchmarkRunDueTimers(benchmark::State &state)
+{
+    auto timerQueue = CreateTimerQueue();
+    int64_t runCount = 0;
+    auto callback = std::make_shared<TimerCallback>([&runCount]() { runCount++; });
+    for (auto _ : state) {
+        for (int64_t index = 0; index < state.range(0); index++) {
+            timerQueue->SetTimer(0, 0, callback);
+        }
+        timerQueue->RunDueTimers();
+    }
+    state.SetItemsProcessed(runCount);
+}
+}  // namespace
+
+BENCHMARK(BenchmarkSetAndClearTimers)->Arg(100)->Arg(10000);
+BENCHMARK(BenchmarkRunDueTimers)->Arg(100)->Arg(10000);
+
+BENCHMARK_MAIN();
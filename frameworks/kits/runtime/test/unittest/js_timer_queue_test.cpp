@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "event_handler.h"
+#include "event_runner.h"
+#define private public
+#include "js_timer_queue.h"
+#undef private
+
+using namespace testing::ext;
+using namespace OHOS::AbilityRuntime;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+const int64_t LONG_DELAY = 100000; // ms, never due within a test
+
+class JsTimerQueueTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+
+    std::shared_ptr<TimerCallback> Record(uint32_t mark)
+    {
+        return std::make_shared<TimerCallback>([this, mark]() { records_.push_back(mark); });
+    }
+
+    std::shared_ptr<JsTimerQueue> timerQueue_;
+    std::vector<uint32_t> records_;
+};
+
+void JsTimerQueueTest::SetUpTestCase()
+{}
+
+void JsTimerQueueTest::TearDownTestCase()
+{}
+
+void JsTimerQueueTest::SetUp()
+{
+    // the runner is not started, the test runs the due timers by itself
+    auto eventHandler = std::make_shared<EventHandler>(EventRunner::Create(false));
+    timerQueue_ = std::make_shared<JsTimerQueue>(eventHandler);
+}
+
+void JsTimerQueueTest::TearDown()
+{
+    timerQueue_.reset();
+    records_.clear();
+}
+
+/*
+ * Feature: JsTimerQueue
+ * Function: SetTimer
+ * SubFunction: NA
+ * FunctionPoints: The due timers run in one go, by deadline and then in the order they were set.
+ * EnvConditions: NA
+ * CaseDescription: Set timers already due and one far away, and run the due ones.
+ */
+HWTEST_F(JsTimerQueueTest, JsTimerQueue_001, TestSize.Level1)
+{
+    EXPECT_EQ(0U, timerQueue_->SetTimer(0, 0, Record(0)));
+    EXPECT_EQ(1U, timerQueue_->SetTimer(LONG_DELAY, 0, Record(1)));
+    EXPECT_EQ(2U, timerQueue_->SetTimer(-1, 0, Record(2)));
+    EXPECT_EQ(3U, timerQueue_->SetTimer(0, 0, Record(3)));
+
+    timerQueue_->RunDueTimers();
+    std::vector<uint32_t> expected = { 0, 2, 3 };
+    EXPECT_EQ(expected, records_);
+    EXPECT_EQ(1U, timerQueue_->GetTimerCount());
+}
+
+/*
+ * Feature: JsTimerQueue
+ * Function: ClearTimer
+ * SubFunction: NA
+ * FunctionPoints: A cleared timer does not run, and the others keep their order.
+ * EnvConditions: NA
+ * CaseDescription: Set timers, clear some of them, and run the rest.
+ */
+HWTEST_F(JsTimerQueueTest, JsTimerQueue_002, TestSize.Level1)
+{
+    const uint32_t count = 10;
+    for (uint32_t mark = 0; mark < count; mark++) {
+        timerQueue_->SetTimer(0, 0, Record(mark));
+    }
+    EXPECT_TRUE(timerQueue_->ClearTimer(0));
+    EXPECT_TRUE(timerQueue_->ClearTimer(5));
+    EXPECT_FALSE(timerQueue_->ClearTimer(5));
+    EXPECT_FALSE(timerQueue_->ClearTimer(count));
+
+    timerQueue_->RunDueTimers();
+    std::vector<uint32_t> expected = { 1, 2, 3, 4, 6, 7, 8, 9 };
+    EXPECT_EQ(expected, records_);
+    EXPECT_EQ(0U, timerQueue_->GetTimerCount());
+    EXPECT_FALSE(timerQueue_->ClearTimer(1));
+}
+
+/*
+ * Feature: JsTimerQueue
+ * Function: RunDueTimers
+ * SubFunction: NA
+ * FunctionPoints: An interval stays until cleared, even from its own callback.
+ * EnvConditions: NA
+ * CaseDescription: Set an interval that clears itself on its second run.
+ */
+HWTEST_F(JsTimerQueueTest, JsTimerQueue_003, TestSize.Level1)
+{
+    uint32_t runCount = 0;
+    uint32_t timerId = 0;
+    timerId = timerQueue_->SetTimer(0, LONG_DELAY, std::make_shared<TimerCallback>([this, &runCount, &timerId]() {
+        if (++runCount == 2) {
+            EXPECT_TRUE(timerQueue_->ClearTimer(timerId));
+        }
+    }));
+
+    timerQueue_->RunDueTimers();
+    EXPECT_EQ(1U, runCount);
+    ASSERT_EQ(1U, timerQueue_->GetTimerCount());
+    EXPECT_GT(timerQueue_->heap_[0].deadline, JsTimerQueue::GetCurrentTime());
+
+    // pretend the interval has passed
+    timerQueue_->heap_[0].deadline = 0;
+    timerQueue_->RunDueTimers();
+    EXPECT_EQ(2U, runCount);
+    EXPECT_EQ(0U, timerQueue_->GetTimerCount());
+}
+
+/*
+ * Feature: JsTimerQueue
+ * Function: RunDueTimers
+ * SubFunction: NA
+ * FunctionPoints: A timer set by a running timer waits for the next run, so that chains do not starve the loop.
+ * EnvConditions: NA
+ * CaseDescription: Set a timer with no delay from a timer callback.
+ */
+HWTEST_F(JsTimerQueueTest, JsTimerQueue_004, TestSize.Level1)
+{
+    timerQueue_->SetTimer(0, 0, std::make_shared<TimerCallback>([this]() {
+        records_.push_back(0);
+        timerQueue_->SetTimer(0, 0, Record(1));
+    }));
+
+    timerQueue_->RunDueTimers();
+    std::vector<uint32_t> expected = { 0 };
+    EXPECT_EQ(expected, records_);
+    EXPECT_EQ(1U, timerQueue_->GetTimerCount());
+
+    timerQueue_->RunDueTimers();
+    expected.push_back(1);
+    EXPECT_EQ(expected, records_);
+}
+
+/*
+ * Feature: JsTimerQueue
+ * Function: SetTimer
+ * SubFunction: NA
+ * FunctionPoints: The ids wrap around, skipping those still in use.
+ * EnvConditions: NA
+ * CaseDescription: Set timers around the largest id.
+ */
+HWTEST_F(JsTimerQueueTest, JsTimerQueue_005, TestSize.Level1)
+{
+    EXPECT_EQ(0U, timerQueue_->SetTimer(LONG_DELAY, 0, Record(0)));
+    timerQueue_->nextTimerId_ = UINT32_MAX;
+    EXPECT_EQ(UINT32_MAX, timerQueue_->SetTimer(LONG_DELAY, 0, Record(1)));
+    EXPECT_EQ(1U, timerQueue_->SetTimer(LONG_DELAY, 0, Record(2)));
+    EXPECT_EQ(3U, timerQueue_->GetTimerCount());
+
+    timerQueue_->Clear();
+    EXPECT_EQ(0U, timerQueue_->GetTimerCount());
+    EXPECT_FALSE(timerQueue_->ClearTimer(0));
+}
+}
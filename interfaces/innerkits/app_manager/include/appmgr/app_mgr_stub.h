@@ -18,6 +18,7 @@
 
 #include <map>
 
+#include "ipc_stub_metrics.h"
 #include "iremote_stub.h"
 #include "nocopyable.h"
 #include "string_ex.h"
@@ -84,6 +85,7 @@ private:
 
     using AppMgrFunc = int32_t (AppMgrStub::*)(MessageParcel &data, MessageParcel &reply);
     std::map<uint32_t, AppMgrFunc> memberFuncMap_;
+    AAFwk::IpcDispatchTable<AppMgrFunc> dispatchTable_ {"AppMgr"};
 
     DISALLOW_COPY_AND_MOVE(AppMgrStub);
 };
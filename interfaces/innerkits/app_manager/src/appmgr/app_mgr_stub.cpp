@@ -82,6 +82,7 @@ AppMgrStub::AppMgrStub()
     memberFuncMap_[static_cast<uint32_t>(IAppMgr::Message::BLOCK_APP_SERVICE)] =
         &AppMgrStub::HandleBlockAppServiceDone;
 #endif
+    dispatchTable_.Build(memberFuncMap_);
 }
 
 AppMgrStub::~AppMgrStub()
@@ -99,12 +100,9 @@ int AppMgrStub::OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParce
         return ERR_INVALID_STATE;
     }
 
-    auto itFunc = memberFuncMap_.find(code);
-    if (itFunc != memberFuncMap_.end()) {
-        auto memberFunc = itFunc->second;
-        if (memberFunc != nullptr) {
-            return (this->*memberFunc)(data, reply);
-        }
+    int result = NO_ERROR;
+    if (dispatchTable_.Dispatch(this, code, data, reply, result)) {
+        return result;
     }
     return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
 }
@@ -66,6 +66,27 @@ public:
      */
     ErrCode NotifyChange(const Uri &uri);
 
+    /**
+     * Registers an observer to DataObsMgr specified by the given Uri, and optionally for its descendants.
+     *
+     * @param uri, Indicates the path of the data to operate.
+     * @param dataObserver, Indicates the IDataAbilityObserver object.
+     * @param isDescendants, Indicates whether the changes of the descendants of the uri are notified.
+     *
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    ErrCode RegisterObserverExt(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver, bool isDescendants);
+
+    /**
+     * Deregisters an observer registered for the descendants of the given Uri.
+     *
+     * @param uri, Indicates the path of the data to operate.
+     * @param dataObserver, Indicates the IDataAbilityObserver object.
+     *
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    ErrCode UnregisterObserverExt(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver);
+
 private:
     /**
      * Connect dataobs manager service.
@@ -65,6 +65,29 @@ public:
      */
     virtual int NotifyChange(const Uri &uri) = 0;
 
+    /**
+     * Registers an observer to DataObsMgr specified by the given Uri, it can be notified of the changes of
+     * the descendants of the uri too, e.g. dataability:///com.example.contacts/person for every person.
+     *
+     * @param uri, Indicates the path of the data to operate.
+     * @param dataObserver, Indicates the IDataAbilityObserver object.
+     * @param isDescendants, Indicates whether the changes of the descendants of the uri are notified.
+     *
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    virtual int RegisterObserverExt(
+        const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver, bool isDescendants) = 0;
+
+    /**
+     * Deregisters an observer registered for the descendants of the given Uri.
+     *
+     * @param uri, Indicates the path of the data to operate.
+     * @param dataObserver, Indicates the IDataAbilityObserver object.
+     *
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    virtual int UnregisterObserverExt(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver) = 0;
+
     enum {
         // ipc id 1-1000 for kit
         // ipc id for RegisterObserver (1)
@@ -75,6 +98,12 @@ public:
 
         // ipc id for NotifyChange (3)
         NOTIFY_CHANGE,
+
+        // ipc id for RegisterObserverExt (4)
+        REGISTER_OBSERVER_EXT,
+
+        // ipc id for UnregisterObserverExt (5)
+        UNREGISTER_OBSERVER_EXT,
     };
 };
 }  // namespace AAFwk
@@ -19,6 +19,7 @@
 #include <map>
 
 #include "form_mgr_interface.h"
+#include "ipc_stub_metrics.h"
 #include "iremote_object.h"
 #include "iremote_stub.h"
 
@@ -239,6 +240,7 @@ private:
 private:
     using FormMgrFunc = int32_t (FormMgrStub::*)(MessageParcel &data, MessageParcel &reply);
     std::map<uint32_t, FormMgrFunc> memberFuncMap_;
+    AAFwk::IpcDispatchTable<FormMgrFunc> dispatchTable_ {"FormMgr"};
 
     DISALLOW_COPY_AND_MOVE(FormMgrStub);
 
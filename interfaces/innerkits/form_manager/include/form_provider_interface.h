@@ -70,6 +70,16 @@ public:
      */
     virtual int NotifyFormUpdate(const int64_t formId, const Want &want, const sptr<IRemoteObject> &callerToken) = 0;
 
+    /**
+     * @brief Notify provider when the forms need update, with one result for all of them.
+     * @param formIds The id list of forms.
+     * @param want Indicates the structure containing form info.
+     * @param callerToken Caller ability token.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    virtual int NotifyFormsUpdate(const std::vector<int64_t> &formIds, const Want &want,
+    const sptr<IRemoteObject> &callerToken) = 0;
+
     /**
      * @brief Event notify when change the form visible.
      *
@@ -141,6 +151,9 @@ public:
 
         // ipc id for acquiring form state (3058)
         FORM_PROVIDER_NOTIFY_STATE_ACQUIRE,
+
+        // ipc id for connecting update forms (3059)
+        FORM_PROVIDER_NOTIFY_FORMS_UPDATE,
     };
 };
 }  // namespace AppExecFwk
@@ -73,6 +73,16 @@ public:
     virtual int NotifyFormUpdate(const int64_t formId, const Want &want,
     const sptr<IRemoteObject> &callerToken) override;
 
+    /**
+     * @brief Notify provider when the forms need update, with one result for all of them.
+     * @param formIds The id list of forms.
+     * @param want Indicates the structure containing form info.
+     * @param callerToken Caller ability token.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    virtual int NotifyFormsUpdate(const std::vector<int64_t> &formIds, const Want &want,
+    const sptr<IRemoteObject> &callerToken) override;
+
     /**
      * @brief Event notify when change the form visible.
      *
@@ -71,6 +71,13 @@ private:
      * @return Returns ERR_OK on success, others on failure.
      */
     int HandleNotifyFormUpdate(MessageParcel &data, MessageParcel &reply);
+    /**
+     * @brief handle NotifyFormsUpdate message.
+     * @param data input param.
+     * @param reply output param.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    int HandleNotifyFormsUpdate(MessageParcel &data, MessageParcel &reply);
 
     /**
      * @brief handle EventNotify message.
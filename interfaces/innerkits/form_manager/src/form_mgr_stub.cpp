@@ -95,6 +95,7 @@ FormMgrStub::FormMgrStub()
         &FormMgrStub::HandleRouterEvent;
     memberFuncMap_[static_cast<uint32_t>(IFormMgr::Message::FORM_MGR_UPDATE_ROUTER_ACTION)] =
         &FormMgrStub::HandleUpdateRouterAction;
+    dispatchTable_.Build(memberFuncMap_);
 }
 
 FormMgrStub::~FormMgrStub()
@@ -119,12 +120,9 @@ int FormMgrStub::OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParc
         return ERR_APPEXECFWK_FORM_INVALID_PARAM;
     }
 
-    auto itFunc = memberFuncMap_.find(code);
-    if (itFunc != memberFuncMap_.end()) {
-        auto memberFunc = itFunc->second;
-        if (memberFunc != nullptr) {
-            return (this->*memberFunc)(data, reply);
-        }
+    int result = ERR_OK;
+    if (dispatchTable_.Dispatch(this, code, data, reply, result)) {
+        return result;
     }
     return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
 }
@@ -34,6 +34,8 @@ FormProviderStub::FormProviderStub()
         &FormProviderStub::HandleNotifyFormsDelete;
     memberFuncMap_[static_cast<uint32_t>(IFormProvider::Message::FORM_PROVIDER_NOTIFY_FORM_UPDATE)] =
         &FormProviderStub::HandleNotifyFormUpdate;
+    memberFuncMap_[static_cast<uint32_t>(IFormProvider::Message::FORM_PROVIDER_NOTIFY_FORMS_UPDATE)] =
+        &FormProviderStub::HandleNotifyFormsUpdate;
     memberFuncMap_[static_cast<uint32_t>(IFormProvider::Message::FORM_PROVIDER_EVENT_NOTIFY)] =
         &FormProviderStub::HandleEventNotify;
     memberFuncMap_[static_cast<uint32_t>(IFormProvider::Message::FORM_PROVIDER_NOTIFY_TEMP_FORM_CAST)] =
@@ -181,6 +183,36 @@ int FormProviderStub::HandleNotifyFormUpdate(MessageParcel &data, MessageParcel
     reply.WriteInt32(result);
     return result;
 }
+/**
+ * @brief handle NotifyFormsUpdate message.
+ * @param data input param.
+ * @param reply output param.
+ * @return Returns ERR_OK on success, others on failure.
+ */
+int FormProviderStub::HandleNotifyFormsUpdate(MessageParcel &data, MessageParcel &reply)
+{
+    std::vector<int64_t> formIds;
+    bool ret = data.ReadInt64Vector(&formIds);
+    if (!ret) {
+        return ERR_INVALID_DATA;
+    }
+
+    std::unique_ptr<Want> want(data.ReadParcelable<Want>());
+    if (!want) {
+        HILOG_ERROR("%{public}s, failed to ReadParcelable<Want>", __func__);
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+
+    sptr<IRemoteObject> client = data.ReadRemoteObject();
+    if (client == nullptr) {
+        HILOG_ERROR("%{public}s, failed to get remote object.", __func__);
+        return ERR_APPEXECFWK_PARCEL_ERROR;
+    }
+
+    int32_t result = NotifyFormsUpdate(formIds, *want, client);
+    reply.WriteInt32(result);
+    return result;
+}
 
 /**
  * @brief handle EventNotify message.
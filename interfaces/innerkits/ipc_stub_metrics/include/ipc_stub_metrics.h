@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_IPC_STUB_METRICS_H
+#define OHOS_AAFWK_IPC_STUB_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "latency_histogram.h"
+#include "message_parcel.h"
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @class IpcStubMetrics
+ * Calls, errors, handler latency, parcel sizes and top calling uids of every code of a service stub. The
+ * counters are kept in per-thread shards and merged when dumped, the latency histogram of a code is only
+ * allocated on its first call. Every instance is listed for DumpAll while it lives.
+ */
+class IpcStubMetrics {
+public:
+    /**
+     * @param name the interface the stub serves.
+     * @param codes the codes of the stub, a code is measured by its index here.
+     */
+    IpcStubMetrics(const std::string &name, const std::vector<uint32_t> &codes);
+    ~IpcStubMetrics();
+
+    /**
+     * Record a handled call.
+     *
+     * @param slot index of the code.
+     * @param startTime when the handler was called, in nanoseconds of GetTimeNs.
+     * @param result what the handler returned, anything but ERR_OK is an error.
+     * @param bytesIn size of the request parcel.
+     * @param bytesOut size of the reply parcel.
+     */
+    void Record(size_t slot, int64_t startTime, int result, size_t bytesIn, size_t bytesOut);
+
+    /**
+     * Dump the calls of the codes called so far, the most called first.
+     *
+     * @param info output dump info.
+     */
+    void Dump(std::vector<std::string> &info);
+
+    /**
+     * Dump every stub of the process.
+     *
+     * @param info output dump info.
+     */
+    static void DumpAll(std::vector<std::string> &info);
+
+    static int64_t GetTimeNs();
+
+private:
+    static constexpr size_t SHARD_COUNT = 8;
+    static constexpr size_t MAX_UID_COUNT = 1024;
+    static constexpr size_t TOP_UID_COUNT = 3;
+
+    struct CodeCounters {
+        std::atomic<uint64_t> calls {0};
+        std::atomic<uint64_t> errors {0};
+        std::atomic<uint64_t> bytesIn {0};
+        std::atomic<uint64_t> bytesOut {0};
+    };
+
+    struct Shard {
+        std::unique_ptr<CodeCounters[]> counters;
+        // calls by slot and calling uid, only the thread of the shard takes the lock but for dumps
+        std::mutex uidMutex;
+        std::unordered_map<uint64_t, uint64_t> uidCalls;
+    };
+
+    static size_t GetShardIndex();
+    LatencyHistogram *GetLatency(size_t slot);
+    void DumpTopUids(size_t slot, std::string &line);
+
+    std::string name_;
+    std::vector<uint32_t> codes_;
+    // a histogram is 2 KB and most codes of a stub are seldom called, each is created by its first call
+    std::unique_ptr<std::atomic<LatencyHistogram *>[]> latencies_;
+    std::array<Shard, SHARD_COUNT> shards_;
+
+    DISALLOW_COPY_AND_MOVE(IpcStubMetrics);
+};
+
+/**
+ * @class IpcDispatchTable
+ * Dispatch table of a service stub, an array indexed by code in place of the map lookup, measuring every call
+ * it dispatches.
+ */
+template<typename FuncType>
+class IpcDispatchTable {
+public:
+    explicit IpcDispatchTable(const std::string &name) : name_(name) {}
+    ~IpcDispatchTable() = default;
+
+    /**
+     * Build the table from the handlers of the stub.
+     *
+     * @param funcMap the handlers by code.
+     */
+    void Build(const std::map<uint32_t, FuncType> &funcMap)
+    {
+        std::vector<uint32_t> codes;
+        funcs_.clear();
+        slots_.clear();
+        sparseSlots_.clear();
+        for (const auto &item : funcMap) {
+            if (item.second == nullptr || funcs_.size() >= NO_SLOT) {
+                continue;
+            }
+            uint16_t slot = static_cast<uint16_t>(funcs_.size());
+            if (item.first < MAX_DENSE_CODE) {
+                if (item.first >= slots_.size()) {
+                    slots_.resize(item.first + 1, NO_SLOT);
+                }
+                slots_[item.first] = slot;
+            } else {
+                sparseSlots_.emplace(item.first, slot);
+            }
+            codes.emplace_back(item.first);
+            funcs_.emplace_back(item.second);
+        }
+        metrics_ = std::make_unique<IpcStubMetrics>(name_, codes);
+    }
+
+    /**
+     * Call the handler of a code.
+     *
+     * @param stub the stub handling the call.
+     * @param code the code of the call.
+     * @param data the request parcel.
+     * @param reply the reply parcel.
+     * @param result output what the handler returned.
+     * @return true if the code has a handler, false otherwise.
+     */
+    template<typename Stub>
+    bool Dispatch(Stub *stub, uint32_t code, MessageParcel &data, MessageParcel &reply, int &result)
+    {
+        uint16_t slot = NO_SLOT;
+        if (code < slots_.size()) {
+            slot = slots_[code];
+        } else if (!sparseSlots_.empty()) {
+            auto iter = sparseSlots_.find(code);
+            slot = iter == sparseSlots_.end() ? NO_SLOT : iter->second;
+        }
+        if (slot == NO_SLOT) {
+            return false;
+        }
+        int64_t startTime = IpcStubMetrics::GetTimeNs();
+        size_t bytesIn = data.GetDataSize();
+        result = (stub->*funcs_[slot])(data, reply);
+        metrics_->Record(slot, startTime, result, bytesIn, reply.GetDataSize());
+        return true;
+    }
+
+private:
+    static constexpr uint16_t NO_SLOT = UINT16_MAX;
+    // codes past it, reserved for tools and tests, are looked up in sparseSlots_
+    static constexpr uint32_t MAX_DENSE_CODE = 8192;
+
+    std::string name_;
+    std::vector<uint16_t> slots_;
+    std::map<uint32_t, uint16_t> sparseSlots_;
+    std::vector<FuncType> funcs_;
+    std::unique_ptr<IpcStubMetrics> metrics_;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_IPC_STUB_METRICS_H
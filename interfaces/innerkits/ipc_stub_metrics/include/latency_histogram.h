@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_LATENCY_HISTOGRAM_H
+#define OHOS_AAFWK_LATENCY_HISTOGRAM_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @class LatencyHistogram
+ * Log-linear histogram of latencies: every power of two is split into 8 linear buckets, so a percentile is off
+ * by 12.5% at most. The unit is up to the caller. Recording only touches atomics.
+ */
+class LatencyHistogram {
+public:
+    static constexpr uint32_t SUB_BUCKET_BITS = 3;
+    static constexpr uint32_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+    // latencies of 2^32 and over fall into the last bucket
+    static constexpr uint32_t MAX_VALUE_BITS = 32;
+    static constexpr size_t BUCKET_COUNT = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    /**
+     * Record a latency.
+     *
+     * @param latency the latency.
+     * @return the number of latencies recorded so far.
+     */
+    uint64_t Record(uint64_t latency)
+    {
+        buckets_[GetBucketIndex(latency)].fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(latency, std::memory_order_relaxed);
+        uint64_t max = max_.load(std::memory_order_relaxed);
+        while (latency > max && !max_.compare_exchange_weak(max, latency, std::memory_order_relaxed)) {
+        }
+        return count_.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    uint64_t GetCount() const
+    {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t GetSum() const
+    {
+        return sum_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t GetMax() const
+    {
+        return max_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Get a percentile of the recorded latencies.
+     *
+     * @param percentile the percentile, in (0, 100].
+     * @return the upper bound of the bucket holding the percentile, 0 if nothing is recorded.
+     */
+    uint64_t GetPercentile(double percentile) const
+    {
+        static constexpr double PERCENTILE_MAX = 100.0;
+        // the buckets are read one by one while others record, so count what was read rather than count_
+        std::array<uint64_t, BUCKET_COUNT> buckets;
+        uint64_t total = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+            total += buckets[i];
+        }
+        if (total == 0) {
+            return 0;
+        }
+        percentile = std::min(std::max(percentile, 0.0), PERCENTILE_MAX);
+        uint64_t rank = std::max(static_cast<uint64_t>(std::ceil(total * percentile / PERCENTILE_MAX)),
+            static_cast<uint64_t>(1));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            seen += buckets[i];
+            if (seen >= rank) {
+                // no bucket bound is more than what was recorded
+                return std::min(GetBucketUpperBound(i), GetMax());
+            }
+        }
+        return GetMax();
+    }
+
+    static size_t GetBucketIndex(uint64_t value)
+    {
+        if (value < SUB_BUCKET_COUNT) {
+            return static_cast<size_t>(value);
+        }
+        value = std::min(value, (static_cast<uint64_t>(1) << MAX_VALUE_BITS) - 1);
+        uint32_t highestBit = 0;
+        for (uint64_t rest = value; rest > 1; rest >>= 1) {
+            highestBit++;
+        }
+        // the power of two picks the bucket group, the bits below the highest one the bucket in it
+        uint32_t shift = highestBit - SUB_BUCKET_BITS;
+        return (shift + 1) * SUB_BUCKET_COUNT + ((value >> shift) & (SUB_BUCKET_COUNT - 1));
+    }
+
+    static uint64_t GetBucketUpperBound(size_t index)
+    {
+        if (index < SUB_BUCKET_COUNT) {
+            return index;
+        }
+        uint32_t shift = index / SUB_BUCKET_COUNT - 1;
+        uint64_t lowerBound = static_cast<uint64_t>(SUB_BUCKET_COUNT + index % SUB_BUCKET_COUNT) << shift;
+        return lowerBound + (static_cast<uint64_t>(1) << shift) - 1;
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets_ {};
+    std::atomic<uint64_t> count_ {0};
+    std::atomic<uint64_t> sum_ {0};
+    std::atomic<uint64_t> max_ {0};
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_LATENCY_HISTOGRAM_H
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ipc_stub_metrics.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "errors.h"
+#include "ipc_skeleton.h"
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+const double PERCENTILE_50 = 50.0;
+const double PERCENTILE_99 = 99.0;
+const uint32_t SLOT_SHIFT = 32;
+std::atomic<size_t> g_nextShardIndex {0};
+
+std::mutex &GetRegistryMutex()
+{
+    static std::mutex registryMutex;
+    return registryMutex;
+}
+
+std::vector<IpcStubMetrics *> &GetRegistry()
+{
+    static std::vector<IpcStubMetrics *> registry;
+    return registry;
+}
+}  // namespace
+
+IpcStubMetrics::IpcStubMetrics(const std::string &name, const std::vector<uint32_t> &codes)
+    : name_(name), codes_(codes)
+{
+    latencies_ = std::make_unique<std::atomic<LatencyHistogram *>[]>(codes_.size());
+    for (size_t slot = 0; slot < codes_.size(); slot++) {
+        latencies_[slot].store(nullptr, std::memory_order_relaxed);
+    }
+    for (auto &shard : shards_) {
+        shard.counters = std::make_unique<CodeCounters[]>(codes_.size());
+    }
+    std::lock_guard<std::mutex> lock(GetRegistryMutex());
+    GetRegistry().emplace_back(this);
+}
+
+IpcStubMetrics::~IpcStubMetrics()
+{
+    // a dump in progress holds the lock, it finishes before the counters go away
+    std::lock_guard<std::mutex> lock(GetRegistryMutex());
+    auto &registry = GetRegistry();
+    registry.erase(std::remove(registry.begin(), registry.end(), this), registry.end());
+    for (size_t slot = 0; slot < codes_.size(); slot++) {
+        delete latencies_[slot].load(std::memory_order_relaxed);
+    }
+}
+
+void IpcStubMetrics::Record(size_t slot, int64_t startTime, int result, size_t bytesIn, size_t bytesOut)
+{
+    if (slot >= codes_.size()) {
+        return;
+    }
+    int64_t latency = GetTimeNs() - startTime;
+    GetLatency(slot)->Record(static_cast<uint64_t>(std::max(latency, static_cast<int64_t>(0))));
+
+    Shard &shard = shards_[GetShardIndex()];
+    CodeCounters &counters = shard.counters[slot];
+    counters.calls.fetch_add(1, std::memory_order_relaxed);
+    if (result != ERR_OK) {
+        counters.errors.fetch_add(1, std::memory_order_relaxed);
+    }
+    counters.bytesIn.fetch_add(bytesIn, std::memory_order_relaxed);
+    counters.bytesOut.fetch_add(bytesOut, std::memory_order_relaxed);
+
+    uint64_t key = (static_cast<uint64_t>(slot) << SLOT_SHIFT) |
+        static_cast<uint32_t>(IPCSkeleton::GetCallingUid());
+    std::lock_guard<std::mutex> lock(shard.uidMutex);
+    auto iter = shard.uidCalls.find(key);
+    if (iter != shard.uidCalls.end()) {
+        iter->second++;
+    } else if (shard.uidCalls.size() < MAX_UID_COUNT) {
+        // past it the top uids only count the uids seen so far
+        shard.uidCalls.emplace(key, 1);
+    }
+}
+
+void IpcStubMetrics::Dump(std::vector<std::string> &info)
+{
+    struct CodeSummary {
+        size_t slot = 0;
+        uint64_t calls = 0;
+        uint64_t errors = 0;
+        uint64_t bytesIn = 0;
+        uint64_t bytesOut = 0;
+    };
+    std::vector<CodeSummary> summaries(codes_.size());
+    for (size_t slot = 0; slot < codes_.size(); slot++) {
+        CodeSummary &summary = summaries[slot];
+        summary.slot = slot;
+        for (const auto &shard : shards_) {
+            const CodeCounters &counters = shard.counters[slot];
+            summary.calls += counters.calls.load(std::memory_order_relaxed);
+            summary.errors += counters.errors.load(std::memory_order_relaxed);
+            summary.bytesIn += counters.bytesIn.load(std::memory_order_relaxed);
+            summary.bytesOut += counters.bytesOut.load(std::memory_order_relaxed);
+        }
+    }
+    std::stable_sort(summaries.begin(), summaries.end(), [](const CodeSummary &lhs, const CodeSummary &rhs) {
+        return lhs.calls > rhs.calls;
+    });
+
+    info.emplace_back("IpcStubMetrics " + name_ + " (latency in ns):");
+    for (const auto &summary : summaries) {
+        if (summary.calls == 0) {
+            break;
+        }
+        // a call is counted after its latency, a code with calls has its histogram
+        const LatencyHistogram &latency = *GetLatency(summary.slot);
+        uint64_t latencyCount = std::max(latency.GetCount(), static_cast<uint64_t>(1));
+        std::string line = "  code " + std::to_string(codes_[summary.slot]) +
+            ": calls " + std::to_string(summary.calls) +
+            ", errors " + std::to_string(summary.errors) +
+            ", mean " + std::to_string(latency.GetSum() / latencyCount) +
+            ", p50 " + std::to_string(latency.GetPercentile(PERCENTILE_50)) +
+            ", p99 " + std::to_string(latency.GetPercentile(PERCENTILE_99)) +
+            ", max " + std::to_string(latency.GetMax()) +
+            ", bytes in " + std::to_string(summary.bytesIn) +
+            ", out " + std::to_string(summary.bytesOut);
+        DumpTopUids(summary.slot, line);
+        info.emplace_back(line);
+    }
+}
+
+void IpcStubMetrics::DumpAll(std::vector<std::string> &info)
+{
+    std::lock_guard<std::mutex> lock(GetRegistryMutex());
+    for (auto metrics : GetRegistry()) {
+        metrics->Dump(info);
+    }
+}
+
+int64_t IpcStubMetrics::GetTimeNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+size_t IpcStubMetrics::GetShardIndex()
+{
+    // binder threads live as long as the process, each keeps the shard it is given first
+    static thread_local size_t shardIndex = g_nextShardIndex.fetch_add(1, std::memory_order_relaxed) % SHARD_COUNT;
+    return shardIndex;
+}
+
+LatencyHistogram *IpcStubMetrics::GetLatency(size_t slot)
+{
+    LatencyHistogram *latency = latencies_[slot].load(std::memory_order_acquire);
+    if (latency != nullptr) {
+        return latency;
+    }
+    auto created = std::make_unique<LatencyHistogram>();
+    if (latencies_[slot].compare_exchange_strong(latency, created.get(), std::memory_order_acq_rel,
+        std::memory_order_acquire)) {
+        return created.release();
+    }
+    // another thread created it first
+    return latency;
+}
+
+void IpcStubMetrics::DumpTopUids(size_t slot, std::string &line)
+{
+    std::unordered_map<int32_t, uint64_t> uidCalls;
+    for (auto &shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.uidMutex);
+        for (const auto &item : shard.uidCalls) {
+            if ((item.first >> SLOT_SHIFT) == slot) {
+                uidCalls[static_cast<int32_t>(static_cast<uint32_t>(item.first))] += item.second;
+            }
+        }
+    }
+    std::vector<std::pair<int32_t, uint64_t>> topUids(uidCalls.begin(), uidCalls.end());
+    size_t topCount = std::min(topUids.size(), TOP_UID_COUNT);
+    std::partial_sort(topUids.begin(), topUids.begin() + topCount, topUids.end(),
+        [](const std::pair<int32_t, uint64_t> &lhs, const std::pair<int32_t, uint64_t> &rhs) {
+            return lhs.second > rhs.second;
+        });
+    line += ", top uids";
+    for (size_t i = 0; i < topCount; i++) {
+        line += " " + std::to_string(topUids[i].first) + ":" + std::to_string(topUids[i].second);
+    }
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -32,7 +32,7 @@ namespace AppExecFwk {
 class EventHandler;
 } // namespace AppExecFwk
 namespace AbilityRuntime {
-class TimerTask;
+class JsTimerQueue;
 class JsRuntime : public Runtime {
 public:
     static std::unique_ptr<Runtime> Create(const Options& options);
@@ -52,7 +52,6 @@ public:
     std::unique_ptr<NativeReference> LoadModule(const std::string& moduleName, const std::string& modulePath);
     std::unique_ptr<NativeReference> LoadSystemModule(
         const std::string& moduleName, NativeValue* const* argv = nullptr, size_t argc = 0);
-    void PostTask(const TimerTask& task, const std::string& name, int64_t delayTime);
     void RemoveTask(const std::string& name);
     NativeValue* SetCallbackTimer(NativeEngine& engine, NativeCallbackInfo& info, bool isInterval);
     NativeValue* ClearCallbackTimer(NativeEngine& engine, NativeCallbackInfo& info);
@@ -74,7 +73,7 @@ protected:
     std::unique_ptr<NativeReference> methodRequireNapiRef_;
 
     std::shared_ptr<AppExecFwk::EventHandler> eventHandler_;
-    uint32_t callbackId_ = 0;
+    std::shared_ptr<JsTimerQueue> timerQueue_;
 
     std::unordered_map<std::string, NativeReference*> modules_;
 };
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_OHOS_ABILITYRUNTIME_JS_TIMER_QUEUE_H
+#define FOUNDATION_OHOS_ABILITYRUNTIME_JS_TIMER_QUEUE_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace OHOS {
+namespace AppExecFwk {
+class EventHandler;
+} // namespace AppExecFwk
+namespace AbilityRuntime {
+using TimerCallback = std::function<void()>;
+
+/**
+ * The timers of setTimeout and setInterval, in a min-heap by deadline. Only the earliest deadline has a wake-up
+ * posted to the event handler, which runs the timers due.
+ */
+class JsTimerQueue final : public std::enable_shared_from_this<JsTimerQueue> {
+public:
+    explicit JsTimerQueue(const std::shared_ptr<AppExecFwk::EventHandler>& eventHandler);
+    ~JsTimerQueue() = default;
+
+    /**
+     * Set a timer.
+     *
+     * @param delayTime The time until the timer is due, in milliseconds.
+     * @param interval The time between the runs of a repeating timer, 0 for a timer that runs once.
+     * @param callback What the timer runs.
+     * @return The id of the timer.
+     */
+    uint32_t SetTimer(int64_t delayTime, int64_t interval, const std::shared_ptr<TimerCallback>& callback);
+
+    /**
+     * Clear a timer, so that it does not run any more.
+     *
+     * @param timerId The id of the timer.
+     * @return true if the timer was set, false otherwise.
+     */
+    bool ClearTimer(uint32_t timerId);
+
+    /**
+     * Run the timers due, then post the wake-up for the next one. The timers set meanwhile wait for a later run.
+     */
+    void RunDueTimers();
+
+    /**
+     * Clear all the timers.
+     */
+    void Clear();
+
+    size_t GetTimerCount() const
+    {
+        return timers_.size();
+    }
+
+private:
+    struct HeapNode {
+        int64_t deadline = 0;
+        uint64_t sequence = 0;
+        uint32_t timerId = 0;
+    };
+
+    struct Timer {
+        std::shared_ptr<TimerCallback> callback;
+        int64_t interval = 0;
+        size_t heapIndex = 0;
+    };
+
+    static int64_t GetCurrentTime();
+    static bool IsEarlier(const HeapNode& left, const HeapNode& right);
+    void OnWakeUp(int64_t wakeUpTime);
+    void PostWakeUp();
+    void SiftUp(size_t index);
+    void SiftDown(size_t index);
+    void SwapNodes(size_t left, size_t right);
+    void RemoveNode(size_t index);
+
+    std::shared_ptr<AppExecFwk::EventHandler> eventHandler_;
+    std::vector<HeapNode> heap_;
+    std::unordered_map<uint32_t, Timer> timers_;
+    uint32_t nextTimerId_ = 0;
+    uint64_t nextSequence_ = 0;
+    // the earliest wake-up posted, a wake-up posted before a later one is only ever early, which is harmless
+    int64_t wakeUpTime_ = INT64_MAX;
+};
+}  // namespace AbilityRuntime
+}  // namespace OHOS
+#endif  // FOUNDATION_OHOS_ABILITYRUNTIME_JS_TIMER_QUEUE_H
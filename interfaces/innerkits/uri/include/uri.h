@@ -16,11 +16,17 @@
 #ifndef UTILS_NATIVE_INCLUDE_URI_H_
 #define UTILS_NATIVE_INCLUDE_URI_H_
 
+#include <functional>
 #include <string>
+#include <string_view>
 #include <vector>
 #include "parcel.h"
 
 namespace OHOS {
+/**
+ * The uri string is parsed once when constructed, the parts are kept as ranges of it and read without copying
+ * through the view getters.
+ */
 class Uri : public Parcelable {
 public:
     explicit Uri(const std::string& uriString);
@@ -31,70 +37,91 @@ public:
      *
      * @return the scheme string.
      */
-    std::string GetScheme();
+    std::string GetScheme() const;
 
     /**
      * Get the Ssp part.
      *
      * @return the SchemeSpecificPart string.
      */
-    std::string GetSchemeSpecificPart();
+    std::string GetSchemeSpecificPart() const;
 
     /**
      * Get the GetAuthority part.
      *
      * @return the authority string.
      */
-    std::string GetAuthority();
+    std::string GetAuthority() const;
 
     /**
      * Get the Host part.
      *
      * @return the host string.
      */
-    std::string GetHost();
+    std::string GetHost() const;
 
     /**
      * Get the Port part.
      *
      * @return the port number.
      */
-    int GetPort();
+    int GetPort() const;
 
     /**
      * Get the User part.
      *
      * @return the user string.
      */
-    std::string GetUserInfo();
+    std::string GetUserInfo() const;
 
     /**
      * Get the Query part.
      *
      * @return the query string.
      */
-    std::string GetQuery();
+    std::string GetQuery() const;
 
     /**
      * Get the Path part.
      *
      * @return the path string.
      */
-    std::string GetPath();
+    std::string GetPath() const;
 
     /**
      * Get the path segments.
      *
      * @param the path segments of Uri.
      */
-    void GetPathSegments(std::vector<std::string>& segments);
+    void GetPathSegments(std::vector<std::string>& segments) const;
+
+    /**
+     * Get the path segments, as views of this uri.
+     *
+     * @param the path segments of Uri, valid as long as this uri.
+     */
+    void GetPathSegments(std::vector<std::string_view>& segments) const;
 
     /**
      * Get the Fragment part.
      *
      * @return the fragment string.
      */
-    std::string GetFragment();
+    std::string GetFragment() const;
+
+    /**
+     * Get the parts as views of this uri, valid as long as this uri.
+     *
+     * @return the part.
+     */
+    std::string_view GetSchemeView() const;
+    std::string_view GetSchemeSpecificPartView() const;
+    std::string_view GetAuthorityView() const;
+    std::string_view GetHostView() const;
+    std::string_view GetUserInfoView() const;
+    std::string_view GetQueryView() const;
+    std::string_view GetPathView() const;
+    std::string_view GetFragmentView() const;
 
     /**
      * Returns true if this URI is hierarchical like "http://www.example.com".
@@ -103,7 +130,7 @@ public:
      *
      * @return true if this URI is hierarchical, false if it's opaque.
      */
-    bool IsHierarchical();
+    bool IsHierarchical() const;
 
     /**
      * Returns true if this URI is opaque like "mailto:nobody@ohos.com".
@@ -111,21 +138,21 @@ public:
      *
      * @return true if this URI is opaque, false if it's hierarchical.
      */
-    bool IsOpaque();
+    bool IsOpaque() const;
 
     /**
      * Returns true if this URI is absolute, i.e.&nbsp;if it contains an explicit scheme.
      *
      * @return true if this URI is absolute, false if it's relative.
      */
-    bool IsAbsolute();
+    bool IsAbsolute() const;
 
     /**
      * Returns true if this URI is relative, i.e.&nbsp;if it doesn't contain an explicit scheme.
      *
      * @return true if this URI is relative, false if it's absolute.
      */
-    bool IsRelative();
+    bool IsRelative() const;
 
     /**
      * Check whether the other is the same as this.
@@ -146,7 +173,17 @@ public:
      *
      * @return a string object.
      */
-    std::string ToString() const;
+    const std::string& ToString() const;
+
+    /**
+     * Get the hash of the uri string, computed once when constructed.
+     *
+     * @return the hash value.
+     */
+    size_t Hash() const
+    {
+        return hash_;
+    }
 
     /**
      * override the == method.
@@ -170,44 +207,40 @@ public:
     static Uri* Unmarshalling(Parcel& parcel);
 
 private:
-    bool CheckScheme();
-    std::string ParseScheme();
-    std::string ParseSsp();
-    std::string ParseAuthority();
-    std::string ParseUserInfo();
-    std::string ParseHost();
-    int ParsePort();
-    std::string ParsePath(size_t ssi);
-    std::string ParsePath();
-    std::string ParseQuery();
-    std::string ParseFragment();
-
-    /**
-    * Finds the first ':'.
-    *
-    * @return the pos of the ':', string::npos if none found.
-    */
-    size_t FindSchemeSeparator();
-
-    /**
-     * Finds the first '#'.
-     *
-     * @return the pos of the '#', string::npos if none found.
-     */
-    size_t FindFragmentSeparator();
+    struct Range {
+        size_t start = 0;
+        size_t length = 0;
+    };
+
+    void Parse();
+    void ParseAuthority(size_t ssi);
+    void ParsePath(size_t ssi);
+    void ParseQuery(size_t ssi, size_t fsi);
+    std::string_view View(const Range& range) const;
+    static bool CheckScheme(std::string_view scheme);
 
     std::string uriString_;
-    std::string scheme_;
-    std::string ssp_;
-    std::string authority_;
-    std::string host_;
-    int port_;
-    std::string userInfo_;
-    std::string query_;
-    std::string path_;
-    std::string fragment_;
-    size_t cachedSsi_;
-    size_t cachedFsi_;
+    size_t schemeSeparator_ = std::string::npos;
+    Range scheme_;
+    Range ssp_;
+    Range authority_;
+    Range userInfo_;
+    Range host_;
+    Range path_;
+    Range query_;
+    Range fragment_;
+    int port_ = -1;
+    size_t hash_ = 0;
 };
 } // namespace OHOS
+
+namespace std {
+template<>
+struct hash<OHOS::Uri> {
+    size_t operator()(const OHOS::Uri& uri) const
+    {
+        return uri.Hash();
+    }
+};
+} // namespace std
 #endif // UTILS_NATIVE_INCLUDE_URI_H_
@@ -13,22 +13,20 @@
  * limitations under the License.
  */
 
-#include <regex>
+#include <cctype>
 #include <vector>
 #include "hilog/log.h"
 #include "string_ex.h"
 #include "uri.h"
 
 using std::string;
-using std::regex;
+using std::string_view;
 using OHOS::HiviewDFX::HiLog;
 
 namespace OHOS {
 namespace {
-    const string NOT_CACHED = "NOT VALID";
     const string EMPTY = "";
     const size_t NOT_FOUND = string::npos;
-    const int NOT_CALCULATED = -2;
     const int PORT_NONE = -1;
     const char SCHEME_SEPARATOR = ':';
     const char SCHEME_FRAGMENT = '#';
@@ -40,106 +38,73 @@ namespace {
     const size_t POS_INC = 1;
     const size_t POS_INC_MORE = 2;
     const size_t POS_INC_AGAIN = 3;
-    const regex SCHEME_REGEX("[a-zA-Z][a-zA-Z|\\d|+|-|.]*$");
     const HiviewDFX::HiLogLabel LABEL = {LOG_CORE, 0xD001800, "URI"};
 }; // namespace
 
-Uri::Uri(const string& uriString)
+Uri::Uri(const string& uriString) : uriString_(uriString)
 {
-    cachedSsi_ = NOT_FOUND;
-    cachedFsi_ = NOT_FOUND;
-    port_ = NOT_CALCULATED;
-
-    if (uriString.empty()) {
-        return;
-    }
-
-    uriString_ = uriString;
-    scheme_ = NOT_CACHED;
-    ssp_ = NOT_CACHED;
-    authority_ = NOT_CACHED;
-    host_ = NOT_CACHED;
-    userInfo_ = NOT_CACHED;
-    query_ = NOT_CACHED;
-    path_ = NOT_CACHED;
-    fragment_ = NOT_CACHED;
-
-    if (!CheckScheme()) {
-        uriString_ = EMPTY;
-        HiLog::Error(LABEL, "Scheme wrong!");
-    }
-}
-
-bool Uri::CheckScheme()
-{
-    scheme_ = ParseScheme();
-    if (scheme_.empty()) {
-        return true;
-    }
-    return regex_match(scheme_, SCHEME_REGEX);
+    Parse();
+    hash_ = std::hash<string>()(uriString_);
 }
 
-string Uri::GetScheme()
+void Uri::Parse()
 {
     if (uriString_.empty()) {
-        return EMPTY;
+        return;
     }
 
-    if (scheme_ == NOT_CACHED) {
-        scheme_ = ParseScheme();
+    size_t length = uriString_.length();
+    size_t ssi = uriString_.find(SCHEME_SEPARATOR);
+    if (ssi != NOT_FOUND) {
+        scheme_ = { 0, ssi };
+        if (!CheckScheme(View(scheme_))) {
+            uriString_ = EMPTY;
+            scheme_ = {};
+            HiLog::Error(LABEL, "Scheme wrong!");
+            return;
+        }
     }
-    return scheme_;
-}
-
-string Uri::ParseScheme()
-{
-    size_t ssi = FindSchemeSeparator();
-    return (ssi == NOT_FOUND) ? EMPTY : uriString_.substr(0, ssi);
-}
+    schemeSeparator_ = ssi;
 
-string Uri::GetSchemeSpecificPart()
-{
-    if (uriString_.empty()) {
-        return EMPTY;
+    // Only a '#' after the scheme separator starts the fragment.
+    size_t fsi = (ssi == NOT_FOUND) ? NOT_FOUND : uriString_.find(SCHEME_FRAGMENT, ssi);
+    if (fsi != NOT_FOUND) {
+        fragment_ = { fsi + POS_INC, length - fsi - POS_INC };
     }
 
-    return (ssp_ == NOT_CACHED) ? (ssp_ = ParseSsp()) : ssp_;
-}
-
-string Uri::ParseSsp()
-{
-    size_t ssi = FindSchemeSeparator();
-    size_t fsi = FindFragmentSeparator();
-
-    size_t start = (ssi == NOT_FOUND) ? 0 : (ssi + 1);
-    size_t end = (fsi == NOT_FOUND) ? uriString_.size() : fsi;
-
-    // Return everything between ssi and fsi.
-    string ssp = EMPTY;
-    if (end > start) {
-        ssp = uriString_.substr(start, end - start);
+    // The ssp is everything between ssi and fsi.
+    size_t sspStart = (ssi == NOT_FOUND) ? 0 : (ssi + POS_INC);
+    size_t sspEnd = (fsi == NOT_FOUND) ? length : fsi;
+    if (sspEnd > sspStart) {
+        ssp_ = { sspStart, sspEnd - sspStart };
     }
 
-    return ssp;
+    ParseAuthority(ssi);
+    ParsePath(ssi);
+    ParseQuery(ssi, fsi);
 }
 
-string Uri::GetAuthority()
+bool Uri::CheckScheme(string_view scheme)
 {
-    if (uriString_.empty()) {
-        return EMPTY;
+    // scheme = ALPHA *( ALPHA / DIGIT / "+" / "-" / "." )
+    if (scheme.empty()) {
+        return true;
     }
-
-    if (authority_ == NOT_CACHED) {
-        authority_ = ParseAuthority();
+    if (!isalpha(static_cast<unsigned char>(scheme.front()))) {
+        return false;
     }
-    return authority_;
+    for (char ch : scheme.substr(POS_INC)) {
+        if (!isalnum(static_cast<unsigned char>(ch)) && (ch != '+') && (ch != '-') && (ch != '.')) {
+            return false;
+        }
+    }
+    return true;
 }
 
-string Uri::ParseAuthority()
+void Uri::ParseAuthority(size_t ssi)
 {
-    size_t ssi = FindSchemeSeparator();
     if (ssi == NOT_FOUND) {
-        return EMPTY;
+        return;
     }
 
     size_t length = uriString_.length();
@@ -160,277 +125,219 @@ string Uri::ParseAuthority()
             end++;
         }
 
-        return uriString_.substr(start, end - start);
-    } else {
-        return EMPTY;
-    }
-}
-
-string Uri::GetUserInfo()
-{
-    if (uriString_.empty()) {
-        return EMPTY;
-    }
-
-    if (userInfo_ == NOT_CACHED) {
-        userInfo_ = ParseUserInfo();
-    }
-    return userInfo_;
-}
-
-string Uri::ParseUserInfo()
-{
-    string authority = GetAuthority();
-    if (authority.empty()) {
-        return EMPTY;
-    }
-
-    size_t end = authority.find_last_of(USER_HOST_SEPARATOR);
-    return (end == NOT_FOUND) ? EMPTY : authority.substr(0, end);
-}
-
-string Uri::GetHost()
-{
-    if (uriString_.empty()) {
-        return EMPTY;
-    }
-
-    if (host_ == NOT_CACHED) {
-        host_ = ParseHost();
+        authority_ = { start, end - start };
     }
-    return host_;
-}
 
-string Uri::ParseHost()
-{
-    string authority = GetAuthority();
+    string_view authority = View(authority_);
     if (authority.empty()) {
-        return EMPTY;
+        return;
     }
 
-    // Parse out user info and then port.
+    // Parse out user info, then host and port after it.
     size_t userInfoSeparator = authority.find_last_of(USER_HOST_SEPARATOR);
-    size_t start = (userInfoSeparator == NOT_FOUND) ? 0 : (userInfoSeparator + 1);
+    if (userInfoSeparator != NOT_FOUND) {
+        userInfo_ = { authority_.start, userInfoSeparator };
+    }
+    size_t start = (userInfoSeparator == NOT_FOUND) ? 0 : (userInfoSeparator + POS_INC);
     size_t portSeparator = authority.find_first_of(PORT_SEPARATOR, start);
     size_t end = (portSeparator == NOT_FOUND) ? authority.size() : portSeparator;
-
-    string host = EMPTY;
     if (start < end) {
-        host = authority.substr(start, end - start);
+        host_ = { authority_.start + start, end - start };
     }
 
-    return host;
-}
-
-int Uri::GetPort()
-{
-    if (uriString_.empty()) {
-        return PORT_NONE;
+    if (portSeparator != NOT_FOUND) {
+        int value = PORT_NONE;
+        port_ = StrToInt(string(authority.substr(portSeparator + POS_INC)), value) ? value : PORT_NONE;
     }
-
-    if (port_ == NOT_CALCULATED) {
-        port_ = ParsePort();
-    }
-    return port_;
 }
 
-int Uri::ParsePort()
+void Uri::ParsePath(size_t ssi)
 {
-    string authority = GetAuthority();
-    if (authority.empty()) {
-        return PORT_NONE;
+    size_t length = uriString_.length();
+    // If the URI is absolute, a '/' after the ':' means this is hierarchical, otherwise it is opaque.
+    if ((ssi != NOT_FOUND) && (((ssi + POS_INC) == length) || (uriString_.at(ssi + POS_INC) != LEFT_SEPARATOR))) {
+        return;
     }
 
-    // Make sure we look for the port separtor *after* the user info separator.
-    size_t userInfoSeparator = authority.find_last_of(USER_HOST_SEPARATOR);
-    size_t start = (userInfoSeparator == NOT_FOUND) ? 0 : (userInfoSeparator + 1);
-    size_t portSeparator = authority.find_first_of(PORT_SEPARATOR, start);
-    if (portSeparator == NOT_FOUND) {
-        return PORT_NONE;
-    }
+    // Find start of path.
+    size_t pathStart = (ssi == NOT_FOUND) ? 0 : (ssi + POS_INC);
+    if ((length > (pathStart + POS_INC)) && (uriString_.at(pathStart) == LEFT_SEPARATOR) &&
+        (uriString_.at(pathStart + POS_INC) == LEFT_SEPARATOR)) {
+        // Skip over authority to path.
+        pathStart += POS_INC_MORE;
 
-    start = portSeparator + 1;
-    string portString = authority.substr(start);
+        while (pathStart < length) {
+            char ch = uriString_.at(pathStart);
+            if ((ch == QUERY_FLAG) || (ch == SCHEME_FRAGMENT)) {
+                return;
+            }
 
-    int value = PORT_NONE;
-    return StrToInt(portString, value) ? value : PORT_NONE;
-}
+            if ((ch == LEFT_SEPARATOR) || (ch == RIGHT_SEPARATOR)) {
+                break;
+            }
 
-string Uri::GetQuery()
-{
-    if (uriString_.empty()) {
-        return EMPTY;
+            pathStart++;
+        }
     }
 
-    if (query_ == NOT_CACHED) {
-        query_ = ParseQuery();
+    // Find end of path.
+    size_t pathEnd = pathStart;
+    while (pathEnd < length) {
+        char ch = uriString_.at(pathEnd);
+        if ((ch == QUERY_FLAG) || (ch == SCHEME_FRAGMENT)) {
+            break;
+        }
+
+        pathEnd++;
     }
-    return query_;
+
+    path_ = { pathStart, pathEnd - pathStart };
 }
 
-string Uri::ParseQuery()
+void Uri::ParseQuery(size_t ssi, size_t fsi)
 {
-    size_t ssi = FindSchemeSeparator();
-    if (ssi == NOT_FOUND) {
-        ssi = 0;
-    }
-    size_t qsi = uriString_.find_first_of(QUERY_FLAG, ssi);
+    size_t qsi = uriString_.find_first_of(QUERY_FLAG, (ssi == NOT_FOUND) ? 0 : ssi);
     if (qsi == NOT_FOUND) {
-        return EMPTY;
+        return;
     }
 
-    size_t start = qsi + 1;
-    size_t fsi = FindFragmentSeparator();
+    size_t start = qsi + POS_INC;
     if (fsi == NOT_FOUND) {
-        return uriString_.substr(start);
+        query_ = { start, uriString_.length() - start };
+        return;
     }
 
     if (fsi < qsi) {
         // Invalid.
-        return EMPTY;
+        return;
     }
 
-    return uriString_.substr(start, fsi - start);
+    query_ = { start, fsi - start };
 }
 
-string Uri::GetPath()
+string_view Uri::View(const Range& range) const
 {
-    if (uriString_.empty()) {
-        return EMPTY;
-    }
+    return string_view(uriString_).substr(range.start, range.length);
+}
 
-    if (path_ == NOT_CACHED) {
-        path_ = ParsePath();
-    }
-    return path_;
+string Uri::GetScheme() const
+{
+    return string(View(scheme_));
 }
 
-void Uri::GetPathSegments(std::vector<std::string>& segments)
+string Uri::GetSchemeSpecificPart() const
 {
-    if (uriString_.empty()) {
-        return;
-    }
-    if (path_ == NOT_CACHED) {
-        path_ = ParsePath();
-    }
+    return string(View(ssp_));
+}
 
-    size_t previous = 0;
-    size_t current;
-    while ((current = path_.find(LEFT_SEPARATOR, previous)) != std::string::npos) {
-        if (previous < current) {
-            segments.emplace_back(path_.substr(previous, current - previous));
-        }
-        previous = current + POS_INC;
-    }
-    // Add in the final path segment.
-    if (previous < path_.length()) {
-        segments.emplace_back(path_.substr(previous));
-    }
+string Uri::GetAuthority() const
+{
+    return string(View(authority_));
 }
 
-string Uri::ParsePath()
+string Uri::GetUserInfo() const
 {
-    size_t ssi = FindSchemeSeparator();
-    // If the URI is absolute.
-    if (ssi != NOT_FOUND) {
-        // Is there anything after the ':'?
-        if ((ssi + 1) == uriString_.length()) {
-            // Opaque URI.
-            return EMPTY;
-        }
+    return string(View(userInfo_));
+}
 
-        // A '/' after the ':' means this is hierarchical.
-        if (uriString_.at(ssi + 1) != LEFT_SEPARATOR) {
-            // Opaque URI.
-            return EMPTY;
-        }
-    } else {
-        // All relative URIs are hierarchical.
-    }
+string Uri::GetHost() const
+{
+    return string(View(host_));
+}
 
-    return ParsePath(ssi);
+int Uri::GetPort() const
+{
+    return port_;
 }
 
-string Uri::ParsePath(size_t ssi)
+string Uri::GetQuery() const
 {
-    size_t length = uriString_.length();
+    return string(View(query_));
+}
 
-    // Find start of path.
-    size_t pathStart = (ssi == NOT_FOUND) ? 0 : (ssi + POS_INC);
-    if ((length > (pathStart + POS_INC)) && (uriString_.at(pathStart) == LEFT_SEPARATOR) &&
-        (uriString_.at(pathStart + POS_INC) == LEFT_SEPARATOR)) {
-        // Skip over authority to path.
-        pathStart += POS_INC_MORE;
+string Uri::GetPath() const
+{
+    return string(View(path_));
+}
 
-        while (pathStart < length) {
-            char ch = uriString_.at(pathStart);
-            if ((ch == QUERY_FLAG) || (ch == SCHEME_FRAGMENT)) {
-                return EMPTY;
-            }
+string Uri::GetFragment() const
+{
+    return string(View(fragment_));
+}
 
-            if ((ch == LEFT_SEPARATOR) || (ch == RIGHT_SEPARATOR)) {
-                break;
-            }
+string_view Uri::GetSchemeView() const
+{
+    return View(scheme_);
+}
 
-            pathStart++;
-        }
-    }
+string_view Uri::GetSchemeSpecificPartView() const
+{
+    return View(ssp_);
+}
 
-    // Find end of path.
-    size_t pathEnd = pathStart;
-    while (pathEnd < length) {
-        char ch = uriString_.at(pathEnd);
-        if ((ch == QUERY_FLAG) || (ch == SCHEME_FRAGMENT)) {
-            break;
-        }
+string_view Uri::GetAuthorityView() const
+{
+    return View(authority_);
+}
 
-        pathEnd++;
-    }
+string_view Uri::GetHostView() const
+{
+    return View(host_);
+}
 
-    return uriString_.substr(pathStart, pathEnd - pathStart);
+string_view Uri::GetUserInfoView() const
+{
+    return View(userInfo_);
 }
 
-string Uri::GetFragment()
+string_view Uri::GetQueryView() const
 {
-    if (uriString_.empty()) {
-        return EMPTY;
-    }
+    return View(query_);
+}
 
-    if (fragment_ == NOT_CACHED) {
-        fragment_ = ParseFragment();
-    }
-    return fragment_;
+string_view Uri::GetPathView() const
+{
+    return View(path_);
 }
 
-string Uri::ParseFragment()
+string_view Uri::GetFragmentView() const
 {
-    size_t fsi = FindFragmentSeparator();
-    return (fsi == NOT_FOUND) ? EMPTY : uriString_.substr(fsi + 1);
+    return View(fragment_);
 }
 
-size_t Uri::FindSchemeSeparator()
+void Uri::GetPathSegments(std::vector<std::string>& segments) const
 {
-    if (cachedSsi_ == NOT_FOUND) {
-        cachedSsi_ = uriString_.find_first_of(SCHEME_SEPARATOR);
+    std::vector<string_view> segmentViews;
+    GetPathSegments(segmentViews);
+    for (auto segment : segmentViews) {
+        segments.emplace_back(segment);
     }
-    return cachedSsi_;
 }
 
-size_t Uri::FindFragmentSeparator()
+void Uri::GetPathSegments(std::vector<string_view>& segments) const
 {
-    if (cachedFsi_ == NOT_FOUND) {
-        cachedFsi_ = uriString_.find_first_of(SCHEME_FRAGMENT, FindSchemeSeparator());
+    string_view path = View(path_);
+    size_t previous = 0;
+    size_t current;
+    while ((current = path.find(LEFT_SEPARATOR, previous)) != NOT_FOUND) {
+        if (previous < current) {
+            segments.emplace_back(path.substr(previous, current - previous));
+        }
+        previous = current + POS_INC;
+    }
+    // Add in the final path segment.
+    if (previous < path.length()) {
+        segments.emplace_back(path.substr(previous));
     }
-    return cachedFsi_;
 }
 
-bool Uri::IsHierarchical()
+bool Uri::IsHierarchical() const
 {
     if (uriString_.empty()) {
         return false;
     }
 
-    size_t ssi = FindSchemeSeparator();
+    size_t ssi = schemeSeparator_;
     if (ssi == NOT_FOUND) {
         // All relative URIs are hierarchical.
         return true;
@@ -445,7 +352,7 @@ bool Uri::IsHierarchical()
     return (uriString_.at(ssi + 1) == LEFT_SEPARATOR);
 }
 
-bool Uri::IsOpaque()
+bool Uri::IsOpaque() const
 {
     if (uriString_.empty()) {
         return false;
@@ -454,7 +361,7 @@ bool Uri::IsOpaque()
     return !IsHierarchical();
 }
 
-bool Uri::IsAbsolute()
+bool Uri::IsAbsolute() const
 {
     if (uriString_.empty()) {
         return false;
@@ -463,34 +370,34 @@ bool Uri::IsAbsolute()
     return !IsRelative();
 }
 
-bool Uri::IsRelative()
+bool Uri::IsRelative() const
 {
     if (uriString_.empty()) {
         return false;
     }
 
     // Note: We return true if the index is 0
-    return FindSchemeSeparator() == NOT_FOUND;
+    return schemeSeparator_ == NOT_FOUND;
 }
 
 bool Uri::Equals(const Uri& other) const
 {
-    return ToString() == other.ToString();
+    return *this == other;
 }
 
 int Uri::CompareTo(const Uri& other) const
 {
-    return ToString().compare(other.ToString());
+    return uriString_.compare(other.uriString_);
 }
 
-string Uri::ToString() const
+const string& Uri::ToString() const
 {
     return uriString_;
 }
 
 bool Uri::operator==(const Uri& other) const
 {
-    return ToString() == other.ToString();
+    return (hash_ == other.hash_) && (uriString_ == other.uriString_);
 }
 
 bool Uri::Marshalling(Parcel& parcel) const
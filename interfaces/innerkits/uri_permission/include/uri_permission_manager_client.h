@@ -41,6 +41,18 @@ public:
      */
     void GrantUriPermission(const Uri &uri, unsigned int flag, const Security::AccessToken::AccessTokenID fromTokenId,
         const Security::AccessToken::AccessTokenID targetTokenId);
+
+    /**
+     * @brief Authorize the uri permissions of fromTokenId to targetTokenId.
+     *
+     * @param uris The file uris.
+     * @param flag Want::FLAG_AUTH_READ_URI_PERMISSION or Want::FLAG_AUTH_WRITE_URI_PERMISSION.
+     * @param fromTokenId The owner of uris.
+     * @param targetTokenId The user of uris.
+     */
+    void GrantUriPermissions(const std::vector<Uri> &uris, unsigned int flag,
+        const Security::AccessToken::AccessTokenID fromTokenId,
+        const Security::AccessToken::AccessTokenID targetTokenId);
     
     /**
      * @brief Check whether the tokenId has URI permissions.
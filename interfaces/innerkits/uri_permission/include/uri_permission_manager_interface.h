@@ -16,6 +16,8 @@
 #ifndef OHOS_AAFWK_URI_PERMISSION_MANAGER_INTERFACE_H
 #define OHOS_AAFWK_URI_PERMISSION_MANAGER_INTERFACE_H
 
+#include <vector>
+
 #include "base/security/access_token/interfaces/innerkits/accesstoken/include/access_token.h"
 #include "iremote_broker.h"
 #include "uri.h"
@@ -26,6 +28,9 @@ class IUriPermissionManager : public IRemoteBroker {
 public:
     DECLARE_INTERFACE_DESCRIPTOR(u"ohos.aafwk.UriPermissionManager");
 
+    // the most uris one request carries, the proxy splits longer lists
+    static constexpr size_t MAX_URI_COUNT = 500;
+
     /**
      * @brief Authorize the uri permission of fromTokenId to targetTokenId.
      *
@@ -38,6 +43,18 @@ public:
         const Security::AccessToken::AccessTokenID fromTokenId,
         const Security::AccessToken::AccessTokenID targetTokenId) = 0;
 
+    /**
+     * @brief Authorize the uri permissions of fromTokenId to targetTokenId.
+     *
+     * @param uris The file uris.
+     * @param flag Want::FLAG_AUTH_READ_URI_PERMISSION or Want::FLAG_AUTH_WRITE_URI_PERMISSION.
+     * @param fromTokenId The owner of uris.
+     * @param targetTokenId The user of uris.
+     */
+    virtual void GrantUriPermissions(const std::vector<Uri> &uris, unsigned int flag,
+        const Security::AccessToken::AccessTokenID fromTokenId,
+        const Security::AccessToken::AccessTokenID targetTokenId) = 0;
+
     /**
      * @brief Check whether the tokenId has URI permissions.
      *
@@ -65,6 +82,9 @@ public:
 
         // ipc id for RemoveUriPermission
         ON_REMOVE_URI_PERMISSION,
+
+        // ipc id for GrantUriPermissions
+        ON_GRANT_URI_PERMISSIONS,
     };
 };
 }  // namespace AAFwk
@@ -30,12 +30,20 @@ public:
         const Security::AccessToken::AccessTokenID fromTokenId,
         const Security::AccessToken::AccessTokenID targetTokenId) override;
 
+    virtual void GrantUriPermissions(const std::vector<Uri> &uris, unsigned int flag,
+        const Security::AccessToken::AccessTokenID fromTokenId,
+        const Security::AccessToken::AccessTokenID targetTokenId) override;
+
     virtual bool VerifyUriPermission(const Uri &uri, unsigned int flag,
         const Security::AccessToken::AccessTokenID tokenId) override;
 
     virtual void RemoveUriPermission(const Security::AccessToken::AccessTokenID tokenId) override;
 
 private:
+    void SendGrantUriPermissions(std::vector<Uri>::const_iterator begin, std::vector<Uri>::const_iterator end,
+        unsigned int flag, const Security::AccessToken::AccessTokenID fromTokenId,
+        const Security::AccessToken::AccessTokenID targetTokenId);
+
     static inline BrokerDelegator<UriPermissionManagerProxy> delegator_;
 };
 }  // namespace AAFwk
@@ -32,6 +32,19 @@ void UriPermissionManagerClient::GrantUriPermission(const Uri &uri, unsigned int
     }
 }
 
+void UriPermissionManagerClient::GrantUriPermissions(const std::vector<Uri> &uris, unsigned int flag,
+    const Security::AccessToken::AccessTokenID fromTokenId, const Security::AccessToken::AccessTokenID targetTokenId)
+{
+    HILOG_DEBUG("UriPermissionManagerClient::GrantUriPermissions is called.");
+    if (uris.empty()) {
+        return;
+    }
+    auto uriPermMgr = ConnectUriPermService();
+    if (uriPermMgr) {
+        uriPermMgr->GrantUriPermissions(uris, flag, fromTokenId, targetTokenId);
+    }
+}
+
 bool UriPermissionManagerClient::VerifyUriPermission(const Uri &uri, unsigned int flag,
     const Security::AccessToken::AccessTokenID tokenId)
 {
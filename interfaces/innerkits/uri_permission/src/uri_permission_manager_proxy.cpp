@@ -15,6 +15,8 @@
 
 #include "uri_permission_manager_proxy.h"
 
+#include <algorithm>
+
 #include "hilog_wrapper.h"
 #include "parcel.h"
 
@@ -56,6 +58,56 @@ void UriPermissionManagerProxy::GrantUriPermission(const Uri &uri, unsigned int
     }
 }
 
+void UriPermissionManagerProxy::GrantUriPermissions(const std::vector<Uri> &uris, unsigned int flag,
+    const Security::AccessToken::AccessTokenID fromTokenId, const Security::AccessToken::AccessTokenID targetTokenId)
+{
+    HILOG_DEBUG("UriPermissionManagerProxy::GrantUriPermissions is called, count: %{public}zu.", uris.size());
+    for (auto begin = uris.begin(); begin != uris.end();) {
+        auto end = begin + std::min(static_cast<size_t>(uris.end() - begin), MAX_URI_COUNT);
+        SendGrantUriPermissions(begin, end, flag, fromTokenId, targetTokenId);
+        begin = end;
+    }
+}
+
+void UriPermissionManagerProxy::SendGrantUriPermissions(std::vector<Uri>::const_iterator begin,
+    std::vector<Uri>::const_iterator end, unsigned int flag,
+    const Security::AccessToken::AccessTokenID fromTokenId, const Security::AccessToken::AccessTokenID targetTokenId)
+{
+    MessageParcel data;
+    if (!data.WriteInterfaceToken(IUriPermissionManager::GetDescriptor())) {
+        HILOG_ERROR("Write interface token failed.");
+        return;
+    }
+    if (!data.WriteInt32(static_cast<int32_t>(end - begin))) {
+        HILOG_ERROR("Write uri count failed.");
+        return;
+    }
+    for (auto iter = begin; iter != end; ++iter) {
+        if (!data.WriteParcelable(&(*iter))) {
+            HILOG_ERROR("Write uri failed.");
+            return;
+        }
+    }
+    if (!data.WriteInt32(flag)) {
+        HILOG_ERROR("Write flag failed.");
+        return;
+    }
+    if (!data.WriteInt32(fromTokenId)) {
+        HILOG_ERROR("Write fromTokenId failed.");
+        return;
+    }
+    if (!data.WriteInt32(targetTokenId)) {
+        HILOG_ERROR("Write targetTokenId failed.");
+        return;
+    }
+    MessageParcel reply;
+    MessageOption option;
+    int error = Remote()->SendRequest(UriPermMgrCmd::ON_GRANT_URI_PERMISSIONS, data, reply, option);
+    if (error != ERR_OK) {
+        HILOG_ERROR("SendRequest fail, error: %{public}d", error);
+    }
+}
+
 bool UriPermissionManagerProxy::VerifyUriPermission(const Uri &uri, unsigned int flag,
     const Security::AccessToken::AccessTokenID tokenId)
 {
@@ -41,6 +41,33 @@ int UriPermissionManagerStub::OnRemoteRequest(
             GrantUriPermission(*uri, flag, fromTokenId, targetTokenId);
             break;
         }
+        case UriPermMgrCmd::ON_GRANT_URI_PERMISSIONS : {
+            auto count = data.ReadInt32();
+            if (count <= 0 || static_cast<size_t>(count) > MAX_URI_COUNT) {
+                errCode = ERR_INVALID_VALUE;
+                HILOG_ERROR("Invalid uri count: %{public}d.", count);
+                break;
+            }
+            std::vector<Uri> uris;
+            uris.reserve(count);
+            for (int32_t i = 0; i < count; i++) {
+                std::unique_ptr<Uri> uri(data.ReadParcelable<Uri>());
+                if (!uri) {
+                    errCode = ERR_DEAD_OBJECT;
+                    HILOG_ERROR("To read uri failed.");
+                    break;
+                }
+                uris.emplace_back(*uri);
+            }
+            if (errCode != ERR_OK) {
+                break;
+            }
+            auto flag = data.ReadInt32();
+            auto fromTokenId = data.ReadInt32();
+            auto targetTokenId = data.ReadInt32();
+            GrantUriPermissions(uris, flag, fromTokenId, targetTokenId);
+            break;
+        }
         case UriPermMgrCmd::ON_VERIFY_URI_PERMISSION : {
             std::unique_ptr<Uri> uri(data.ReadParcelable<Uri>());
             if (!uri) {
@@ -470,6 +470,19 @@ public:
      */
     static PacMap *Unmarshalling(Parcel &parcel);
 
+    /**
+     * @brief Sets the parcel format written by Marshalling(). Unmarshalling() accepts both formats, so the
+     * binary format (typed values, no JSON) must only be enabled once every reader understands it.
+     * @param binary Indicates whether to write the binary format.
+     */
+    static void SetBinaryMarshalling(bool binary);
+
+    /**
+     * @brief Checks whether Marshalling() writes the binary parcel format.
+     * @return Returns true if the binary format is written; returns false otherwise.
+     */
+    static bool IsBinaryMarshalling();
+
     /**
      * @brief Save pacmap to string.
      * @return Returns the string.
@@ -497,9 +510,16 @@ private:
     bool GetArrayJsonValue(PacMapList::const_iterator &it, Json::Value &json) const;
     bool GetUserObjectJsonValue(PacMapList::const_iterator &it, Json::Value &json) const;
     void ShallowCopyData(PacMapList &desPacMap, const PacMapList &srcPacMap);
+    void DeepCopyData(PacMapList &desPacMap, const PacMapList &srcPacMap);
     void RemoveData(PacMapList &srcPacMap, const std::string &key);
     bool EqualPacMapData(const PacMapList &leftPacMapList, const PacMapList &rightPacMapList);
     bool ReadFromParcel(Parcel &parcel);
+    bool WriteMapListToParcel(Parcel &parcel, const PacMapList &mapList) const;
+    bool WriteValueToParcel(Parcel &parcel, IInterface *value) const;
+    bool WriteArrayToParcel(Parcel &parcel, IArray *array) const;
+    bool ReadMapListFromParcel(Parcel &parcel, PacMapList &mapList, int depth);
+    bool ReadValueFromParcel(Parcel &parcel, PacMapList &mapList, const std::string &key, int type, int depth);
+    bool ReadArrayFromParcel(Parcel &parcel, PacMapList &mapList, const std::string &key, int type);
 
     bool ParseJson(Json::Value &data, PacMapList &mapList);
     bool ParseJsonItem(PacMapList &mapList, const std::string &key, Json::Value &item);
@@ -16,6 +16,7 @@
 #ifndef OHOS_AAFWK_SKILLS_H
 #define OHOS_AAFWK_SKILLS_H
 
+#include <memory>
 #include <vector>
 #include <string>
 #include "want.h"
@@ -403,7 +404,16 @@ public:
      *
      * @param want The desired want data to match for.
      */
-    bool Match(const Want &want);
+    bool Match(const Want &want) const;
+
+    /**
+     * @brief Match a Want against a list of skills. The Want is decoded once for the whole list.
+     *
+     * @param want The desired want data to match for.
+     * @param skillsList The skills to match against.
+     * @return Returns the indexes in skillsList of the skills that match the want.
+     */
+    static std::vector<size_t> MatchAll(const Want &want, const std::vector<Skills> &skillsList);
 
     /**
      * @brief Obtains the want params data.
@@ -458,6 +468,12 @@ private:
     WantParams wantParams_;
     bool hasPartialTypes_ = false;
 
+    struct MatchIndex;
+    struct MatchTarget;
+
+    // hashed lookup sets built from the lists above on the first match, dropped on every change
+    mutable std::shared_ptr<const MatchIndex> matchIndex_;
+
     // no object in parcel
     static constexpr int VALUE_NULL = -1;
     // object exist in parcel
@@ -466,43 +482,47 @@ private:
 private:
     bool ReadFromParcel(Parcel &parcel);
 
+    std::shared_ptr<const MatchIndex> GetMatchIndex() const;
+
+    void InvalidateMatchIndex();
+
+    bool Match(MatchTarget &target) const;
+
     /**
      * @brief Match this skills against a Want's action.  If the skills does not
      * specify any actions, the match will always fail.
      *
-     * @param action The desired action to look for.
+     * @param index The lookup sets of this skills.
+     * @param target The decoded want data, holding the desired action to look for.
      *
      * @return True if the action is listed in the skills.
      */
-    bool MatchAction(const std::string &action);
+    bool MatchAction(const MatchIndex &index, const MatchTarget &target) const;
 
     /**
      * @brief Match this skills against a Want's data (type, scheme and path).
      *
-     * @param type The desired data type to look for.
-     * @param scheme The desired data scheme to look for.
-     * @param data The full data string to match against.
+     * @param index The lookup sets of this skills.
+     * @param target The decoded want data to match against.
      *
      * @return Returns either a valid match constant.
      */
-    int MatchData(const std::string &type, const std::string &scheme, Uri data);
-
-    bool FindMimeType(const std::string &type);
+    int MatchData(const MatchIndex &index, const MatchTarget &target) const;
 
-    bool RegionMatches(const std::string &type, int toffset, const std::string &other, int ooffset, int len);
+    bool FindMimeType(const MatchIndex &index, const MatchTarget &target) const;
 
     /**
      * @brief Match this skills against a Want's entities.  Each entity in
      * the Want must be specified by the skills; if any are not in the
      * skills, the match fails.
      *
-     * @param entities The entities included in the want, as returned by
-     *                   Want.getEntities().
+     * @param index The lookup sets of this skills.
+     * @param target The decoded want data, holding the entities included in the want.
      *
      * @return If all entities match (success), null; else the name of the
      *         first entity that didn't match.
      */
-    std::string MatchEntities(const std::vector<std::string> &entities);
+    std::string MatchEntities(const MatchIndex &index, const MatchTarget &target) const;
 };
 
 }  // namespace AAFwk
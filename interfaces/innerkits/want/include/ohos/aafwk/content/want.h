@@ -757,6 +757,19 @@ public:
      */
     static Want *Unmarshalling(Parcel &parcel);
 
+    /**
+     * @description: Sets the parcel format written by Marshalling(). Unmarshalling() accepts both formats, so the
+     * compact format (UTF-8 strings, parameters inlined) must only be enabled once every reader understands it.
+     * @param compact Indicates whether to write the compact format.
+     */
+    static void SetCompactMarshalling(bool compact);
+
+    /**
+     * @description: Checks whether Marshalling() writes the compact parcel format.
+     * @return Returns true if the compact format is written; returns false otherwise.
+     */
+    static bool IsCompactMarshalling();
+
     void DumpInfo(int level) const;
 
     std::string ToString() const;
@@ -838,6 +851,8 @@ private:
     static bool ParseContent(const std::string &content, std::string &prop, std::string &value);
     static bool ParseUriInternal(const std::string &content, OHOS::AppExecFwk::ElementName &element, Want &want);
     bool ReadFromParcel(Parcel &parcel);
+    bool MarshallingCompact(Parcel &parcel) const;
+    bool ReadFromParcelCompact(Parcel &parcel);
     static bool CheckAndSetParameters(Want &want, const std::string &key, std::string &prop, const std::string &value);
     Uri GetLowerCaseScheme(const Uri &uri);
     void ToUriStringInner(std::string &uriString) const;
@@ -17,6 +17,7 @@
 
 #include <iostream>
 #include <map>
+#include <memory>
 #include <set>
 #include <vector>
 #include "ohos/aafwk/base/base_interfaces.h"
@@ -25,6 +26,8 @@
 
 namespace OHOS {
 namespace AAFwk {
+class Want;
+
 class UnsupportedData {
 public:
     std::u16string key;
@@ -64,7 +67,7 @@ public:
 
     sptr<IInterface> GetParam(const std::string &key) const;
 
-    const std::map<std::string, sptr<IInterface>> &GetParams() const;
+    std::map<std::string, sptr<IInterface>> GetParams() const;
 
     const std::set<std::string> KeySet() const;
 
@@ -116,11 +119,15 @@ private:
         VALUE_TYPE_ARRAY = 102,
     };
 
-    bool WriteArrayToParcel(Parcel &parcel, IArray *ao) const;
-    bool ReadArrayToParcel(Parcel &parcel, int type, sptr<IArray> &ao);
-    bool ReadFromParcel(Parcel &parcel);
-    bool ReadFromParcelParam(Parcel &parcel, const std::string &key, int type);
-    bool ReadFromParcelString(Parcel &parcel, const std::string &key);
+    struct Value;
+    struct Entry;
+    struct Storage;
+
+    bool WriteArrayToParcel(Parcel &parcel, IArray *ao, bool compact) const;
+    bool ReadArrayToParcel(Parcel &parcel, int type, sptr<IArray> &ao, bool compact);
+    bool ReadFromParcel(Parcel &parcel, bool compact = false);
+    bool ReadFromParcelParam(Parcel &parcel, const std::string &key, int type, bool compact);
+    bool ReadFromParcelString(Parcel &parcel, const std::string &key, bool compact);
     bool ReadFromParcelBool(Parcel &parcel, const std::string &key);
     bool ReadFromParcelInt8(Parcel &parcel, const std::string &key);
     bool ReadFromParcelChar(Parcel &parcel, const std::string &key);
@@ -130,7 +137,7 @@ private:
     bool ReadFromParcelFloat(Parcel &parcel, const std::string &key);
     bool ReadFromParcelDouble(Parcel &parcel, const std::string &key);
 
-    bool ReadFromParcelArrayString(Parcel &parcel, sptr<IArray> &ao);
+    bool ReadFromParcelArrayString(Parcel &parcel, sptr<IArray> &ao, bool compact);
     bool ReadFromParcelArrayBool(Parcel &parcel, sptr<IArray> &ao);
     bool ReadFromParcelArrayByte(Parcel &parcel, sptr<IArray> &ao);
     bool ReadFromParcelArrayChar(Parcel &parcel, sptr<IArray> &ao);
@@ -143,7 +150,7 @@ private:
     bool ReadFromParcelArrayWantParams(Parcel &parcel, sptr<IArray> &ao);
     bool ReadFromParcelWantParamWrapper(Parcel &parcel, const std::string &key);
 
-    bool WriteArrayToParcelString(Parcel &parcel, IArray *ao) const;
+    bool WriteArrayToParcelString(Parcel &parcel, IArray *ao, bool compact) const;
     bool WriteArrayToParcelBool(Parcel &parcel, IArray *ao) const;
     bool WriteArrayToParcelByte(Parcel &parcel, IArray *ao) const;
     bool WriteArrayToParcelChar(Parcel &parcel, IArray *ao) const;
@@ -154,27 +161,23 @@ private:
     bool WriteArrayToParcelDouble(Parcel &parcel, IArray *ao) const;
     bool WriteArrayToParcelWantParams(Parcel &parcel, IArray *ao) const;
 
-    bool WriteMarshalling(Parcel &parcel, sptr<IInterface> &o) const;
-    bool WriteToParcelString(Parcel &parcel, sptr<IInterface> &o) const;
-    bool WriteToParcelBool(Parcel &parcel, sptr<IInterface> &o) const;
-    bool WriteToParcelByte(Parcel &parcel, sptr<IInterface> &o) const;
-    bool WriteToParcelChar(Parcel &parcel, sptr<IInterface> &o) const;
-    bool WriteToParcelShort(Parcel &parcel, sptr<IInterface> &o) const;
-    bool WriteToParcelInt(Parcel &parcel, sptr<IInterface> &o) const;
-    bool WriteToParcelLong(Parcel &parcel, sptr<IInterface> &o) const;
-    bool WriteToParcelFloat(Parcel &parcel, sptr<IInterface> &o) const;
-    bool WriteToParcelDouble(Parcel &parcel, sptr<IInterface> &o) const;
-    bool WriteToParcelWantParams(Parcel &parcel, sptr<IInterface> &o) const;
-
-    bool DoMarshalling(Parcel &parcel) const;
+    bool WriteValueToParcel(Parcel &parcel, const Value &value, bool compact) const;
+
+    // compact: UTF-8 strings, written and read in place by Want's compact parcel format
+    bool DoMarshalling(Parcel &parcel, bool compact = false) const;
     bool ReadUnsupportedData(Parcel &parcel, const std::string &key, int type);
 
+    friend class Want;
     friend class WantParamWrapper;
     // inner use function
-    bool NewArrayData(IArray *source, sptr<IArray> &dest);
-    bool NewParams(const WantParams &source, WantParams &dest);
-    std::map<std::string, sptr<IInterface>> params_;
-    std::vector<UnsupportedData> cachedUnsupportedData_;
+    static bool NewArrayData(IArray *source, sptr<IArray> &dest);
+    static void MakeValue(IInterface *object, Value &value);
+    static std::shared_ptr<Storage> ShareStorage(const std::shared_ptr<Storage> &storage);
+    Storage &MutableStorage();
+    void SetParamValue(const std::string &key, Value &&value);
+
+    // shared, copy-on-write; nullptr means empty
+    std::shared_ptr<Storage> storage_;
 };
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_ABILITY_LIFECYCLE_METRICS_H
+#define OHOS_AAFWK_ABILITY_LIFECYCLE_METRICS_H
+
+#include <array>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "latency_histogram.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @enum LifecyclePhase
+ * Phase of an ability lifecycle whose latency is measured.
+ */
+enum class LifecyclePhase : uint32_t {
+    // from the load request to the first foreground or active done, what the user waits for
+    START = 0,
+    // from the load request to the ability thread attached, it covers the process start
+    LOAD,
+    FOREGROUND,
+    BACKGROUND,
+    ACTIVE,
+    INACTIVE,
+    TERMINATE,
+    PHASE_COUNT,
+};
+
+/**
+ * The latency histograms of the lifecycle phases of one bundle.
+ */
+struct LifecycleHistograms {
+    std::string bundleName;
+    std::array<LatencyHistogram, static_cast<size_t>(LifecyclePhase::PHASE_COUNT)> phases;
+};
+
+/**
+ * @class AbilityLifecycleMetrics
+ * Service-wide lifecycle latencies by bundle and phase. An ability record takes the histograms of its bundle
+ * once, then records without locking. Summaries go to hisysevent now and then and to dumpsys on demand.
+ */
+class AbilityLifecycleMetrics {
+    DECLARE_DELAYED_SINGLETON(AbilityLifecycleMetrics)
+public:
+    /**
+     * Get the histograms of a bundle, created on first use. Once MAX_BUNDLE_COUNT bundles are tracked, the
+     * bundles beyond share one histogram set.
+     *
+     * @param bundleName the bundle name.
+     * @return the histograms of the bundle.
+     */
+    std::shared_ptr<LifecycleHistograms> GetHistograms(const std::string &bundleName);
+
+    /**
+     * Record the latency of a phase, and report the summary of the phase every REPORT_INTERVAL latencies.
+     *
+     * @param histograms the histograms of the bundle.
+     * @param phase the lifecycle phase.
+     * @param latencyUs the latency in microseconds.
+     */
+    void Record(const std::shared_ptr<LifecycleHistograms> &histograms, LifecyclePhase phase, uint64_t latencyUs);
+
+    /**
+     * Dump the latency summary of every bundle and phase.
+     *
+     * @param info output dump info.
+     */
+    void Dump(std::vector<std::string> &info);
+
+    static const char *GetPhaseName(LifecyclePhase phase);
+
+    /**
+     * Get the monotonic time lifecycle latencies are measured with.
+     *
+     * @return the time in microseconds.
+     */
+    static int64_t GetTimeUs();
+
+private:
+    static constexpr size_t MAX_BUNDLE_COUNT = 128;
+    static constexpr uint64_t REPORT_INTERVAL = 256;
+
+    void Report(const LifecycleHistograms &histograms, LifecyclePhase phase);
+
+    std::shared_mutex mutex_;
+    std::unordered_map<std::string, std::shared_ptr<LifecycleHistograms>> bundleHistograms_;
+    std::shared_ptr<LifecycleHistograms> otherHistograms_;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_ABILITY_LIFECYCLE_METRICS_H
@@ -27,6 +27,8 @@
 #include "ability_connect_manager.h"
 #include "ability_event_handler.h"
 #include "ability_manager_stub.h"
+#include "ability_resolve_cache.h"
+#include "ability_token_index.h"
 #include "app_scheduler.h"
 #include "atomic_service_status_callback.h"
 #include "bundlemgr/bundle_mgr_interface.h"
@@ -40,6 +42,7 @@
 #include "mission_list_manager.h"
 #include "system_ability.h"
 #include "uri.h"
+#include "uri_owner_cache.h"
 #include "ability_config.h"
 #include "pending_want_manager.h"
 #include "ams_configuration_parameter.h"
@@ -68,6 +71,7 @@ class AbilityManagerService : public SystemAbility,
 public:
     void OnStart() override;
     void OnStop() override;
+    void OnAddSystemAbility(int32_t systemAbilityId, const std::string &deviceId) override;
     ServiceRunningState QueryServiceState() const;
 
     /**
@@ -806,6 +810,9 @@ public:
         KEY_DUMPSYS_PENDING,
         KEY_DUMPSYS_PROCESS,
         KEY_DUMPSYS_DATA,
+        KEY_DUMPSYS_RESOLVE_CACHE,
+        KEY_DUMPSYS_PERF,
+        KEY_DUMPSYS_IPC,
     };
 
     friend class UserController;
@@ -942,6 +949,12 @@ private:
         const std::string &args, std::vector<std::string> &info, bool isClient, bool isUserID, int userId);
     void DataDumpSysStateInner(
         const std::string &args, std::vector<std::string> &info, bool isClient, bool isUserID, int userId);
+    void DumpSysResolveCacheInner(
+        const std::string &args, std::vector<std::string> &info, bool isClient, bool isUserID, int userId);
+    void DumpSysPerfInner(
+        const std::string &args, std::vector<std::string> &info, bool isClient, bool isUserID, int userId);
+    void DumpSysIpcInner(
+        const std::string &args, std::vector<std::string> &info, bool isClient, bool isUserID, int userId);
     ErrCode ProcessMultiParam(std::vector<std::string> &argsStr, std::string &result);
     void ShowHelp(std::string &result);
     void ShowIllealInfomation(std::string &result);
@@ -952,6 +965,8 @@ private:
 
     int32_t InitAbilityInfoFromExtension(AppExecFwk::ExtensionAbilityInfo &extensionInfo,
         AppExecFwk::AbilityInfo &abilityInfo);
+    int QueryAbilityInfo(const sptr<AppExecFwk::IBundleMgr> &bms, const Want &want, int32_t abilityInfoFlag,
+        int32_t userId, AppExecFwk::AbilityInfo &abilityInfo);
 #ifdef SUPPORT_GRAPHICS
     int32_t ShowPickerDialog(const Want& want, int32_t userId);
 #endif
@@ -972,6 +987,7 @@ private:
     bool IsSystemUI(const std::string &bundleName) const;
 
     bool VerificationAllToken(const sptr<IRemoteObject> &token);
+    bool GetIndexedTokenEntryLocked(const sptr<IRemoteObject> &token, AbilityTokenIndex::Entry &entry);
     std::shared_ptr<DataAbilityManager> GetDataAbilityManager(const sptr<IAbilityScheduler> &scheduler);
     bool CheckDataAbilityRequest(AbilityRequest &abilityRequest);
     std::shared_ptr<MissionListManager> GetListManagerByUserId(int32_t userId);
@@ -1028,6 +1044,8 @@ private:
     std::unordered_map<int, std::shared_ptr<AbilityConnectManager>> connectManagers_;
     std::shared_ptr<AbilityConnectManager> connectManager_;
     sptr<AppExecFwk::IBundleMgr> iBundleManager_;
+    UriOwnerCache uriOwnerCache_;
+    AbilityResolveCache abilityResolveCache_;
     std::shared_ptr<AppScheduler> appScheduler_;
     std::unordered_map<int, std::shared_ptr<DataAbilityManager>> dataAbilityManagers_;
     std::shared_ptr<DataAbilityManager> dataAbilityManager_;
@@ -22,6 +22,7 @@
 #include <iremote_stub.h>
 
 #include "hilog_wrapper.h"
+#include "ipc_stub_metrics.h"
 
 namespace OHOS {
 namespace AAFwk {
@@ -164,6 +165,7 @@ private:
 
     using RequestFuncType = int (AbilityManagerStub::*)(MessageParcel &data, MessageParcel &reply);
     std::map<uint32_t, RequestFuncType> requestFuncMap_;
+    IpcDispatchTable<RequestFuncType> dispatchTable_ {"AbilityManager"};
 
     #ifdef ABILITY_COMMAND_FOR_TEST
     int BlockAmsServiceInner(MessageParcel &data, MessageParcel &reply);
@@ -16,6 +16,7 @@
 #ifndef OHOS_AAFWK_ABILITY_RECORD_H
 #define OHOS_AAFWK_ABILITY_RECORD_H
 
+#include <atomic>
 #include <ctime>
 #include <functional>
 #include <list>
@@ -24,6 +25,7 @@
 
 #include "ability_connect_callback_interface.h"
 #include "ability_info.h"
+#include "ability_lifecycle_metrics.h"
 #include "ability_start_setting.h"
 #include "ability_token_stub.h"
 #ifdef SUPPORT_GRAPHICS
@@ -588,6 +590,19 @@ public:
 
     int64_t GetStartTime() const;
 
+    /**
+     * Record the latency from the load request to the ability thread attached.
+     *
+     */
+    void RecordAttachDone();
+
+    /**
+     * Record the latency of a lifecycle transition, and of the start if it is the first foreground or active.
+     *
+     * @param targetState the ability state the transition is done with.
+     */
+    void RecordTransitionDone(int targetState);
+
     /**
      * dump service info.
      *
@@ -702,6 +717,7 @@ private:
      *
      */
     void GetAbilityTypeString(std::string &typeStr);
+    void MarkTransitionRequest(LifecyclePhase phase);
     void OnSchedulerDied(const wptr<IRemoteObject> &remote);
     void GrantUriPermission(const Want &want);
     int GetCurrentAccountId();
@@ -713,6 +729,11 @@ private:
     std::weak_ptr<AbilityRecord> preAbilityRecord_ = {};   // who starts this ability record
     std::weak_ptr<AbilityRecord> nextAbilityRecord_ = {};  // ability that started by this ability
     int64_t startTime_ = 0;                           // records first time of ability start
+    // lifecycle latencies, times in microseconds of AbilityLifecycleMetrics::GetTimeUs, 0 when not pending
+    std::shared_ptr<LifecycleHistograms> lifecycleHistograms_;
+    std::atomic<int64_t> loadRequestTime_ {0};
+    std::atomic<int64_t> transitionRequestTime_ {0};
+    std::atomic<LifecyclePhase> transitionPhase_ {LifecyclePhase::PHASE_COUNT};
     bool isReady_ = false;                            // is ability thread attached?
     bool isWindowAttached_ = false;                   // Is window of this ability attached?
     bool isLauncherAbility_ = false;                  // is launcher?
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_ABILITY_RESOLVE_CACHE_H
+#define OHOS_AAFWK_ABILITY_RESOLVE_CACHE_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ability_info.h"
+#include "application_info.h"
+#include "bundle_info.h"
+#include "common_event_subscriber.h"
+#include "nocopyable.h"
+#include "want.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * The data abilities of a bundle, what preloading needs from its bundle info.
+ */
+struct BundleDataAbilities {
+    AppExecFwk::ApplicationInfo appInfo;
+    int32_t uid = 0;
+    std::vector<AppExecFwk::AbilityInfo> abilityInfos;
+};
+
+/**
+ * @class AbilityResolveCache
+ * Keeps the abilities the bundle manager resolved for wants, and the data abilities of bundles,
+ * until the bundles change.
+ */
+class AbilityResolveCache {
+public:
+    using AbilityResolver = std::function<int(AppExecFwk::AbilityInfo &)>;
+    using BundleResolver = std::function<bool(AppExecFwk::BundleInfo &)>;
+
+    AbilityResolveCache() = default;
+    ~AbilityResolveCache();
+
+    /**
+     * @brief Resolve the ability of a want, asking the resolver if it is not cached.
+     * @param want The want to start.
+     * @param flags The ability info flags of the query.
+     * @param userId The user of the ability.
+     * @param abilityInfo Returns the ability.
+     * @param resolver Queries the bundle manager, only successful queries are cached.
+     * @return Returns ERR_OK on success, the error of the resolver otherwise.
+     */
+    int ResolveAbility(const Want &want, int32_t flags, int32_t userId, AppExecFwk::AbilityInfo &abilityInfo,
+        const AbilityResolver &resolver);
+
+    /**
+     * @brief Get the data abilities of a bundle, asking the resolver if they are not cached.
+     * @param bundleName The bundle name.
+     * @param userId The user of the bundle.
+     * @param dataAbilities Returns the data abilities, the application is only filled if there are some.
+     * @param resolver Queries the bundle info with its abilities, only successful queries are cached.
+     * @return Returns true on success, false otherwise.
+     */
+    bool GetDataAbilities(const std::string &bundleName, int32_t userId, BundleDataAbilities &dataAbilities,
+        const BundleResolver &resolver);
+
+    /**
+     * @brief Drop what a bundle resolved, and every implicit resolution, which the bundle may now answer.
+     * @param bundleName The bundle name.
+     */
+    void Invalidate(const std::string &bundleName);
+
+    /**
+     * @brief Drop everything.
+     */
+    void Clear();
+
+    /**
+     * @brief Dump the size and the hit rates of the cache.
+     * @param info Returns the dump lines.
+     */
+    void Dump(std::vector<std::string> &info);
+
+    /**
+     * @brief Invalidate the cache on package change events. Called again when the common event service
+     * is (re)started, it subscribes anew and drops what was cached while the events could be missed.
+     * @return Returns true if subscribed, false otherwise.
+     */
+    bool SubscribePackageEvents();
+
+    /**
+     * @brief Stop listening to package change events.
+     */
+    void UnsubscribePackageEvents();
+
+private:
+    using PackageEventCallback = std::function<void(const EventFwk::CommonEventData &)>;
+
+    class PackageEventSubscriber : public EventFwk::CommonEventSubscriber {
+    public:
+        PackageEventSubscriber(const EventFwk::CommonEventSubscribeInfo &subscribeInfo,
+            const PackageEventCallback &callback)
+            : EventFwk::CommonEventSubscriber(subscribeInfo), callback_(callback) {}
+        ~PackageEventSubscriber() = default;
+        void OnReceiveEvent(const EventFwk::CommonEventData &eventData) override;
+
+    private:
+        PackageEventCallback callback_;
+    };
+
+    struct ResolvedAbility {
+        bool isImplicit = false;
+        AppExecFwk::AbilityInfo abilityInfo;
+    };
+
+    struct Counter {
+        std::atomic<uint64_t> hits = 0;
+        std::atomic<uint64_t> misses = 0;
+    };
+
+    void OnPackageEvent(const EventFwk::CommonEventData &eventData);
+    static std::string GetAbilityKey(const Want &want, int32_t flags, int32_t userId, bool &isImplicit);
+    static std::string GetBundleKey(const std::string &bundleName, int32_t userId);
+    static std::string DumpCounter(const std::string &name, size_t size, const Counter &counter);
+
+    std::mutex subscriberMutex_;
+    std::shared_mutex mutex_;
+    std::unordered_map<std::string, ResolvedAbility> abilities_;
+    std::unordered_map<std::string, BundleDataAbilities> bundles_;
+    // bumped by every invalidation, so that a query racing with it is not cached
+    uint64_t generation_ = 0;
+    Counter abilityCounter_;
+    Counter bundleCounter_;
+    std::atomic<uint64_t> invalidations_ = 0;
+    // guarded by subscriberMutex_
+    std::shared_ptr<PackageEventSubscriber> subscriber_;
+
+    DISALLOW_COPY_AND_MOVE(AbilityResolveCache);
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_ABILITY_RESOLVE_CACHE_H
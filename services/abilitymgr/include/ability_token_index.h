@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_ABILITY_TOKEN_INDEX_H
+#define OHOS_AAFWK_ABILITY_TOKEN_INDEX_H
+
+#include <array>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "iremote_object.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace AAFwk {
+class AbilityRecord;
+
+/**
+ * @enum AbilityTokenOwnerType
+ * Kind of manager that keeps an ability record.
+ */
+enum class AbilityTokenOwnerType {
+    MISSION_LIST = 0,
+    DATA_ABILITY,
+    SERVICE,
+};
+
+/**
+ * @class AbilityTokenIndex
+ * Service-wide index from ability token to the ability record holding it. A manager adds a record when it takes
+ * the record into its lists and removes it when the record leaves them, so token verification and lookup do not
+ * have to walk every manager of every user.
+ */
+class AbilityTokenIndex {
+    DECLARE_DELAYED_SINGLETON(AbilityTokenIndex)
+public:
+    struct Entry {
+        std::weak_ptr<AbilityRecord> abilityRecord;
+        AbilityTokenOwnerType ownerType = AbilityTokenOwnerType::MISSION_LIST;
+        // identity of the owning manager, only compared and never dereferenced
+        const void *owner = nullptr;
+        int32_t userId = -1;
+    };
+
+    /**
+     * Add an ability record to the index, replacing any previous owner of its token.
+     *
+     * @param abilityRecord the record taken by the manager.
+     * @param ownerType kind of the owning manager.
+     * @param owner the owning manager.
+     * @param userId user of the owning manager.
+     */
+    void Add(const std::shared_ptr<AbilityRecord> &abilityRecord, AbilityTokenOwnerType ownerType,
+        const void *owner, int32_t userId);
+
+    /**
+     * Remove an ability record from the index.
+     *
+     * @param abilityRecord the record released by its manager.
+     */
+    void Remove(const std::shared_ptr<AbilityRecord> &abilityRecord);
+
+    /**
+     * Remove a token from the index.
+     *
+     * @param token the token of the released record.
+     */
+    void Remove(const IRemoteObject *token);
+
+    /**
+     * Remove all records kept by a manager, used when the manager drops its lists at once.
+     *
+     * @param owner the manager.
+     */
+    void RemoveOwner(const void *owner);
+
+    /**
+     * Find the live ability record of a token, whichever manager keeps it.
+     *
+     * @param token the ability token.
+     * @return the ability record, or nullptr if no manager keeps the token.
+     */
+    std::shared_ptr<AbilityRecord> Find(const sptr<IRemoteObject> &token);
+
+    /**
+     * Find the live ability record of a token kept by the given manager.
+     *
+     * @param token the ability token.
+     * @param owner the manager.
+     * @return the ability record, or nullptr if the manager does not keep the token.
+     */
+    std::shared_ptr<AbilityRecord> Find(const sptr<IRemoteObject> &token, const void *owner);
+
+    /**
+     * Get the index entry of a token.
+     *
+     * @param token the ability token.
+     * @param entry output entry.
+     * @return true if the token is indexed and its record is alive.
+     */
+    bool GetEntry(const sptr<IRemoteObject> &token, Entry &entry);
+
+    size_t Size() const;
+
+private:
+    static constexpr size_t SHARD_COUNT = 16;
+
+    struct Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<const IRemoteObject *, Entry> entries;
+    };
+
+    Shard &GetShard(const IRemoteObject *token);
+    bool Lookup(const IRemoteObject *token, Entry &entry, std::shared_ptr<AbilityRecord> &abilityRecord);
+    void RemoveExpired(const IRemoteObject *token);
+
+    std::array<Shard, SHARD_COUNT> shards_;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_ABILITY_TOKEN_INDEX_H
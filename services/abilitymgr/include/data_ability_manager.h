@@ -30,7 +30,7 @@ namespace OHOS {
 namespace AAFwk {
 class DataAbilityManager : public NoCopyable {
 public:
-    DataAbilityManager();
+    explicit DataAbilityManager(int32_t userId = 0);
     virtual ~DataAbilityManager();
 
 public:
@@ -62,6 +62,7 @@ private:
 
 private:
     std::mutex mutex_;
+    int32_t userId_;
     DataAbilityRecordPtrMap dataAbilityRecordsLoaded_;
     DataAbilityRecordPtrMap dataAbilityRecordsLoading_;
 };
@@ -17,11 +17,13 @@
 #define FOUNDATION_AAFWK_SERVICES_ABILITYMGR_INCLUDE_MISSION_DATA_STORAGE_H
 
 #include <list>
+#include <map>
 #include <mutex>
 #include <queue>
 
 #include "event_handler.h"
 #include "inner_mission_info.h"
+#include "mission_journal.h"
 #include "mission_snapshot.h"
 
 namespace OHOS {
@@ -47,7 +49,7 @@ public:
     bool LoadAllMissionInfo(std::list<InnerMissionInfo> &missionInfoList);
 
     /**
-     * @brief Save the mission data.
+     * @brief Save the mission data, written to the journal by the next flush.
      * @param missionInfo Indicates the missionInfo object to be save.
      */
     void SaveMissionInfo(const InnerMissionInfo &missionInfo);
@@ -58,6 +60,16 @@ public:
      */
     void DeleteMissionInfo(int missionId);
 
+    /**
+     * @brief Write the pending mission data to the journal.
+     */
+    void FlushMissionInfo();
+
+    /**
+     * @brief Drop the pending mission data and stop writing, the user directory is being removed.
+     */
+    void DiscardMissionInfo();
+
     /**
      * @brief Save mission snapshot
      * @param missionId Indicates this mission id.
@@ -82,7 +94,11 @@ public:
 private:
     std::string GetMissionDataDirPath();
 
-    std::string GetMissionDataFilePath(int missionId);
+    void ScheduleFlush();
+
+    void MigrateLegacyMissionInfo(std::map<int32_t, std::string> &records);
+
+    void RemoveLegacyMissionFiles();
 
     std::string GetMissionSnapshotPath(int32_t missionId);
 
@@ -100,6 +116,9 @@ private:
 
 private:
     int userId_ = 0;
+    MissionJournal journal_;
+    // only touched on the event runner of handler_
+    bool flushScheduled_ = false;
     std::shared_ptr<AppExecFwk::EventHandler> handler_;
     std::mutex cachedPixelMapMutex_;
 #ifdef SUPPORT_GRAPHICS
@@ -17,8 +17,10 @@
 #define OHOS_AAFWK_MISSION_INFO_MGR_H
 
 #include <list>
+#include <map>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include "inner_mission_info.h"
 #include "mission_listener_controller.h"
@@ -161,6 +163,24 @@ public:
 
     void HandleUnInstallApp(const std::string &bundleName, int32_t uid, std::list<int32_t> &missions);
 private:
+    /**
+     * @struct MissionOrderKey
+     * Orders the missions by numeric time stamp, the latest first, and by adding order among equal time stamps.
+     */
+    struct MissionOrderKey {
+        uint64_t timestamp = 0;
+        uint64_t sequence = 0;
+
+        bool operator<(const MissionOrderKey &other) const
+        {
+            if (timestamp != other.timestamp) {
+                return timestamp > other.timestamp;
+            }
+            return sequence < other.sequence;
+        }
+    };
+    using MissionInfoList = std::map<MissionOrderKey, InnerMissionInfo>;
+
     /**
      * @brief Boot query mission info.
      * @return Returns true if this function is successfully called; returns false otherwise.
@@ -169,10 +189,20 @@ private:
 
     void GetMatchedMission(const std::string &bundleName, int32_t uid, std::list<int32_t> &missions);
 
+    MissionOrderKey MakeOrderKey(const std::string &time);
+    void InsertMissionInfo(const InnerMissionInfo &missionInfo);
+    void EraseMissionInfo(MissionInfoList::iterator it);
+    void ReorderMissionInfo(MissionInfoList::iterator it, const InnerMissionInfo &missionInfo);
+    MissionInfoList::iterator FindMissionInfo(int32_t missionId);
+    MissionInfoList::const_iterator FindMissionInfo(int32_t missionId) const;
+
 private:
     int32_t currentMisionId_ = MIN_MISSION_ID;
     std::unordered_map<int32_t, bool> missionIdMap_; // key:distributed misisonid, vaule: has been saved
-    std::list<InnerMissionInfo> missionInfoList_;
+    MissionInfoList missionInfoList_;
+    // mission id to its node of missionInfoList_
+    std::unordered_map<int32_t, MissionInfoList::iterator> missionInfoIndex_;
+    uint64_t missionSequence_ = 0;
     std::shared_ptr<TaskDataPersistenceMgr> taskDataPersistenceMgr_;
     sptr<ISnapshotHandler> snapshotHandler_;
 };
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_AAFWK_SERVICES_ABILITYMGR_INCLUDE_MISSION_JOURNAL_H
+#define FOUNDATION_AAFWK_SERVICES_ABILITYMGR_INCLUDE_MISSION_JOURNAL_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace OHOS {
+namespace AAFwk {
+const std::string MISSION_BASE_FILE_NAME = "missions.db";
+const std::string MISSION_JOURNAL_FILE_NAME = "missions.journal";
+
+/**
+ * @class MissionJournal
+ * Persists the mission records of one user as a compacted base file plus an append-only journal of binary
+ * records. Updates are kept in memory, coalesced per mission, and written with a single append and fsync by
+ * Flush. Once the journal grows past the live data it is folded into a new base file.
+ */
+class MissionJournal {
+public:
+    explicit MissionJournal(const std::string &dirPath);
+    ~MissionJournal() = default;
+
+    /**
+     * @brief Whether the journal layout already exists on disk.
+     */
+    bool Exists();
+
+    /**
+     * @brief Get all mission records, the ones not flushed yet included.
+     * @param records Output, mission id to record data.
+     * @return Returns true if the files on disk could be read.
+     */
+    bool GetAll(std::map<int32_t, std::string> &records);
+
+    /**
+     * @brief Replace all data with the given records, used to migrate from the file-per-mission layout.
+     * @param records Mission id to record data.
+     * @return Returns true if the records are durably written.
+     */
+    bool Reset(const std::map<int32_t, std::string> &records);
+
+    /**
+     * @brief Save a mission record, replacing a pending update of the same mission.
+     */
+    void Put(int32_t missionId, const std::string &data);
+
+    /**
+     * @brief Delete a mission record.
+     */
+    void Remove(int32_t missionId);
+
+    /**
+     * @brief Append the pending updates to the journal and sync it, compacting when the journal has grown.
+     * @return Returns true if nothing was pending or the updates are durably written.
+     */
+    bool Flush();
+
+    /**
+     * @brief Fold the journal into a new base file.
+     * @return Returns true if compacted.
+     */
+    bool Compact();
+
+    /**
+     * @brief Drop pending updates and refuse further writes, used when the user directory is removed.
+     */
+    void Discard();
+
+    bool HasPending();
+
+    size_t GetJournalRecordCount();
+
+private:
+    bool LoadLocked();
+    bool ReplayFile(const std::string &path, bool isJournal);
+    bool FlushLocked();
+    bool CompactLocked();
+    bool WriteBaseFileLocked();
+    bool ResetJournalFileLocked();
+    bool NeedCompactLocked() const;
+
+    std::string GetBaseFilePath() const;
+    std::string GetJournalFilePath() const;
+
+    struct PendingRecord {
+        bool removed = false;
+        std::string data;
+    };
+
+    std::mutex mutex_;
+    std::string dirPath_;
+    bool loaded_ = false;
+    bool discarded_ = false;
+    // durable state after the last flush
+    std::map<int32_t, std::string> records_;
+    // updates not flushed yet, coalesced per mission
+    std::map<int32_t, PendingRecord> pending_;
+    size_t journalRecordCount_ = 0;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_AAFWK_SERVICES_ABILITYMGR_INCLUDE_MISSION_JOURNAL_H
@@ -404,6 +404,8 @@ private:
     int ClearMissionLocked(int missionId, std::shared_ptr<Mission> mission);
     int TerminateAbilityLocked(const std::shared_ptr<AbilityRecord> &abilityRecord, bool flag);
     std::shared_ptr<AbilityRecord> GetAbilityRecordByEventId(int64_t eventId) const;
+    bool IsAbilityRecordInListsLocked(const std::shared_ptr<AbilityRecord> &abilityRecord,
+        const sptr<IRemoteObject> &token) const;
     std::shared_ptr<AbilityRecord> GetAbilityRecordByCaller(
         const std::shared_ptr<AbilityRecord> &caller, int requestCode);
     std::shared_ptr<MissionList> GetTargetMissionList(int missionId, std::shared_ptr<Mission> &mission);
@@ -53,7 +53,14 @@ public:
     int32_t GetCode();
     int32_t GetUserId();
 
+    // content hash over the fields pending wants are matched on, cached until one of them changes.
+    size_t GetHashCode();
+    // Want::ToString() of the request want, cached until the want changes.
+    const std::string &GetRequestWantString();
+
 private:
+    void ResetHashCode();
+
     int32_t type_ = {};
     std::string bundleName_ = {};
     std::string requestWho_ = {};
@@ -64,6 +71,10 @@ private:
     int32_t flags_ = {};
     int32_t code_ = {};
     int32_t userId_ = {};
+    bool hashReady_ = false;
+    size_t hashCode_ = 0;
+    bool requestWantStringReady_ = false;
+    std::string requestWantString_ = {};
 };
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -19,6 +19,7 @@
 #include <mutex>
 #include <memory>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <string>
 
@@ -177,8 +178,16 @@ private:
     static int32_t PendingRecordIdCreate();
     void ClearPendingWantRecordTask(const std::string &bundleName, int32_t uid);
 
+    void AddWantRecordLocked(const std::shared_ptr<PendingWantKey> &key, const sptr<PendingWantRecord> &record);
+    void RemoveWantRecordLocked(const std::shared_ptr<PendingWantKey> &key);
+    void AddKeyHashLocked(const std::shared_ptr<PendingWantKey> &key, const sptr<PendingWantRecord> &record);
+    void RemoveKeyHashLocked(const std::shared_ptr<PendingWantKey> &key);
+
 private:
     std::map<std::shared_ptr<PendingWantKey>, sptr<PendingWantRecord>> wantRecords_;
+    // indexes of wantRecords_ by key content hash and by record code
+    std::unordered_multimap<size_t, sptr<PendingWantRecord>> wantRecordsByHash_;
+    std::unordered_map<int32_t, sptr<PendingWantRecord>> wantRecordsByCode_;
     std::recursive_mutex mutex_;
 };
 }  // namespace AAFwk
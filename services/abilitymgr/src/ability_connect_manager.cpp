@@ -20,6 +20,7 @@
 #include "ability_connect_callback_stub.h"
 #include "ability_manager_errors.h"
 #include "ability_manager_service.h"
+#include "ability_token_index.h"
 #include "ability_util.h"
 #include "bytrace.h"
 #include "hilog_wrapper.h"
@@ -31,7 +32,9 @@ AbilityConnectManager::AbilityConnectManager(int userId) : userId_(userId)
 {}
 
 AbilityConnectManager::~AbilityConnectManager()
-{}
+{
+    DelayedSingleton<AbilityTokenIndex>::GetInstance()->RemoveOwner(this);
+}
 
 int AbilityConnectManager::StartAbility(const AbilityRequest &abilityRequest)
 {
@@ -215,6 +218,8 @@ void AbilityConnectManager::GetOrCreateServiceRecord(const AbilityRequest &abili
             targetService->SetRestarting(abilityRequest.restart, abilityRequest.restartCount);
         }
         serviceMap_.emplace(element.GetURI(), targetService);
+        DelayedSingleton<AbilityTokenIndex>::GetInstance()->Add(
+            targetService, AbilityTokenOwnerType::SERVICE, this, userId_);
         isLoadedAbility = false;
     } else {
         targetService = serviceMapIter->second;
@@ -560,6 +565,11 @@ std::shared_ptr<AbilityRecord> AbilityConnectManager::GetServiceRecordByElementN
 
 std::shared_ptr<AbilityRecord> AbilityConnectManager::GetServiceRecordByToken(const sptr<IRemoteObject> &token)
 {
+    auto indexedRecord = DelayedSingleton<AbilityTokenIndex>::GetInstance()->Find(token, this);
+    if (indexedRecord) {
+        return indexedRecord;
+    }
+
     std::lock_guard<std::recursive_mutex> guard(Lock_);
     auto IsMatch = [token](auto service) {
         if (!service.second) {
@@ -605,6 +615,7 @@ std::shared_ptr<AbilityRecord> AbilityConnectManager::GetAbilityRecordByEventId(
 
 void AbilityConnectManager::RemoveAll()
 {
+    DelayedSingleton<AbilityTokenIndex>::GetInstance()->RemoveOwner(this);
     serviceMap_.clear();
     connectMap_.clear();
 }
@@ -897,6 +908,7 @@ void AbilityConnectManager::RemoveServiceAbility(const std::shared_ptr<AbilityRe
     auto it = serviceMap_.find(element);
     if (it != serviceMap_.end()) {
         HILOG_INFO("Remove service(%{public}s) from map.", element.c_str());
+        DelayedSingleton<AbilityTokenIndex>::GetInstance()->Remove(it->second);
         serviceMap_.erase(it);
     }
 }
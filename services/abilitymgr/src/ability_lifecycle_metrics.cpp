@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability_lifecycle_metrics.h"
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+
+#include "hilog_wrapper.h"
+#include "hisysevent.h"
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+const std::string OTHER_BUNDLES = "(other bundles)";
+const std::string EVENT_LIFECYCLE_LATENCY = "LIFECYCLE_LATENCY";
+const std::string EVENT_KEY_BUNDLE_NAME = "BUNDLE_NAME";
+const std::string EVENT_KEY_PHASE = "PHASE";
+const std::string EVENT_KEY_COUNT = "COUNT";
+const std::string EVENT_KEY_MEAN = "MEAN";
+const std::string EVENT_KEY_P50 = "P50";
+const std::string EVENT_KEY_P90 = "P90";
+const std::string EVENT_KEY_P99 = "P99";
+const std::string EVENT_KEY_MAX = "MAX";
+const double PERCENTILE_50 = 50.0;
+const double PERCENTILE_90 = 90.0;
+const double PERCENTILE_99 = 99.0;
+const char *PHASE_NAMES[] = { "start", "load", "foreground", "background", "active", "inactive", "terminate" };
+}  // namespace
+
+AbilityLifecycleMetrics::AbilityLifecycleMetrics()
+{
+    otherHistograms_ = std::make_shared<LifecycleHistograms>();
+    otherHistograms_->bundleName = OTHER_BUNDLES;
+}
+
+AbilityLifecycleMetrics::~AbilityLifecycleMetrics()
+{}
+
+std::shared_ptr<LifecycleHistograms> AbilityLifecycleMetrics::GetHistograms(const std::string &bundleName)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto iter = bundleHistograms_.find(bundleName);
+        if (iter != bundleHistograms_.end()) {
+            return iter->second;
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto iter = bundleHistograms_.find(bundleName);
+    if (iter != bundleHistograms_.end()) {
+        return iter->second;
+    }
+    if (bundleHistograms_.size() >= MAX_BUNDLE_COUNT) {
+        return otherHistograms_;
+    }
+    auto histograms = std::make_shared<LifecycleHistograms>();
+    histograms->bundleName = bundleName;
+    bundleHistograms_.emplace(bundleName, histograms);
+    return histograms;
+}
+
+void AbilityLifecycleMetrics::Record(const std::shared_ptr<LifecycleHistograms> &histograms,
+    LifecyclePhase phase, uint64_t latencyUs)
+{
+    if (histograms == nullptr || phase >= LifecyclePhase::PHASE_COUNT) {
+        return;
+    }
+    uint64_t count = histograms->phases[static_cast<size_t>(phase)].Record(latencyUs);
+    if (count % REPORT_INTERVAL == 0) {
+        Report(*histograms, phase);
+    }
+}
+
+void AbilityLifecycleMetrics::Dump(std::vector<std::string> &info)
+{
+    std::vector<std::shared_ptr<LifecycleHistograms>> allHistograms;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        for (const auto &item : bundleHistograms_) {
+            allHistograms.emplace_back(item.second);
+        }
+    }
+    std::sort(allHistograms.begin(), allHistograms.end(),
+        [](const std::shared_ptr<LifecycleHistograms> &lhs, const std::shared_ptr<LifecycleHistograms> &rhs) {
+            return lhs->bundleName < rhs->bundleName;
+        });
+    allHistograms.emplace_back(otherHistograms_);
+
+    info.emplace_back("AbilityLifecycleMetrics (us):");
+    for (const auto &histograms : allHistograms) {
+        bool hasTitle = false;
+        for (size_t i = 0; i < histograms->phases.size(); i++) {
+            const LatencyHistogram &histogram = histograms->phases[i];
+            uint64_t count = histogram.GetCount();
+            if (count == 0) {
+                continue;
+            }
+            if (!hasTitle) {
+                info.emplace_back("  " + histograms->bundleName + ":");
+                hasTitle = true;
+            }
+            info.emplace_back("    " + std::string(GetPhaseName(static_cast<LifecyclePhase>(i))) +
+                ": count " + std::to_string(count) +
+                ", mean " + std::to_string(histogram.GetSum() / count) +
+                ", p50 " + std::to_string(histogram.GetPercentile(PERCENTILE_50)) +
+                ", p90 " + std::to_string(histogram.GetPercentile(PERCENTILE_90)) +
+                ", p99 " + std::to_string(histogram.GetPercentile(PERCENTILE_99)) +
+                ", max " + std::to_string(histogram.GetMax()));
+        }
+    }
+}
+
+const char *AbilityLifecycleMetrics::GetPhaseName(LifecyclePhase phase)
+{
+    if (phase >= LifecyclePhase::PHASE_COUNT) {
+        return "unknown";
+    }
+    return PHASE_NAMES[static_cast<size_t>(phase)];
+}
+
+int64_t AbilityLifecycleMetrics::GetTimeUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void AbilityLifecycleMetrics::Report(const LifecycleHistograms &histograms, LifecyclePhase phase)
+{
+    const LatencyHistogram &histogram = histograms.phases[static_cast<size_t>(phase)];
+    uint64_t count = histogram.GetCount();
+    if (count == 0) {
+        return;
+    }
+    uint64_t p50 = histogram.GetPercentile(PERCENTILE_50);
+    uint64_t p90 = histogram.GetPercentile(PERCENTILE_90);
+    uint64_t p99 = histogram.GetPercentile(PERCENTILE_99);
+    HILOG_DEBUG("%{public}s, bundle:%{public}s, phase:%{public}s, count:%{public}llu, p50:%{public}llu, "
+        "p90:%{public}llu, p99:%{public}llu", __func__, histograms.bundleName.c_str(), GetPhaseName(phase),
+        static_cast<unsigned long long>(count), static_cast<unsigned long long>(p50),
+        static_cast<unsigned long long>(p90), static_cast<unsigned long long>(p99));
+    OHOS::HiviewDFX::HiSysEvent::Write(OHOS::HiviewDFX::HiSysEvent::Domain::AAFWK, EVENT_LIFECYCLE_LATENCY,
+        OHOS::HiviewDFX::HiSysEvent::EventType::STATISTIC,
+        EVENT_KEY_BUNDLE_NAME, histograms.bundleName,
+        EVENT_KEY_PHASE, std::string(GetPhaseName(phase)),
+        EVENT_KEY_COUNT, count,
+        EVENT_KEY_MEAN, histogram.GetSum() / count,
+        EVENT_KEY_P50, p50,
+        EVENT_KEY_P90, p90,
+        EVENT_KEY_P99, p99,
+        EVENT_KEY_MAX, histogram.GetMax());
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -31,6 +31,7 @@
 #include <cstdlib>
 
 #include "ability_info.h"
+#include "ability_lifecycle_metrics.h"
 #include "ability_manager_errors.h"
 #include "ability_util.h"
 #include "bytrace.h"
@@ -43,6 +44,7 @@
 #include "if_system_ability_manager.h"
 #include "in_process_call_wrapper.h"
 #include "ipc_skeleton.h"
+#include "ipc_stub_metrics.h"
 #include "iservice_registry.h"
 #include "itest_observer.h"
 #ifdef SUPPORT_GRAPHICS
@@ -160,6 +162,12 @@ const std::map<std::string, AbilityManagerService::DumpsysKey> AbilityManagerSer
     std::map<std::string, AbilityManagerService::DumpsysKey>::value_type("-r", KEY_DUMPSYS_PROCESS),
     std::map<std::string, AbilityManagerService::DumpsysKey>::value_type("--data", KEY_DUMPSYS_DATA),
     std::map<std::string, AbilityManagerService::DumpsysKey>::value_type("-d", KEY_DUMPSYS_DATA),
+    std::map<std::string, AbilityManagerService::DumpsysKey>::value_type("--resolve-cache", KEY_DUMPSYS_RESOLVE_CACHE),
+    std::map<std::string, AbilityManagerService::DumpsysKey>::value_type("-R", KEY_DUMPSYS_RESOLVE_CACHE),
+    std::map<std::string, AbilityManagerService::DumpsysKey>::value_type("--perf", KEY_DUMPSYS_PERF),
+    std::map<std::string, AbilityManagerService::DumpsysKey>::value_type("-P", KEY_DUMPSYS_PERF),
+    std::map<std::string, AbilityManagerService::DumpsysKey>::value_type("--ipc", KEY_DUMPSYS_IPC),
+    std::map<std::string, AbilityManagerService::DumpsysKey>::value_type("-I", KEY_DUMPSYS_IPC),
 };
 
 const bool REGISTER_RESULT =
@@ -251,12 +259,27 @@ bool AbilityManagerService::Init()
         HILOG_ERROR("HiviewDFX::Watchdog::GetInstance AddThread Fail");
     }
 
+    // the caches are subscribed to package events once the common event service is up, and again on restart
+    if (!AddSystemAbilityListener(COMMON_EVENT_SERVICE_ID)) {
+        HILOG_ERROR("Failed to listen to the common event service.");
+    }
+
     auto startSystemTask = [aams = shared_from_this()]() { aams->StartSystemApplication(); };
     handler_->PostTask(startSystemTask, "StartSystemApplication");
     HILOG_INFO("Init success.");
     return true;
 }
 
+void AbilityManagerService::OnAddSystemAbility(int32_t systemAbilityId, const std::string &deviceId)
+{
+    if (systemAbilityId != COMMON_EVENT_SERVICE_ID) {
+        return;
+    }
+    HILOG_INFO("Common event service added, subscribe package events.");
+    uriOwnerCache_.SubscribePackageEvents();
+    abilityResolveCache_.SubscribePackageEvents();
+}
+
 void AbilityManagerService::OnStop()
 {
     HILOG_INFO("Stop AMS.");
@@ -560,30 +583,38 @@ void AbilityManagerService::GrantUriPermission(const Want &want, int32_t validUs
 {
     auto bms = GetBundleManager();
     CHECK_POINTER_IS_NULLPTR(bms);
-    auto uriStr = want.GetUri().ToString();
     auto uriVec = want.GetStringArrayParam(AbilityConfig::PARAMS_STREAM);
-    uriVec.emplace_back(uriStr);
-    auto upmClient = AAFwk::UriPermissionManagerClient::GetInstance();
+    uriVec.emplace_back(want.GetUri().ToString());
     auto fromTokenId = IPCSkeleton::GetCallingTokenID();
-    AppExecFwk::ExtensionAbilityInfo info;
-    for (auto str : uriVec) {
-        if (!IN_PROCESS_CALL(bms->QueryExtensionAbilityInfoByUri(str, validUserId, info))) {
+    std::vector<Uri> uris;
+    for (const auto &str : uriVec) {
+        if (str.empty()) {
+            continue;
+        }
+        Uri uri(str);
+        UriOwnerInfo info;
+        if (!uriOwnerCache_.GetOwner(bms, uri, validUserId, info)) {
             HILOG_WARN("Not found ExtensionAbilityInfo according to the uri.");
             continue;
         }
         if (info.type != AppExecFwk::ExtensionAbilityType::FILESHARE) {
             HILOG_WARN("The upms only open to FILESHARE. The type is %{public}u.", info.type);
-            HILOG_WARN("BundleName: %{public}s, AbilityName: %{public}s.", info.bundleName.c_str(), info.name.c_str());
+            HILOG_WARN("BundleName: %{public}s.", info.bundleName.c_str());
             continue;
         }
-        if (fromTokenId != info.applicationInfo.accessTokenId) {
+        if (fromTokenId != info.accessTokenId) {
             HILOG_WARN("Only the uri of this application can be authorized.");
             continue;
         }
-
-        Uri uri(str);
-        IN_PROCESS_CALL_WITHOUT_RET(upmClient->GrantUriPermission(uri, want.GetFlags(), fromTokenId, targetTokenId));
+        uris.emplace_back(std::move(uri));
     }
+    if (uris.empty()) {
+        return;
+    }
+
+    // all the uris go to the uri permission manager in one request
+    auto upmClient = AAFwk::UriPermissionManagerClient::GetInstance();
+    IN_PROCESS_CALL_WITHOUT_RET(upmClient->GrantUriPermissions(uris, want.GetFlags(), fromTokenId, targetTokenId));
 }
 
 int AbilityManagerService::TerminateAbility(const sptr<IRemoteObject> &token, int resultCode, const Want *resultWant)
@@ -1697,6 +1728,7 @@ int AbilityManagerService::AttachAbilityThread(
             abilityInfo.name.c_str());
         return ERR_OK;
     }
+    abilityRecord->RecordAttachDone();
     int returnCode = -1;
     if (type == AppExecFwk::AbilityType::SERVICE || type == AppExecFwk::AbilityType::EXTENSION) {
         auto connectManager = GetConnectManagerByUserId(userId);
@@ -1742,6 +1774,9 @@ void AbilityManagerService::DumpSysFuncInit()
     dumpsysFuncMap_[KEY_DUMPSYS_PENDING] = &AbilityManagerService::DumpSysPendingInner;
     dumpsysFuncMap_[KEY_DUMPSYS_PROCESS] = &AbilityManagerService::DumpSysProcess;
     dumpsysFuncMap_[KEY_DUMPSYS_DATA] = &AbilityManagerService::DataDumpSysStateInner;
+    dumpsysFuncMap_[KEY_DUMPSYS_RESOLVE_CACHE] = &AbilityManagerService::DumpSysResolveCacheInner;
+    dumpsysFuncMap_[KEY_DUMPSYS_PERF] = &AbilityManagerService::DumpSysPerfInner;
+    dumpsysFuncMap_[KEY_DUMPSYS_IPC] = &AbilityManagerService::DumpSysIpcInner;
 }
 
 void AbilityManagerService::DumpSysInner(
@@ -1969,6 +2004,27 @@ void AbilityManagerService::DataDumpSysStateInner(
     }
 }
 
+void AbilityManagerService::DumpSysResolveCacheInner(
+    const std::string& args, std::vector<std::string>& info, bool isClient, bool isUserID, int userId)
+{
+    abilityResolveCache_.Dump(info);
+}
+
+void AbilityManagerService::DumpSysPerfInner(
+    const std::string& args, std::vector<std::string>& info, bool isClient, bool isUserID, int userId)
+{
+    auto lifecycleMetrics = DelayedSingleton<AbilityLifecycleMetrics>::GetInstance();
+    CHECK_POINTER(lifecycleMetrics);
+    lifecycleMetrics->Dump(info);
+}
+
+void AbilityManagerService::DumpSysIpcInner(
+    const std::string& args, std::vector<std::string>& info, bool isClient, bool isUserID, int userId)
+{
+    // every instrumented stub of the process, the ability manager and the services hosted with it
+    IpcStubMetrics::DumpAll(info);
+}
+
 void AbilityManagerService::DumpInner(const std::string &args, std::vector<std::string> &info)
 {
     if (currentMissionListManager_) {
@@ -2122,6 +2178,7 @@ int AbilityManagerService::AbilityTransitionDone(const sptr<IRemoteObject> &toke
             abilityInfo.name.c_str());
         return ERR_OK;
     }
+    abilityRecord->RecordTransitionDone(targetState);
     if (type == AppExecFwk::AbilityType::SERVICE || type == AppExecFwk::AbilityType::EXTENSION) {
         auto connectManager = GetConnectManagerByUserId(userId);
         if (!connectManager) {
@@ -2382,9 +2439,38 @@ int AbilityManagerService::GenerateAbilityRequest(
     auto abilityInfoFlag = (AppExecFwk::AbilityInfoFlag::GET_ABILITY_INFO_WITH_APPLICATION |
         AppExecFwk::AbilityInfoFlag::GET_ABILITY_INFO_WITH_PERMISSION |
         AppExecFwk::AbilityInfoFlag::GET_ABILITY_INFO_WITH_METADATA);
+    int result = abilityResolveCache_.ResolveAbility(want, abilityInfoFlag, userId, request.abilityInfo,
+        [this, &bms, &want, abilityInfoFlag, userId](AppExecFwk::AbilityInfo &abilityInfo) {
+            return QueryAbilityInfo(bms, want, abilityInfoFlag, userId, abilityInfo);
+        });
+    if (result != ERR_OK) {
+        return result;
+    }
+    HILOG_DEBUG("QueryAbilityInfo success, ability name: %{public}s, is stage mode: %{public}d.",
+        request.abilityInfo.name.c_str(), request.abilityInfo.isStageBasedModel);
+    if (request.abilityInfo.type == AppExecFwk::AbilityType::SERVICE && request.abilityInfo.isStageBasedModel) {
+        HILOG_INFO("Stage mode, abilityInfo SERVICE type reset EXTENSION.");
+        request.abilityInfo.type = AppExecFwk::AbilityType::EXTENSION;
+    }
+
+    if (request.abilityInfo.applicationInfo.name.empty() || request.abilityInfo.applicationInfo.bundleName.empty()) {
+        HILOG_ERROR("Get app info failed.");
+        return RESOLVE_APP_ERR;
+    }
+    request.appInfo = request.abilityInfo.applicationInfo;
+    request.uid = request.appInfo.uid;
+    HILOG_DEBUG("GenerateAbilityRequest end, app name: %{public}s, bundle name: %{public}s, uid: %{public}d.",
+        request.appInfo.name.c_str(), request.appInfo.bundleName.c_str(), request.uid);
+
+    return ERR_OK;
+}
+
+int AbilityManagerService::QueryAbilityInfo(const sptr<AppExecFwk::IBundleMgr> &bms, const Want &want,
+    int32_t abilityInfoFlag, int32_t userId, AppExecFwk::AbilityInfo &abilityInfo)
+{
     HILOG_DEBUG("QueryAbilityInfo from bms, userId is %{public}d.", userId);
-    IN_PROCESS_CALL_WITHOUT_RET(bms->QueryAbilityInfo(want, abilityInfoFlag, userId, request.abilityInfo));
-    if (request.abilityInfo.name.empty() || request.abilityInfo.bundleName.empty()) {
+    IN_PROCESS_CALL_WITHOUT_RET(bms->QueryAbilityInfo(want, abilityInfoFlag, userId, abilityInfo));
+    if (abilityInfo.name.empty() || abilityInfo.bundleName.empty()) {
         // try to find extension
         std::vector<AppExecFwk::ExtensionAbilityInfo> extensionInfos;
         IN_PROCESS_CALL_WITHOUT_RET(bms->QueryExtensionAbilityInfos(want, abilityInfoFlag, userId, extensionInfos));
@@ -2401,24 +2487,8 @@ int AbilityManagerService::GenerateAbilityRequest(
         HILOG_DEBUG("Extension ability info found, name=%{public}s.",
             extensionInfo.name.c_str());
         // For compatibility translates to AbilityInfo
-        InitAbilityInfoFromExtension(extensionInfo, request.abilityInfo);
-    }
-    HILOG_DEBUG("QueryAbilityInfo success, ability name: %{public}s, is stage mode: %{public}d.",
-        request.abilityInfo.name.c_str(), request.abilityInfo.isStageBasedModel);
-    if (request.abilityInfo.type == AppExecFwk::AbilityType::SERVICE && request.abilityInfo.isStageBasedModel) {
-        HILOG_INFO("Stage mode, abilityInfo SERVICE type reset EXTENSION.");
-        request.abilityInfo.type = AppExecFwk::AbilityType::EXTENSION;
+        InitAbilityInfoFromExtension(extensionInfo, abilityInfo);
     }
-
-    if (request.abilityInfo.applicationInfo.name.empty() || request.abilityInfo.applicationInfo.bundleName.empty()) {
-        HILOG_ERROR("Get app info failed.");
-        return RESOLVE_APP_ERR;
-    }
-    request.appInfo = request.abilityInfo.applicationInfo;
-    request.uid = request.appInfo.uid;
-    HILOG_DEBUG("GenerateAbilityRequest end, app name: %{public}s, bundle name: %{public}s, uid: %{public}d.",
-        request.appInfo.name.c_str(), request.appInfo.bundleName.c_str(), request.uid);
-
     return ERR_OK;
 }
 
@@ -2570,6 +2640,8 @@ int AbilityManagerService::UninstallApp(const std::string &bundleName, int32_t u
         return CHECK_PERMISSION_FAILED;
     }
 
+    uriOwnerCache_.Invalidate(bundleName);
+    abilityResolveCache_.Invalidate(bundleName);
     int32_t targetUserId = uid / BASE_USER_RANGE;
     auto listManager = GetListManagerByUserId(targetUserId);
     if (listManager) {
@@ -2615,29 +2687,32 @@ int AbilityManagerService::PreLoadAppDataAbilities(const std::string &bundleName
     auto bms = GetBundleManager();
     CHECK_POINTER_AND_RETURN(bms, GET_ABILITY_SERVICE_FAILED);
 
-    AppExecFwk::BundleInfo bundleInfo;
-    bool ret = IN_PROCESS_CALL(
-        bms->GetBundleInfo(bundleName, AppExecFwk::BundleFlag::GET_BUNDLE_WITH_ABILITIES, bundleInfo, userId));
+    BundleDataAbilities dataAbilities;
+    bool ret = abilityResolveCache_.GetDataAbilities(bundleName, userId, dataAbilities,
+        [&bms, &bundleName, userId](AppExecFwk::BundleInfo &bundleInfo) {
+            return IN_PROCESS_CALL(bms->GetBundleInfo(bundleName, AppExecFwk::BundleFlag::GET_BUNDLE_WITH_ABILITIES,
+                bundleInfo, userId));
+        });
     if (!ret) {
         HILOG_ERROR("Failed to get bundle info when app data abilities preloading, userId is %{public}d", userId);
         return RESOLVE_APP_ERR;
     }
+    if (dataAbilities.abilityInfos.empty()) {
+        return ERR_OK;
+    }
 
     HILOG_INFO("App data abilities preloading for bundle '%{public}s'...", bundleName.data());
 
     auto begin = system_clock::now();
     AbilityRequest dataAbilityRequest;
-    dataAbilityRequest.appInfo = bundleInfo.applicationInfo;
-    for (auto it = bundleInfo.abilityInfos.begin(); it != bundleInfo.abilityInfos.end(); ++it) {
-        if (it->type != AppExecFwk::AbilityType::DATA) {
-            continue;
-        }
+    dataAbilityRequest.appInfo = dataAbilities.appInfo;
+    for (auto it = dataAbilities.abilityInfos.begin(); it != dataAbilities.abilityInfos.end(); ++it) {
         if ((system_clock::now() - begin) >= DATA_ABILITY_START_TIMEOUT) {
             HILOG_ERROR("App data ability preloading for '%{public}s' timeout.", bundleName.c_str());
             return ERR_TIMED_OUT;
         }
         dataAbilityRequest.abilityInfo = *it;
-        dataAbilityRequest.uid = bundleInfo.uid;
+        dataAbilityRequest.uid = dataAbilities.uid;
         HILOG_INFO("App data ability preloading: '%{public}s.%{public}s'...", it->bundleName.c_str(), it->name.c_str());
 
         auto dataAbility = dataAbilityManager->Acquire(dataAbilityRequest, false, nullptr, false);
@@ -2761,6 +2836,11 @@ bool AbilityManagerService::VerificationAllToken(const sptr<IRemoteObject> &toke
 {
     HILOG_INFO("VerificationAllToken.");
     std::shared_lock<std::shared_mutex> lock(managersMutex_);
+    AbilityTokenIndex::Entry entry;
+    if (GetIndexedTokenEntryLocked(token, entry)) {
+        return true;
+    }
+
     for (auto item: missionListManagers_) {
         if (item.second && item.second->GetAbilityRecordByToken(token)) {
             return true;
@@ -2787,6 +2867,34 @@ bool AbilityManagerService::VerificationAllToken(const sptr<IRemoteObject> &toke
     return false;
 }
 
+bool AbilityManagerService::GetIndexedTokenEntryLocked(const sptr<IRemoteObject> &token,
+    AbilityTokenIndex::Entry &entry)
+{
+    if (!DelayedSingleton<AbilityTokenIndex>::GetInstance()->GetEntry(token, entry)) {
+        return false;
+    }
+
+    // the owner must still be the manager registered for that user.
+    switch (entry.ownerType) {
+        case AbilityTokenOwnerType::MISSION_LIST: {
+            // and still keep the record in its lists, it checks the index against them under its lock
+            auto it = missionListManagers_.find(entry.userId);
+            return it != missionListManagers_.end() && it->second.get() == entry.owner &&
+                it->second->GetAbilityRecordByToken(token) != nullptr;
+        }
+        case AbilityTokenOwnerType::DATA_ABILITY: {
+            auto it = dataAbilityManagers_.find(entry.userId);
+            return it != dataAbilityManagers_.end() && it->second.get() == entry.owner;
+        }
+        case AbilityTokenOwnerType::SERVICE: {
+            auto it = connectManagers_.find(entry.userId);
+            return it != connectManagers_.end() && it->second.get() == entry.owner;
+        }
+        default:
+            return false;
+    }
+}
+
 std::shared_ptr<DataAbilityManager> AbilityManagerService::GetDataAbilityManager(
     const sptr<IAbilityScheduler> &scheduler)
 {
@@ -2841,6 +2949,11 @@ std::shared_ptr<DataAbilityManager> AbilityManagerService::GetDataAbilityManager
 std::shared_ptr<MissionListManager> AbilityManagerService::GetListManagerByToken(const sptr<IRemoteObject> &token)
 {
     std::shared_lock<std::shared_mutex> lock(managersMutex_);
+    AbilityTokenIndex::Entry entry;
+    if (GetIndexedTokenEntryLocked(token, entry) && entry.ownerType == AbilityTokenOwnerType::MISSION_LIST) {
+        return missionListManagers_.find(entry.userId)->second;
+    }
+
     for (auto item: missionListManagers_) {
         if (item.second && item.second->GetAbilityRecordByToken(token)) {
             return item.second;
@@ -2858,6 +2971,11 @@ std::shared_ptr<AbilityConnectManager> AbilityManagerService::GetConnectManagerB
     const sptr<IRemoteObject> &token)
 {
     std::shared_lock<std::shared_mutex> lock(managersMutex_);
+    AbilityTokenIndex::Entry entry;
+    if (GetIndexedTokenEntryLocked(token, entry) && entry.ownerType == AbilityTokenOwnerType::SERVICE) {
+        return connectManagers_.find(entry.userId)->second;
+    }
+
     for (auto item: connectManagers_) {
         if (item.second && item.second->GetServiceRecordByToken(token)) {
             return item.second;
@@ -2871,6 +2989,11 @@ std::shared_ptr<DataAbilityManager> AbilityManagerService::GetDataAbilityManager
     const sptr<IRemoteObject> &token)
 {
     std::shared_lock<std::shared_mutex> lock(managersMutex_);
+    AbilityTokenIndex::Entry entry;
+    if (GetIndexedTokenEntryLocked(token, entry) && entry.ownerType == AbilityTokenOwnerType::DATA_ABILITY) {
+        return dataAbilityManagers_.find(entry.userId)->second;
+    }
+
     for (auto item: dataAbilityManagers_) {
         if (item.second && item.second->GetAbilityRecordByToken(token)) {
             return item.second;
@@ -3613,7 +3736,7 @@ void AbilityManagerService::InitDataAbilityManager(int32_t userId, bool switchUs
         }
     }
     if (!find) {
-        auto manager = std::make_shared<DataAbilityManager>();
+        auto manager = std::make_shared<DataAbilityManager>(userId);
         std::unique_lock<std::shared_mutex> lock(managersMutex_);
         dataAbilityManagers_.emplace(userId, manager);
         if (switchUser) {
@@ -4739,7 +4862,13 @@ void AbilityManagerService::ShowHelp(std::string &result)
         .append("-r                          ")
         .append("dump all process in the system\n")
         .append("-d                          ")
-        .append("dump all data ability infomation in the system");
+        .append("dump all data ability infomation in the system\n")
+        .append("-R                          ")
+        .append("dump the hit rates of the ability resolve cache\n")
+        .append("-P                          ")
+        .append("dump the lifecycle latencies of abilities by bundle\n")
+        .append("-I                          ")
+        .append("dump the calls, latencies and sizes of ipc codes");
 }
 
 void AbilityManagerService::ShowIllealInfomation(std::string &result)
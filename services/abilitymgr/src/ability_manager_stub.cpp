@@ -32,6 +32,7 @@ AbilityManagerStub::AbilityManagerStub()
     FirstStepInit();
     SecondStepInit();
     ThirdStepInit();
+    dispatchTable_.Build(requestFuncMap_);
 }
 
 AbilityManagerStub::~AbilityManagerStub()
@@ -153,12 +154,9 @@ int AbilityManagerStub::OnRemoteRequest(uint32_t code, MessageParcel &data, Mess
         return ERR_INVALID_STATE;
     }
 
-    auto itFunc = requestFuncMap_.find(code);
-    if (itFunc != requestFuncMap_.end()) {
-        auto requestFunc = itFunc->second;
-        if (requestFunc != nullptr) {
-            return (this->*requestFunc)(data, reply);
-        }
+    int result = ERR_OK;
+    if (dispatchTable_.Dispatch(this, code, data, reply, result)) {
+        return result;
     }
     HILOG_WARN("default case, need check.");
     return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
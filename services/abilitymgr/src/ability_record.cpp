@@ -21,6 +21,7 @@
 #include "ability_event_handler.h"
 #include "ability_manager_service.h"
 #include "ability_scheduler_stub.h"
+#include "ability_token_index.h"
 #include "ability_util.h"
 #include "bundle_mgr_client.h"
 #include "bytrace.h"
@@ -96,6 +97,10 @@ AbilityRecord::AbilityRecord(const Want &want, const AppExecFwk::AbilityInfo &ab
         abilityMgr->GetMaxRestartNum(restratMax_);
     }
     restartCount_ = restratMax_;
+    auto lifecycleMetrics = DelayedSingleton<AbilityLifecycleMetrics>::GetInstance();
+    if (lifecycleMetrics) {
+        lifecycleHistograms_ = lifecycleMetrics->GetHistograms(abilityInfo_.bundleName);
+    }
 }
 
 AbilityRecord::~AbilityRecord()
@@ -106,6 +111,9 @@ AbilityRecord::~AbilityRecord()
             object->RemoveDeathRecipient(schedulerDeathRecipient_);
         }
     }
+    if (token_ != nullptr) {
+        DelayedSingleton<AbilityTokenIndex>::GetInstance()->Remove(token_->AsObject().GetRefPtr());
+    }
 }
 
 std::shared_ptr<AbilityRecord> AbilityRecord::CreateAbilityRecord(const AbilityRequest &abilityRequest)
@@ -158,6 +166,7 @@ int AbilityRecord::LoadAbility()
     BYTRACE_NAME(BYTRACE_TAG_ABILITY_MANAGER, __PRETTY_FUNCTION__);
     HILOG_INFO("Start load ability, name is %{public}s.", abilityInfo_.name.c_str());
     startTime_ = AbilityUtil::SystemTimeMillis();
+    loadRequestTime_ = AbilityLifecycleMetrics::GetTimeUs();
     CHECK_POINTER_AND_RETURN(token_, ERR_INVALID_VALUE);
     std::string appName = applicationInfo_.name;
     if (appName.empty()) {
@@ -200,6 +209,7 @@ void AbilityRecord::ForegroundAbility(uint32_t sceneFlag)
     CHECK_POINTER(lifecycleDeal_);
 
     SendEvent(AbilityManagerService::FOREGROUNDNEW_TIMEOUT_MSG, AbilityManagerService::FOREGROUNDNEW_TIMEOUT);
+    MarkTransitionRequest(LifecyclePhase::FOREGROUND);
 
     // schedule active after updating AbilityState and sending timeout message to avoid ability async callback
     // earlier than above actions.
@@ -264,6 +274,7 @@ void AbilityRecord::BackgroundAbility(const Closure &task)
         SaveAbilityState();
     }
 
+    MarkTransitionRequest(LifecyclePhase::BACKGROUND);
     // schedule background after updating AbilityState and sending timeout message to avoid ability async callback
     // earlier than above actions.
     currentState_ = AbilityState::BACKGROUNDING;
@@ -429,6 +440,7 @@ void AbilityRecord::Activate()
     CHECK_POINTER(lifecycleDeal_);
 
     SendEvent(AbilityManagerService::ACTIVE_TIMEOUT_MSG, AbilityManagerService::ACTIVE_TIMEOUT);
+    MarkTransitionRequest(LifecyclePhase::ACTIVE);
 
     // schedule active after updating AbilityState and sending timeout message to avoid ability async callback
     // earlier than above actions.
@@ -451,6 +463,7 @@ void AbilityRecord::Inactivate()
     CHECK_POINTER(lifecycleDeal_);
 
     SendEvent(AbilityManagerService::INACTIVE_TIMEOUT_MSG, AbilityManagerService::INACTIVE_TIMEOUT);
+    MarkTransitionRequest(LifecyclePhase::INACTIVE);
 
     // schedule inactive after updating AbilityState and sending timeout message to avoid ability async callback
     // earlier than above actions.
@@ -473,6 +486,7 @@ void AbilityRecord::Terminate(const Closure &task)
             HILOG_INFO("Is debug mode, no need to handle time out.");
         }
     }
+    MarkTransitionRequest(LifecyclePhase::TERMINATE);
     // schedule background after updating AbilityState and sending timeout message to avoid ability async callback
     // earlier than above actions.
     currentState_ = AbilityState::TERMINATING;
@@ -843,6 +857,66 @@ int64_t AbilityRecord::GetStartTime() const
     return startTime_;
 }
 
+void AbilityRecord::MarkTransitionRequest(LifecyclePhase phase)
+{
+    // the phase first, so that a done reading the new time also reads its phase
+    transitionPhase_ = phase;
+    transitionRequestTime_ = AbilityLifecycleMetrics::GetTimeUs();
+}
+
+void AbilityRecord::RecordAttachDone()
+{
+    int64_t loadRequestTime = loadRequestTime_;
+    if (loadRequestTime == 0) {
+        return;
+    }
+    auto lifecycleMetrics = DelayedSingleton<AbilityLifecycleMetrics>::GetInstance();
+    CHECK_POINTER(lifecycleMetrics);
+    lifecycleMetrics->Record(lifecycleHistograms_, LifecyclePhase::LOAD,
+        static_cast<uint64_t>(AbilityLifecycleMetrics::GetTimeUs() - loadRequestTime));
+}
+
+void AbilityRecord::RecordTransitionDone(int targetState)
+{
+    LifecyclePhase phase = LifecyclePhase::PHASE_COUNT;
+    switch (targetState) {
+        case AbilityState::FOREGROUND:
+            phase = LifecyclePhase::FOREGROUND;
+            break;
+        case AbilityState::BACKGROUND:
+            phase = LifecyclePhase::BACKGROUND;
+            break;
+        case AbilityState::ACTIVE:
+            phase = LifecyclePhase::ACTIVE;
+            break;
+        case AbilityState::INACTIVE:
+            phase = LifecyclePhase::INACTIVE;
+            break;
+        case AbilityState::INITIAL:
+            phase = LifecyclePhase::TERMINATE;
+            break;
+        default:
+            return;
+    }
+    auto lifecycleMetrics = DelayedSingleton<AbilityLifecycleMetrics>::GetInstance();
+    CHECK_POINTER(lifecycleMetrics);
+    int64_t now = AbilityLifecycleMetrics::GetTimeUs();
+    // a done without its request, like the inactive done of a loading page, is not a transition to measure
+    if (transitionPhase_ == phase) {
+        int64_t transitionRequestTime = transitionRequestTime_.exchange(0);
+        if (transitionRequestTime != 0) {
+            lifecycleMetrics->Record(lifecycleHistograms_, phase, static_cast<uint64_t>(now - transitionRequestTime));
+        }
+    }
+    if (phase == LifecyclePhase::FOREGROUND || phase == LifecyclePhase::ACTIVE) {
+        int64_t loadRequestTime = loadRequestTime_.exchange(0);
+        if (loadRequestTime != 0) {
+            lifecycleMetrics->Record(lifecycleHistograms_, LifecyclePhase::START,
+                static_cast<uint64_t>(now - loadRequestTime));
+        }
+    }
+}
+
 void AbilityRecord::DumpService(std::vector<std::string> &info, bool isClient) const
 {
     std::vector<std::string> params;
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability_resolve_cache.h"
+
+#include <algorithm>
+
+#include "ability_manager_errors.h"
+#include "common_event_manager.h"
+#include "common_event_support.h"
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+// implicit wants carry uris, a full cache starts over rather than grow with them
+const size_t MAX_RESOLVED_ABILITIES = 1024;
+const size_t MAX_RESOLVED_BUNDLES = 1024;
+const char KEY_SEPARATOR = '#';
+const char KEY_LENGTH_SEPARATOR = ':';
+const int PERCENTAGE = 100;
+
+// want fields may hold any character, uris a '#' among them, so each one goes with its length
+void AppendKeyField(std::string &key, const std::string &field)
+{
+    key.append(1, KEY_SEPARATOR).append(std::to_string(field.length()));
+    key.append(1, KEY_LENGTH_SEPARATOR).append(field);
+}
+}
+
+AbilityResolveCache::~AbilityResolveCache()
+{
+    UnsubscribePackageEvents();
+}
+
+int AbilityResolveCache::ResolveAbility(const Want &want, int32_t flags, int32_t userId,
+    AppExecFwk::AbilityInfo &abilityInfo, const AbilityResolver &resolver)
+{
+    bool isImplicit = false;
+    std::string key = GetAbilityKey(want, flags, userId, isImplicit);
+    uint64_t generation = 0;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto iter = abilities_.find(key);
+        if (iter != abilities_.end()) {
+            abilityInfo = iter->second.abilityInfo;
+            abilityCounter_.hits++;
+            return ERR_OK;
+        }
+        generation = generation_;
+    }
+
+    abilityCounter_.misses++;
+    int result = resolver(abilityInfo);
+    if (result != ERR_OK) {
+        return result;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (generation != generation_) {
+        return ERR_OK;
+    }
+    if (abilities_.size() >= MAX_RESOLVED_ABILITIES) {
+        HILOG_INFO("%{public}s, %{public}zu abilities resolved, start over.", __func__, abilities_.size());
+        abilities_.clear();
+    }
+    abilities_[key] = ResolvedAbility { isImplicit, abilityInfo };
+    return ERR_OK;
+}
+
+bool AbilityResolveCache::GetDataAbilities(const std::string &bundleName, int32_t userId,
+    BundleDataAbilities &dataAbilities, const BundleResolver &resolver)
+{
+    std::string key = GetBundleKey(bundleName, userId);
+    uint64_t generation = 0;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto iter = bundles_.find(key);
+        if (iter != bundles_.end()) {
+            dataAbilities = iter->second;
+            bundleCounter_.hits++;
+            return true;
+        }
+        generation = generation_;
+    }
+
+    bundleCounter_.misses++;
+    AppExecFwk::BundleInfo bundleInfo;
+    if (!resolver(bundleInfo)) {
+        return false;
+    }
+    dataAbilities.abilityInfos.clear();
+    std::copy_if(bundleInfo.abilityInfos.begin(), bundleInfo.abilityInfos.end(),
+        std::back_inserter(dataAbilities.abilityInfos), [](const AppExecFwk::AbilityInfo &abilityInfo) {
+            return abilityInfo.type == AppExecFwk::AbilityType::DATA;
+        });
+    if (!dataAbilities.abilityInfos.empty()) {
+        dataAbilities.appInfo = bundleInfo.applicationInfo;
+        dataAbilities.uid = bundleInfo.uid;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (generation != generation_) {
+        return true;
+    }
+    if (bundles_.size() >= MAX_RESOLVED_BUNDLES) {
+        HILOG_INFO("%{public}s, %{public}zu bundles resolved, start over.", __func__, bundles_.size());
+        bundles_.clear();
+    }
+    bundles_[key] = dataAbilities;
+    return true;
+}
+
+void AbilityResolveCache::Invalidate(const std::string &bundleName)
+{
+    std::string bundlePrefix = bundleName + KEY_SEPARATOR;
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    generation_++;
+    invalidations_++;
+    for (auto iter = abilities_.begin(); iter != abilities_.end();) {
+        if (iter->second.isImplicit || iter->second.abilityInfo.bundleName == bundleName) {
+            iter = abilities_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    for (auto iter = bundles_.begin(); iter != bundles_.end();) {
+        if (iter->first.compare(0, bundlePrefix.length(), bundlePrefix) == 0) {
+            iter = bundles_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+void AbilityResolveCache::Clear()
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    generation_++;
+    invalidations_++;
+    abilities_.clear();
+    bundles_.clear();
+}
+
+void AbilityResolveCache::Dump(std::vector<std::string> &info)
+{
+    size_t abilityCount = 0;
+    size_t bundleCount = 0;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        abilityCount = abilities_.size();
+        bundleCount = bundles_.size();
+    }
+    info.emplace_back("AbilityResolveCache:");
+    info.emplace_back(DumpCounter("abilities", abilityCount, abilityCounter_));
+    info.emplace_back(DumpCounter("data abilities of bundles", bundleCount, bundleCounter_));
+    info.emplace_back("  invalidations: " + std::to_string(invalidations_));
+}
+
+bool AbilityResolveCache::SubscribePackageEvents()
+{
+    std::lock_guard<std::mutex> guard(subscriberMutex_);
+    if (subscriber_ != nullptr) {
+        // the common event service restarted, the old subscription went with it
+        EventFwk::CommonEventManager::UnSubscribeCommonEvent(subscriber_);
+        subscriber_ = nullptr;
+    }
+    EventFwk::MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_ADDED);
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED);
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_REMOVED);
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_USER_REMOVED);
+    EventFwk::CommonEventSubscribeInfo subscribeInfo(matchingSkills);
+    auto subscriber = std::make_shared<PackageEventSubscriber>(subscribeInfo,
+        [this](const EventFwk::CommonEventData &eventData) { OnPackageEvent(eventData); });
+    if (!EventFwk::CommonEventManager::SubscribeCommonEvent(subscriber)) {
+        HILOG_ERROR("%{public}s, subscribe package events failed.", __func__);
+        return false;
+    }
+    subscriber_ = subscriber;
+    Clear();
+    return true;
+}
+
+void AbilityResolveCache::UnsubscribePackageEvents()
+{
+    std::lock_guard<std::mutex> guard(subscriberMutex_);
+    if (subscriber_ == nullptr) {
+        return;
+    }
+    EventFwk::CommonEventManager::UnSubscribeCommonEvent(subscriber_);
+    subscriber_ = nullptr;
+}
+
+void AbilityResolveCache::OnPackageEvent(const EventFwk::CommonEventData &eventData)
+{
+    const AAFwk::Want &want = eventData.GetWant();
+    std::string action = want.GetAction();
+    if (action == EventFwk::CommonEventSupport::COMMON_EVENT_USER_REMOVED) {
+        Clear();
+        return;
+    }
+    std::string bundleName = want.GetElement().GetBundleName();
+    HILOG_DEBUG("%{public}s, action:%{public}s, bundleName:%{public}s", __func__, action.c_str(), bundleName.c_str());
+    Invalidate(bundleName);
+}
+
+void AbilityResolveCache::PackageEventSubscriber::OnReceiveEvent(const EventFwk::CommonEventData &eventData)
+{
+    if (callback_) {
+        callback_(eventData);
+    }
+}
+
+std::string AbilityResolveCache::GetAbilityKey(const Want &want, int32_t flags, int32_t userId, bool &isImplicit)
+{
+    // what the bundle manager matches a want with, by element or else by action, entities, uri and type
+    std::string key = std::to_string(userId);
+    key.append(1, KEY_SEPARATOR).append(std::to_string(flags));
+    key.append(1, KEY_SEPARATOR).append(std::to_string(want.GetFlags()));
+    const auto &element = want.GetElement();
+    isImplicit = element.GetBundleName().empty() || element.GetAbilityName().empty();
+    key.append(1, KEY_SEPARATOR).append(isImplicit ? "implicit" : "element");
+    if (!isImplicit) {
+        AppendKeyField(key, element.GetDeviceID());
+        AppendKeyField(key, element.GetBundleName());
+        AppendKeyField(key, element.GetModuleName());
+        AppendKeyField(key, element.GetAbilityName());
+        return key;
+    }
+    AppendKeyField(key, want.GetAction());
+    std::vector<std::string> entities = want.GetEntities();
+    std::sort(entities.begin(), entities.end());
+    key.append(1, KEY_SEPARATOR).append(std::to_string(entities.size()));
+    for (const auto &entity : entities) {
+        AppendKeyField(key, entity);
+    }
+    AppendKeyField(key, want.GetUriString());
+    AppendKeyField(key, want.GetType());
+    return key;
+}
+
+std::string AbilityResolveCache::GetBundleKey(const std::string &bundleName, int32_t userId)
+{
+    std::string key = bundleName;
+    key.append(1, KEY_SEPARATOR).append(std::to_string(userId));
+    return key;
+}
+
+std::string AbilityResolveCache::DumpCounter(const std::string &name, size_t size, const Counter &counter)
+{
+    uint64_t hits = counter.hits;
+    uint64_t misses = counter.misses;
+    uint64_t total = hits + misses;
+    std::string line = "  " + name + ": " + std::to_string(size) + " cached, " + std::to_string(hits) +
+        " hits, " + std::to_string(misses) + " misses";
+    if (total > 0) {
+        line += ", hit rate " + std::to_string(hits * PERCENTAGE / total) + "%";
+    }
+    return line;
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability_token_index.h"
+
+#include <functional>
+#include <mutex>
+
+#include "ability_record.h"
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+const IRemoteObject *GetTokenObject(const std::shared_ptr<AbilityRecord> &abilityRecord)
+{
+    if (abilityRecord == nullptr) {
+        return nullptr;
+    }
+    auto token = abilityRecord->GetToken();
+    return token == nullptr ? nullptr : token->AsObject().GetRefPtr();
+}
+}  // namespace
+
+AbilityTokenIndex::AbilityTokenIndex()
+{}
+
+AbilityTokenIndex::~AbilityTokenIndex()
+{}
+
+AbilityTokenIndex::Shard &AbilityTokenIndex::GetShard(const IRemoteObject *token)
+{
+    return shards_[std::hash<const IRemoteObject *>()(token) % SHARD_COUNT];
+}
+
+void AbilityTokenIndex::Add(const std::shared_ptr<AbilityRecord> &abilityRecord, AbilityTokenOwnerType ownerType,
+    const void *owner, int32_t userId)
+{
+    const IRemoteObject *token = GetTokenObject(abilityRecord);
+    if (token == nullptr) {
+        HILOG_ERROR("Add to token index fail, ability record or token is null.");
+        return;
+    }
+
+    Shard &shard = GetShard(token);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    Entry &entry = shard.entries[token];
+    entry.abilityRecord = abilityRecord;
+    entry.ownerType = ownerType;
+    entry.owner = owner;
+    entry.userId = userId;
+}
+
+void AbilityTokenIndex::Remove(const std::shared_ptr<AbilityRecord> &abilityRecord)
+{
+    Remove(GetTokenObject(abilityRecord));
+}
+
+void AbilityTokenIndex::Remove(const IRemoteObject *token)
+{
+    if (token == nullptr) {
+        return;
+    }
+
+    Shard &shard = GetShard(token);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    shard.entries.erase(token);
+}
+
+void AbilityTokenIndex::RemoveOwner(const void *owner)
+{
+    for (auto &shard : shards_) {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        for (auto it = shard.entries.begin(); it != shard.entries.end();) {
+            if (it->second.owner == owner) {
+                it = shard.entries.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+}
+
+bool AbilityTokenIndex::Lookup(const IRemoteObject *token, Entry &entry,
+    std::shared_ptr<AbilityRecord> &abilityRecord)
+{
+    if (token == nullptr) {
+        return false;
+    }
+
+    {
+        Shard &shard = GetShard(token);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        auto it = shard.entries.find(token);
+        if (it == shard.entries.end()) {
+            return false;
+        }
+        entry = it->second;
+    }
+
+    abilityRecord = entry.abilityRecord.lock();
+    // the address of a destroyed token may be reused, so the record has to still hold this very token.
+    if (GetTokenObject(abilityRecord) != token) {
+        abilityRecord = nullptr;
+        RemoveExpired(token);
+        return false;
+    }
+    return true;
+}
+
+void AbilityTokenIndex::RemoveExpired(const IRemoteObject *token)
+{
+    Shard &shard = GetShard(token);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.entries.find(token);
+    if (it != shard.entries.end() && GetTokenObject(it->second.abilityRecord.lock()) != token) {
+        shard.entries.erase(it);
+    }
+}
+
+std::shared_ptr<AbilityRecord> AbilityTokenIndex::Find(const sptr<IRemoteObject> &token)
+{
+    Entry entry;
+    std::shared_ptr<AbilityRecord> abilityRecord;
+    Lookup(token.GetRefPtr(), entry, abilityRecord);
+    return abilityRecord;
+}
+
+std::shared_ptr<AbilityRecord> AbilityTokenIndex::Find(const sptr<IRemoteObject> &token, const void *owner)
+{
+    Entry entry;
+    std::shared_ptr<AbilityRecord> abilityRecord;
+    if (!Lookup(token.GetRefPtr(), entry, abilityRecord) || entry.owner != owner) {
+        return nullptr;
+    }
+    return abilityRecord;
+}
+
+bool AbilityTokenIndex::GetEntry(const sptr<IRemoteObject> &token, Entry &entry)
+{
+    std::shared_ptr<AbilityRecord> abilityRecord;
+    return Lookup(token.GetRefPtr(), entry, abilityRecord);
+}
+
+size_t AbilityTokenIndex::Size() const
+{
+    size_t size = 0;
+    for (const auto &shard : shards_) {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        size += shard.entries.size();
+    }
+    return size;
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -19,6 +19,7 @@
 #include <thread>
 
 #include "ability_manager_service.h"
+#include "ability_token_index.h"
 #include "ability_util.h"
 #include "hilog_wrapper.h"
 
@@ -32,7 +33,7 @@ constexpr bool DEBUG_ENABLED = false;
 constexpr system_clock::duration DATA_ABILITY_LOAD_TIMEOUT = 11000ms;
 }  // namespace
 
-DataAbilityManager::DataAbilityManager()
+DataAbilityManager::DataAbilityManager(int32_t userId) : userId_(userId)
 {
     HILOG_DEBUG("%{public}s(%{public}d)", __PRETTY_FUNCTION__, __LINE__);
 }
@@ -40,6 +41,7 @@ DataAbilityManager::DataAbilityManager()
 DataAbilityManager::~DataAbilityManager()
 {
     HILOG_DEBUG("%{public}s(%{public}d)", __PRETTY_FUNCTION__, __LINE__);
+    DelayedSingleton<AbilityTokenIndex>::GetInstance()->RemoveOwner(this);
 }
 
 sptr<IAbilityScheduler> DataAbilityManager::Acquire(
@@ -103,6 +105,7 @@ sptr<IAbilityScheduler> DataAbilityManager::Acquire(
         if (it != dataAbilityRecordsLoaded_.end()) {
             dataAbilityRecordsLoaded_.erase(it);
         }
+        DelayedSingleton<AbilityTokenIndex>::GetInstance()->Remove(dataAbilityRecord->GetAbilityRecord());
         return nullptr;
     }
 
@@ -298,6 +301,7 @@ void DataAbilityManager::OnAbilityDied(const std::shared_ptr<AbilityRecord> &abi
                 if (it->second && it->second->GetAbilityRecord() == abilityRecord) {
                     it->second->KillBoundClientProcesses();
                     HILOG_DEBUG("Removing died data ability record...");
+                    DelayedSingleton<AbilityTokenIndex>::GetInstance()->Remove(abilityRecord);
                     it = dataAbilityRecordsLoaded_.erase(it);
                     break;
                 } else {
@@ -388,6 +392,11 @@ std::shared_ptr<AbilityRecord> DataAbilityManager::GetAbilityRecordByToken(const
 
     CHECK_POINTER_AND_RETURN(token, nullptr);
 
+    auto indexedRecord = DelayedSingleton<AbilityTokenIndex>::GetInstance()->Find(token, this);
+    if (indexedRecord) {
+        return indexedRecord;
+    }
+
     std::lock_guard<std::mutex> locker(mutex_);
     for (auto it = dataAbilityRecordsLoaded_.begin(); it != dataAbilityRecordsLoaded_.end(); ++it) {
         if (!it->second) {
@@ -466,6 +475,8 @@ DataAbilityManager::DataAbilityRecordPtr DataAbilityManager::LoadLocked(
             HILOG_ERROR("Failed to insert data ability to loading map.");
             return nullptr;
         }
+        DelayedSingleton<AbilityTokenIndex>::GetInstance()->Add(
+            dataAbilityRecord->GetAbilityRecord(), AbilityTokenOwnerType::DATA_ABILITY, this, userId_);
     } else {
         HILOG_INFO("Acquired data ability is loading...");
         dataAbilityRecord = it->second;
@@ -486,6 +497,7 @@ DataAbilityManager::DataAbilityRecordPtr DataAbilityManager::LoadLocked(
         if (it != dataAbilityRecordsLoading_.end()) {
             dataAbilityRecordsLoading_.erase(it);
         }
+        DelayedSingleton<AbilityTokenIndex>::GetInstance()->Remove(dataAbilityRecord->GetAbilityRecord());
         return nullptr;
     }
 
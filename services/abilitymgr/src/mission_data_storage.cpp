@@ -25,20 +25,50 @@
 
 namespace OHOS {
 namespace AAFwk {
-MissionDataStorage::MissionDataStorage(int userId)
-{
-    userId_ = userId;
-}
+namespace {
+const std::string FLUSH_MISSION_INFO = "FlushMissionInfo";
+// updates arriving within this window are coalesced into one journal write, in ms
+constexpr int64_t FLUSH_MISSION_INFO_DELAY = 200;
+}  // namespace
 
-MissionDataStorage::~MissionDataStorage()
+MissionDataStorage::MissionDataStorage(int userId) : userId_(userId), journal_(GetMissionDataDirPath())
 {}
 
+MissionDataStorage::~MissionDataStorage()
+{
+    journal_.Flush();
+}
+
 void MissionDataStorage::SetEventHandler(const std::shared_ptr<AppExecFwk::EventHandler> &handler)
 {
     handler_ = handler;
 }
 
 bool MissionDataStorage::LoadAllMissionInfo(std::list<InnerMissionInfo> &missionInfoList)
+{
+    std::map<int32_t, std::string> records;
+    if (journal_.Exists()) {
+        if (!journal_.GetAll(records)) {
+            HILOG_ERROR("load mission journal failed, keep the readable missions.");
+        }
+        // leftovers of a migration interrupted after the journal was written
+        RemoveLegacyMissionFiles();
+    } else {
+        MigrateLegacyMissionInfo(records);
+    }
+
+    for (const auto &record : records) {
+        InnerMissionInfo misssionInfo;
+        if (!misssionInfo.FromJsonStr(record.second)) {
+            HILOG_ERROR("parse mission info failed. missionId: %{public}d", record.first);
+            continue;
+        }
+        missionInfoList.push_back(misssionInfo);
+    }
+    return true;
+}
+
+void MissionDataStorage::MigrateLegacyMissionInfo(std::map<int32_t, std::string> &records)
 {
     std::vector<std::string> fileNameVec;
     std::string dirPath = GetMissionDataDirPath();
@@ -46,7 +76,6 @@ bool MissionDataStorage::LoadAllMissionInfo(std::list<InnerMissionInfo> &mission
 
     for (auto fileName : fileNameVec) {
         if (!CheckFileNameValid(fileName)) {
-            HILOG_ERROR("load mission info: file name %{public}s invalid.", fileName.c_str());
             continue;
         }
 
@@ -62,50 +91,84 @@ bool MissionDataStorage::LoadAllMissionInfo(std::list<InnerMissionInfo> &mission
             HILOG_ERROR("parse mission info failed. file: %{public}s", fileName.c_str());
             continue;
         }
-        missionInfoList.push_back(misssionInfo);
+        records[misssionInfo.missionInfo.id] = content;
     }
-    return true;
+
+    if (!journal_.Reset(records)) {
+        // keep the mission files, and let the next flush bring the missions into the journal
+        HILOG_ERROR("migrate %{public}zu missions to journal failed.", records.size());
+        for (const auto &record : records) {
+            journal_.Put(record.first, record.second);
+        }
+        return;
+    }
+    HILOG_INFO("migrate %{public}zu missions to journal.", records.size());
+    RemoveLegacyMissionFiles();
 }
 
-void MissionDataStorage::SaveMissionInfo(const InnerMissionInfo &missionInfo)
+void MissionDataStorage::RemoveLegacyMissionFiles()
 {
-    std::string filePath = GetMissionDataFilePath(missionInfo.missionInfo.id);
-    std::string dirPath = OHOS::HiviewDFX::FileUtil::ExtractFilePath(filePath);
-    if (!OHOS::HiviewDFX::FileUtil::FileExists(dirPath)) {
-        bool createDir = OHOS::HiviewDFX::FileUtil::ForceCreateDirectory(dirPath);
-        if (!createDir) {
-            HILOG_ERROR("create dir %{public}s failed.", dirPath.c_str());
-            return;
+    std::vector<std::string> fileNameVec;
+    OHOS::HiviewDFX::FileUtil::GetDirFiles(GetMissionDataDirPath(), fileNameVec);
+    for (const auto &fileName : fileNameVec) {
+        if (CheckFileNameValid(fileName) && !OHOS::HiviewDFX::FileUtil::RemoveFile(fileName)) {
+            HILOG_ERROR("remove mission file %{public}s failed.", fileName.c_str());
         }
     }
+}
 
-    std::string jsonStr = missionInfo.ToJsonStr();
-    bool saveMissionFile = OHOS::HiviewDFX::FileUtil::SaveStringToFile(filePath, jsonStr, true);
-    if (!saveMissionFile) {
-        HILOG_ERROR("save mission file %{public}s failed.", filePath.c_str());
-    }
+void MissionDataStorage::SaveMissionInfo(const InnerMissionInfo &missionInfo)
+{
+    journal_.Put(missionInfo.missionInfo.id, missionInfo.ToJsonStr());
+    ScheduleFlush();
 }
 
 void MissionDataStorage::DeleteMissionInfo(int missionId)
 {
-    std::string filePath = GetMissionDataFilePath(missionId);
-    bool removeMissionFile = OHOS::HiviewDFX::FileUtil::RemoveFile(filePath);
-    if (!removeMissionFile) {
-        HILOG_ERROR("remove mission file %{public}s failed.", filePath.c_str());
-        return;
-    }
+    journal_.Remove(missionId);
+    ScheduleFlush();
     DeleteMissionSnapshot(missionId);
 }
 
-std::string MissionDataStorage::GetMissionDataDirPath()
+void MissionDataStorage::FlushMissionInfo()
 {
-    return TASK_DATA_FILE_BASE_PATH + "/" + std::to_string(userId_) + "/" + MISSION_DATA_FILE_PATH;
+    flushScheduled_ = false;
+    if (!journal_.Flush()) {
+        HILOG_ERROR("flush mission journal of user %{public}d failed.", userId_);
+    }
 }
 
-std::string MissionDataStorage::GetMissionDataFilePath(int missionId)
+void MissionDataStorage::DiscardMissionInfo()
 {
-    return GetMissionDataDirPath() + "/"
-        + MISSION_JSON_FILE_PREFIX + "_" + std::to_string(missionId) + JSON_FILE_SUFFIX;
+    journal_.Discard();
+}
+
+void MissionDataStorage::ScheduleFlush()
+{
+    if (!handler_) {
+        FlushMissionInfo();
+        return;
+    }
+    if (flushScheduled_) {
+        return;
+    }
+
+    std::weak_ptr<MissionDataStorage> weakStorage = shared_from_this();
+    auto flushTask = [weakStorage]() {
+        auto storage = weakStorage.lock();
+        if (storage) {
+            storage->FlushMissionInfo();
+        }
+    };
+    flushScheduled_ = handler_->PostTask(flushTask, FLUSH_MISSION_INFO, FLUSH_MISSION_INFO_DELAY);
+    if (!flushScheduled_) {
+        FlushMissionInfo();
+    }
+}
+
+std::string MissionDataStorage::GetMissionDataDirPath()
+{
+    return TASK_DATA_FILE_BASE_PATH + "/" + std::to_string(userId_) + "/" + MISSION_DATA_FILE_PATH;
 }
 
 bool MissionDataStorage::CheckFileNameValid(const std::string &fileName)
@@ -14,6 +14,10 @@
  */
 
 #include "mission_info_mgr.h"
+
+#include <cerrno>
+#include <cstdlib>
+
 #include "hilog_wrapper.h"
 #include "nlohmann/json.hpp"
 
@@ -63,6 +67,7 @@ bool MissionInfoMgr::Init(int userId)
     }
 
     missionInfoList_.clear();
+    missionInfoIndex_.clear();
     missionIdMap_.clear();
     if (!LoadAllMissionInfo()) {
         return false;
@@ -79,19 +84,12 @@ bool MissionInfoMgr::AddMissionInfo(const InnerMissionInfo &missionInfo)
         return false;
     }
 
-    auto listIter = missionInfoList_.begin();
-    for (; listIter != missionInfoList_.end(); listIter++) {
-        if (listIter->missionInfo.time < missionInfo.missionInfo.time) {
-            break;  // first listIter->time < missionInfo.time
-        }
-    }
-
     if (!taskDataPersistenceMgr_->SaveMissionInfo(missionInfo)) {
         HILOG_ERROR("save mission info failed");
         return false;
     }
 
-    missionInfoList_.insert(listIter, missionInfo);
+    InsertMissionInfo(missionInfo);
     missionIdMap_[id] = true;
     return true;
 }
@@ -104,31 +102,23 @@ bool MissionInfoMgr::UpdateMissionInfo(const InnerMissionInfo &missionInfo)
         return false;
     }
 
-    auto listIter = missionInfoList_.begin();
-    for (; listIter != missionInfoList_.end(); listIter++) {
-        if (listIter->missionInfo.id == id) {
-            break;
-        }
-    }
-
+    auto listIter = FindMissionInfo(id);
     if (listIter == missionInfoList_.end()) {
         HILOG_ERROR("update mission info failed, missionId %{public}d not exists", id);
         return false;
     }
 
-    if (missionInfo.missionInfo.time == listIter->missionInfo.time) {
+    if (missionInfo.missionInfo.time == listIter->second.missionInfo.time) {
         // time not changes, no need sort again
-        *listIter = missionInfo;
-        if (!taskDataPersistenceMgr_->SaveMissionInfo(missionInfo)) {
-            HILOG_ERROR("save mission info failed.");
-            return false;
-        }
-        return true;
+        listIter->second = missionInfo;
+    } else {
+        ReorderMissionInfo(listIter, missionInfo);
     }
-
-    missionInfoList_.erase(listIter);
-    missionIdMap_.erase(id);
-    return AddMissionInfo(missionInfo);
+    if (!taskDataPersistenceMgr_->SaveMissionInfo(missionInfo)) {
+        HILOG_ERROR("save mission info failed.");
+        return false;
+    }
+    return true;
 }
 
 bool MissionInfoMgr::DeleteMissionInfo(int missionId)
@@ -154,11 +144,9 @@ bool MissionInfoMgr::DeleteMissionInfo(int missionId)
         return false;
     }
 
-    for (auto listIter = missionInfoList_.begin(); listIter != missionInfoList_.end(); listIter++) {
-        if (listIter->missionInfo.id == missionId) {
-            missionInfoList_.erase(listIter);
-            break;
-        }
+    auto listIter = FindMissionInfo(missionId);
+    if (listIter != missionInfoList_.end()) {
+        EraseMissionInfo(listIter);
     }
 
     missionIdMap_.erase(missionId);
@@ -173,13 +161,14 @@ bool MissionInfoMgr::DeleteAllMissionInfos(const std::shared_ptr<MissionListener
     }
 
     for (auto listIter = missionInfoList_.begin(); listIter != missionInfoList_.end();) {
-        if (!(listIter->missionInfo.lockedState)) {
-            missionIdMap_.erase(listIter->missionInfo.id);
-            taskDataPersistenceMgr_->DeleteMissionInfo(listIter->missionInfo.id);
+        if (!(listIter->second.missionInfo.lockedState)) {
+            int32_t missionId = listIter->second.missionInfo.id;
+            missionIdMap_.erase(missionId);
+            taskDataPersistenceMgr_->DeleteMissionInfo(missionId);
             if (listenerController) {
-                listenerController->NotifyMissionDestroyed(listIter->missionInfo.id);
+                listenerController->NotifyMissionDestroyed(missionId);
             }
-            missionInfoList_.erase(listIter++);
+            EraseMissionInfo(listIter++);
         } else {
             ++listIter;
         }
@@ -204,17 +193,18 @@ int MissionInfoMgr::GetMissionInfos(int32_t numMax, std::vector<MissionInfo> &mi
         return -1;
     }
 
-    for (auto &mission : missionInfoList_) {
+    missionInfos.reserve(missionInfos.size() + std::min(static_cast<size_t>(numMax), missionInfoList_.size()));
+    for (const auto &item : missionInfoList_) {
         if (static_cast<int>(missionInfos.size()) >= numMax) {
             break;
         }
 
+        const auto &mission = item.second;
         if (DoesNotShowInTheMissionList(mission.startMethod)) {
             HILOG_INFO("MissionId[%{public}d] don't show in mission list", mission.missionInfo.id);
             continue;
         }
-        MissionInfo info = mission.missionInfo;
-        missionInfos.emplace_back(info);
+        missionInfos.emplace_back(mission.missionInfo);
     }
 
     return 0;
@@ -228,24 +218,19 @@ int MissionInfoMgr::GetMissionInfoById(int32_t missionId, MissionInfo &missionIn
         return -1;
     }
 
-    auto it = std::find_if(missionInfoList_.begin(), missionInfoList_.end(),
-        [&missionId](const InnerMissionInfo item) {
-            return item.missionInfo.id == missionId;
-        }
-    );
-
+    auto it = FindMissionInfo(missionId);
     if (it == missionInfoList_.end()) {
         HILOG_ERROR("no such mission:%{public}d", missionId);
         return -1;
     }
 
-    if (DoesNotShowInTheMissionList((*it).startMethod)) {
-        HILOG_INFO("MissionId[%{public}d] don't show in mission list", (*it).missionInfo.id);
+    if (DoesNotShowInTheMissionList(it->second.startMethod)) {
+        HILOG_INFO("MissionId[%{public}d] don't show in mission list", it->second.missionInfo.id);
         return -1;
     }
 
     HILOG_INFO("GetMissionInfoById, find missionId missionId:%{public}d", missionId);
-    missionInfo = (*it).missionInfo;
+    missionInfo = it->second.missionInfo;
     return 0;
 }
 
@@ -256,17 +241,12 @@ int MissionInfoMgr::GetInnerMissionInfoById(int32_t missionId, InnerMissionInfo
         return -1;
     }
 
-    auto it = std::find_if(missionInfoList_.begin(), missionInfoList_.end(),
-        [&missionId](const InnerMissionInfo item) {
-            return item.missionInfo.id == missionId;
-        }
-    );
-
+    auto it = FindMissionInfo(missionId);
     if (it == missionInfoList_.end()) {
         HILOG_ERROR("no such mission:%{public}d", missionId);
         return -1;
     }
-    innerMissionInfo = *it;
+    innerMissionInfo = it->second;
     return 0;
 }
 
@@ -277,8 +257,8 @@ bool MissionInfoMgr::FindReusedSingletonMission(const std::string &missionName,
     }
 
     auto it = std::find_if(missionInfoList_.begin(), missionInfoList_.end(),
-        [&missionName](const InnerMissionInfo item) {
-            return (missionName == item.missionName && item.isSingletonMode);
+        [&missionName](const MissionInfoList::value_type &item) {
+            return (missionName == item.second.missionName && item.second.isSingletonMode);
         }
     );
 
@@ -286,29 +266,27 @@ bool MissionInfoMgr::FindReusedSingletonMission(const std::string &missionName,
         HILOG_WARN("can not find target singleton mission:%{public}s", missionName.c_str());
         return false;
     }
-    info = *it;
+    info = it->second;
     return true;
 }
 
 void MissionInfoMgr::UpdateMissionTimeStamp(int32_t missionId, const std::string& timestamp)
 {
-    auto it = find_if(missionInfoList_.begin(), missionInfoList_.end(), [missionId](const InnerMissionInfo &info) {
-        return missionId == info.missionInfo.id;
-    });
+    auto it = FindMissionInfo(missionId);
     if (it == missionInfoList_.end()) {
         HILOG_ERROR("UpdateMissionTimeStamp failed, missionId %{public}d not exists", missionId);
         return;
     }
 
-    if (timestamp == it->missionInfo.time) {
+    if (timestamp == it->second.missionInfo.time) {
         return;
     }
-    InnerMissionInfo updateInfo = *it;
+    InnerMissionInfo updateInfo = it->second;
     updateInfo.missionInfo.time = timestamp;
-
-    missionInfoList_.erase(it);
-    missionIdMap_.erase(missionId);
-    (void)AddMissionInfo(updateInfo);
+    ReorderMissionInfo(it, updateInfo);
+    if (!taskDataPersistenceMgr_->SaveMissionInfo(updateInfo)) {
+        HILOG_ERROR("save mission info failed.");
+    }
 }
 
 int MissionInfoMgr::UpdateMissionLabel(int32_t missionId, const std::string& label)
@@ -317,16 +295,14 @@ int MissionInfoMgr::UpdateMissionLabel(int32_t missionId, const std::string& lab
         HILOG_ERROR("task data persist not init.");
         return -1;
     }
-    auto it = find_if(missionInfoList_.begin(), missionInfoList_.end(), [missionId](const InnerMissionInfo &info) {
-        return missionId == info.missionInfo.id;
-    });
+    auto it = FindMissionInfo(missionId);
     if (it == missionInfoList_.end()) {
         HILOG_ERROR("UpdateMissionLabel failed, missionId %{public}d not exists", missionId);
         return -1;
     }
 
-    it->missionInfo.label = label;
-    if (!taskDataPersistenceMgr_->SaveMissionInfo(*it)) {
+    it->second.missionInfo.label = label;
+    if (!taskDataPersistenceMgr_->SaveMissionInfo(it->second)) {
         HILOG_ERROR("save mission info failed.");
         return -1;
     }
@@ -340,23 +316,67 @@ bool MissionInfoMgr::LoadAllMissionInfo()
         return false;
     }
 
-    if (!taskDataPersistenceMgr_->LoadAllMissionInfo(missionInfoList_)) {
+    std::list<InnerMissionInfo> missionInfoList;
+    if (!taskDataPersistenceMgr_->LoadAllMissionInfo(missionInfoList)) {
         HILOG_ERROR("load mission info failed");
         return false;
     }
 
-    // sort by time
-    auto cmpFunc = [] (const InnerMissionInfo &infoBase, const InnerMissionInfo &infoCmp) {
-        return infoBase.missionInfo.time > infoCmp.missionInfo.time;
-    };
-    missionInfoList_.sort(cmpFunc);
-
-    for (const auto &info : missionInfoList_) {
+    for (const auto &info : missionInfoList) {
+        InsertMissionInfo(info);
         missionIdMap_[info.missionInfo.id] = true;
     }
     return true;
 }
 
+MissionInfoMgr::MissionOrderKey MissionInfoMgr::MakeOrderKey(const std::string &time)
+{
+    MissionOrderKey key;
+    // the time stamp is saved as decimal nanoseconds, compare it as a number
+    errno = 0;
+    char *end = nullptr;
+    unsigned long long timestamp = std::strtoull(time.c_str(), &end, 10);
+    if (errno == 0 && end != time.c_str() && *end == '\0') {
+        key.timestamp = static_cast<uint64_t>(timestamp);
+    }
+    key.sequence = missionSequence_++;
+    return key;
+}
+
+void MissionInfoMgr::InsertMissionInfo(const InnerMissionInfo &missionInfo)
+{
+    auto result = missionInfoList_.emplace(MakeOrderKey(missionInfo.missionInfo.time), missionInfo);
+    missionInfoIndex_[missionInfo.missionInfo.id] = result.first;
+}
+
+void MissionInfoMgr::EraseMissionInfo(MissionInfoList::iterator it)
+{
+    missionInfoIndex_.erase(it->second.missionInfo.id);
+    missionInfoList_.erase(it);
+}
+
+void MissionInfoMgr::ReorderMissionInfo(MissionInfoList::iterator it, const InnerMissionInfo &missionInfo)
+{
+    // move the node itself to its new position, no mission info is copied or reallocated
+    auto node = missionInfoList_.extract(it);
+    node.key() = MakeOrderKey(missionInfo.missionInfo.time);
+    node.mapped() = missionInfo;
+    auto result = missionInfoList_.insert(std::move(node));
+    missionInfoIndex_[missionInfo.missionInfo.id] = result.position;
+}
+
+MissionInfoMgr::MissionInfoList::iterator MissionInfoMgr::FindMissionInfo(int32_t missionId)
+{
+    auto it = missionInfoIndex_.find(missionId);
+    return it == missionInfoIndex_.end() ? missionInfoList_.end() : it->second;
+}
+
+MissionInfoMgr::MissionInfoList::const_iterator MissionInfoMgr::FindMissionInfo(int32_t missionId) const
+{
+    auto it = missionInfoIndex_.find(missionId);
+    return it == missionInfoIndex_.end() ? missionInfoList_.cend() : MissionInfoList::const_iterator(it->second);
+}
+
 void MissionInfoMgr::HandleUnInstallApp(const std::string &bundleName, int32_t uid, std::list<int32_t> &missions)
 {
     HILOG_INFO("HandleUnInstallApp, bundleName:%{public}s, uid:%{public}d", bundleName.c_str(), uid);
@@ -372,7 +392,8 @@ void MissionInfoMgr::HandleUnInstallApp(const std::string &bundleName, int32_t u
 
 void MissionInfoMgr::GetMatchedMission(const std::string &bundleName, int32_t uid, std::list<int32_t> &missions)
 {
-    for (const auto& innerMissionInfo : missionInfoList_) {
+    for (const auto& item : missionInfoList_) {
+        const auto& innerMissionInfo = item.second;
         if (innerMissionInfo.bundleName == bundleName && innerMissionInfo.uid == uid) {
             missions.push_back(innerMissionInfo.missionInfo.id);
         }
@@ -381,8 +402,8 @@ void MissionInfoMgr::GetMatchedMission(const std::string &bundleName, int32_t ui
 
 void MissionInfoMgr::Dump(std::vector<std::string> &info)
 {
-    for (const auto& innerMissionInfo : missionInfoList_) {
-        innerMissionInfo.Dump(info);
+    for (const auto& item : missionInfoList_) {
+        item.second.Dump(info);
     }
 }
 
@@ -395,9 +416,7 @@ bool MissionInfoMgr::UpdateMissionSnapshot(int32_t missionId, const sptr<IRemote
     MissionSnapshot& missionSnapshot) const
 {
     HILOG_INFO("Update mission snapshot, missionId:%{public}d.", missionId);
-    auto it = find_if(missionInfoList_.begin(), missionInfoList_.end(), [missionId](const InnerMissionInfo &info) {
-        return missionId == info.missionInfo.id;
-    });
+    auto it = FindMissionInfo(missionId);
     if (it == missionInfoList_.end()) {
         HILOG_ERROR("snapshot: get mission failed, missionId %{public}d not exists", missionId);
         return false;
@@ -419,7 +438,7 @@ bool MissionInfoMgr::UpdateMissionSnapshot(int32_t missionId, const sptr<IRemote
 #ifdef SUPPORT_GRAPHICS
     missionSnapshot.snapshot = snapshot.GetPixelMap();
 #endif
-    missionSnapshot.topAbility = it->missionInfo.want.GetElement();
+    missionSnapshot.topAbility = it->second.missionInfo.want.GetElement();
     if (!taskDataPersistenceMgr_->SaveMissionSnapshot(missionId, missionSnapshot)) {
         HILOG_ERROR("snapshot: save mission snapshot failed");
         return false;
@@ -432,9 +451,7 @@ bool MissionInfoMgr::GetMissionSnapshot(int32_t missionId, const sptr<IRemoteObj
     MissionSnapshot& missionSnapshot, bool force) const
 {
     HILOG_INFO("mission_list_info GetMissionSnapshot, missionId:%{public}d, force:%{public}d", missionId, force);
-    auto it = find_if(missionInfoList_.begin(), missionInfoList_.end(), [missionId](const InnerMissionInfo &info) {
-        return missionId == info.missionInfo.id;
-    });
+    auto it = FindMissionInfo(missionId);
     if (it == missionInfoList_.end()) {
         HILOG_ERROR("snapshot: get mission failed, missionId %{public}d not exists", missionId);
         return false;
@@ -450,7 +467,7 @@ bool MissionInfoMgr::GetMissionSnapshot(int32_t missionId, const sptr<IRemoteObj
     }
 
     if (taskDataPersistenceMgr_->GetMissionSnapshot(missionId, missionSnapshot)) {
-        missionSnapshot.topAbility = it->missionInfo.want.GetElement();
+        missionSnapshot.topAbility = it->second.missionInfo.want.GetElement();
         HILOG_ERROR("mission_list_info GetMissionSnapshot, find snapshot OK, missionId:%{public}d", missionId);
         return true;
     }
@@ -0,0 +1,445 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mission_journal.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <fcntl.h>
+#include <fstream>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "file_util.h"
+#include "hilog_wrapper.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+constexpr uint32_t MISSION_FILE_MAGIC = 0x4D4A524E;
+constexpr uint32_t MISSION_FILE_VERSION = 1;
+// type, mission id, data size and checksum
+constexpr size_t RECORD_HEADER_SIZE = sizeof(uint8_t) + sizeof(int32_t) + sizeof(uint32_t) * 2;
+constexpr size_t COMPACT_MIN_RECORD_COUNT = 128;
+constexpr size_t COMPACT_FACTOR = 2;
+constexpr uint32_t FNV_OFFSET_BASIS = 2166136261U;
+constexpr uint32_t FNV_PRIME = 16777619U;
+constexpr mode_t MISSION_FILE_MODE = S_IRUSR | S_IWUSR;
+const std::string TEMP_FILE_SUFFIX = ".tmp";
+
+enum class RecordType : uint8_t {
+    SAVE = 1,
+    REMOVE = 2,
+};
+
+template<typename T>
+void AppendValue(std::string &buffer, T value)
+{
+    buffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+// reads a value at offset and moves offset past it
+template<typename T>
+bool ReadValue(const std::string &buffer, size_t &offset, T &value)
+{
+    if (offset > buffer.size() || buffer.size() - offset < sizeof(T) ||
+        memcpy_s(&value, sizeof(T), buffer.data() + offset, sizeof(T)) != EOK) {
+        return false;
+    }
+    offset += sizeof(T);
+    return true;
+}
+
+uint32_t Checksum(RecordType type, int32_t missionId, const char *data, size_t size)
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+    auto mix = [&hash](const char *bytes, size_t length) {
+        for (size_t i = 0; i < length; i++) {
+            hash = (hash ^ static_cast<uint8_t>(bytes[i])) * FNV_PRIME;
+        }
+    };
+    mix(reinterpret_cast<const char *>(&type), sizeof(type));
+    mix(reinterpret_cast<const char *>(&missionId), sizeof(missionId));
+    mix(data, size);
+    return hash;
+}
+
+void AppendFileHeader(std::string &buffer)
+{
+    AppendValue(buffer, MISSION_FILE_MAGIC);
+    AppendValue(buffer, MISSION_FILE_VERSION);
+}
+
+void AppendRecord(std::string &buffer, RecordType type, int32_t missionId, const std::string &data)
+{
+    AppendValue(buffer, static_cast<uint8_t>(type));
+    AppendValue(buffer, missionId);
+    AppendValue(buffer, static_cast<uint32_t>(data.size()));
+    AppendValue(buffer, Checksum(type, missionId, data.data(), data.size()));
+    buffer.append(data);
+}
+
+bool WriteAll(int fd, const std::string &buffer)
+{
+    size_t written = 0;
+    while (written < buffer.size()) {
+        ssize_t ret = write(fd, buffer.data() + written, buffer.size() - written);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        written += static_cast<size_t>(ret);
+    }
+    return true;
+}
+
+bool ReadFile(const std::string &path, std::string &content)
+{
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::stringstream stream;
+    stream << file.rdbuf();
+    content = stream.str();
+    return true;
+}
+
+void SyncDirectory(const std::string &dirPath)
+{
+    int fd = open(dirPath.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) {
+        return;
+    }
+    (void)fsync(fd);
+    (void)close(fd);
+}
+}  // namespace
+
+MissionJournal::MissionJournal(const std::string &dirPath) : dirPath_(dirPath)
+{}
+
+std::string MissionJournal::GetBaseFilePath() const
+{
+    return dirPath_ + "/" + MISSION_BASE_FILE_NAME;
+}
+
+std::string MissionJournal::GetJournalFilePath() const
+{
+    return dirPath_ + "/" + MISSION_JOURNAL_FILE_NAME;
+}
+
+bool MissionJournal::Exists()
+{
+    return OHOS::HiviewDFX::FileUtil::FileExists(GetBaseFilePath()) ||
+        OHOS::HiviewDFX::FileUtil::FileExists(GetJournalFilePath());
+}
+
+bool MissionJournal::GetAll(std::map<int32_t, std::string> &records)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    bool ret = loaded_ || LoadLocked();
+    records = records_;
+    for (const auto &item : pending_) {
+        if (item.second.removed) {
+            records.erase(item.first);
+        } else {
+            records[item.first] = item.second.data;
+        }
+    }
+    return ret;
+}
+
+bool MissionJournal::Reset(const std::map<int32_t, std::string> &records)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (discarded_) {
+        return false;
+    }
+    records_ = records;
+    pending_.clear();
+    loaded_ = true;
+    return CompactLocked();
+}
+
+void MissionJournal::Put(int32_t missionId, const std::string &data)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (discarded_) {
+        return;
+    }
+    PendingRecord &record = pending_[missionId];
+    record.removed = false;
+    record.data = data;
+}
+
+void MissionJournal::Remove(int32_t missionId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (discarded_) {
+        return;
+    }
+    PendingRecord &record = pending_[missionId];
+    record.removed = true;
+    record.data.clear();
+}
+
+bool MissionJournal::Flush()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return FlushLocked();
+}
+
+bool MissionJournal::Compact()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (discarded_) {
+        return false;
+    }
+    if (!loaded_) {
+        LoadLocked();
+    }
+    return CompactLocked();
+}
+
+void MissionJournal::Discard()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    discarded_ = true;
+    pending_.clear();
+    records_.clear();
+}
+
+bool MissionJournal::HasPending()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !pending_.empty();
+}
+
+size_t MissionJournal::GetJournalRecordCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return journalRecordCount_;
+}
+
+bool MissionJournal::LoadLocked()
+{
+    records_.clear();
+    journalRecordCount_ = 0;
+    loaded_ = true;
+    bool ret = ReplayFile(GetBaseFilePath(), false);
+    return ReplayFile(GetJournalFilePath(), true) && ret;
+}
+
+bool MissionJournal::ReplayFile(const std::string &path, bool isJournal)
+{
+    std::string content;
+    if (!ReadFile(path, content) || content.empty()) {
+        // a missing file holds no records
+        return true;
+    }
+
+    size_t offset = 0;
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    if (!ReadValue(content, offset, magic) || magic != MISSION_FILE_MAGIC ||
+        !ReadValue(content, offset, version) || version != MISSION_FILE_VERSION) {
+        HILOG_ERROR("mission file %{public}s has an invalid header.", path.c_str());
+        offset = 0;
+    }
+
+    while (offset != 0 && offset + RECORD_HEADER_SIZE <= content.size()) {
+        size_t cursor = offset;
+        uint8_t rawType = 0;
+        int32_t missionId = 0;
+        uint32_t size = 0;
+        uint32_t checksum = 0;
+        if (!ReadValue(content, cursor, rawType) || !ReadValue(content, cursor, missionId) ||
+            !ReadValue(content, cursor, size) || !ReadValue(content, cursor, checksum)) {
+            break;
+        }
+        auto type = static_cast<RecordType>(rawType);
+        if (size > content.size() - cursor || checksum != Checksum(type, missionId, content.data() + cursor, size)) {
+            break;
+        }
+
+        if (type == RecordType::SAVE) {
+            records_[missionId] = content.substr(cursor, size);
+        } else if (type == RecordType::REMOVE) {
+            records_.erase(missionId);
+        } else {
+            break;
+        }
+        offset = cursor + size;
+        if (isJournal) {
+            journalRecordCount_++;
+        }
+    }
+
+    if (offset == content.size()) {
+        return true;
+    }
+    if (!isJournal) {
+        HILOG_ERROR("mission base file %{public}s is damaged at %{public}zu.", path.c_str(), offset);
+        return false;
+    }
+    // an interrupted append leaves a torn tail, drop it so later appends stay readable
+    HILOG_WARN("mission journal %{public}s: drop %{public}zu bytes of torn tail.", path.c_str(),
+        content.size() - offset);
+    if (offset == 0) {
+        return ResetJournalFileLocked();
+    }
+    if (truncate(path.c_str(), static_cast<off_t>(offset)) != 0) {
+        HILOG_ERROR("truncate mission journal failed, errno: %{public}d.", errno);
+        return false;
+    }
+    return true;
+}
+
+bool MissionJournal::FlushLocked()
+{
+    if (discarded_ || pending_.empty()) {
+        return true;
+    }
+    if (!loaded_) {
+        LoadLocked();
+    }
+    if (!OHOS::HiviewDFX::FileUtil::FileExists(dirPath_) &&
+        !OHOS::HiviewDFX::FileUtil::ForceCreateDirectory(dirPath_)) {
+        HILOG_ERROR("create dir %{public}s failed.", dirPath_.c_str());
+        return false;
+    }
+
+    std::string path = GetJournalFilePath();
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, MISSION_FILE_MODE);
+    if (fd < 0) {
+        HILOG_ERROR("open mission journal failed, errno: %{public}d.", errno);
+        return false;
+    }
+    off_t size = lseek(fd, 0, SEEK_END);
+    std::string buffer;
+    if (size == 0) {
+        AppendFileHeader(buffer);
+    }
+    for (const auto &item : pending_) {
+        if (item.second.removed) {
+            AppendRecord(buffer, RecordType::REMOVE, item.first, "");
+        } else {
+            AppendRecord(buffer, RecordType::SAVE, item.first, item.second.data);
+        }
+    }
+    if (size < 0 || !WriteAll(fd, buffer) || fsync(fd) != 0) {
+        HILOG_ERROR("write mission journal failed, errno: %{public}d.", errno);
+        if (size >= 0) {
+            (void)ftruncate(fd, size);
+        }
+        (void)close(fd);
+        return false;
+    }
+    (void)close(fd);
+    if (size == 0) {
+        SyncDirectory(dirPath_);
+    }
+
+    for (const auto &item : pending_) {
+        if (item.second.removed) {
+            records_.erase(item.first);
+        } else {
+            records_[item.first] = item.second.data;
+        }
+    }
+    journalRecordCount_ += pending_.size();
+    pending_.clear();
+
+    if (NeedCompactLocked()) {
+        CompactLocked();
+    }
+    return true;
+}
+
+bool MissionJournal::NeedCompactLocked() const
+{
+    return journalRecordCount_ >= std::max(COMPACT_MIN_RECORD_COUNT, records_.size() * COMPACT_FACTOR);
+}
+
+bool MissionJournal::CompactLocked()
+{
+    if (!OHOS::HiviewDFX::FileUtil::FileExists(dirPath_) &&
+        !OHOS::HiviewDFX::FileUtil::ForceCreateDirectory(dirPath_)) {
+        HILOG_ERROR("create dir %{public}s failed.", dirPath_.c_str());
+        return false;
+    }
+    // the journal is replayed over the base file, so it only goes away once the new base file is durable
+    if (!WriteBaseFileLocked()) {
+        return false;
+    }
+    return ResetJournalFileLocked();
+}
+
+bool MissionJournal::WriteBaseFileLocked()
+{
+    std::string buffer;
+    AppendFileHeader(buffer);
+    for (const auto &item : records_) {
+        AppendRecord(buffer, RecordType::SAVE, item.first, item.second);
+    }
+
+    std::string path = GetBaseFilePath();
+    std::string tempPath = path + TEMP_FILE_SUFFIX;
+    int fd = open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, MISSION_FILE_MODE);
+    if (fd < 0) {
+        HILOG_ERROR("open mission base file failed, errno: %{public}d.", errno);
+        return false;
+    }
+    if (!WriteAll(fd, buffer) || fsync(fd) != 0) {
+        HILOG_ERROR("write mission base file failed, errno: %{public}d.", errno);
+        (void)close(fd);
+        (void)unlink(tempPath.c_str());
+        return false;
+    }
+    (void)close(fd);
+    if (rename(tempPath.c_str(), path.c_str()) != 0) {
+        HILOG_ERROR("rename mission base file failed, errno: %{public}d.", errno);
+        (void)unlink(tempPath.c_str());
+        return false;
+    }
+    SyncDirectory(dirPath_);
+    return true;
+}
+
+bool MissionJournal::ResetJournalFileLocked()
+{
+    std::string buffer;
+    AppendFileHeader(buffer);
+    int fd = open(GetJournalFilePath().c_str(), O_WRONLY | O_CREAT | O_TRUNC, MISSION_FILE_MODE);
+    if (fd < 0) {
+        HILOG_ERROR("open mission journal failed, errno: %{public}d.", errno);
+        return false;
+    }
+    bool ret = WriteAll(fd, buffer) && fsync(fd) == 0;
+    (void)close(fd);
+    if (!ret) {
+        HILOG_ERROR("reset mission journal failed, errno: %{public}d.", errno);
+        return false;
+    }
+    journalRecordCount_ = 0;
+    return true;
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -15,8 +15,11 @@
 
 #include "mission_list_manager.h"
 
+#include <algorithm>
+
 #include "ability_manager_errors.h"
 #include "ability_manager_service.h"
+#include "ability_token_index.h"
 #include "ability_util.h"
 #include "bytrace.h"
 #include "errors.h"
@@ -46,7 +49,10 @@ std::string GetCurrentTime()
 
 MissionListManager::MissionListManager(int userId) : userId_(userId) {}
 
-MissionListManager::~MissionListManager() {}
+MissionListManager::~MissionListManager()
+{
+    DelayedSingleton<AbilityTokenIndex>::GetInstance()->RemoveOwner(this);
+}
 
 void MissionListManager::Init()
 {
@@ -382,6 +388,8 @@ void MissionListManager::GetTargetMissionAndAbility(const AbilityRequest &abilit
         targetRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
         targetMission = std::make_shared<Mission>(info.missionInfo.id, targetRecord, missionName, startMethod);
         targetRecord->SetMission(targetMission);
+        DelayedSingleton<AbilityTokenIndex>::GetInstance()->Add(
+            targetRecord, AbilityTokenOwnerType::MISSION_LIST, this, userId_);
     } else {
         HILOG_DEBUG("Update old mission data.");
         auto state = targetMission->UpdateMissionId(info.missionInfo.id, startMethod);
@@ -739,6 +747,12 @@ std::shared_ptr<AbilityRecord> MissionListManager::GetAbilityRecordByToken(
     }
 
     std::lock_guard<std::recursive_mutex> guard(managerLock_);
+    // a record can leave the lists before the index, so a hit is checked against the lists of its mission
+    auto abilityRecord = DelayedSingleton<AbilityTokenIndex>::GetInstance()->Find(token, this);
+    if (abilityRecord && IsAbilityRecordInListsLocked(abilityRecord, token)) {
+        return abilityRecord;
+    }
+
     // first find in terminating list
     for (auto ability : terminateAbilityList_) {
         if (ability && token == ability->GetToken()->AsObject()) {
@@ -746,7 +760,6 @@ std::shared_ptr<AbilityRecord> MissionListManager::GetAbilityRecordByToken(
         }
     }
 
-    std::shared_ptr<AbilityRecord> abilityRecord = nullptr;
     for (auto missionList : currentMissionLists_) {
         if (missionList && (abilityRecord = missionList->GetAbilityRecordByToken(token)) != nullptr) {
             return abilityRecord;
@@ -760,6 +773,23 @@ std::shared_ptr<AbilityRecord> MissionListManager::GetAbilityRecordByToken(
     return defaultStandardList_->GetAbilityRecordByToken(token);
 }
 
+bool MissionListManager::IsAbilityRecordInListsLocked(const std::shared_ptr<AbilityRecord> &abilityRecord,
+    const sptr<IRemoteObject> &token) const
+{
+    if (std::find(terminateAbilityList_.begin(), terminateAbilityList_.end(), abilityRecord) !=
+        terminateAbilityList_.end()) {
+        return true;
+    }
+    auto mission = abilityRecord->GetMission();
+    auto missionList = mission ? mission->GetMissionList() : nullptr;
+    if (missionList == nullptr || missionList->GetAbilityRecordByToken(token) != abilityRecord) {
+        return false;
+    }
+    return missionList == defaultSingleList_ || missionList == defaultStandardList_ ||
+        std::find(currentMissionLists_.begin(), currentMissionLists_.end(), missionList) !=
+        currentMissionLists_.end();
+}
+
 std::shared_ptr<Mission> MissionListManager::GetMissionById(int missionId) const
 {
     std::shared_ptr<Mission> mission = nullptr;
@@ -1180,6 +1210,7 @@ void MissionListManager::CompleteTerminateAndUpdateMission(const std::shared_ptr
     for (auto it : terminateAbilityList_) {
         if (it == abilityRecord) {
             terminateAbilityList_.remove(it);
+            DelayedSingleton<AbilityTokenIndex>::GetInstance()->Remove(abilityRecord);
             // update inner mission info time
             InnerMissionInfo innerMissionInfo;
             int result = DelayedSingleton<MissionInfoMgr>::GetInstance()->GetInnerMissionInfoById(
@@ -1563,6 +1594,7 @@ void MissionListManager::MoveToTerminateList(const std::shared_ptr<AbilityRecord
     // load timeout will not wait for died event, directly remove.
     if (abilityRecord->IsAbilityState(AbilityState::INITIAL)) {
         HILOG_WARN("load timeout will not wait for died event, directly remove.");
+        DelayedSingleton<AbilityTokenIndex>::GetInstance()->Remove(abilityRecord);
         // update running state.
         InnerMissionInfo info;
         if (DelayedSingleton<MissionInfoMgr>::GetInstance()->GetInnerMissionInfoById(
@@ -1699,6 +1731,8 @@ std::shared_ptr<MissionList> MissionListManager::GetTargetMissionList(int missio
     auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
     mission = std::make_shared<Mission>(innerMissionInfo.missionInfo.id, abilityRecord, innerMissionInfo.missionName);
     abilityRecord->SetMission(mission);
+    DelayedSingleton<AbilityTokenIndex>::GetInstance()->Add(
+        abilityRecord, AbilityTokenOwnerType::MISSION_LIST, this, userId_);
     std::shared_ptr<MissionList> newMissionList = std::make_shared<MissionList>();
     listenerController_->NotifyMissionCreated(innerMissionInfo.missionInfo.id);
     return newMissionList;
@@ -1794,6 +1828,7 @@ void MissionListManager::HandleLauncherDied(std::shared_ptr<AbilityRecord> abili
     } else {
         HILOG_INFO("launcher Ability died, remove, %{public}d", __LINE__);
         missionList->RemoveMission(mission);
+        DelayedSingleton<AbilityTokenIndex>::GetInstance()->Remove(ability);
     }
     if (isForeground) {
         HILOG_INFO("active launchrer ability died, start launcher, %{public}d", __LINE__);
@@ -1823,6 +1858,7 @@ void MissionListManager::HandleAbilityDiedByDefault(std::shared_ptr<AbilityRecor
 
     // remove from mission list.
     missionList->RemoveMission(mission);
+    DelayedSingleton<AbilityTokenIndex>::GetInstance()->Remove(ability);
     if (missionList->GetType() == MissionListType::CURRENT && missionList->IsEmpty()) {
         RemoveMissionList(missionList);
     }
@@ -14,38 +14,56 @@
  */
 
 #include "pending_want_key.h"
+
+#include <functional>
+
 #include "iremote_object.h"
 
 namespace OHOS {
 namespace AAFwk {
+namespace {
+template<typename T>
+void CombineHash(size_t &hashCode, const T &value)
+{
+    hashCode = hashCode * ODD_PRIME_NUMBER + std::hash<T>()(value);
+}
+}  // namespace
+
 void PendingWantKey::SetType(const int32_t type)
 {
     type_ = type;
+    ResetHashCode();
 }
 
 void PendingWantKey::SetBundleName(const std::string &bundleName)
 {
     bundleName_ = bundleName;
+    ResetHashCode();
 }
 
 void PendingWantKey::SetRequestWho(const std::string &requestWho)
 {
     requestWho_ = requestWho;
+    ResetHashCode();
 }
 
 void PendingWantKey::SetRequestCode(int32_t requestCode)
 {
     requestCode_ = requestCode;
+    ResetHashCode();
 }
 
 void PendingWantKey::SetRequestWant(const Want &requestWant)
 {
     requestWant_ = requestWant;
+    requestWantStringReady_ = false;
+    ResetHashCode();
 }
 
 void PendingWantKey::SetRequestResolvedType(const std::string &requestResolvedType)
 {
     requestResolvedType_ = requestResolvedType;
+    ResetHashCode();
 }
 
 void PendingWantKey::SetAllWantsInfos(const std::vector<WantsInfo> &allWantsInfos)
@@ -56,6 +74,7 @@ void PendingWantKey::SetAllWantsInfos(const std::vector<WantsInfo> &allWantsInfo
 void PendingWantKey::SetFlags(int32_t flags)
 {
     flags_ = flags;
+    ResetHashCode();
 }
 
 void PendingWantKey::SetCode(int32_t code)
@@ -66,6 +85,7 @@ void PendingWantKey::SetCode(int32_t code)
 void PendingWantKey::SetUserId(int32_t userId)
 {
     userId_ = userId;
+    ResetHashCode();
 }
 
 int32_t PendingWantKey::GetType()
@@ -117,5 +137,37 @@ int32_t PendingWantKey::GetUserId()
 {
     return userId_;
 }
+
+size_t PendingWantKey::GetHashCode()
+{
+    if (!hashReady_) {
+        size_t hashCode = 0;
+        CombineHash(hashCode, type_);
+        CombineHash(hashCode, bundleName_);
+        CombineHash(hashCode, requestWho_);
+        CombineHash(hashCode, requestCode_);
+        CombineHash(hashCode, GetRequestWantString());
+        CombineHash(hashCode, requestResolvedType_);
+        CombineHash(hashCode, flags_);
+        CombineHash(hashCode, userId_);
+        hashCode_ = hashCode;
+        hashReady_ = true;
+    }
+    return hashCode_;
+}
+
+const std::string &PendingWantKey::GetRequestWantString()
+{
+    if (!requestWantStringReady_) {
+        requestWantString_ = requestWant_.ToString();
+        requestWantStringReady_ = true;
+    }
+    return requestWantString_;
+}
+
+void PendingWantKey::ResetHashCode()
+{
+    hashReady_ = false;
+}
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
@@ -91,17 +91,20 @@ sptr<IWantSender> PendingWantManager::GetWantSenderLocked(const int32_t callingU
     if (ref != nullptr) {
         if (!needCancel) {
             if (needUpdate && wantSenderInfo.allWants.size() > 0) {
+                // the update changes the hashed content of the key, so rehash it.
+                RemoveKeyHashLocked(ref->GetKey());
                 ref->GetKey()->SetRequestWant(wantSenderInfo.allWants.back().want);
                 ref->GetKey()->SetRequestResolvedType(wantSenderInfo.allWants.back().resolvedTypes);
                 wantSenderInfo.allWants.back().want = ref->GetKey()->GetRequestWant();
                 wantSenderInfo.allWants.back().resolvedTypes = ref->GetKey()->GetRequestResolvedType();
                 ref->GetKey()->SetAllWantsInfos(wantSenderInfo.allWants);
+                AddKeyHashLocked(ref->GetKey(), ref);
                 ref->SetCallerUid(callingUid);
             }
             return ref;
         }
         MakeWantSenderCanceledLocked(*ref);
-        wantRecords_.erase(ref->GetKey());
+        RemoveWantRecordLocked(ref->GetKey());
         return nullptr;
     }
 
@@ -114,7 +117,7 @@ sptr<IWantSender> PendingWantManager::GetWantSenderLocked(const int32_t callingU
     if (rec != nullptr) {
         rec->SetCallerUid(callingUid);
         pendingKey->SetCode(PendingRecordIdCreate());
-        wantRecords_.insert(std::make_pair(pendingKey, rec));
+        AddWantRecordLocked(pendingKey, rec);
         HILOG_INFO("wantRecords_ size %{public}zu", wantRecords_.size());
         return rec;
     }
@@ -136,10 +139,10 @@ sptr<PendingWantRecord> PendingWantManager::GetPendingWantRecordByKey(const std:
     HILOG_INFO("%{public}s:begin.", __func__);
 
     std::lock_guard<std::recursive_mutex> locker(mutex_);
-    for (const auto &item : wantRecords_) {
-        const auto &pendingKey = item.first;
-        const auto &pendingRecord = item.second;
-        if ((pendingRecord != nullptr) && CheckPendingWantRecordByKey(pendingKey, key)) {
+    auto range = wantRecordsByHash_.equal_range(key->GetHashCode());
+    for (auto it = range.first; it != range.second; ++it) {
+        const auto &pendingRecord = it->second;
+        if ((pendingRecord != nullptr) && CheckPendingWantRecordByKey(pendingRecord->GetKey(), key)) {
             return pendingRecord;
         }
     }
@@ -149,6 +152,9 @@ sptr<PendingWantRecord> PendingWantManager::GetPendingWantRecordByKey(const std:
 bool PendingWantManager::CheckPendingWantRecordByKey(
     const std::shared_ptr<PendingWantKey> &inputKey, const std::shared_ptr<PendingWantKey> &key)
 {
+    if (inputKey->GetHashCode() != key->GetHashCode()) {
+        return false;
+    }
     if (inputKey->GetBundleName().compare(key->GetBundleName()) != 0) {
         return false;
     }
@@ -161,7 +167,7 @@ bool PendingWantManager::CheckPendingWantRecordByKey(
     if (inputKey->GetRequestCode() != key->GetRequestCode()) {
         return false;
     }
-    if (inputKey->GetRequestWant().ToString().compare(key->GetRequestWant().ToString()) != 0) {
+    if (inputKey->GetRequestWantString().compare(key->GetRequestWantString()) != 0) {
         return false;
     }
     if (!inputKey->GetRequestWant().OperationEquals(key->GetRequestWant())) {
@@ -218,7 +224,41 @@ void PendingWantManager::CancelWantSenderLocked(PendingWantRecord &record, bool
 
     MakeWantSenderCanceledLocked(record);
     if (cleanAbility) {
-        wantRecords_.erase(record.GetKey());
+        RemoveWantRecordLocked(record.GetKey());
+    }
+}
+
+void PendingWantManager::AddWantRecordLocked(
+    const std::shared_ptr<PendingWantKey> &key, const sptr<PendingWantRecord> &record)
+{
+    wantRecords_.insert(std::make_pair(key, record));
+    wantRecordsByCode_[key->GetCode()] = record;
+    AddKeyHashLocked(key, record);
+}
+
+void PendingWantManager::RemoveWantRecordLocked(const std::shared_ptr<PendingWantKey> &key)
+{
+    if (wantRecords_.erase(key) == 0) {
+        return;
+    }
+    wantRecordsByCode_.erase(key->GetCode());
+    RemoveKeyHashLocked(key);
+}
+
+void PendingWantManager::AddKeyHashLocked(
+    const std::shared_ptr<PendingWantKey> &key, const sptr<PendingWantRecord> &record)
+{
+    wantRecordsByHash_.emplace(key->GetHashCode(), record);
+}
+
+void PendingWantManager::RemoveKeyHashLocked(const std::shared_ptr<PendingWantKey> &key)
+{
+    auto range = wantRecordsByHash_.equal_range(key->GetHashCode());
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second != nullptr && it->second->GetKey() == key) {
+            wantRecordsByHash_.erase(it);
+            return;
+        }
     }
 }
 int32_t PendingWantManager::DeviceIdDetermine(
@@ -316,10 +356,8 @@ sptr<PendingWantRecord> PendingWantManager::GetPendingWantRecordByCode(int32_t c
     HILOG_INFO("%{public}s:begin. wantRecords_ size = %{public}zu", __func__, wantRecords_.size());
 
     std::lock_guard<std::recursive_mutex> locker(mutex_);
-    auto iter = std::find_if(wantRecords_.begin(), wantRecords_.end(), [&code](const auto &pair) {
-        return pair.second->GetKey()->GetCode() == code;
-    });
-    return ((iter == wantRecords_.end()) ? nullptr : iter->second);
+    auto iter = wantRecordsByCode_.find(code);
+    return ((iter == wantRecordsByCode_.end()) ? nullptr : iter->second);
 }
 
 int32_t PendingWantManager::GetPendingWantUid(const sptr<IWantSender> &target)
@@ -513,6 +551,8 @@ void PendingWantManager::ClearPendingWantRecordTask(const std::string &bundleNam
                 }
             }
             if (hasBundle) {
+                wantRecordsByCode_.erase(iter->first->GetCode());
+                RemoveKeyHashLocked(iter->first);
                 iter = wantRecords_.erase(iter);
                 HILOG_INFO("wantRecords_ size %{public}zu", wantRecords_.size());
             } else {
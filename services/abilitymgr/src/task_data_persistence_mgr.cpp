@@ -46,6 +46,7 @@ bool TaskDataPersistenceMgr::Init(int userId)
 
     if (missionDataStorageMgr_.find(userId) == missionDataStorageMgr_.end()) {
         currentMissionDataStorage_ = std::make_shared<MissionDataStorage>(userId);
+        currentMissionDataStorage_->SetEventHandler(handler_);
         missionDataStorageMgr_.insert(std::make_pair(userId, currentMissionDataStorage_));
     } else {
         currentMissionDataStorage_ = missionDataStorageMgr_[userId];
@@ -97,6 +98,13 @@ bool TaskDataPersistenceMgr::RemoveUserDir(int32_t userId)
         HILOG_ERROR("can not removed current user dir");
         return false;
     }
+    auto storage = missionDataStorageMgr_.find(userId);
+    if (storage != missionDataStorageMgr_.end()) {
+        if (storage->second) {
+            storage->second->DiscardMissionInfo();
+        }
+        missionDataStorageMgr_.erase(storage);
+    }
     std::string userDir = TASK_DATA_FILE_BASE_PATH + "/" + std::to_string(userId);
     bool ret = OHOS::HiviewDFX::FileUtil::ForceRemoveDirectory(userDir);
     if (!ret) {
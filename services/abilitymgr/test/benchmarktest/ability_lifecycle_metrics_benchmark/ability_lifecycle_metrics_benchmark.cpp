@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include "ability_lifecycle_metrics.h"
+
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+const std::string BUNDLE_NAME = "com.lifecycle.benchmark";
+
+void BenchmarkGetTimeUs(benchmark::State &state)
+{
+    // what a lifecycle request pays, one clock read
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(AbilityLifecycleMetrics::GetTimeUs());
+    }
+}
+
+void BenchmarkRecordTransitionDone(benchmark::State &state)
+{
+    // what a transition done pays, one clock read and one record, from as many threads as binder runs
+    auto lifecycleMetrics = DelayedSingleton<AbilityLifecycleMetrics>::GetInstance();
+    auto histograms = lifecycleMetrics->GetHistograms(BUNDLE_NAME);
+    int64_t requestTime = AbilityLifecycleMetrics::GetTimeUs();
+    for (auto _ : state) {
+        uint64_t latencyUs = static_cast<uint64_t>(AbilityLifecycleMetrics::GetTimeUs() - requestTime);
+        lifecycleMetrics->Record(histograms, LifecyclePhase::FOREGROUND, latencyUs);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BenchmarkGetHistograms(benchmark::State &state)
+{
+    // what an ability record pays once, when it is created
+    auto lifecycleMetrics = DelayedSingleton<AbilityLifecycleMetrics>::GetInstance();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lifecycleMetrics->GetHistograms(BUNDLE_NAME));
+    }
+}
+}  // namespace
+
+BENCHMARK(BenchmarkGetTimeUs);
+BENCHMARK(BenchmarkRecordTransitionDone)->ThreadRange(1, 8);
+BENCHMARK(BenchmarkGetHistograms);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "ability_manager_errors.h"
+#include "ability_resolve_cache.h"
+#include "bundle_mgr_host.h"
+#include "bundle_mgr_proxy.h"
+
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+const std::string BUNDLE_NAME = "com.example.benchmark";
+const std::string ABILITY_NAME = "MainAbility";
+const int32_t ABILITY_INFO_FLAGS = 7;
+const int32_t USER_ID = 100;
+const int ABILITY_COUNT = 8;
+const int PERMISSION_COUNT = 16;
+
+/**
+ * Stands in for the bundle manager, with a bundle of several abilities and permissions, none of them data.
+ */
+class StandInBundleMgr : public AppExecFwk::BundleMgrHost {
+public:
+    bool QueryAbilityInfo(const Want &want, int32_t flags, int32_t userId,
+        AppExecFwk::AbilityInfo &abilityInfo) override
+    {
+        queryCount_++;
+        abilityInfo = MakeAbilityInfo(ABILITY_NAME);
+        return true;
+    }
+
+    bool GetBundleInfo(const std::string &bundleName, const AppExecFwk::BundleFlag flag,
+        AppExecFwk::BundleInfo &bundleInfo, int32_t userId) override
+    {
+        queryCount_++;
+        bundleInfo.name = bundleName;
+        bundleInfo.uid = USER_ID;
+        bundleInfo.applicationInfo = MakeApplicationInfo();
+        for (int i = 0; i < ABILITY_COUNT; i++) {
+            bundleInfo.abilityInfos.emplace_back(MakeAbilityInfo(ABILITY_NAME + std::to_string(i)));
+        }
+        return true;
+    }
+
+    int64_t queryCount_ = 0;
+
+private:
+    static AppExecFwk::ApplicationInfo MakeApplicationInfo()
+    {
+        AppExecFwk::ApplicationInfo applicationInfo;
+        applicationInfo.name = BUNDLE_NAME;
+        applicationInfo.bundleName = BUNDLE_NAME;
+        for (int i = 0; i < PERMISSION_COUNT; i++) {
+            applicationInfo.permissions.emplace_back("ohos.permission.BENCHMARK_" + std::to_string(i));
+        }
+        return applicationInfo;
+    }
+
+    static AppExecFwk::AbilityInfo MakeAbilityInfo(const std::string &name)
+    {
+        AppExecFwk::AbilityInfo abilityInfo;
+        abilityInfo.name = name;
+        abilityInfo.bundleName = BUNDLE_NAME;
+        abilityInfo.moduleName = "entry";
+        abilityInfo.label = "$string:entry_MainAbility";
+        abilityInfo.description = "$string:mainability_description";
+        abilityInfo.iconPath = "$media:icon";
+        abilityInfo.type = AppExecFwk::AbilityType::PAGE;
+        for (int i = 0; i < PERMISSION_COUNT; i++) {
+            abilityInfo.permissions.emplace_back("ohos.permission.BENCHMARK_" + std::to_string(i));
+        }
+        abilityInfo.applicationInfo = MakeApplicationInfo();
+        return abilityInfo;
+    }
+};
+
+/**
+ * What a start asks the bundle manager, the ability of the want, then the bundle for its data abilities.
+ */
+void QueryStart(const sptr<AppExecFwk::IBundleMgr> &bms, const Want &want, AppExecFwk::AbilityInfo &abilityInfo,
+    AppExecFwk::BundleInfo &bundleInfo)
+{
+    bms->QueryAbilityInfo(want, ABILITY_INFO_FLAGS, USER_ID, abilityInfo);
+    bms->GetBundleInfo(abilityInfo.bundleName, AppExecFwk::BundleFlag::GET_BUNDLE_WITH_ABILITIES, bundleInfo,
+        USER_ID);
+}
+
+void BenchmarkStartUncached(benchmark::State &state)
+{
+    sptr<StandInBundleMgr> standInBms = new StandInBundleMgr();
+    // the proxy marshals every call, as it would across processes
+    sptr<AppExecFwk::IBundleMgr> bms = new AppExecFwk::BundleMgrProxy(standInBms);
+    Want want;
+    want.SetElementName(BUNDLE_NAME, ABILITY_NAME);
+    for (auto _ : state) {
+        AppExecFwk::AbilityInfo abilityInfo;
+        AppExecFwk::BundleInfo bundleInfo;
+        QueryStart(bms, want, abilityInfo, bundleInfo);
+        benchmark::DoNotOptimize(bundleInfo);
+    }
+    state.counters["queries"] = benchmark::Counter(standInBms->queryCount_, benchmark::Counter::kAvgIterations);
+}
+
+void BenchmarkStartCached(benchmark::State &state)
+{
+    sptr<StandInBundleMgr> standInBms = new StandInBundleMgr();
+    sptr<AppExecFwk::IBundleMgr> bms = new AppExecFwk::BundleMgrProxy(standInBms);
+    AbilityResolveCache cache;
+    Want want;
+    want.SetElementName(BUNDLE_NAME, ABILITY_NAME);
+    for (auto _ : state) {
+        AppExecFwk::AbilityInfo abilityInfo;
+        cache.ResolveAbility(want, ABILITY_INFO_FLAGS, USER_ID, abilityInfo,
+            [&bms, &want](AppExecFwk::AbilityInfo &resolvedInfo) {
+                bms->QueryAbilityInfo(want, ABILITY_INFO_FLAGS, USER_ID, resolvedInfo);
+                return ERR_OK;
+            });
+        BundleDataAbilities dataAbilities;
+        cache.GetDataAbilities(abilityInfo.bundleName, USER_ID, dataAbilities,
+            [&bms, &abilityInfo](AppExecFwk::BundleInfo &bundleInfo) {
+                return bms->GetBundleInfo(abilityInfo.bundleName, AppExecFwk::BundleFlag::GET_BUNDLE_WITH_ABILITIES,
+                    bundleInfo, USER_ID);
+            });
+        benchmark::DoNotOptimize(dataAbilities);
+    }
+    state.counters["queries"] = benchmark::Counter(standInBms->queryCount_, benchmark::Counter::kAvgIterations);
+}
+
+void BenchmarkStartAfterInvalidate(benchmark::State &state)
+{
+    // every start follows a package event, the worst case of the cache
+    sptr<StandInBundleMgr> standInBms = new StandInBundleMgr();
+    sptr<AppExecFwk::IBundleMgr> bms = new AppExecFwk::BundleMgrProxy(standInBms);
+    AbilityResolveCache cache;
+    Want want;
+    want.SetElementName(BUNDLE_NAME, ABILITY_NAME);
+    for (auto _ : state) {
+        cache.Invalidate(BUNDLE_NAME);
+        AppExecFwk::AbilityInfo abilityInfo;
+        cache.ResolveAbility(want, ABILITY_INFO_FLAGS, USER_ID, abilityInfo,
+            [&bms, &want](AppExecFwk::AbilityInfo &resolvedInfo) {
+                bms->QueryAbilityInfo(want, ABILITY_INFO_FLAGS, USER_ID, resolvedInfo);
+                return ERR_OK;
+            });
+        BundleDataAbilities dataAbilities;
+        cache.GetDataAbilities(abilityInfo.bundleName, USER_ID, dataAbilities,
+            [&bms, &abilityInfo](AppExecFwk::BundleInfo &bundleInfo) {
+                return bms->GetBundleInfo(abilityInfo.bundleName, AppExecFwk::BundleFlag::GET_BUNDLE_WITH_ABILITIES,
+                    bundleInfo, USER_ID);
+            });
+        benchmark::DoNotOptimize(dataAbilities);
+    }
+    state.counters["queries"] = benchmark::Counter(standInBms->queryCount_, benchmark::Counter::kAvgIterations);
+}
+}  // namespace
+
+BENCHMARK(BenchmarkStartUncached);
+BENCHMARK(BenchmarkStartCached);
+BENCHMARK(BenchmarkStartAfterInvalidate);
+
+BENCHMARK_MAIN();
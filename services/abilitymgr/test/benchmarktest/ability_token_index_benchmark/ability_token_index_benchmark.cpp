@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ability_record.h"
+#include "ability_token_index.h"
+
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+constexpr int32_t USER_COUNT = 4;
+constexpr int32_t FIRST_USER_ID = 100;
+constexpr int OWNER_TYPES = 3;
+constexpr int THREADS = 8;
+constexpr int64_t SHARED_ABILITY_COUNT = 512;
+
+/**
+ * Stand-in for one manager: the records it keeps in a list, scanned under its lock the way
+ * the managers looked tokens up before the index.
+ */
+struct Manager {
+    std::mutex mutex;
+    std::list<std::shared_ptr<AbilityRecord>> records;
+};
+
+struct Fixture {
+    std::vector<std::unique_ptr<Manager>> managers;
+    std::vector<std::shared_ptr<AbilityRecord>> records;
+};
+
+std::shared_ptr<AbilityRecord> CreateRecord(int64_t index)
+{
+    AbilityRequest abilityRequest;
+    abilityRequest.abilityInfo.type = AppExecFwk::AbilityType::PAGE;
+    abilityRequest.abilityInfo.name = "Ability" + std::to_string(index);
+    abilityRequest.abilityInfo.bundleName = "com.example.benchmark" + std::to_string(index);
+    abilityRequest.appInfo.bundleName = abilityRequest.abilityInfo.bundleName;
+    return AbilityRecord::CreateAbilityRecord(abilityRequest);
+}
+
+/**
+ * Spreads count live abilities over the mission list, data ability and service managers of several users.
+ */
+std::unique_ptr<Fixture> MakeFixture(int64_t count)
+{
+    auto fixture = std::make_unique<Fixture>();
+    for (int i = 0; i < USER_COUNT * OWNER_TYPES; i++) {
+        fixture->managers.emplace_back(std::make_unique<Manager>());
+    }
+    auto index = DelayedSingleton<AbilityTokenIndex>::GetInstance();
+    for (int64_t i = 0; i < count; i++) {
+        auto abilityRecord = CreateRecord(i);
+        int managerIndex = static_cast<int>(i % fixture->managers.size());
+        Manager *manager = fixture->managers[managerIndex].get();
+        manager->records.push_back(abilityRecord);
+        index->Add(abilityRecord, static_cast<AbilityTokenOwnerType>(managerIndex % OWNER_TYPES), manager,
+            FIRST_USER_ID + managerIndex / OWNER_TYPES);
+        fixture->records.push_back(abilityRecord);
+    }
+    return fixture;
+}
+
+void ReleaseFixture(std::unique_ptr<Fixture> &fixture)
+{
+    auto index = DelayedSingleton<AbilityTokenIndex>::GetInstance();
+    for (auto &manager : fixture->managers) {
+        index->RemoveOwner(manager.get());
+    }
+    fixture.reset();
+}
+
+bool LegacyVerify(Fixture &fixture, const sptr<IRemoteObject> &token)
+{
+    for (auto &manager : fixture.managers) {
+        std::lock_guard<std::mutex> guard(manager->mutex);
+        for (const auto &abilityRecord : manager->records) {
+            if (abilityRecord && token == abilityRecord->GetToken()->AsObject()) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void BenchmarkLegacyVerifyAllToken(benchmark::State &state)
+{
+    auto fixture = MakeFixture(state.range(0));
+    size_t next = 0;
+    for (auto _ : state) {
+        sptr<IRemoteObject> token = fixture->records[next++ % fixture->records.size()]->GetToken()->AsObject();
+        benchmark::DoNotOptimize(LegacyVerify(*fixture, token));
+    }
+    ReleaseFixture(fixture);
+}
+
+void BenchmarkVerifyAllToken(benchmark::State &state)
+{
+    auto fixture = MakeFixture(state.range(0));
+    auto index = DelayedSingleton<AbilityTokenIndex>::GetInstance();
+    size_t next = 0;
+    for (auto _ : state) {
+        sptr<IRemoteObject> token = fixture->records[next++ % fixture->records.size()]->GetToken()->AsObject();
+        benchmark::DoNotOptimize(index->Find(token));
+    }
+    ReleaseFixture(fixture);
+}
+
+// shared by the threads of the concurrent benchmarks, kept until the process exits.
+Fixture &GetSharedFixture()
+{
+    static std::unique_ptr<Fixture> fixture = MakeFixture(SHARED_ABILITY_COUNT);
+    return *fixture;
+}
+
+void BenchmarkLegacyConcurrentVerify(benchmark::State &state)
+{
+    Fixture &fixture = GetSharedFixture();
+    size_t next = std::hash<std::thread::id>()(std::this_thread::get_id());
+    for (auto _ : state) {
+        sptr<IRemoteObject> token = fixture.records[next++ % fixture.records.size()]->GetToken()->AsObject();
+        benchmark::DoNotOptimize(LegacyVerify(fixture, token));
+    }
+}
+
+void BenchmarkConcurrentVerify(benchmark::State &state)
+{
+    Fixture &fixture = GetSharedFixture();
+    auto index = DelayedSingleton<AbilityTokenIndex>::GetInstance();
+    size_t next = std::hash<std::thread::id>()(std::this_thread::get_id());
+    for (auto _ : state) {
+        sptr<IRemoteObject> token = fixture.records[next++ % fixture.records.size()]->GetToken()->AsObject();
+        benchmark::DoNotOptimize(index->Find(token));
+    }
+}
+}  // namespace
+
+BENCHMARK(BenchmarkLegacyVerifyAllToken)->Arg(512)->Arg(2048);
+BENCHMARK(BenchmarkVerifyAllToken)->Arg(512)->Arg(2048);
+BENCHMARK(BenchmarkLegacyConcurrentVerify)->Threads(THREADS);
+BENCHMARK(BenchmarkConcurrentVerify)->Threads(THREADS);
+
+BENCHMARK_MAIN();
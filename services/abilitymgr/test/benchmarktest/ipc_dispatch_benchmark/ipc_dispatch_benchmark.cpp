@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <map>
+
+#include "errors.h"
+#include "ipc_stub_metrics.h"
+
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+// about as many codes as the ability manager serves
+const uint32_t CODE_COUNT = 120;
+const uint32_t CODE_STEP = 7;
+
+class StandInStub {
+public:
+    using RequestFuncType = int (StandInStub::*)(MessageParcel &data, MessageParcel &reply);
+
+    int Handle(MessageParcel &data, MessageParcel &reply)
+    {
+        return ERR_OK;
+    }
+};
+
+std::map<uint32_t, StandInStub::RequestFuncType> BuildFuncMap()
+{
+    std::map<uint32_t, StandInStub::RequestFuncType> funcMap;
+    for (uint32_t code = 0; code < CODE_COUNT * CODE_STEP; code += CODE_STEP) {
+        funcMap[code] = &StandInStub::Handle;
+    }
+    return funcMap;
+}
+
+IpcDispatchTable<StandInStub::RequestFuncType> &GetDispatchTable()
+{
+    static IpcDispatchTable<StandInStub::RequestFuncType> dispatchTable("Benchmark");
+    dispatchTable.Build(BuildFuncMap());
+    return dispatchTable;
+}
+
+void BenchmarkMapDispatch(benchmark::State &state)
+{
+    // what OnRemoteRequest did, a map lookup and the call
+    static StandInStub stub;
+    static const auto funcMap = BuildFuncMap();
+    MessageParcel data;
+    MessageParcel reply;
+    uint32_t code = 0;
+    for (auto _ : state) {
+        auto iter = funcMap.find(code);
+        if (iter != funcMap.end()) {
+            benchmark::DoNotOptimize((stub.*(iter->second))(data, reply));
+        }
+        code = (code + CODE_STEP) % (CODE_COUNT * CODE_STEP);
+    }
+}
+
+void BenchmarkTableDispatch(benchmark::State &state)
+{
+    // what it does now, an array lookup, the call and its metrics, from as many threads as binder runs
+    static StandInStub stub;
+    static IpcDispatchTable<StandInStub::RequestFuncType> &dispatchTable = GetDispatchTable();
+    MessageParcel data;
+    MessageParcel reply;
+    uint32_t code = 0;
+    int result = ERR_OK;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dispatchTable.Dispatch(&stub, code, data, reply, result));
+        code = (code + CODE_STEP) % (CODE_COUNT * CODE_STEP);
+    }
+}
+}  // namespace
+
+BENCHMARK(BenchmarkMapDispatch)->ThreadRange(1, 8);
+BENCHMARK(BenchmarkTableDispatch)->ThreadRange(1, 8);
+
+BENCHMARK_MAIN();
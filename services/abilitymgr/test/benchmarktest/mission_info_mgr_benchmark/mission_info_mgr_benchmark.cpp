@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#define private public
+#include "mission_info_mgr.h"
+#undef private
+
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+const int32_t BENCHMARK_USER_ID = 10001;
+constexpr int32_t RECENT_MISSION_COUNT = 20;
+constexpr uint64_t BASE_TIME = 1600000000000000000ULL;
+
+InnerMissionInfo MakeMissionInfo(int32_t missionId, uint64_t time)
+{
+    InnerMissionInfo info;
+    info.missionInfo.id = missionId;
+    info.missionInfo.time = std::to_string(time);
+    info.missionInfo.lockedState = false;
+    info.missionInfo.label = "Mission" + std::to_string(missionId);
+    info.missionName = "#com.example.benchmark" + std::to_string(missionId) + ":MainAbility";
+    info.bundleName = "com.example.benchmark" + std::to_string(missionId);
+    return info;
+}
+
+/**
+ * The time sorted list the manager kept before the index, with its insertion sort and id scans.
+ */
+struct LegacyMissionList {
+    std::list<InnerMissionInfo> missionInfoList;
+
+    void Add(const InnerMissionInfo &missionInfo)
+    {
+        auto listIter = missionInfoList.begin();
+        for (; listIter != missionInfoList.end(); listIter++) {
+            if (listIter->missionInfo.time < missionInfo.missionInfo.time) {
+                break;
+            }
+        }
+        missionInfoList.insert(listIter, missionInfo);
+    }
+
+    std::list<InnerMissionInfo>::iterator Find(int32_t missionId)
+    {
+        return std::find_if(missionInfoList.begin(), missionInfoList.end(),
+            [missionId](const InnerMissionInfo &info) { return missionId == info.missionInfo.id; });
+    }
+
+    void UpdateTimeStamp(int32_t missionId, const std::string &timestamp)
+    {
+        auto it = Find(missionId);
+        if (it == missionInfoList.end()) {
+            return;
+        }
+        InnerMissionInfo updateInfo = *it;
+        updateInfo.missionInfo.time = timestamp;
+        missionInfoList.erase(it);
+        Add(updateInfo);
+    }
+};
+
+LegacyMissionList MakeLegacyList(int64_t count)
+{
+    LegacyMissionList list;
+    for (int32_t i = 0; i < count; i++) {
+        list.Add(MakeMissionInfo(i + 1, BASE_TIME + i));
+    }
+    return list;
+}
+
+std::shared_ptr<MissionInfoMgr> MakeMissionInfoMgr(int64_t count)
+{
+    auto missionInfoMgr = std::shared_ptr<MissionInfoMgr>(new MissionInfoMgr());
+    missionInfoMgr->taskDataPersistenceMgr_ = DelayedSingleton<TaskDataPersistenceMgr>::GetInstance();
+    missionInfoMgr->taskDataPersistenceMgr_->Init(BENCHMARK_USER_ID);
+    for (int32_t i = 0; i < count; i++) {
+        missionInfoMgr->AddMissionInfo(MakeMissionInfo(i + 1, BASE_TIME + i));
+    }
+    return missionInfoMgr;
+}
+
+void BenchmarkLegacyGetMissionById(benchmark::State &state)
+{
+    auto list = MakeLegacyList(state.range(0));
+    // the oldest missions are the ones at the end of the list
+    int32_t missionId = 1;
+    for (auto _ : state) {
+        auto it = list.Find(missionId);
+        benchmark::DoNotOptimize(it);
+    }
+}
+
+void BenchmarkGetMissionById(benchmark::State &state)
+{
+    auto missionInfoMgr = MakeMissionInfoMgr(state.range(0));
+    int32_t missionId = 1;
+    for (auto _ : state) {
+        MissionInfo missionInfo;
+        int ret = missionInfoMgr->GetMissionInfoById(missionId, missionInfo);
+        benchmark::DoNotOptimize(ret);
+    }
+    missionInfoMgr->DeleteAllMissionInfos(nullptr);
+}
+
+void BenchmarkLegacyMoveToFront(benchmark::State &state)
+{
+    auto list = MakeLegacyList(state.range(0));
+    uint64_t time = BASE_TIME + state.range(0);
+    int32_t missionId = 1;
+    for (auto _ : state) {
+        // switching to an old task makes it the latest one
+        list.UpdateTimeStamp(missionId, std::to_string(time++));
+        missionId = missionId % state.range(0) + 1;
+    }
+}
+
+void BenchmarkMoveToFront(benchmark::State &state)
+{
+    auto missionInfoMgr = MakeMissionInfoMgr(state.range(0));
+    uint64_t time = BASE_TIME + state.range(0);
+    int32_t missionId = 1;
+    for (auto _ : state) {
+        missionInfoMgr->UpdateMissionTimeStamp(missionId, std::to_string(time++));
+        missionId = missionId % state.range(0) + 1;
+    }
+    missionInfoMgr->DeleteAllMissionInfos(nullptr);
+}
+
+void BenchmarkGetRecentMissions(benchmark::State &state)
+{
+    auto missionInfoMgr = MakeMissionInfoMgr(state.range(0));
+    for (auto _ : state) {
+        std::vector<MissionInfo> missionInfos;
+        missionInfoMgr->GetMissionInfos(RECENT_MISSION_COUNT, missionInfos);
+        benchmark::DoNotOptimize(missionInfos);
+    }
+    missionInfoMgr->DeleteAllMissionInfos(nullptr);
+}
+}  // namespace
+
+BENCHMARK(BenchmarkLegacyGetMissionById)->Arg(100)->Arg(1000)->Arg(5000);
+BENCHMARK(BenchmarkGetMissionById)->Arg(100)->Arg(1000)->Arg(5000);
+BENCHMARK(BenchmarkLegacyMoveToFront)->Arg(100)->Arg(1000)->Arg(5000);
+BENCHMARK(BenchmarkMoveToFront)->Arg(100)->Arg(1000)->Arg(5000);
+BENCHMARK(BenchmarkGetRecentMissions)->Arg(100)->Arg(1000)->Arg(5000);
+
+BENCHMARK_MAIN();
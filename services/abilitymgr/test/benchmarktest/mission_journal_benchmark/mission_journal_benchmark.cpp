@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "file_util.h"
+#include "inner_mission_info.h"
+#include "mission_data_storage.h"
+#include "mission_journal.h"
+
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+const std::string LEGACY_DIR = "/data/test/mission_journal_benchmark/legacy";
+const std::string JOURNAL_DIR = "/data/test/mission_journal_benchmark/journal";
+constexpr int64_t UPDATES_PER_FLUSH = 16;
+
+InnerMissionInfo MakeMissionInfo(int32_t missionId)
+{
+    InnerMissionInfo info;
+    info.missionInfo.id = missionId;
+    info.missionInfo.lockedState = false;
+    info.missionInfo.label = "Mission" + std::to_string(missionId);
+    info.missionInfo.iconPath = "/data/icons/mission" + std::to_string(missionId) + ".png";
+    info.missionInfo.want.SetElementName("", "com.example.benchmark" + std::to_string(missionId), "MainAbility");
+    info.missionName = "#com.example.benchmark" + std::to_string(missionId) + ":MainAbility";
+    info.isSingletonMode = true;
+    info.startMethod = 0;
+    info.bundleName = "com.example.benchmark" + std::to_string(missionId);
+    info.uid = 20010001;
+    return info;
+}
+
+std::string GetLegacyFilePath(int32_t missionId)
+{
+    return LEGACY_DIR + "/" + MISSION_JSON_FILE_PREFIX + "_" + std::to_string(missionId) + JSON_FILE_SUFFIX;
+}
+
+void PrepareLegacy(int64_t count)
+{
+    OHOS::HiviewDFX::FileUtil::ForceRemoveDirectory(LEGACY_DIR);
+    OHOS::HiviewDFX::FileUtil::ForceCreateDirectory(LEGACY_DIR);
+    for (int32_t i = 0; i < count; i++) {
+        OHOS::HiviewDFX::FileUtil::SaveStringToFile(GetLegacyFilePath(i), MakeMissionInfo(i).ToJsonStr(), true);
+    }
+}
+
+void PrepareJournal(int64_t count)
+{
+    OHOS::HiviewDFX::FileUtil::ForceRemoveDirectory(JOURNAL_DIR);
+    std::map<int32_t, std::string> records;
+    for (int32_t i = 0; i < count; i++) {
+        records[i] = MakeMissionInfo(i).ToJsonStr();
+    }
+    MissionJournal journal(JOURNAL_DIR);
+    journal.Reset(records);
+}
+
+void BenchmarkLegacyLoad(benchmark::State &state)
+{
+    PrepareLegacy(state.range(0));
+    for (auto _ : state) {
+        // what LoadAllMissionInfo did with one json file per mission
+        std::list<InnerMissionInfo> missionInfoList;
+        std::vector<std::string> fileNameVec;
+        OHOS::HiviewDFX::FileUtil::GetDirFiles(LEGACY_DIR, fileNameVec);
+        for (const auto &fileName : fileNameVec) {
+            std::string content;
+            InnerMissionInfo missionInfo;
+            if (OHOS::HiviewDFX::FileUtil::LoadStringFromFile(fileName, content) &&
+                missionInfo.FromJsonStr(content)) {
+                missionInfoList.push_back(missionInfo);
+            }
+        }
+        benchmark::DoNotOptimize(missionInfoList);
+    }
+    OHOS::HiviewDFX::FileUtil::ForceRemoveDirectory(LEGACY_DIR);
+}
+
+void BenchmarkJournalLoad(benchmark::State &state)
+{
+    PrepareJournal(state.range(0));
+    for (auto _ : state) {
+        std::list<InnerMissionInfo> missionInfoList;
+        MissionJournal journal(JOURNAL_DIR);
+        std::map<int32_t, std::string> records;
+        journal.GetAll(records);
+        for (const auto &record : records) {
+            InnerMissionInfo missionInfo;
+            if (missionInfo.FromJsonStr(record.second)) {
+                missionInfoList.push_back(missionInfo);
+            }
+        }
+        benchmark::DoNotOptimize(missionInfoList);
+    }
+    OHOS::HiviewDFX::FileUtil::ForceRemoveDirectory(JOURNAL_DIR);
+}
+
+void BenchmarkLegacyUpdate(benchmark::State &state)
+{
+    PrepareLegacy(state.range(0));
+    std::string jsonStr = MakeMissionInfo(0).ToJsonStr();
+    int64_t missionId = 0;
+    for (auto _ : state) {
+        // task switching rewrote the file of each touched mission
+        for (int64_t i = 0; i < UPDATES_PER_FLUSH; i++) {
+            OHOS::HiviewDFX::FileUtil::SaveStringToFile(GetLegacyFilePath(missionId), jsonStr, true);
+            missionId = (missionId + 1) % state.range(0);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * UPDATES_PER_FLUSH);
+    OHOS::HiviewDFX::FileUtil::ForceRemoveDirectory(LEGACY_DIR);
+}
+
+void BenchmarkJournalUpdate(benchmark::State &state)
+{
+    PrepareJournal(state.range(0));
+    MissionJournal journal(JOURNAL_DIR);
+    std::string jsonStr = MakeMissionInfo(0).ToJsonStr();
+    int64_t missionId = 0;
+    for (auto _ : state) {
+        for (int64_t i = 0; i < UPDATES_PER_FLUSH; i++) {
+            journal.Put(missionId, jsonStr);
+            missionId = (missionId + 1) % state.range(0);
+        }
+        journal.Flush();
+    }
+    state.SetItemsProcessed(state.iterations() * UPDATES_PER_FLUSH);
+    OHOS::HiviewDFX::FileUtil::ForceRemoveDirectory(JOURNAL_DIR);
+}
+}  // namespace
+
+BENCHMARK(BenchmarkLegacyLoad)->Arg(100)->Arg(1000);
+BENCHMARK(BenchmarkJournalLoad)->Arg(100)->Arg(1000);
+BENCHMARK(BenchmarkLegacyUpdate)->Arg(100)->Arg(1000);
+BENCHMARK(BenchmarkJournalUpdate)->Arg(100)->Arg(1000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#define private public
+#include "pending_want_manager.h"
+#undef private
+#include "pending_want_key.h"
+#include "pending_want_record.h"
+#include "wants_info.h"
+
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+constexpr int64_t SENDER_COUNT = 10000;
+constexpr int32_t USER_ID = 100;
+constexpr int32_t CALLING_UID = 20010001;
+
+WantSenderInfo MakeWantSenderInfo(int64_t index, int32_t flags)
+{
+    Want want;
+    want.SetElementName("", "com.example.benchmark", "MainAbility" + std::to_string(index % 16));
+    want.SetAction("action.system.home");
+    want.SetParam("index", static_cast<int>(index));
+    WantsInfo wantsInfo;
+    wantsInfo.want = want;
+    wantsInfo.resolvedTypes = "";
+
+    WantSenderInfo wantSenderInfo;
+    wantSenderInfo.type = static_cast<int32_t>(OperationType::START_ABILITY);
+    wantSenderInfo.bundleName = "com.example.benchmark";
+    wantSenderInfo.resultWho = "MainAbility";
+    wantSenderInfo.requestCode = static_cast<int32_t>(index);
+    wantSenderInfo.allWants.push_back(wantsInfo);
+    wantSenderInfo.flags = flags;
+    wantSenderInfo.userId = USER_ID;
+    return wantSenderInfo;
+}
+
+std::shared_ptr<PendingWantKey> MakeWantKey(WantSenderInfo &wantSenderInfo)
+{
+    std::shared_ptr<PendingWantKey> pendingKey = std::make_shared<PendingWantKey>();
+    pendingKey->SetBundleName(wantSenderInfo.bundleName);
+    pendingKey->SetRequestWho(wantSenderInfo.resultWho);
+    pendingKey->SetRequestCode(wantSenderInfo.requestCode);
+    pendingKey->SetFlags(wantSenderInfo.flags);
+    pendingKey->SetUserId(wantSenderInfo.userId);
+    pendingKey->SetType(wantSenderInfo.type);
+    pendingKey->SetRequestWant(wantSenderInfo.allWants.back().want);
+    pendingKey->SetRequestResolvedType(wantSenderInfo.allWants.back().resolvedTypes);
+    pendingKey->SetAllWantsInfos(wantSenderInfo.allWants);
+    return pendingKey;
+}
+
+std::shared_ptr<PendingWantManager> MakeManager(int64_t count)
+{
+    auto pendingManager = std::make_shared<PendingWantManager>();
+    for (int64_t i = 0; i < count; i++) {
+        WantSenderInfo wantSenderInfo = MakeWantSenderInfo(i, 0);
+        pendingManager->GetWantSenderLocked(CALLING_UID, CALLING_UID, USER_ID, wantSenderInfo, nullptr);
+    }
+    return pendingManager;
+}
+
+/**
+ * The comparison the manager ran against every record before the hash index, serializing both wants each time.
+ */
+bool LegacyKeyEquals(const std::shared_ptr<PendingWantKey> &inputKey, const std::shared_ptr<PendingWantKey> &key)
+{
+    return inputKey->GetBundleName() == key->GetBundleName() && inputKey->GetType() == key->GetType() &&
+        inputKey->GetRequestWho() == key->GetRequestWho() && inputKey->GetRequestCode() == key->GetRequestCode() &&
+        inputKey->GetRequestWant().ToString() == key->GetRequestWant().ToString() &&
+        inputKey->GetRequestWant().OperationEquals(key->GetRequestWant()) &&
+        inputKey->GetRequestResolvedType() == key->GetRequestResolvedType() &&
+        inputKey->GetFlags() == key->GetFlags() && inputKey->GetUserId() == key->GetUserId();
+}
+
+void BenchmarkLegacyGetRecordByKey(benchmark::State &state)
+{
+    auto pendingManager = MakeManager(state.range(0));
+    WantSenderInfo wantSenderInfo = MakeWantSenderInfo(state.range(0) / 2, 0);
+    auto key = MakeWantKey(wantSenderInfo);
+    for (auto _ : state) {
+        sptr<PendingWantRecord> result = nullptr;
+        for (const auto &item : pendingManager->wantRecords_) {
+            if (LegacyKeyEquals(item.first, key)) {
+                result = item.second;
+                break;
+            }
+        }
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void BenchmarkGetRecordByKey(benchmark::State &state)
+{
+    auto pendingManager = MakeManager(state.range(0));
+    WantSenderInfo wantSenderInfo = MakeWantSenderInfo(state.range(0) / 2, 0);
+    for (auto _ : state) {
+        // the key is built per call, as GetWantSenderLocked does
+        auto result = pendingManager->GetPendingWantRecordByKey(MakeWantKey(wantSenderInfo));
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void BenchmarkLegacyGetRecordByCode(benchmark::State &state)
+{
+    auto pendingManager = MakeManager(state.range(0));
+    int32_t code = pendingManager->wantRecords_.rbegin()->first->GetCode();
+    for (auto _ : state) {
+        sptr<PendingWantRecord> result = nullptr;
+        for (const auto &item : pendingManager->wantRecords_) {
+            if (item.first->GetCode() == code) {
+                result = item.second;
+                break;
+            }
+        }
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void BenchmarkGetRecordByCode(benchmark::State &state)
+{
+    auto pendingManager = MakeManager(state.range(0));
+    int32_t code = pendingManager->wantRecords_.rbegin()->first->GetCode();
+    for (auto _ : state) {
+        auto result = pendingManager->GetPendingWantRecordByCode(code);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void BenchmarkCancelAndCreate(benchmark::State &state)
+{
+    auto pendingManager = MakeManager(state.range(0));
+    WantSenderInfo cancelInfo =
+        MakeWantSenderInfo(state.range(0) / 2, static_cast<int32_t>(Flags::CANCEL_PRESENT_FLAG));
+    WantSenderInfo createInfo = MakeWantSenderInfo(state.range(0) / 2, 0);
+    for (auto _ : state) {
+        WantSenderInfo info = cancelInfo;
+        pendingManager->GetWantSenderLocked(CALLING_UID, CALLING_UID, USER_ID, info, nullptr);
+        info = createInfo;
+        auto result = pendingManager->GetWantSenderLocked(CALLING_UID, CALLING_UID, USER_ID, info, nullptr);
+        benchmark::DoNotOptimize(result);
+    }
+}
+}  // namespace
+
+BENCHMARK(BenchmarkLegacyGetRecordByKey)->Arg(100)->Arg(1000)->Arg(SENDER_COUNT);
+BENCHMARK(BenchmarkGetRecordByKey)->Arg(100)->Arg(1000)->Arg(SENDER_COUNT);
+BENCHMARK(BenchmarkLegacyGetRecordByCode)->Arg(100)->Arg(1000)->Arg(SENDER_COUNT);
+BENCHMARK(BenchmarkGetRecordByCode)->Arg(100)->Arg(1000)->Arg(SENDER_COUNT);
+BENCHMARK(BenchmarkCancelAndCreate)->Arg(100)->Arg(1000)->Arg(SENDER_COUNT);
+
+BENCHMARK_MAIN();
@@ -16,6 +16,8 @@
 #ifndef FOUNDATION_AAFWK_SERVICES_TEST_MOCK_SYSTEM_ABILITY_H
 #define FOUNDATION_AAFWK_SERVICES_TEST_MOCK_SYSTEM_ABILITY_H
 
+#include <string>
+
 #include "hilog/log.h"
 #include "iremote_object.h"
 
@@ -44,6 +46,17 @@ protected:
         HiviewDFX::HiLog::Debug(LABEL, "Mock SystemAbility OnStop called");
     }
 
+    virtual void OnAddSystemAbility(int32_t systemAbilityId, const std::string &deviceId)
+    {
+        HiviewDFX::HiLog::Debug(LABEL, "Mock SystemAbility OnAddSystemAbility called");
+    }
+
+    bool AddSystemAbilityListener(int32_t systemAbilityId)
+    {
+        HiviewDFX::HiLog::Debug(LABEL, "Mock SystemAbility AddSystemAbilityListener called");
+        return true;
+    }
+
     bool Publish(sptr<IRemoteObject> systemAbility)
     {
         HiviewDFX::HiLog::Debug(LABEL, "Mock SystemAbility Publish called");
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ability_lifecycle_metrics.h"
+#define private public
+#include "ability_record.h"
+#undef private
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+const std::string BUNDLE_NAME = "com.test.perf";
+const uint64_t LATENCY_COUNT = 1000;
+}  // namespace
+
+class AbilityLifecycleMetricsTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    bool HasDumpLine(const std::string &line);
+
+    std::shared_ptr<AbilityLifecycleMetrics> metrics_ {nullptr};
+};
+
+void AbilityLifecycleMetricsTest::SetUpTestCase(void)
+{}
+
+void AbilityLifecycleMetricsTest::TearDownTestCase(void)
+{}
+
+void AbilityLifecycleMetricsTest::SetUp(void)
+{
+    metrics_ = DelayedSingleton<AbilityLifecycleMetrics>::GetInstance();
+}
+
+void AbilityLifecycleMetricsTest::TearDown(void)
+{}
+
+bool AbilityLifecycleMetricsTest::HasDumpLine(const std::string &line)
+{
+    std::vector<std::string> info;
+    metrics_->Dump(info);
+    for (const auto &dumpLine : info) {
+        if (dumpLine.find(line) != std::string::npos) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * Feature: LatencyHistogram
+ * Function: GetBucketIndex GetBucketUpperBound
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Verify small latencies get a bucket each, and larger ones a bucket at most 12.5% wide.
+ */
+HWTEST_F(AbilityLifecycleMetricsTest, LatencyHistogram_Bucket_001, TestSize.Level1)
+{
+    for (uint64_t value = 0; value < LatencyHistogram::SUB_BUCKET_COUNT; value++) {
+        EXPECT_EQ(LatencyHistogram::GetBucketIndex(value), value);
+        EXPECT_EQ(LatencyHistogram::GetBucketUpperBound(value), value);
+    }
+    size_t lastIndex = 0;
+    for (uint64_t value = LatencyHistogram::SUB_BUCKET_COUNT; value < (1ULL << 32); value = value * 9 / 8 + 1) {
+        size_t index = LatencyHistogram::GetBucketIndex(value);
+        uint64_t upperBound = LatencyHistogram::GetBucketUpperBound(index);
+        EXPECT_GE(index, lastIndex);
+        EXPECT_GE(upperBound, value);
+        EXPECT_LE(upperBound - value, value / LatencyHistogram::SUB_BUCKET_COUNT);
+        lastIndex = index;
+    }
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(UINT64_MAX), LatencyHistogram::BUCKET_COUNT - 1);
+}
+
+/*
+ * Feature: LatencyHistogram
+ * Function: Record GetPercentile
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Verify the count, mean, percentiles and max of recorded latencies.
+ */
+HWTEST_F(AbilityLifecycleMetricsTest, LatencyHistogram_Percentile_001, TestSize.Level1)
+{
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.GetPercentile(50.0), 0U);
+    for (uint64_t latency = 1; latency <= LATENCY_COUNT; latency++) {
+        EXPECT_EQ(histogram.Record(latency), latency);
+    }
+    EXPECT_EQ(histogram.GetCount(), LATENCY_COUNT);
+    EXPECT_EQ(histogram.GetSum() / histogram.GetCount(), 500U);
+    EXPECT_EQ(histogram.GetMax(), LATENCY_COUNT);
+
+    uint64_t p50 = histogram.GetPercentile(50.0);
+    EXPECT_GE(p50, 500U);
+    EXPECT_LE(p50, 500U + 500U / LatencyHistogram::SUB_BUCKET_COUNT);
+    uint64_t p99 = histogram.GetPercentile(99.0);
+    EXPECT_GE(p99, 990U);
+    EXPECT_LE(p99, LATENCY_COUNT);
+    EXPECT_EQ(histogram.GetPercentile(100.0), LATENCY_COUNT);
+}
+
+/*
+ * Feature: AbilityLifecycleMetrics
+ * Function: RecordAttachDone RecordTransitionDone Dump
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Verify an ability record measures its load, start and requested transitions by bundle.
+ */
+HWTEST_F(AbilityLifecycleMetricsTest, AbilityLifecycleMetrics_Record_001, TestSize.Level1)
+{
+    AbilityRequest abilityRequest;
+    abilityRequest.abilityInfo.type = AppExecFwk::AbilityType::PAGE;
+    abilityRequest.abilityInfo.name = "MainAbility";
+    abilityRequest.abilityInfo.bundleName = BUNDLE_NAME;
+    abilityRequest.appInfo.bundleName = BUNDLE_NAME;
+    auto abilityRecord = AbilityRecord::CreateAbilityRecord(abilityRequest);
+    ASSERT_NE(abilityRecord, nullptr);
+    EXPECT_EQ(abilityRecord->lifecycleHistograms_, metrics_->GetHistograms(BUNDLE_NAME));
+
+    abilityRecord->loadRequestTime_ = AbilityLifecycleMetrics::GetTimeUs();
+    abilityRecord->RecordAttachDone();
+    abilityRecord->MarkTransitionRequest(LifecyclePhase::FOREGROUND);
+    abilityRecord->RecordTransitionDone(AbilityState::FOREGROUND);
+    // a second done and a done without its request are not measured
+    abilityRecord->RecordTransitionDone(AbilityState::FOREGROUND);
+    abilityRecord->RecordTransitionDone(AbilityState::BACKGROUND);
+
+    auto &phases = abilityRecord->lifecycleHistograms_->phases;
+    EXPECT_EQ(phases[static_cast<size_t>(LifecyclePhase::LOAD)].GetCount(), 1U);
+    EXPECT_EQ(phases[static_cast<size_t>(LifecyclePhase::START)].GetCount(), 1U);
+    EXPECT_EQ(phases[static_cast<size_t>(LifecyclePhase::FOREGROUND)].GetCount(), 1U);
+    EXPECT_EQ(phases[static_cast<size_t>(LifecyclePhase::BACKGROUND)].GetCount(), 0U);
+
+    EXPECT_TRUE(HasDumpLine("  " + BUNDLE_NAME + ":"));
+    EXPECT_TRUE(HasDumpLine("    foreground: count 1,"));
+    EXPECT_FALSE(HasDumpLine("    background: count"));
+}
+}  // namespace AAFwk
+}  // namespace OHOS
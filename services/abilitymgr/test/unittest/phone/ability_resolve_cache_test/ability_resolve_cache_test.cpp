@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ability_manager_errors.h"
+#define private public
+#include "ability_resolve_cache.h"
+#undef private
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+const std::string BUNDLE_NAME = "com.test.resolve";
+const std::string OTHER_BUNDLE_NAME = "com.test.resolve.other";
+const std::string ABILITY_NAME = "MainAbility";
+const std::string DATA_ABILITY_NAME = "DataAbility";
+const std::string ACTION_VIEW = "action.system.view";
+const int32_t FLAGS = 7;
+const int32_t USER_ID_U100 = 100;
+const int32_t USER_ID_U101 = 101;
+}  // namespace
+
+class AbilityResolveCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    AbilityResolveCache::AbilityResolver MakeAbilityResolver(const std::string &bundleName, int result = ERR_OK);
+    AbilityResolveCache::BundleResolver MakeBundleResolver(bool hasDataAbility);
+
+    int queryCount_ = 0;
+};
+
+void AbilityResolveCacheTest::SetUpTestCase(void)
+{}
+
+void AbilityResolveCacheTest::TearDownTestCase(void)
+{}
+
+void AbilityResolveCacheTest::SetUp(void)
+{
+    queryCount_ = 0;
+}
+
+void AbilityResolveCacheTest::TearDown(void)
+{}
+
+AbilityResolveCache::AbilityResolver AbilityResolveCacheTest::MakeAbilityResolver(
+    const std::string &bundleName, int result)
+{
+    return [this, bundleName, result](AppExecFwk::AbilityInfo &abilityInfo) {
+        queryCount_++;
+        abilityInfo.bundleName = bundleName;
+        abilityInfo.name = ABILITY_NAME;
+        return result;
+    };
+}
+
+AbilityResolveCache::BundleResolver AbilityResolveCacheTest::MakeBundleResolver(bool hasDataAbility)
+{
+    return [this, hasDataAbility](AppExecFwk::BundleInfo &bundleInfo) {
+        queryCount_++;
+        bundleInfo.uid = USER_ID_U100;
+        bundleInfo.applicationInfo.bundleName = BUNDLE_NAME;
+        AppExecFwk::AbilityInfo abilityInfo;
+        abilityInfo.name = ABILITY_NAME;
+        abilityInfo.type = AppExecFwk::AbilityType::PAGE;
+        bundleInfo.abilityInfos.emplace_back(abilityInfo);
+        if (hasDataAbility) {
+            abilityInfo.name = DATA_ABILITY_NAME;
+            abilityInfo.type = AppExecFwk::AbilityType::DATA;
+            bundleInfo.abilityInfos.emplace_back(abilityInfo);
+        }
+        return true;
+    };
+}
+
+/*
+ * Feature: AbilityResolveCache
+ * Function: ResolveAbility
+ * SubFunction: NA
+ * FunctionPoints: An explicit want is resolved once per user and flags, until its bundle changes.
+ * EnvConditions: NA
+ * CaseDescription: Resolve a want twice, for another user, and after its bundle and another one change.
+ */
+HWTEST_F(AbilityResolveCacheTest, AbilityResolveCache_001, TestSize.Level1)
+{
+    AbilityResolveCache cache;
+    Want want;
+    want.SetElementName(BUNDLE_NAME, ABILITY_NAME);
+    AppExecFwk::AbilityInfo abilityInfo;
+    auto resolver = MakeAbilityResolver(BUNDLE_NAME);
+    EXPECT_EQ(ERR_OK, cache.ResolveAbility(want, FLAGS, USER_ID_U100, abilityInfo, resolver));
+    EXPECT_EQ(ERR_OK, cache.ResolveAbility(want, FLAGS, USER_ID_U100, abilityInfo, resolver));
+    EXPECT_EQ(ABILITY_NAME, abilityInfo.name);
+    EXPECT_EQ(1, queryCount_);
+    EXPECT_EQ(ERR_OK, cache.ResolveAbility(want, FLAGS, USER_ID_U101, abilityInfo, resolver));
+    EXPECT_EQ(ERR_OK, cache.ResolveAbility(want, 0, USER_ID_U100, abilityInfo, resolver));
+    EXPECT_EQ(3, queryCount_);
+
+    cache.Invalidate(OTHER_BUNDLE_NAME);
+    EXPECT_EQ(ERR_OK, cache.ResolveAbility(want, FLAGS, USER_ID_U100, abilityInfo, resolver));
+    EXPECT_EQ(3, queryCount_);
+    cache.Invalidate(BUNDLE_NAME);
+    EXPECT_EQ(ERR_OK, cache.ResolveAbility(want, FLAGS, USER_ID_U100, abilityInfo, resolver));
+    EXPECT_EQ(4, queryCount_);
+    EXPECT_EQ(2U, cache.abilityCounter_.hits);
+    EXPECT_EQ(4U, cache.abilityCounter_.misses);
+}
+
+/*
+ * Feature: AbilityResolveCache
+ * Function: ResolveAbility
+ * SubFunction: NA
+ * FunctionPoints: Implicit wants are dropped by any bundle change, failed resolutions are not kept.
+ * EnvConditions: NA
+ * CaseDescription: Resolve an implicit want, change another bundle, and fail to resolve a want twice.
+ */
+HWTEST_F(AbilityResolveCacheTest, AbilityResolveCache_002, TestSize.Level1)
+{
+    AbilityResolveCache cache;
+    Want want;
+    want.SetAction(ACTION_VIEW);
+    want.SetUri("dataability:///com.test.resolve/photos");
+    AppExecFwk::AbilityInfo abilityInfo;
+    auto resolver = MakeAbilityResolver(BUNDLE_NAME);
+    EXPECT_EQ(ERR_OK, cache.ResolveAbility(want, FLAGS, USER_ID_U100, abilityInfo, resolver));
+    EXPECT_EQ(ERR_OK, cache.ResolveAbility(want, FLAGS, USER_ID_U100, abilityInfo, resolver));
+    EXPECT_EQ(1, queryCount_);
+
+    // a new bundle may answer the want better
+    cache.Invalidate(OTHER_BUNDLE_NAME);
+    EXPECT_EQ(ERR_OK, cache.ResolveAbility(want, FLAGS, USER_ID_U100, abilityInfo, resolver));
+    EXPECT_EQ(2, queryCount_);
+
+    Want missingWant;
+    missingWant.SetElementName(OTHER_BUNDLE_NAME, ABILITY_NAME);
+    auto failingResolver = MakeAbilityResolver(OTHER_BUNDLE_NAME, RESOLVE_ABILITY_ERR);
+    EXPECT_EQ(RESOLVE_ABILITY_ERR, cache.ResolveAbility(missingWant, FLAGS, USER_ID_U100, abilityInfo,
+        failingResolver));
+    EXPECT_EQ(RESOLVE_ABILITY_ERR, cache.ResolveAbility(missingWant, FLAGS, USER_ID_U100, abilityInfo,
+        failingResolver));
+    EXPECT_EQ(4, queryCount_);
+    EXPECT_EQ(1U, cache.abilities_.size());
+}
+
+/*
+ * Feature: AbilityResolveCache
+ * Function: GetDataAbilities
+ * SubFunction: NA
+ * FunctionPoints: The data abilities of a bundle are queried once, a bundle without any keeps nothing else.
+ * EnvConditions: NA
+ * CaseDescription: Get the data abilities of a bundle with and without some, then clear the cache.
+ */
+HWTEST_F(AbilityResolveCacheTest, AbilityResolveCache_003, TestSize.Level1)
+{
+    AbilityResolveCache cache;
+    BundleDataAbilities dataAbilities;
+    EXPECT_TRUE(cache.GetDataAbilities(BUNDLE_NAME, USER_ID_U100, dataAbilities, MakeBundleResolver(true)));
+    EXPECT_TRUE(cache.GetDataAbilities(BUNDLE_NAME, USER_ID_U100, dataAbilities, MakeBundleResolver(true)));
+    EXPECT_EQ(1, queryCount_);
+    ASSERT_EQ(1U, dataAbilities.abilityInfos.size());
+    EXPECT_EQ(DATA_ABILITY_NAME, dataAbilities.abilityInfos.front().name);
+    EXPECT_EQ(BUNDLE_NAME, dataAbilities.appInfo.bundleName);
+    EXPECT_EQ(USER_ID_U100, dataAbilities.uid);
+
+    BundleDataAbilities noDataAbilities;
+    EXPECT_TRUE(cache.GetDataAbilities(OTHER_BUNDLE_NAME, USER_ID_U100, noDataAbilities,
+        MakeBundleResolver(false)));
+    EXPECT_TRUE(noDataAbilities.abilityInfos.empty());
+    EXPECT_TRUE(noDataAbilities.appInfo.bundleName.empty());
+
+    cache.Clear();
+    EXPECT_TRUE(cache.GetDataAbilities(BUNDLE_NAME, USER_ID_U100, dataAbilities, MakeBundleResolver(true)));
+    EXPECT_EQ(3, queryCount_);
+
+    std::vector<std::string> info;
+    cache.Dump(info);
+    ASSERT_EQ(4U, info.size());
+    EXPECT_EQ("  data abilities of bundles: 1 cached, 1 hits, 3 misses, hit rate 25%", info[2]);
+}
+
+/*
+ * Feature: AbilityResolveCache
+ * Function: ResolveAbility
+ * SubFunction: NA
+ * FunctionPoints: Implicit wants whose fields only differ by where a '#' falls are resolved apart.
+ * EnvConditions: NA
+ * CaseDescription: Resolve a want with a uri fragment, then one moving the fragment into its type.
+ */
+HWTEST_F(AbilityResolveCacheTest, AbilityResolveCache_004, TestSize.Level1)
+{
+    AbilityResolveCache cache;
+    Want want;
+    want.SetAction(ACTION_VIEW);
+    want.SetUri("dataability:///com.test.resolve/photos#1");
+    want.SetType("image/*");
+    Want otherWant;
+    otherWant.SetAction(ACTION_VIEW);
+    otherWant.SetUri("dataability:///com.test.resolve/photos");
+    otherWant.SetType("1#image/*");
+    AppExecFwk::AbilityInfo abilityInfo;
+    auto resolver = MakeAbilityResolver(BUNDLE_NAME);
+    EXPECT_EQ(ERR_OK, cache.ResolveAbility(want, FLAGS, USER_ID_U100, abilityInfo, resolver));
+    EXPECT_EQ(ERR_OK, cache.ResolveAbility(otherWant, FLAGS, USER_ID_U100, abilityInfo, resolver));
+    EXPECT_EQ(2, queryCount_);
+    EXPECT_EQ(2U, cache.abilities_.size());
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ability_record.h"
+#include "ability_token_index.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+const int32_t USER_ID_U100 = 100;
+const int32_t USER_ID_U101 = 101;
+}  // namespace
+
+class AbilityTokenIndexTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    std::shared_ptr<AbilityRecord> CreateRecord(const std::string &name);
+
+    std::shared_ptr<AbilityTokenIndex> index_ {nullptr};
+    int missionListOwner_ = 0;
+    int connectOwner_ = 0;
+};
+
+void AbilityTokenIndexTest::SetUpTestCase(void)
+{}
+
+void AbilityTokenIndexTest::TearDownTestCase(void)
+{}
+
+void AbilityTokenIndexTest::SetUp(void)
+{
+    index_ = DelayedSingleton<AbilityTokenIndex>::GetInstance();
+}
+
+void AbilityTokenIndexTest::TearDown(void)
+{
+    index_->RemoveOwner(&missionListOwner_);
+    index_->RemoveOwner(&connectOwner_);
+}
+
+std::shared_ptr<AbilityRecord> AbilityTokenIndexTest::CreateRecord(const std::string &name)
+{
+    AbilityRequest abilityRequest;
+    abilityRequest.abilityInfo.type = AppExecFwk::AbilityType::PAGE;
+    abilityRequest.abilityInfo.name = name;
+    abilityRequest.abilityInfo.bundleName = "com.test.token";
+    abilityRequest.appInfo.bundleName = "com.test.token";
+    return AbilityRecord::CreateAbilityRecord(abilityRequest);
+}
+
+/*
+ * Feature: AbilityTokenIndex
+ * Function: Add Find
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Verify an added record is found by its token, and only for its owner.
+ */
+HWTEST_F(AbilityTokenIndexTest, AbilityTokenIndex_Find_001, TestSize.Level1)
+{
+    auto abilityRecord = CreateRecord("MainAbility");
+    ASSERT_NE(abilityRecord, nullptr);
+    sptr<IRemoteObject> token = abilityRecord->GetToken()->AsObject();
+    EXPECT_EQ(index_->Find(token), nullptr);
+
+    index_->Add(abilityRecord, AbilityTokenOwnerType::MISSION_LIST, &missionListOwner_, USER_ID_U100);
+    EXPECT_EQ(index_->Find(token), abilityRecord);
+    EXPECT_EQ(index_->Find(token, &missionListOwner_), abilityRecord);
+    EXPECT_EQ(index_->Find(token, &connectOwner_), nullptr);
+
+    AbilityTokenIndex::Entry entry;
+    EXPECT_TRUE(index_->GetEntry(token, entry));
+    EXPECT_EQ(entry.ownerType, AbilityTokenOwnerType::MISSION_LIST);
+    EXPECT_EQ(entry.owner, &missionListOwner_);
+    EXPECT_EQ(entry.userId, USER_ID_U100);
+}
+
+/*
+ * Feature: AbilityTokenIndex
+ * Function: Find
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Verify tokens that were never added and null tokens are not found.
+ */
+HWTEST_F(AbilityTokenIndexTest, AbilityTokenIndex_Find_002, TestSize.Level1)
+{
+    auto abilityRecord = CreateRecord("MainAbility");
+    auto fakeRecord = CreateRecord("FakeAbility");
+    ASSERT_NE(abilityRecord, nullptr);
+    ASSERT_NE(fakeRecord, nullptr);
+    index_->Add(abilityRecord, AbilityTokenOwnerType::MISSION_LIST, &missionListOwner_, USER_ID_U100);
+
+    EXPECT_EQ(index_->Find(fakeRecord->GetToken()->AsObject()), nullptr);
+    EXPECT_EQ(index_->Find(nullptr), nullptr);
+    AbilityTokenIndex::Entry entry;
+    EXPECT_FALSE(index_->GetEntry(nullptr, entry));
+}
+
+/*
+ * Feature: AbilityTokenIndex
+ * Function: Add
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Verify adding a token again moves it to the new owner.
+ */
+HWTEST_F(AbilityTokenIndexTest, AbilityTokenIndex_Add_001, TestSize.Level1)
+{
+    auto abilityRecord = CreateRecord("ServiceAbility");
+    ASSERT_NE(abilityRecord, nullptr);
+    sptr<IRemoteObject> token = abilityRecord->GetToken()->AsObject();
+
+    index_->Add(abilityRecord, AbilityTokenOwnerType::MISSION_LIST, &missionListOwner_, USER_ID_U100);
+    index_->Add(abilityRecord, AbilityTokenOwnerType::SERVICE, &connectOwner_, USER_ID_U101);
+    EXPECT_EQ(index_->Find(token, &missionListOwner_), nullptr);
+    EXPECT_EQ(index_->Find(token, &connectOwner_), abilityRecord);
+
+    AbilityTokenIndex::Entry entry;
+    EXPECT_TRUE(index_->GetEntry(token, entry));
+    EXPECT_EQ(entry.ownerType, AbilityTokenOwnerType::SERVICE);
+    EXPECT_EQ(entry.userId, USER_ID_U101);
+}
+
+/*
+ * Feature: AbilityTokenIndex
+ * Function: Remove RemoveOwner
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Verify removed records and records of a removed owner are no longer found.
+ */
+HWTEST_F(AbilityTokenIndexTest, AbilityTokenIndex_Remove_001, TestSize.Level1)
+{
+    auto first = CreateRecord("FirstAbility");
+    auto second = CreateRecord("SecondAbility");
+    auto service = CreateRecord("ServiceAbility");
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    ASSERT_NE(service, nullptr);
+    index_->Add(first, AbilityTokenOwnerType::MISSION_LIST, &missionListOwner_, USER_ID_U100);
+    index_->Add(second, AbilityTokenOwnerType::MISSION_LIST, &missionListOwner_, USER_ID_U100);
+    index_->Add(service, AbilityTokenOwnerType::SERVICE, &connectOwner_, USER_ID_U100);
+
+    index_->Remove(first);
+    EXPECT_EQ(index_->Find(first->GetToken()->AsObject()), nullptr);
+    EXPECT_EQ(index_->Find(second->GetToken()->AsObject()), second);
+
+    index_->RemoveOwner(&missionListOwner_);
+    EXPECT_EQ(index_->Find(second->GetToken()->AsObject()), nullptr);
+    EXPECT_EQ(index_->Find(service->GetToken()->AsObject()), service);
+}
+
+/*
+ * Feature: AbilityTokenIndex
+ * Function: Find
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Verify the entry of a destroyed record is dropped.
+ */
+HWTEST_F(AbilityTokenIndexTest, AbilityTokenIndex_Expired_001, TestSize.Level1)
+{
+    size_t size = index_->Size();
+    auto abilityRecord = CreateRecord("MainAbility");
+    ASSERT_NE(abilityRecord, nullptr);
+    sptr<IRemoteObject> token = abilityRecord->GetToken()->AsObject();
+    index_->Add(abilityRecord, AbilityTokenOwnerType::MISSION_LIST, &missionListOwner_, USER_ID_U100);
+    EXPECT_EQ(index_->Size(), size + 1);
+
+    abilityRecord.reset();
+    EXPECT_EQ(index_->Find(token), nullptr);
+    EXPECT_EQ(index_->Size(), size);
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "errors.h"
+#include "ipc_skeleton.h"
+#define private public
+#include "ipc_stub_metrics.h"
+#undef private
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+const uint32_t DENSE_CODE = 10;
+const uint32_t FAILING_CODE = 20;
+const uint32_t SPARSE_CODE = 100000;
+const uint32_t UNKNOWN_CODE = 30;
+const int32_t CALL_COUNT = 3;
+const int32_t FAILED = -1;
+}  // namespace
+
+/**
+ * Stands in for a service stub, its handlers only count their calls.
+ */
+class StandInStub {
+public:
+    using RequestFuncType = int (StandInStub::*)(MessageParcel &data, MessageParcel &reply);
+
+    int Handle(MessageParcel &data, MessageParcel &reply)
+    {
+        handleCount_++;
+        reply.WriteInt32(handleCount_);
+        return ERR_OK;
+    }
+    int Fail(MessageParcel &data, MessageParcel &reply)
+    {
+        return FAILED;
+    }
+
+    int32_t handleCount_ = 0;
+};
+
+class IpcStubMetricsTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    bool HasDumpLine(const std::string &line);
+
+    StandInStub stub_;
+    std::unique_ptr<IpcDispatchTable<StandInStub::RequestFuncType>> dispatchTable_ {nullptr};
+};
+
+void IpcStubMetricsTest::SetUpTestCase(void)
+{}
+
+void IpcStubMetricsTest::TearDownTestCase(void)
+{}
+
+void IpcStubMetricsTest::SetUp(void)
+{
+    std::map<uint32_t, StandInStub::RequestFuncType> funcMap;
+    funcMap[DENSE_CODE] = &StandInStub::Handle;
+    funcMap[FAILING_CODE] = &StandInStub::Fail;
+    funcMap[SPARSE_CODE] = &StandInStub::Handle;
+    dispatchTable_ = std::make_unique<IpcDispatchTable<StandInStub::RequestFuncType>>("StandIn");
+    dispatchTable_->Build(funcMap);
+}
+
+void IpcStubMetricsTest::TearDown(void)
+{
+    dispatchTable_.reset();
+}
+
+bool IpcStubMetricsTest::HasDumpLine(const std::string &line)
+{
+    std::vector<std::string> info;
+    IpcStubMetrics::DumpAll(info);
+    for (const auto &dumpLine : info) {
+        if (dumpLine.find(line) != std::string::npos) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * Feature: IpcDispatchTable
+ * Function: Dispatch
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Verify the handlers of small and large codes are called, and an unknown code is not handled.
+ */
+HWTEST_F(IpcStubMetricsTest, IpcDispatchTable_Dispatch_001, TestSize.Level1)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    int result = FAILED;
+    EXPECT_TRUE(dispatchTable_->Dispatch(&stub_, DENSE_CODE, data, reply, result));
+    EXPECT_EQ(result, ERR_OK);
+    EXPECT_TRUE(dispatchTable_->Dispatch(&stub_, SPARSE_CODE, data, reply, result));
+    EXPECT_EQ(result, ERR_OK);
+    EXPECT_EQ(stub_.handleCount_, 2);
+    EXPECT_TRUE(dispatchTable_->Dispatch(&stub_, FAILING_CODE, data, reply, result));
+    EXPECT_EQ(result, FAILED);
+
+    result = ERR_OK;
+    EXPECT_FALSE(dispatchTable_->Dispatch(&stub_, UNKNOWN_CODE, data, reply, result));
+    EXPECT_FALSE(dispatchTable_->Dispatch(&stub_, SPARSE_CODE + 1, data, reply, result));
+    EXPECT_EQ(result, ERR_OK);
+    EXPECT_EQ(stub_.handleCount_, 2);
+}
+
+/*
+ * Feature: IpcStubMetrics
+ * Function: Record Dump
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Verify the dump shows the calls, errors, parcel sizes and calling uid of every called code.
+ */
+HWTEST_F(IpcStubMetricsTest, IpcStubMetrics_Dump_001, TestSize.Level1)
+{
+    MessageParcel reply;
+    int result = ERR_OK;
+    for (int32_t i = 0; i < CALL_COUNT; i++) {
+        MessageParcel data;
+        data.WriteInt32(i);
+        dispatchTable_->Dispatch(&stub_, DENSE_CODE, data, reply, result);
+    }
+    MessageParcel data;
+    dispatchTable_->Dispatch(&stub_, FAILING_CODE, data, reply, result);
+
+    EXPECT_TRUE(HasDumpLine("IpcStubMetrics StandIn (latency in ns):"));
+    // the reply parcel keeps what every call wrote, it is 4, 8 then 12 bytes
+    std::string uid = std::to_string(IPCSkeleton::GetCallingUid());
+    EXPECT_TRUE(HasDumpLine("  code " + std::to_string(DENSE_CODE) + ": calls 3, errors 0,"));
+    EXPECT_TRUE(HasDumpLine("bytes in 12, out 24, top uids " + uid + ":3"));
+    EXPECT_TRUE(HasDumpLine("  code " + std::to_string(FAILING_CODE) + ": calls 1, errors 1,"));
+    EXPECT_FALSE(HasDumpLine("  code " + std::to_string(SPARSE_CODE) + ":"));
+
+    // gone with its stub
+    dispatchTable_.reset();
+    EXPECT_FALSE(HasDumpLine("IpcStubMetrics StandIn"));
+}
+
+/*
+ * Feature: IpcStubMetrics
+ * Function: Record
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Verify a latency histogram is only allocated for a code once it is called.
+ */
+HWTEST_F(IpcStubMetricsTest, IpcStubMetrics_Record_001, TestSize.Level1)
+{
+    auto &metrics = dispatchTable_->metrics_;
+    ASSERT_NE(metrics, nullptr);
+    for (size_t slot = 0; slot < metrics->codes_.size(); slot++) {
+        EXPECT_EQ(metrics->latencies_[slot].load(), nullptr);
+    }
+
+    MessageParcel data;
+    MessageParcel reply;
+    int result = FAILED;
+    dispatchTable_->Dispatch(&stub_, DENSE_CODE, data, reply, result);
+    dispatchTable_->Dispatch(&stub_, DENSE_CODE, data, reply, result);
+    for (size_t slot = 0; slot < metrics->codes_.size(); slot++) {
+        LatencyHistogram *latency = metrics->latencies_[slot].load();
+        if (metrics->codes_[slot] == DENSE_CODE) {
+            ASSERT_NE(latency, nullptr);
+            EXPECT_EQ(latency->GetCount(), 2);
+        } else {
+            EXPECT_EQ(latency, nullptr);
+        }
+    }
+}
+}  // namespace AAFwk
+}  // namespace OHOS
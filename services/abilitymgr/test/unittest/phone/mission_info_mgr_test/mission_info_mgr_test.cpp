@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "mission_info_mgr.h"
+#undef private
+#undef protected
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+// a user of its own, so the test never touches the missions of a real user
+const int32_t TEST_USER_ID = 10000;
+}  // namespace
+
+class MissionInfoMgrTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    InnerMissionInfo AddMission(const std::string &time);
+    std::vector<int32_t> GetMissionIds(int32_t numMax);
+
+    std::shared_ptr<MissionInfoMgr> missionInfoMgr_ {nullptr};
+};
+
+void MissionInfoMgrTest::SetUpTestCase(void)
+{}
+
+void MissionInfoMgrTest::TearDownTestCase(void)
+{}
+
+void MissionInfoMgrTest::SetUp(void)
+{
+    missionInfoMgr_ = std::shared_ptr<MissionInfoMgr>(new MissionInfoMgr());
+    missionInfoMgr_->taskDataPersistenceMgr_ = DelayedSingleton<TaskDataPersistenceMgr>::GetInstance();
+    missionInfoMgr_->taskDataPersistenceMgr_->Init(TEST_USER_ID);
+}
+
+void MissionInfoMgrTest::TearDown(void)
+{
+    missionInfoMgr_->DeleteAllMissionInfos(nullptr);
+}
+
+InnerMissionInfo MissionInfoMgrTest::AddMission(const std::string &time)
+{
+    InnerMissionInfo info;
+    EXPECT_TRUE(missionInfoMgr_->GenerateMissionId(info.missionInfo.id));
+    info.missionInfo.time = time;
+    info.missionInfo.lockedState = false;
+    info.missionName = "#com.example.test:MainAbility" + std::to_string(info.missionInfo.id);
+    info.bundleName = "com.example.test";
+    EXPECT_TRUE(missionInfoMgr_->AddMissionInfo(info));
+    return info;
+}
+
+std::vector<int32_t> MissionInfoMgrTest::GetMissionIds(int32_t numMax)
+{
+    std::vector<MissionInfo> missionInfos;
+    EXPECT_EQ(missionInfoMgr_->GetMissionInfos(numMax, missionInfos), 0);
+    std::vector<int32_t> missionIds;
+    for (const auto &missionInfo : missionInfos) {
+        missionIds.push_back(missionInfo.id);
+    }
+    return missionIds;
+}
+
+/*
+ * Feature: MissionInfoMgr
+ * Function: AddMissionInfo
+ * SubFunction: NA
+ * FunctionPoints: Missions are listed by time stamp, the latest first.
+ * EnvConditions: NA
+ * CaseDescription: Add missions out of order, with a time stamp of more digits too, and get the top ones.
+ */
+HWTEST_F(MissionInfoMgrTest, AddMissionInfo_0100, TestSize.Level1)
+{
+    auto mission1 = AddMission("300");
+    auto mission2 = AddMission("100");
+    auto mission3 = AddMission("200");
+    auto mission4 = AddMission("1000");
+    auto mission5 = AddMission("200");
+
+    std::vector<int32_t> expectIds = { mission4.missionInfo.id, mission1.missionInfo.id, mission3.missionInfo.id,
+        mission5.missionInfo.id, mission2.missionInfo.id };
+    EXPECT_EQ(GetMissionIds(10), expectIds);
+    expectIds.resize(2);
+    EXPECT_EQ(GetMissionIds(2), expectIds);
+    EXPECT_FALSE(missionInfoMgr_->AddMissionInfo(mission1));
+}
+
+/*
+ * Feature: MissionInfoMgr
+ * Function: UpdateMissionInfo
+ * SubFunction: NA
+ * FunctionPoints: A mission with a new time stamp moves to its new position.
+ * EnvConditions: NA
+ * CaseDescription: Update the oldest mission to the latest time, then update its label only.
+ */
+HWTEST_F(MissionInfoMgrTest, UpdateMissionInfo_0100, TestSize.Level1)
+{
+    auto mission1 = AddMission("300");
+    auto mission2 = AddMission("100");
+
+    mission2.missionInfo.time = "400";
+    EXPECT_TRUE(missionInfoMgr_->UpdateMissionInfo(mission2));
+    std::vector<int32_t> expectIds = { mission2.missionInfo.id, mission1.missionInfo.id };
+    EXPECT_EQ(GetMissionIds(10), expectIds);
+
+    EXPECT_EQ(missionInfoMgr_->UpdateMissionLabel(mission2.missionInfo.id, "label"), 0);
+    MissionInfo missionInfo;
+    EXPECT_EQ(missionInfoMgr_->GetMissionInfoById(mission2.missionInfo.id, missionInfo), 0);
+    EXPECT_EQ(missionInfo.label, "label");
+    EXPECT_EQ(missionInfo.time, "400");
+
+    missionInfoMgr_->UpdateMissionTimeStamp(mission1.missionInfo.id, "500");
+    expectIds = { mission1.missionInfo.id, mission2.missionInfo.id };
+    EXPECT_EQ(GetMissionIds(10), expectIds);
+}
+
+/*
+ * Feature: MissionInfoMgr
+ * Function: DeleteMissionInfo
+ * SubFunction: NA
+ * FunctionPoints: A deleted mission can not be found any more.
+ * EnvConditions: NA
+ * CaseDescription: Delete one mission, then all the missions but a locked one.
+ */
+HWTEST_F(MissionInfoMgrTest, DeleteMissionInfo_0100, TestSize.Level1)
+{
+    auto mission1 = AddMission("300");
+    auto mission2 = AddMission("200");
+    auto mission3 = AddMission("100");
+
+    EXPECT_TRUE(missionInfoMgr_->DeleteMissionInfo(mission2.missionInfo.id));
+    InnerMissionInfo innerMissionInfo;
+    EXPECT_NE(missionInfoMgr_->GetInnerMissionInfoById(mission2.missionInfo.id, innerMissionInfo), 0);
+
+    mission3.missionInfo.lockedState = true;
+    EXPECT_TRUE(missionInfoMgr_->UpdateMissionInfo(mission3));
+    EXPECT_TRUE(missionInfoMgr_->DeleteAllMissionInfos(nullptr));
+    std::vector<int32_t> expectIds = { mission3.missionInfo.id };
+    EXPECT_EQ(GetMissionIds(10), expectIds);
+    EXPECT_NE(missionInfoMgr_->GetInnerMissionInfoById(mission1.missionInfo.id, innerMissionInfo), 0);
+
+    mission3.missionInfo.lockedState = false;
+    EXPECT_TRUE(missionInfoMgr_->UpdateMissionInfo(mission3));
+}
+}  // namespace AAFwk
+}  // namespace OHOS
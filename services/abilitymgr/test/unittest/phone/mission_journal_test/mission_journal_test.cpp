@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <fstream>
+
+#include "file_util.h"
+#include "mission_journal.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+const std::string TEST_DIR = "/data/test/mission_journal_test";
+const std::string MISSION_DATA_1 = "{\"id\":1}";
+const std::string MISSION_DATA_2 = "{\"id\":2}";
+const std::string MISSION_DATA_3 = "{\"id\":3}";
+constexpr int32_t COMPACT_UPDATE_COUNT = 300;
+}  // namespace
+
+class MissionJournalTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    std::map<int32_t, std::string> Reload();
+};
+
+void MissionJournalTest::SetUpTestCase(void)
+{}
+
+void MissionJournalTest::TearDownTestCase(void)
+{}
+
+void MissionJournalTest::SetUp(void)
+{
+    OHOS::HiviewDFX::FileUtil::ForceRemoveDirectory(TEST_DIR);
+}
+
+void MissionJournalTest::TearDown(void)
+{
+    OHOS::HiviewDFX::FileUtil::ForceRemoveDirectory(TEST_DIR);
+}
+
+std::map<int32_t, std::string> MissionJournalTest::Reload()
+{
+    MissionJournal journal(TEST_DIR);
+    std::map<int32_t, std::string> records;
+    EXPECT_TRUE(journal.GetAll(records));
+    return records;
+}
+
+/*
+ * Feature: MissionJournal
+ * Function: Flush
+ * SubFunction: NA
+ * FunctionPoints: Updates of the same mission are coalesced and survive a reload.
+ * EnvConditions: NA
+ * CaseDescription: Put and Remove several missions, flush, and load them from disk again.
+ */
+HWTEST_F(MissionJournalTest, Flush_0100, TestSize.Level1)
+{
+    MissionJournal journal(TEST_DIR);
+    EXPECT_FALSE(journal.Exists());
+    journal.Put(1, MISSION_DATA_2);
+    journal.Put(1, MISSION_DATA_1);
+    journal.Put(2, MISSION_DATA_2);
+    journal.Put(3, MISSION_DATA_3);
+    journal.Remove(3);
+    EXPECT_TRUE(journal.HasPending());
+    EXPECT_TRUE(journal.Flush());
+    EXPECT_FALSE(journal.HasPending());
+    EXPECT_TRUE(journal.Exists());
+    EXPECT_EQ(journal.GetJournalRecordCount(), 3);
+
+    auto records = Reload();
+    EXPECT_EQ(records.size(), 2);
+    EXPECT_EQ(records[1], MISSION_DATA_1);
+    EXPECT_EQ(records[2], MISSION_DATA_2);
+}
+
+/*
+ * Feature: MissionJournal
+ * Function: GetAll
+ * SubFunction: NA
+ * FunctionPoints: A torn record at the end of the journal is dropped.
+ * EnvConditions: NA
+ * CaseDescription: Append garbage after the flushed records, the records before stay readable and later
+ *                  appends too.
+ */
+HWTEST_F(MissionJournalTest, GetAll_0100, TestSize.Level1)
+{
+    {
+        MissionJournal journal(TEST_DIR);
+        journal.Put(1, MISSION_DATA_1);
+        EXPECT_TRUE(journal.Flush());
+    }
+    {
+        std::ofstream file(TEST_DIR + "/" + MISSION_JOURNAL_FILE_NAME, std::ios::binary | std::ios::app);
+        file << "torn";
+    }
+
+    MissionJournal journal(TEST_DIR);
+    std::map<int32_t, std::string> records;
+    EXPECT_TRUE(journal.GetAll(records));
+    EXPECT_EQ(records.size(), 1);
+    journal.Put(2, MISSION_DATA_2);
+    EXPECT_TRUE(journal.Flush());
+
+    records = Reload();
+    EXPECT_EQ(records.size(), 2);
+    EXPECT_EQ(records[2], MISSION_DATA_2);
+}
+
+/*
+ * Feature: MissionJournal
+ * Function: Compact
+ * SubFunction: NA
+ * FunctionPoints: The journal is folded into the base file once it grows past the live data.
+ * EnvConditions: NA
+ * CaseDescription: Flush many updates of two missions, the journal stays short and the data intact.
+ */
+HWTEST_F(MissionJournalTest, Compact_0100, TestSize.Level1)
+{
+    MissionJournal journal(TEST_DIR);
+    for (int32_t i = 0; i < COMPACT_UPDATE_COUNT; i++) {
+        journal.Put(1, MISSION_DATA_1 + std::to_string(i));
+        journal.Put(2, MISSION_DATA_2);
+        EXPECT_TRUE(journal.Flush());
+    }
+    EXPECT_LT(journal.GetJournalRecordCount(), COMPACT_UPDATE_COUNT);
+
+    auto records = Reload();
+    EXPECT_EQ(records.size(), 2);
+    EXPECT_EQ(records[1], MISSION_DATA_1 + std::to_string(COMPACT_UPDATE_COUNT - 1));
+}
+
+/*
+ * Feature: MissionJournal
+ * Function: Reset
+ * SubFunction: NA
+ * FunctionPoints: Migrated records are written to the base file.
+ * EnvConditions: NA
+ * CaseDescription: Reset with the records of the legacy files, and load them again.
+ */
+HWTEST_F(MissionJournalTest, Reset_0100, TestSize.Level1)
+{
+    MissionJournal journal(TEST_DIR);
+    std::map<int32_t, std::string> legacyRecords = {{1, MISSION_DATA_1}, {3, MISSION_DATA_3}};
+    EXPECT_TRUE(journal.Reset(legacyRecords));
+    EXPECT_TRUE(journal.Exists());
+    EXPECT_EQ(journal.GetJournalRecordCount(), 0);
+    EXPECT_EQ(Reload(), legacyRecords);
+}
+
+/*
+ * Feature: MissionJournal
+ * Function: Discard
+ * SubFunction: NA
+ * FunctionPoints: A discarded journal writes nothing.
+ * EnvConditions: NA
+ * CaseDescription: Discard pending updates, later updates are not written either.
+ */
+HWTEST_F(MissionJournalTest, Discard_0100, TestSize.Level1)
+{
+    MissionJournal journal(TEST_DIR);
+    journal.Put(1, MISSION_DATA_1);
+    journal.Discard();
+    journal.Put(2, MISSION_DATA_2);
+    EXPECT_FALSE(journal.HasPending());
+    EXPECT_TRUE(journal.Flush());
+    EXPECT_FALSE(journal.Exists());
+}
+}  // namespace AAFwk
+}  // namespace OHOS
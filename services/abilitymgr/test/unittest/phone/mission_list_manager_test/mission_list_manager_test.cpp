@@ -17,6 +17,7 @@
 #define private public
 #define protected public
 #include "ability_info.h"
+#include "ability_token_index.h"
 #include "mission.h"
 #include "mission_list_manager.h"
 #undef private
@@ -245,5 +246,37 @@ HWTEST_F(MissionListManagerTest, OnAcceptWantResponse_002, TestSize.Level1)
     EXPECT_EQ(ability->IsNewWant(), false);
     missionListManager.reset();
 }
+
+/*
+ * Feature: MissionListManager
+ * Function: GetAbilityRecordByToken
+ * SubFunction: NA
+ * FunctionPoints: MissionListManager GetAbilityRecordByToken
+ * EnvConditions: NA
+ * CaseDescription: Verify a record still indexed is not found by its token once it leaves the mission lists
+ */
+HWTEST_F(MissionListManagerTest, GetAbilityRecordByToken_001, TestSize.Level1)
+{
+    int userId = 0;
+    auto missionListManager = std::make_shared<MissionListManager>(userId);
+    missionListManager->Init();
+
+    AppExecFwk::AbilityInfo abilityInfo;
+    Want want;
+    AppExecFwk::ApplicationInfo applicationInfo;
+    auto ability = std::make_shared<AbilityRecord>(want, abilityInfo, applicationInfo);
+    ability->Init();
+    auto mission = std::make_shared<Mission>(11, ability, "missionName");
+    ability->SetMission(mission);
+    missionListManager->launcherList_->AddMissionToTop(mission);
+    DelayedSingleton<AbilityTokenIndex>::GetInstance()->Add(
+        ability, AbilityTokenOwnerType::MISSION_LIST, missionListManager.get(), userId);
+    auto token = ability->GetToken();
+    EXPECT_EQ(ability, missionListManager->GetAbilityRecordByToken(token));
+
+    missionListManager->launcherList_->RemoveMissionByAbilityRecord(ability);
+    EXPECT_EQ(nullptr, missionListManager->GetAbilityRecordByToken(token));
+    missionListManager.reset();
+}
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -193,5 +193,38 @@ HWTEST_F(PendingWantKeyTest, SetUserId_0100, TestSize.Level1)
     amsPendingWantKey->SetUserId(PENDING_WANT_USERID);
     EXPECT_EQ(PENDING_WANT_USERID, amsPendingWantKey->GetUserId());
 }
+
+/*
+ * @tc.number    : GetHashCode_0100
+ * @tc.name      : get HashCode
+ * @tc.desc      : Keys of the same content have the same HashCode, and a setter refreshes the HashCode
+ */
+HWTEST_F(PendingWantKeyTest, GetHashCode_0100, TestSize.Level1)
+{
+    Want want;
+    ElementName element("device", "bundleName", "abilityName");
+    want.SetElement(element);
+    std::unique_ptr<PendingWantKey> amsPendingWantKey = std::make_unique<PendingWantKey>();
+    amsPendingWantKey->SetBundleName(PENDING_WANT_BUNDLENAME);
+    amsPendingWantKey->SetRequestWant(want);
+    std::unique_ptr<PendingWantKey> otherPendingWantKey = std::make_unique<PendingWantKey>();
+    otherPendingWantKey->SetBundleName(PENDING_WANT_BUNDLENAME);
+    otherPendingWantKey->SetRequestWant(want);
+    EXPECT_EQ(amsPendingWantKey->GetHashCode(), otherPendingWantKey->GetHashCode());
+
+    // the code is not part of the key content
+    otherPendingWantKey->SetCode(PENDING_WANT_CODE);
+    EXPECT_EQ(amsPendingWantKey->GetHashCode(), otherPendingWantKey->GetHashCode());
+
+    otherPendingWantKey->SetUserId(PENDING_WANT_USERID);
+    EXPECT_NE(amsPendingWantKey->GetHashCode(), otherPendingWantKey->GetHashCode());
+    otherPendingWantKey->SetUserId(amsPendingWantKey->GetUserId());
+    EXPECT_EQ(amsPendingWantKey->GetHashCode(), otherPendingWantKey->GetHashCode());
+
+    want.SetAction("action.system.home");
+    otherPendingWantKey->SetRequestWant(want);
+    EXPECT_EQ(otherPendingWantKey->GetRequestWantString(), want.ToString());
+    EXPECT_NE(amsPendingWantKey->GetHashCode(), otherPendingWantKey->GetHashCode());
+}
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
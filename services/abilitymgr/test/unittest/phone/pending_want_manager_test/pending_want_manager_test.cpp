@@ -1053,5 +1053,58 @@ HWTEST_F(PendingWantManagerTest, PendingWantManagerTest_4100, TestSize.Level1)
         nullptr, -1, callerUid);
     EXPECT_NE(ERR_OK, result);
 }
+
+/*
+ * @tc.number    : PendingWantManagerTest_4200
+ * @tc.name      : PendingWantManager GetPendingWantRecordByKey
+ * @tc.desc      : 1.GetPendingWantRecordByKey finds the record again after its want is updated
+ */
+HWTEST_F(PendingWantManagerTest, PendingWantManagerTest_4200, TestSize.Level1)
+{
+    Want want;
+    ElementName element("device", "bundleName", "abilityName");
+    want.SetElement(element);
+    WantSenderInfo wantSenderInfo = MakeWantSenderInfo(want, 0, 0);
+    pendingManager_ = std::make_shared<PendingWantManager>();
+    EXPECT_NE(pendingManager_, nullptr);
+    auto pendingRecord = iface_cast<PendingWantRecord>(
+        pendingManager_->GetWantSenderLocked(1, 1, wantSenderInfo.userId, wantSenderInfo, nullptr)->AsObject());
+    EXPECT_NE(pendingRecord, nullptr);
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByCode(pendingRecord->GetKey()->GetCode()), pendingRecord);
+
+    // the update keeps the record but changes the extras of its want
+    want.SetParam("key", std::string("value"));
+    WantSenderInfo wantSenderInfo1 = MakeWantSenderInfo(want, static_cast<int32_t>(Flags::UPDATE_PRESENT_FLAG), 0);
+    auto pendingRecord1 = iface_cast<PendingWantRecord>(
+        pendingManager_->GetWantSenderLocked(1, 1, wantSenderInfo1.userId, wantSenderInfo1, nullptr)->AsObject());
+    EXPECT_EQ(pendingRecord1, pendingRecord);
+    EXPECT_EQ((int)pendingManager_->wantRecords_.size(), 1);
+    EXPECT_EQ((int)pendingManager_->wantRecordsByHash_.size(), 1);
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByKey(MakeWantKey(wantSenderInfo1)), pendingRecord);
+}
+
+/*
+ * @tc.number    : PendingWantManagerTest_4300
+ * @tc.name      : PendingWantManager CancelWantSenderLocked
+ * @tc.desc      : 1.CancelWantSenderLocked removes the record from every index
+ */
+HWTEST_F(PendingWantManagerTest, PendingWantManagerTest_4300, TestSize.Level1)
+{
+    Want want;
+    ElementName element("device", "bundleName", "abilityName");
+    want.SetElement(element);
+    WantSenderInfo wantSenderInfo = MakeWantSenderInfo(want, 0, 0);
+    pendingManager_ = std::make_shared<PendingWantManager>();
+    EXPECT_NE(pendingManager_, nullptr);
+    auto pendingRecord = iface_cast<PendingWantRecord>(
+        pendingManager_->GetWantSenderLocked(1, 1, wantSenderInfo.userId, wantSenderInfo, nullptr)->AsObject());
+    EXPECT_NE(pendingRecord, nullptr);
+    int32_t code = pendingRecord->GetKey()->GetCode();
+    pendingManager_->CancelWantSenderLocked(*pendingRecord, true);
+    EXPECT_EQ((int)pendingManager_->wantRecords_.size(), 0);
+    EXPECT_EQ((int)pendingManager_->wantRecordsByHash_.size(), 0);
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByCode(code), nullptr);
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByKey(MakeWantKey(wantSenderInfo)), nullptr);
+}
 }  // namespace AAFwk
 }  // namespace OHOS
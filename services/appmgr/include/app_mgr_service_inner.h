@@ -16,10 +16,11 @@
 #ifndef FOUNDATION_APPEXECFWK_SERVICES_APPMGR_INCLUDE_APP_MGR_SERVICE_INNER_H
 #define FOUNDATION_APPEXECFWK_SERVICES_APPMGR_INCLUDE_APP_MGR_SERVICE_INNER_H
 
+#include <deque>
 #include <list>
 #include <map>
+#include <mutex>
 #include <vector>
-#include <regex>
 
 #include "iremote_object.h"
 #include "refbase.h"
@@ -435,6 +436,9 @@ public:
      */
     void LoadResidentProcess(const std::vector<BundleInfo> &infos);
 
+    /**
+     * Queue the resident processes to spawn, and spawn the first of them unless a spawn task is already posted.
+     */
     void StartResidentProcess(const std::vector<BundleInfo> &infos,  int restartCount);
 
     bool CheckRemoteClient();
@@ -512,7 +516,59 @@ public:
     void ClearAppRunningData(const std::shared_ptr<AppRunningRecord> &appRecord, bool containsApp);
 private:
 
-    void StartEmptyResidentProcess(const BundleInfo &info, const std::string &processName, int restartCount);
+    /**
+     * Create the record of a resident process, its process is spawned later together with the others.
+     *
+     * @param info, the bundle information.
+     * @param processName, the process name.
+     * @param startMsg, request message to appspawn.
+     *
+     * @return the record created, nullptr if failed.
+     */
+    std::shared_ptr<AppRunningRecord> PrepareResidentProcess(
+        const BundleInfo &info, const std::string &processName, AppSpawnStartMsg &startMsg);
+
+    // a resident process whose record is created and whose spawn is queued
+    struct ResidentProcessSpawn {
+        BundleInfo bundleInfo;
+        std::shared_ptr<AppRunningRecord> appRecord;
+        AppSpawnStartMsg startMsg;
+        int restartCount = -1;
+    };
+
+    /**
+     * Create the records of the resident processes not running yet, and queue their spawn.
+     *
+     * @param infos, the bundle information.
+     * @param restartCount, the restart count of the processes.
+     */
+    void QueueResidentProcesses(const std::vector<BundleInfo> &infos, int restartCount);
+
+    /**
+     * Send a chunk of the queued resident processes to appspawn in one batch. The handler runs other tasks until
+     * the results are posted back to it.
+     */
+    void SpawnResidentProcesses();
+
+    /**
+     * Finish the records of a spawned chunk of resident processes, and post the task spawning the next chunk.
+     *
+     * @param spawns, the resident processes of the chunk.
+     * @param results, error code and pid of each process, in the order of spawns.
+     */
+    void OnResidentProcessesSpawned(
+        const std::vector<ResidentProcessSpawn> &spawns, const std::vector<AppSpawnResult> &results);
+
+    /**
+     * Post the task spawning the queued resident processes, unless it is posted or a chunk is spawning already.
+     */
+    void PostSpawnResidentProcesses();
+
+    /**
+     * Mark the record of a spawned resident process as keep alive.
+     */
+    void FinishResidentProcess(const BundleInfo &info, const std::shared_ptr<AppRunningRecord> &appRecord,
+        int restartCount);
 
     void RestartResidentProcess(std::shared_ptr<AppRunningRecord> appRecord);
 
@@ -553,6 +609,34 @@ private:
     void StartProcess(const std::string &appName, const std::string &processName, uint32_t startFlags,
         const std::shared_ptr<AppRunningRecord> &appRecord, const int uid, const std::string &bundleName);
 
+    /**
+     * CreateStartMsg, create the request message to appspawn of a process.
+     *
+     * @param processName, the process name.
+     * @param startFlags, the start flags of the process.
+     * @param uid, the process uid.
+     * @param bundleName, the app bundleName.
+     * @param startMsg, request message to appspawn.
+     *
+     * @return true if created.
+     */
+    bool CreateStartMsg(const std::string &processName, uint32_t startFlags, const int uid,
+        const std::string &bundleName, AppSpawnStartMsg &startMsg);
+
+    /**
+     * OnProcessSpawned, update the record with the result of appspawn.
+     *
+     * @param appName, the app name.
+     * @param appRecord, the app information.
+     * @param startMsg, request message to appspawn.
+     * @param errCode, result of appspawn.
+     * @param pid, pid of the new process.
+     *
+     * @return true if the process is spawned.
+     */
+    bool OnProcessSpawned(const std::string &appName, const std::shared_ptr<AppRunningRecord> &appRecord,
+        const AppSpawnStartMsg &startMsg, ErrCode errCode, pid_t pid);
+
     /**
      * PushAppFront, Adjust the latest application record to the top level.
      *
@@ -663,8 +747,6 @@ private:
 
     void HandleAddAbilityStageTimeOut(const int64_t eventId);
 
-    void ClipStringContent(const std::regex &re, const std::string &sorce, std::string &afferCutStr);
-
     bool GetBundleAndHapInfo(const AbilityInfo &abilityInfo, const std::shared_ptr<ApplicationInfo> &appInfo,
         BundleInfo &bundleInfo, HapModuleInfo &hapModuleInfo);
     AppProcessData WrapAppProcessData(const std::shared_ptr<AppRunningRecord> &appRecord,
@@ -749,6 +831,8 @@ private:
     int FinishUserTestLocked(
         const std::string &msg, const int64_t &resultCode, const std::shared_ptr<AppRunningRecord> &appRecord);
     const std::string TASK_ON_CALLBACK_DIED = "OnCallbackDiedTask";
+    const std::string TASK_SPAWN_RESIDENT_PROCESSES = "SpawnResidentProcessesTask";
+    const std::string TASK_RESIDENT_PROCESSES_SPAWNED = "ResidentProcessesSpawnedTask";
     std::vector<sptr<IApplicationStateObserver>> appStateObservers_;
     std::map<sptr<IRemoteObject>, sptr<IRemoteObject::DeathRecipient>> recipientMap_;
     std::recursive_mutex observerLock_;
@@ -760,6 +844,10 @@ private:
     std::shared_ptr<Configuration> configuration_;
     std::mutex userTestLock_;
     sptr<IStartSpecifiedAbilityResponse> startSpecifiedAbilityResponse_;
+    std::mutex residentSpawnLock_;
+    std::deque<ResidentProcessSpawn> residentSpawnQueue_;
+    // a spawn task is posted, or a chunk is being spawned
+    bool isResidentSpawnBusy_ = false;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
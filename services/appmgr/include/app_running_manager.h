@@ -18,7 +18,8 @@
 
 #include <map>
 #include <mutex>
-#include <regex>
+#include <set>
+#include <unordered_map>
 
 #include "iremote_object.h"
 #include "refbase.h"
@@ -145,7 +146,6 @@ public:
 
     void GetRunningProcessInfoByToken(const sptr<IRemoteObject> &token, AppExecFwk::RunningProcessInfo &info);
 
-    void ClipStringContent(const std::regex &re, const std::string &sorce, std::string &afferCutStr);
     void HandleAddAbilityStageTimeOut(const int64_t eventId);
     void HandleStartSpecifiedAbilityTimeOut(const int64_t eventId);
     std::shared_ptr<AppRunningRecord> GetAppRunningRecordByRenderPid(const pid_t pid);
@@ -153,8 +153,26 @@ public:
 private:
     std::shared_ptr<AbilityRunningRecord> GetAbilityRunningRecord(const int64_t eventId);
 
+    /**
+     * Get the records of the ids in a bucket of an index, in the order of the ids like the record map.
+     */
+    std::vector<std::shared_ptr<AppRunningRecord>> GetAppRunningRecordsByIds(const std::set<int32_t> &recordIds);
+
+    void AddAppRunningRecordIndex(const std::shared_ptr<AppRunningRecord> &appRecord);
+    void RemoveAppRunningRecordIndex(const std::shared_ptr<AppRunningRecord> &appRecord);
+    void ClearAppRunningRecordIndex();
+
 private:
     std::map<const int32_t, const std::shared_ptr<AppRunningRecord>> appRunningRecordMap_;
+    // indexes of the record map by what never changes after a record is created
+    std::unordered_map<std::string, std::set<int32_t>> processNameIndex_;
+    std::unordered_map<std::string, std::set<int32_t>> bundleNameIndex_;
+    std::unordered_map<int32_t, std::set<int32_t>> userIdIndex_;
+    // a process of a joint user id runs other bundles than its own, so these are looked at for any bundle
+    std::set<int32_t> jointRecordIds_;
+    // pid and abilities are set on the record itself, so a hit is checked and a miss looks at all the records
+    std::unordered_map<pid_t, int32_t> pidIndex_;
+    std::unordered_map<IRemoteObject *, int32_t> abilityTokenIndex_;
     std::map<const std::string, int> processRestartRecord_;
     std::recursive_mutex lock_;
 };
@@ -16,16 +16,29 @@
 #ifndef FOUNDATION_APPEXECFWK_SERVICES_APPMGR_INCLUDE_APP_SPAWN_CLIENT_H
 #define FOUNDATION_APPEXECFWK_SERVICES_APPMGR_INCLUDE_APP_SPAWN_CLIENT_H
 
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "nocopyable.h"
 #include "app_spawn_msg_wrapper.h"
 #include "app_spawn_socket.h"
+#include "thread_pool.h"
 
 namespace OHOS {
 namespace AppExecFwk {
 enum class SpawnConnectionState { STATE_NOT_CONNECT, STATE_CONNECTED, STATE_CONNECT_FAILED };
 
+struct AppSpawnResult {
+    ErrCode errCode = ERR_OK;
+    pid_t pid = 0;
+};
+
 class AppSpawnClient {
 public:
+    using StartProcessesCallback = std::function<void(const std::vector<AppSpawnResult> &results)>;
+
     /**
      * Constructor.
      */
@@ -34,7 +47,7 @@ public:
     /**
      * Destructor
      */
-    virtual ~AppSpawnClient() = default;
+    virtual ~AppSpawnClient();
 
     /**
      * Disable copy.
@@ -59,6 +72,25 @@ public:
      */
     virtual ErrCode StartProcess(const AppSpawnStartMsg &startMsg, pid_t &pid);
 
+    /**
+     * Start several requests to appspawn at once, each on a connection of its own, and wait for all of them.
+     *
+     * @param startMsgs, request messages.
+     * @param results, error code and pid of each request, in the order of startMsgs.
+     */
+    void StartProcesses(const std::vector<AppSpawnStartMsg> &startMsgs, std::vector<AppSpawnResult> &results);
+
+    /**
+     * Start several requests to appspawn at once on the spawn workers, each on a connection of its own.
+     * Without the function creating the connections, the requests are sent one by one in the call itself.
+     *
+     * @param startMsgs, request messages.
+     * @param callback, called with the error code and pid of each request, in the order of startMsgs, once all
+     * of them are answered. It runs on a spawn worker, or in the call itself.
+     */
+    virtual void StartProcessesAsync(
+        const std::vector<AppSpawnStartMsg> &startMsgs, const StartProcessesCallback &callback);
+
     /**
      * Get render process termination status.
      *
@@ -77,6 +109,12 @@ public:
      */
     void SetSocket(const std::shared_ptr<AppSpawnSocket> socket);
 
+    /**
+     * Set the function creating the connection of each request of StartProcesses, unit test also use it.
+     * Without it, the requests are sent one by one through StartProcess.
+     */
+    void SetSocketCreator(const std::function<std::shared_ptr<AppSpawnSocket>()> &socketCreator);
+
 private:
     /**
      * AppSpawnClient core function,
@@ -86,9 +124,41 @@ private:
      */
     ErrCode StartProcessImpl(const AppSpawnStartMsg &startMsg, pid_t &pid);
 
+    /**
+     * Open the connection, retried with an exponential backoff.
+     *
+     * @param socket, connection to appspawn.
+     */
+    ErrCode OpenConnectionWithRetry(const std::shared_ptr<AppSpawnSocket> &socket);
+
+    /**
+     * Send the request on an opened connection and read the pid of the app process.
+     *
+     * @param socket, connection to appspawn.
+     * @param startMsg, request message.
+     * @param pid, pid of app process, get it from appspawn.
+     */
+    ErrCode SendStartMsg(const std::shared_ptr<AppSpawnSocket> &socket, const AppSpawnStartMsg &startMsg, pid_t &pid);
+
+    /**
+     * Start one request of StartProcesses on a new connection, retried like StartProcess.
+     *
+     * @param startMsg, request message.
+     */
+    AppSpawnResult StartProcessOnNewConnection(const AppSpawnStartMsg &startMsg);
+
+    /**
+     * Start the spawn workers, unless they are started already.
+     */
+    void CreateSpawnExecutor();
+
 private:
     std::shared_ptr<AppSpawnSocket> socket_;
+    std::function<std::shared_ptr<AppSpawnSocket>()> socketCreator_;
     SpawnConnectionState state_ = SpawnConnectionState::STATE_NOT_CONNECT;
+    std::mutex executorLock_;
+    // the workers sending the requests of StartProcessesAsync, as many as appspawn is sent at once
+    std::unique_ptr<ThreadPool> spawnExecutor_;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -15,9 +15,11 @@
 
 #include "app_mgr_service_inner.h"
 
+#include <algorithm>
 #include <csignal>
 #include <securec.h>
 #include <sys/stat.h>
+#include <thread>
 #include <unistd.h>
 
 #include "accesstoken_kit.h"
@@ -68,6 +70,8 @@ const std::string SO_PATH = "system/lib64/libmapleappkit.z.so";
 const std::string RENDER_PARAM = "invalidparam";
 const int32_t SIGNAL_KILL = 9;
 constexpr int32_t USER_SCALE = 200000;
+// resident processes spawned by one task of the handler, as many as appspawn is sent at once
+constexpr size_t RESIDENT_SPAWN_CHUNK_SIZE = 4;
 #define ENUM_TO_STRING(s) #s
 
 constexpr int32_t BASE_USER_RANGE = 200000;
@@ -1238,21 +1242,35 @@ void AppMgrServiceInner::StartProcess(const std::string &appName, const std::str
         return;
     }
 
+    AppSpawnStartMsg startMsg;
+    if (!CreateStartMsg(processName, startFlags, uid, bundleName, startMsg)) {
+        return;
+    }
+
+    PerfProfile::GetInstance().SetAppForkStartTime(GetTickCount());
+    pid_t pid = 0;
+    ErrCode errCode = remoteClientManager_->GetSpawnClient()->StartProcess(startMsg, pid);
+    if (OnProcessSpawned(appName, appRecord, startMsg, errCode, pid)) {
+        PerfProfile::GetInstance().SetAppForkEndTime(GetTickCount());
+    }
+}
+
+bool AppMgrServiceInner::CreateStartMsg(const std::string &processName, uint32_t startFlags, const int uid,
+    const std::string &bundleName, AppSpawnStartMsg &startMsg)
+{
     auto bundleMgr_ = remoteClientManager_->GetBundleManager();
     if (bundleMgr_ == nullptr) {
         HILOG_ERROR("GetBundleManager fail");
-        return;
+        return false;
     }
 
     auto userId = GetUserIdByUid(uid);
-    AppSpawnStartMsg startMsg;
-    BundleInfo bundleInfo;
     std::vector<AppExecFwk::BundleInfo> bundleInfos;
     bool bundleMgrResult = IN_PROCESS_CALL(bundleMgr_->GetBundleInfos(AppExecFwk::BundleFlag::GET_BUNDLE_WITH_ABILITIES,
         bundleInfos, userId));
     if (!bundleMgrResult) {
         HILOG_ERROR("GetBundleInfo is fail");
-        return;
+        return false;
     }
 
     auto isExist = [&bundleName, &uid](const AppExecFwk::BundleInfo &bundleInfo) {
@@ -1261,7 +1279,7 @@ void AppMgrServiceInner::StartProcess(const std::string &appName, const std::str
     auto bundleInfoIter = std::find_if(bundleInfos.begin(), bundleInfos.end(), isExist);
     if (bundleInfoIter == bundleInfos.end()) {
         HILOG_ERROR("Get target fail.");
-        return;
+        return false;
     }
     startMsg.uid = (*bundleInfoIter).uid;
     startMsg.gid = (*bundleInfoIter).gid;
@@ -1276,19 +1294,22 @@ void AppMgrServiceInner::StartProcess(const std::string &appName, const std::str
     bundleMgrResult = IN_PROCESS_CALL(bundleMgr_->GetBundleGidsByUid(bundleName, uid, startMsg.gids));
     if (!bundleMgrResult) {
         HILOG_ERROR("GetBundleGids is fail");
-        return;
+        return false;
     }
     startMsg.procName = processName;
     startMsg.soPath = SO_PATH;
+    return true;
+}
 
-    PerfProfile::GetInstance().SetAppForkStartTime(GetTickCount());
-    pid_t pid = 0;
-    ErrCode errCode = remoteClientManager_->GetSpawnClient()->StartProcess(startMsg, pid);
+bool AppMgrServiceInner::OnProcessSpawned(const std::string &appName,
+    const std::shared_ptr<AppRunningRecord> &appRecord, const AppSpawnStartMsg &startMsg, ErrCode errCode, pid_t pid)
+{
     if (FAILED(errCode)) {
         HILOG_ERROR("failed to spawn new app process, errCode %{public}08x", errCode);
         appRunningManager_->RemoveAppRunningRecordById(appRecord->GetRecordId());
-        return;
+        return false;
     }
+    auto &processName = startMsg.procName;
     HILOG_INFO("Start process success, pid is %{public}d, processName is %{public}s.", pid, processName.c_str());
     appRecord->GetPriorityObject()->SetPid(pid);
     appRecord->SetUid(startMsg.uid);
@@ -1297,7 +1318,7 @@ void AppMgrServiceInner::StartProcess(const std::string &appName, const std::str
     OnAppStateChanged(appRecord, ApplicationState::APP_STATE_CREATE);
     AddAppToRecentList(appName, appRecord->GetProcessName(), pid, appRecord->GetRecordId());
     OnProcessCreated(appRecord);
-    PerfProfile::GetInstance().SetAppForkEndTime(GetTickCount());
+    return true;
 }
 
 void AppMgrServiceInner::RemoveAppFromRecentList(const std::string &appName, const std::string &processName)
@@ -1602,6 +1623,24 @@ void AppMgrServiceInner::StartResidentProcess(const std::vector<BundleInfo> &inf
         return;
     }
 
+    if (!CheckRemoteClient()) {
+        HILOG_INFO("Failed to start resident process!");
+        return;
+    }
+
+    QueueResidentProcesses(infos, restartCount);
+    {
+        // a posted task, or the end of the chunk being spawned, spawns the queue in order
+        std::lock_guard<std::mutex> lock(residentSpawnLock_);
+        if (isResidentSpawnBusy_) {
+            return;
+        }
+    }
+    SpawnResidentProcesses();
+}
+
+void AppMgrServiceInner::QueueResidentProcesses(const std::vector<BundleInfo> &infos, int restartCount)
+{
     for (auto &bundle : infos) {
         auto processName = bundle.applicationInfo.process.empty() ?
             bundle.applicationInfo.bundleName : bundle.applicationInfo.process;
@@ -1614,52 +1653,152 @@ void AppMgrServiceInner::StartResidentProcess(const std::vector<BundleInfo> &inf
             HILOG_INFO("processName [%{public}s] Already exists ", processName.c_str());
             continue;
         }
-        StartEmptyResidentProcess(bundle, processName, restartCount);
+        ResidentProcessSpawn spawn;
+        spawn.appRecord = PrepareResidentProcess(bundle, processName, spawn.startMsg);
+        if (!spawn.appRecord) {
+            continue;
+        }
+        spawn.bundleInfo = bundle;
+        spawn.restartCount = restartCount;
+        std::lock_guard<std::mutex> lock(residentSpawnLock_);
+        residentSpawnQueue_.emplace_back(std::move(spawn));
     }
 }
 
-void AppMgrServiceInner::StartEmptyResidentProcess(
-    const BundleInfo &info, const std::string &processName, int restartCount)
+void AppMgrServiceInner::SpawnResidentProcesses()
 {
-    HILOG_INFO("start bundle [%{public}s | processName [%{public}s]]", info.name.c_str(), processName.c_str());
-    if (!CheckRemoteClient() || !appRunningManager_) {
-        HILOG_INFO("Failed to start resident process!");
+    auto spawns = std::make_shared<std::vector<ResidentProcessSpawn>>();
+    {
+        std::lock_guard<std::mutex> lock(residentSpawnLock_);
+        // without a handler to post the rest to, the whole queue is spawned at once
+        size_t count = eventHandler_ ?
+            std::min(residentSpawnQueue_.size(), RESIDENT_SPAWN_CHUNK_SIZE) : residentSpawnQueue_.size();
+        for (size_t i = 0; i < count; i++) {
+            spawns->emplace_back(std::move(residentSpawnQueue_.front()));
+            residentSpawnQueue_.pop_front();
+        }
+        // the rest of the queue waits for the results of the chunk
+        isResidentSpawnBusy_ = !spawns->empty();
+    }
+    if (spawns->empty()) {
         return;
     }
 
+    // resident processes are spawned together, instead of waiting for appspawn one by one
+    std::vector<AppSpawnStartMsg> startMsgs;
+    for (const auto &spawn : *spawns) {
+        startMsgs.push_back(spawn.startMsg);
+    }
+    auto callerThread = std::this_thread::get_id();
+    auto onSpawned = [innerService = shared_from_this(), spawns, callerThread](
+        const std::vector<AppSpawnResult> &results) {
+        // answered in the call itself, or else on a spawn worker, the records are only updated on the handler
+        if (std::this_thread::get_id() == callerThread || !innerService->eventHandler_) {
+            innerService->OnResidentProcessesSpawned(*spawns, results);
+            return;
+        }
+        auto spawnedTask = [innerService, spawns, results]() {
+            innerService->OnResidentProcessesSpawned(*spawns, results);
+        };
+        innerService->eventHandler_->PostTask(spawnedTask, innerService->TASK_RESIDENT_PROCESSES_SPAWNED);
+    };
+    PerfProfile::GetInstance().SetAppForkStartTime(GetTickCount());
+    remoteClientManager_->GetSpawnClient()->StartProcessesAsync(startMsgs, onSpawned);
+}
+
+void AppMgrServiceInner::OnResidentProcessesSpawned(
+    const std::vector<ResidentProcessSpawn> &spawns, const std::vector<AppSpawnResult> &results)
+{
+    bool isSpawned = false;
+    for (size_t i = 0; i < spawns.size(); i++) {
+        auto &appRecord = spawns[i].appRecord;
+        auto &startMsg = spawns[i].startMsg;
+        bool isResult = i < results.size();
+        if (!GetAppRunningRecordByAppRecordId(appRecord->GetRecordId())) {
+            HILOG_WARN("process [%{public}s] is removed while spawning", startMsg.procName.c_str());
+            if (isResult && SUCCEEDED(results[i].errCode)) {
+                KillProcessByPid(results[i].pid);
+            }
+            continue;
+        }
+        if (!isResult ||
+            !OnProcessSpawned(appRecord->GetName(), appRecord, startMsg, results[i].errCode, results[i].pid)) {
+            HILOG_ERROR("start process [%{public}s] failed!", startMsg.procName.c_str());
+            continue;
+        }
+        isSpawned = true;
+        FinishResidentProcess(spawns[i].bundleInfo, appRecord, spawns[i].restartCount);
+    }
+    if (isSpawned) {
+        PerfProfile::GetInstance().SetAppForkEndTime(GetTickCount());
+    }
+    {
+        std::lock_guard<std::mutex> lock(residentSpawnLock_);
+        isResidentSpawnBusy_ = false;
+    }
+    PostSpawnResidentProcesses();
+}
+
+void AppMgrServiceInner::PostSpawnResidentProcesses()
+{
+    {
+        std::lock_guard<std::mutex> lock(residentSpawnLock_);
+        if (residentSpawnQueue_.empty() || isResidentSpawnBusy_) {
+            return;
+        }
+        if (eventHandler_) {
+            isResidentSpawnBusy_ = true;
+        }
+    }
+    if (!eventHandler_) {
+        SpawnResidentProcesses();
+        return;
+    }
+    auto spawnTask = [innerService = shared_from_this()]() { innerService->SpawnResidentProcesses(); };
+    eventHandler_->PostTask(spawnTask, TASK_SPAWN_RESIDENT_PROCESSES);
+}
+
+std::shared_ptr<AppRunningRecord> AppMgrServiceInner::PrepareResidentProcess(
+    const BundleInfo &info, const std::string &processName, AppSpawnStartMsg &startMsg)
+{
+    HILOG_INFO("start bundle [%{public}s | processName [%{public}s]]", info.name.c_str(), processName.c_str());
     auto appInfo = std::make_shared<ApplicationInfo>(info.applicationInfo);
     auto appRecord = appRunningManager_->CreateAppRunningRecord(appInfo, processName, info);
     if (!appRecord) {
         HILOG_ERROR("start process [%{public}s] failed!", processName.c_str());
-        return;
+        return nullptr;
     }
 
-    StartProcess(appInfo->name, processName, 0, appRecord, appInfo->uid, appInfo->bundleName);
-
-    // If it is empty, the startup failed
-    if (!appRecord) {
+    if (!CreateStartMsg(processName, 0, appInfo->uid, appInfo->bundleName, startMsg)) {
         HILOG_ERROR("start process [%{public}s] failed!", processName.c_str());
-        return;
+        appRunningManager_->RemoveAppRunningRecordById(appRecord->GetRecordId());
+        return nullptr;
     }
+    return appRecord;
+}
 
+void AppMgrServiceInner::FinishResidentProcess(const BundleInfo &info,
+    const std::shared_ptr<AppRunningRecord> &appRecord, int restartCount)
+{
+    auto appInfo = std::make_shared<ApplicationInfo>(info.applicationInfo);
     bool isStageBased = false;
     bool moduelJson = false;
     if (!info.hapModuleInfos.empty()) {
         isStageBased = info.hapModuleInfos.back().isStageBasedModel;
         moduelJson = info.hapModuleInfos.back().isModuleJson;
     }
-    HILOG_INFO("StartEmptyResidentProcess stage:%{public}d moduel:%{public}d size:%{public}d",
+    HILOG_INFO("FinishResidentProcess stage:%{public}d moduel:%{public}d size:%{public}d",
         isStageBased, moduelJson, (int32_t)info.hapModuleInfos.size());
     appRecord->SetKeepAliveAppState(true, isStageBased);
 
     if (restartCount > 0) {
-        HILOG_INFO("StartEmptyResidentProcess restartCount : [%{public}d], ", restartCount);
+        HILOG_INFO("FinishResidentProcess restartCount : [%{public}d], ", restartCount);
         appRecord->SetRestartResidentProcCount(restartCount);
     }
 
     appRecord->SetEventHandler(eventHandler_);
     appRecord->AddModules(appInfo, info.hapModuleInfos);
-    HILOG_INFO("StartEmptyResidentProcess oK pid : [%{public}d], ", appRecord->GetPriorityObject()->GetPid());
+    HILOG_INFO("FinishResidentProcess oK pid : [%{public}d], ", appRecord->GetPriorityObject()->GetPid());
 }
 
 bool AppMgrServiceInner::CheckRemoteClient()
@@ -1701,7 +1840,9 @@ void AppMgrServiceInner::RestartResidentProcess(std::shared_ptr<AppRunningRecord
     infos.emplace_back(bundleInfo);
     HILOG_INFO("the resident process [%{public}s] remaining restarts num is [%{public}d]",
         appRecord->GetProcessName().c_str(), (int)appRecord->GetRestartResidentProcCount());
-    StartResidentProcess(infos, appRecord->GetRestartResidentProcCount());
+    // restarted by the spawn task, with the other processes died and queued in the meantime
+    QueueResidentProcesses(infos, appRecord->GetRestartResidentProcCount());
+    PostSpawnResidentProcesses();
 }
 
 void AppMgrServiceInner::NotifyAppStatus(const std::string &bundleName, const std::string &eventData)
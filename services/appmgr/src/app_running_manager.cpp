@@ -36,6 +36,54 @@ static void GetOsAccountIdFromUid(int uid, int &osAccountId)
 }
 }
 #endif // OS_ACCOUNT_PART_ENABLED
+namespace {
+int32_t GetUserIdOfUid(int32_t uid)
+{
+    int32_t userId = -1;
+#ifdef OS_ACCOUNT_PART_ENABLED
+    if (AccountSA::OsAccountManager::GetOsAccountLocalIdFromUid(uid, userId) != 0) {
+        return -1;
+    }
+#else // OS_ACCOUNT_PART_ENABLED
+    GetOsAccountIdFromUid(uid, userId);
+#endif // OS_ACCOUNT_PART_ENABLED
+    return userId;
+}
+
+bool IsSignCodeNameChar(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '.';
+}
+
+bool IsSignCodeSeparator(char c)
+{
+    return c == '-' || c == '_' || c == '#';
+}
+
+/**
+ * Clip the first match of "[a-zA-Z.]+[-_#]{1}" out of the app id, without building a regex on each call.
+ */
+std::string ClipSignCode(const std::string &appId)
+{
+    size_t begin = 0;
+    while (begin < appId.size()) {
+        if (!IsSignCodeNameChar(appId[begin])) {
+            begin++;
+            continue;
+        }
+        size_t end = begin;
+        while (end < appId.size() && IsSignCodeNameChar(appId[end])) {
+            end++;
+        }
+        if (end < appId.size() && IsSignCodeSeparator(appId[end])) {
+            return appId.substr(0, begin) + appId.substr(end + 1);
+        }
+        begin = end;
+    }
+    return "";
+}
+}  // namespace
+
 AppRunningManager::AppRunningManager()
 {}
 AppRunningManager::~AppRunningManager()
@@ -61,14 +109,11 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::CreateAppRunningRecord(
         return nullptr;
     }
 
-    std::regex rule("[a-zA-Z.]+[-_#]{1}");
-    std::string signCode;
-    ClipStringContent(rule, bundleInfo.appId, signCode);
-
     HILOG_INFO("Create AppRunningRecord, processName: %{public}s, recordId: %{public}d", processName.c_str(), recordId);
-    appRecord->SetSignCode(signCode);
+    appRecord->SetSignCode(ClipSignCode(bundleInfo.appId));
     appRecord->SetJointUserId(bundleInfo.jointUserId);
     appRunningRecordMap_.emplace(recordId, appRecord);
+    AddAppRunningRecordIndex(appRecord);
     return appRecord;
 }
 
@@ -79,26 +124,18 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::CheckAppRunningRecordIsExis
         appName.c_str(), processName.c_str(), uid);
     std::lock_guard<std::recursive_mutex> guard(lock_);
 
-    std::regex rule("[a-zA-Z.]+[-_#]{1}");
-    std::string signCode;
     auto jointUserId = bundleInfo.jointUserId;
     HILOG_INFO("jointUserId : %{public}s", jointUserId.c_str());
-    ClipStringContent(rule, bundleInfo.appId, signCode);
-
-    auto FindSameProcess = [signCode, processName, jointUserId](const auto &pair) {
-            return ((pair.second->GetSignCode() == signCode) &&
-                    (pair.second->GetProcessName() == processName) &&
-                    (pair.second->GetJointUserId() == jointUserId) &&
-                    !(pair.second->IsTerminating()) &&
-                    !(pair.second->IsKilling()));
-    };
+    auto indexIter = processNameIndex_.find(processName);
+    if (indexIter == processNameIndex_.end()) {
+        return nullptr;
+    }
+    auto appRecords = GetAppRunningRecordsByIds(indexIter->second);
 
     // If it is not empty, look for whether it can come in the same process
     if (jointUserId.empty()) {
-        for (const auto &item : appRunningRecordMap_) {
-            const auto &appRecord = item.second;
-            if (appRecord && appRecord->GetProcessName() == processName &&
-                !(appRecord->IsTerminating()) && !(appRecord->IsKilling())) {
+        for (const auto &appRecord : appRecords) {
+            if (appRecord && !(appRecord->IsTerminating()) && !(appRecord->IsKilling())) {
                 HILOG_INFO("appRecord->GetProcessName() : %{public}s", appRecord->GetProcessName().c_str());
                 auto appInfoList = appRecord->GetAppInfoList();
                 HILOG_INFO("appInfoList : %{public}zu", appInfoList.size());
@@ -115,26 +152,61 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::CheckAppRunningRecordIsExis
         return nullptr;
     }
 
-    auto iter = std::find_if(appRunningRecordMap_.begin(), appRunningRecordMap_.end(), FindSameProcess);
-    return ((iter == appRunningRecordMap_.end()) ? nullptr : iter->second);
+    auto signCode = ClipSignCode(bundleInfo.appId);
+    auto FindSameProcess = [&signCode, &jointUserId](const std::shared_ptr<AppRunningRecord> &appRecord) {
+            return ((appRecord->GetSignCode() == signCode) &&
+                    (appRecord->GetJointUserId() == jointUserId) &&
+                    !(appRecord->IsTerminating()) &&
+                    !(appRecord->IsKilling()));
+    };
+    auto iter = std::find_if(appRecords.begin(), appRecords.end(), FindSameProcess);
+    return ((iter == appRecords.end()) ? nullptr : *iter);
 }
 
 std::shared_ptr<AppRunningRecord> AppRunningManager::GetAppRunningRecordByPid(const pid_t pid)
 {
     std::lock_guard<std::recursive_mutex> guard(lock_);
-    auto iter = std::find_if(appRunningRecordMap_.begin(), appRunningRecordMap_.end(), [&pid](const auto &pair) {
-        return pair.second->GetPriorityObject()->GetPid() == pid;
-    });
-    return ((iter == appRunningRecordMap_.end()) ? nullptr : iter->second);
+    auto indexIter = pidIndex_.find(pid);
+    if (indexIter != pidIndex_.end()) {
+        auto iter = appRunningRecordMap_.find(indexIter->second);
+        if (iter != appRunningRecordMap_.end() && iter->second->GetPriorityObject()->GetPid() == pid) {
+            return iter->second;
+        }
+        pidIndex_.erase(indexIter);
+    }
+
+    // the pid is set after the record is created, so a miss walks the records and indexes only the one found
+    for (const auto &item : appRunningRecordMap_) {
+        if (item.second->GetPriorityObject()->GetPid() == pid) {
+            if (pid > 0) {
+                pidIndex_[pid] = item.first;
+            }
+            return item.second;
+        }
+    }
+    return nullptr;
 }
 
 std::shared_ptr<AppRunningRecord> AppRunningManager::GetAppRunningRecordByAbilityToken(
     const sptr<IRemoteObject> &abilityToken)
 {
     std::lock_guard<std::recursive_mutex> guard(lock_);
+    if (!abilityToken) {
+        return nullptr;
+    }
+    auto indexIter = abilityTokenIndex_.find(abilityToken.GetRefPtr());
+    if (indexIter != abilityTokenIndex_.end()) {
+        auto iter = appRunningRecordMap_.find(indexIter->second);
+        if (iter != appRunningRecordMap_.end() && iter->second->GetAbilityRunningRecordByToken(abilityToken)) {
+            return iter->second;
+        }
+        abilityTokenIndex_.erase(indexIter);
+    }
+
     for (const auto &item : appRunningRecordMap_) {
         const auto &appRecord = item.second;
         if (appRecord && appRecord->GetAbilityRunningRecordByToken(abilityToken)) {
+            abilityTokenIndex_.emplace(abilityToken.GetRefPtr(), item.first);
             return appRecord;
         }
     }
@@ -144,8 +216,12 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::GetAppRunningRecordByAbilit
 bool AppRunningManager::ProcessExitByBundleName(const std::string &bundleName, std::list<pid_t> &pids)
 {
     std::lock_guard<std::recursive_mutex> guard(lock_);
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
+    auto recordIds = jointRecordIds_;
+    auto indexIter = bundleNameIndex_.find(bundleName);
+    if (indexIter != bundleNameIndex_.end()) {
+        recordIds.insert(indexIter->second.begin(), indexIter->second.end());
+    }
+    for (const auto &appRecord : GetAppRunningRecordsByIds(recordIds)) {
         // condition [!appRecord->IsKeepAliveApp()] Is to not kill the resident process.
         // Before using this method, consider whether you need.
         if (appRecord && !appRecord->IsKeepAliveApp()) {
@@ -168,8 +244,11 @@ bool AppRunningManager::ProcessExitByBundleName(const std::string &bundleName, s
 bool AppRunningManager::GetPidsByUserId(int32_t userId, std::list<pid_t> &pids)
 {
     std::lock_guard<std::recursive_mutex> guard(lock_);
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
+    auto indexIter = userIdIndex_.find(userId);
+    if (indexIter == userIdIndex_.end()) {
+        return false;
+    }
+    for (const auto &appRecord : GetAppRunningRecordsByIds(indexIter->second)) {
         if (appRecord) {
             int32_t id = -1;
 #ifdef OS_ACCOUNT_PART_ENABLED
@@ -195,8 +274,12 @@ bool AppRunningManager::ProcessExitByBundleNameAndUid(
     const std::string &bundleName, const int uid, std::list<pid_t> &pids)
 {
     std::lock_guard<std::recursive_mutex> guard(lock_);
-    for (const auto &item : appRunningRecordMap_) {
-        const auto &appRecord = item.second;
+    auto recordIds = jointRecordIds_;
+    auto indexIter = bundleNameIndex_.find(bundleName);
+    if (indexIter != bundleNameIndex_.end()) {
+        recordIds.insert(indexIter->second.begin(), indexIter->second.end());
+    }
+    for (const auto &appRecord : GetAppRunningRecordsByIds(recordIds)) {
         if (appRecord) {
             auto appInfoList = appRecord->GetAppInfoList();
             auto isExist = [&bundleName, &uid](const std::shared_ptr<ApplicationInfo> &appInfo) {
@@ -242,6 +325,7 @@ std::shared_ptr<AppRunningRecord> AppRunningManager::OnRemoteDied(const wptr<IRe
     auto appRecord = iter->second;
     if (appRecord != nullptr) {
         appRecord->SetApplicationClient(nullptr);
+        RemoveAppRunningRecordIndex(appRecord);
     }
     appRunningRecordMap_.erase(iter);
     return appRecord;
@@ -256,13 +340,91 @@ const std::map<const int32_t, const std::shared_ptr<AppRunningRecord>> &AppRunni
 void AppRunningManager::RemoveAppRunningRecordById(const int32_t recordId)
 {
     std::lock_guard<std::recursive_mutex> guard(lock_);
-    appRunningRecordMap_.erase(recordId);
+    auto iter = appRunningRecordMap_.find(recordId);
+    if (iter == appRunningRecordMap_.end()) {
+        return;
+    }
+    RemoveAppRunningRecordIndex(iter->second);
+    appRunningRecordMap_.erase(iter);
 }
 
 void AppRunningManager::ClearAppRunningRecordMap()
 {
     std::lock_guard<std::recursive_mutex> guard(lock_);
     appRunningRecordMap_.clear();
+    ClearAppRunningRecordIndex();
+}
+
+std::vector<std::shared_ptr<AppRunningRecord>> AppRunningManager::GetAppRunningRecordsByIds(
+    const std::set<int32_t> &recordIds)
+{
+    std::vector<std::shared_ptr<AppRunningRecord>> appRecords;
+    for (auto recordId : recordIds) {
+        auto iter = appRunningRecordMap_.find(recordId);
+        if (iter != appRunningRecordMap_.end()) {
+            appRecords.push_back(iter->second);
+        }
+    }
+    return appRecords;
+}
+
+void AppRunningManager::AddAppRunningRecordIndex(const std::shared_ptr<AppRunningRecord> &appRecord)
+{
+    auto recordId = appRecord->GetRecordId();
+    processNameIndex_[appRecord->GetProcessName()].insert(recordId);
+    bundleNameIndex_[appRecord->GetBundleName()].insert(recordId);
+    // the process is spawned with the uid of its application
+    auto appInfo = appRecord->GetApplicationInfo();
+    if (appInfo) {
+        userIdIndex_[GetUserIdOfUid(appInfo->uid)].insert(recordId);
+    }
+    if (!appRecord->GetJointUserId().empty()) {
+        jointRecordIds_.insert(recordId);
+    }
+}
+
+void AppRunningManager::RemoveAppRunningRecordIndex(const std::shared_ptr<AppRunningRecord> &appRecord)
+{
+    auto recordId = appRecord->GetRecordId();
+    auto removeFromIndex = [recordId](auto &index, const auto &key) {
+        auto iter = index.find(key);
+        if (iter == index.end()) {
+            return;
+        }
+        iter->second.erase(recordId);
+        if (iter->second.empty()) {
+            index.erase(iter);
+        }
+    };
+    removeFromIndex(processNameIndex_, appRecord->GetProcessName());
+    removeFromIndex(bundleNameIndex_, appRecord->GetBundleName());
+    auto appInfo = appRecord->GetApplicationInfo();
+    if (appInfo) {
+        removeFromIndex(userIdIndex_, GetUserIdOfUid(appInfo->uid));
+    }
+    jointRecordIds_.erase(recordId);
+
+    auto pidIter = pidIndex_.find(appRecord->GetPriorityObject()->GetPid());
+    if (pidIter != pidIndex_.end() && pidIter->second == recordId) {
+        pidIndex_.erase(pidIter);
+    }
+    for (auto iter = abilityTokenIndex_.begin(); iter != abilityTokenIndex_.end();) {
+        if (iter->second == recordId) {
+            iter = abilityTokenIndex_.erase(iter);
+        } else {
+            iter++;
+        }
+    }
+}
+
+void AppRunningManager::ClearAppRunningRecordIndex()
+{
+    processNameIndex_.clear();
+    bundleNameIndex_.clear();
+    userIdIndex_.clear();
+    jointRecordIds_.clear();
+    pidIndex_.clear();
+    abilityTokenIndex_.clear();
 }
 
 void AppRunningManager::HandleTerminateTimeOut(int64_t eventId)
@@ -402,14 +564,6 @@ void AppRunningManager::GetRunningProcessInfoByToken(
     info.bundleNames.emplace_back(appRecord->GetBundleName());
 }
 
-void AppRunningManager::ClipStringContent(const std::regex &re, const std::string &sorce, std::string &afferCutStr)
-{
-    std::smatch basket;
-    if (std::regex_search(sorce, basket, re)) {
-        afferCutStr = basket.prefix().str() + basket.suffix().str();
-    }
-}
-
 void AppRunningManager::GetForegroundApplications(std::vector<AppStateData> &list)
 {
     HILOG_INFO("%{public}s, begin.", __func__);
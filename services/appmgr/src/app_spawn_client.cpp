@@ -15,22 +15,43 @@
 
 #include "app_spawn_client.h"
 
+#include <algorithm>
+#include <atomic>
+#include <future>
+
 #include "bytrace.h"
 #include "hilog_wrapper.h"
 
 namespace OHOS {
 namespace AppExecFwk {
 namespace {
-const int32_t CONNECT_RETRY_DELAY = 200 * 1000;  // 200ms
+const int32_t CONNECT_RETRY_INITIAL_DELAY = 50 * 1000;  // 50ms, doubled on each retry
+const int32_t CONNECT_RETRY_MAX_DELAY = 200 * 1000;  // 200ms
 const int32_t CONNECT_RETRY_MAX_TIMES = 2;
+// appspawn forks one by one, a few requests in flight are enough to keep it busy
+const int SPAWN_MAX_IN_FLIGHT = 4;
+
+int32_t GetRetryDelay(int32_t retryCount)
+{
+    return std::min(CONNECT_RETRY_INITIAL_DELAY << (retryCount - 1), CONNECT_RETRY_MAX_DELAY);
+}
 }  // namespace
 
 AppSpawnClient::AppSpawnClient(bool isNWebSpawn)
 {
     socket_ = std::make_shared<AppSpawnSocket>(isNWebSpawn);
+    socketCreator_ = [isNWebSpawn]() { return std::make_shared<AppSpawnSocket>(isNWebSpawn); };
     state_ = SpawnConnectionState::STATE_NOT_CONNECT;
 }
 
+AppSpawnClient::~AppSpawnClient()
+{
+    std::lock_guard<std::mutex> lock(executorLock_);
+    if (spawnExecutor_) {
+        spawnExecutor_->Stop();
+    }
+}
+
 ErrCode AppSpawnClient::OpenConnection()
 {
     BYTRACE_NAME(BYTRACE_TAG_APP, __PRETTY_FUNCTION__);
@@ -39,14 +60,7 @@ ErrCode AppSpawnClient::OpenConnection()
         return ERR_APPEXECFWK_BAD_APPSPAWN_SOCKET;
     }
 
-    int32_t retryCount = 1;
-    ErrCode errCode = socket_->OpenAppSpawnConnection();
-    while (FAILED(errCode) && retryCount <= CONNECT_RETRY_MAX_TIMES) {
-        HILOG_WARN("failed to OpenConnection, retry times %{public}d ...", retryCount);
-        usleep(CONNECT_RETRY_DELAY);
-        errCode = socket_->OpenAppSpawnConnection();
-        retryCount++;
-    }
+    ErrCode errCode = OpenConnectionWithRetry(socket_);
     if (SUCCEEDED(errCode)) {
         state_ = SpawnConnectionState::STATE_CONNECTED;
     } else {
@@ -56,6 +70,19 @@ ErrCode AppSpawnClient::OpenConnection()
     return errCode;
 }
 
+ErrCode AppSpawnClient::OpenConnectionWithRetry(const std::shared_ptr<AppSpawnSocket> &socket)
+{
+    int32_t retryCount = 1;
+    ErrCode errCode = socket->OpenAppSpawnConnection();
+    while (FAILED(errCode) && retryCount <= CONNECT_RETRY_MAX_TIMES) {
+        HILOG_WARN("failed to OpenConnection, retry times %{public}d ...", retryCount);
+        usleep(GetRetryDelay(retryCount));
+        errCode = socket->OpenAppSpawnConnection();
+        retryCount++;
+    }
+    return errCode;
+}
+
 ErrCode AppSpawnClient::StartProcess(const AppSpawnStartMsg &startMsg, pid_t &pid)
 {
     BYTRACE_NAME(BYTRACE_TAG_APP, __PRETTY_FUNCTION__);
@@ -63,7 +90,7 @@ ErrCode AppSpawnClient::StartProcess(const AppSpawnStartMsg &startMsg, pid_t &pi
     ErrCode errCode = StartProcessImpl(startMsg, pid);
     while (FAILED(errCode) && retryCount <= CONNECT_RETRY_MAX_TIMES) {
         HILOG_WARN("failed to StartProcess, retry times %{public}d ...", retryCount);
-        usleep(CONNECT_RETRY_DELAY);
+        usleep(GetRetryDelay(retryCount));
         errCode = StartProcessImpl(startMsg, pid);
         retryCount++;
     }
@@ -90,6 +117,13 @@ ErrCode AppSpawnClient::StartProcessImpl(const AppSpawnStartMsg &startMsg, pid_t
     std::unique_ptr<AppSpawnClient, void (*)(AppSpawnClient *)> autoCloseConnection(
         this, [](AppSpawnClient *client) { client->CloseConnection(); });
 
+    return SendStartMsg(socket_, startMsg, pid);
+}
+
+ErrCode AppSpawnClient::SendStartMsg(
+    const std::shared_ptr<AppSpawnSocket> &socket, const AppSpawnStartMsg &startMsg, pid_t &pid)
+{
+    ErrCode result = ERR_OK;
     AppSpawnMsgWrapper msgWrapper;
     if (!msgWrapper.AssembleMsg(startMsg)) {
         HILOG_ERROR("AssembleMsg failed!");
@@ -97,12 +131,12 @@ ErrCode AppSpawnClient::StartProcessImpl(const AppSpawnStartMsg &startMsg, pid_t
     }
     AppSpawnPidMsg pidMsg;
     if (msgWrapper.IsValid()) {
-        result = socket_->WriteMessage(msgWrapper.GetMsgBuf(), msgWrapper.GetMsgLength());
+        result = socket->WriteMessage(msgWrapper.GetMsgBuf(), msgWrapper.GetMsgLength());
         if (FAILED(result)) {
             HILOG_ERROR("WriteMessage failed!");
             return result;
         }
-        result = socket_->ReadMessage(reinterpret_cast<void *>(pidMsg.pidBuf), LEN_PID);
+        result = socket->ReadMessage(reinterpret_cast<void *>(pidMsg.pidBuf), LEN_PID);
         if (FAILED(result)) {
             HILOG_ERROR("ReadMessage failed!");
             return result;
@@ -117,6 +151,86 @@ ErrCode AppSpawnClient::StartProcessImpl(const AppSpawnStartMsg &startMsg, pid_t
     return result;
 }
 
+void AppSpawnClient::StartProcesses(
+    const std::vector<AppSpawnStartMsg> &startMsgs, std::vector<AppSpawnResult> &results)
+{
+    std::promise<std::vector<AppSpawnResult>> promise;
+    auto future = promise.get_future();
+    StartProcessesAsync(startMsgs, [&promise](const std::vector<AppSpawnResult> &batchResults) {
+        promise.set_value(batchResults);
+    });
+    results = future.get();
+}
+
+void AppSpawnClient::StartProcessesAsync(
+    const std::vector<AppSpawnStartMsg> &startMsgs, const StartProcessesCallback &callback)
+{
+    BYTRACE_NAME(BYTRACE_TAG_APP, __PRETTY_FUNCTION__);
+    if (!socketCreator_ || startMsgs.empty()) {
+        std::vector<AppSpawnResult> results(startMsgs.size());
+        for (size_t i = 0; i < startMsgs.size(); i++) {
+            results[i].errCode = StartProcess(startMsgs[i], results[i].pid);
+        }
+        callback(results);
+        return;
+    }
+
+    // appspawn serves one request per connection, the requests go out on connections of their own
+    struct SpawnBatch {
+        std::vector<AppSpawnStartMsg> startMsgs;
+        std::vector<AppSpawnResult> results;
+        std::atomic<size_t> remaining;
+        StartProcessesCallback callback;
+    };
+    auto batch = std::make_shared<SpawnBatch>();
+    batch->startMsgs = startMsgs;
+    batch->results.resize(startMsgs.size());
+    batch->remaining = startMsgs.size();
+    batch->callback = callback;
+    CreateSpawnExecutor();
+    for (size_t i = 0; i < startMsgs.size(); i++) {
+        spawnExecutor_->AddTask([this, batch, i]() {
+            batch->results[i] = StartProcessOnNewConnection(batch->startMsgs[i]);
+            if (--batch->remaining == 0) {
+                batch->callback(batch->results);
+            }
+        });
+    }
+}
+
+void AppSpawnClient::CreateSpawnExecutor()
+{
+    std::lock_guard<std::mutex> lock(executorLock_);
+    if (spawnExecutor_ == nullptr) {
+        spawnExecutor_ = std::make_unique<ThreadPool>("AppSpawnClient");
+        spawnExecutor_->Start(SPAWN_MAX_IN_FLIGHT);
+    }
+}
+
+AppSpawnResult AppSpawnClient::StartProcessOnNewConnection(const AppSpawnStartMsg &startMsg)
+{
+    AppSpawnResult result;
+    int32_t retryCount = 0;
+    do {
+        if (retryCount > 0) {
+            HILOG_WARN("failed to start %{public}s, retry times %{public}d ...", startMsg.procName.c_str(), retryCount);
+            usleep(GetRetryDelay(retryCount));
+        }
+        auto socket = socketCreator_();
+        if (!socket) {
+            result.errCode = ERR_APPEXECFWK_BAD_APPSPAWN_SOCKET;
+            break;
+        }
+        result.errCode = OpenConnectionWithRetry(socket);
+        if (SUCCEEDED(result.errCode)) {
+            result.errCode = SendStartMsg(socket, startMsg, result.pid);
+            socket->CloseAppSpawnConnection();
+        }
+        retryCount++;
+    } while (FAILED(result.errCode) && retryCount <= CONNECT_RETRY_MAX_TIMES);
+    return result;
+}
+
 ErrCode AppSpawnClient::GetRenderProcessTerminationStatus(const AppSpawnStartMsg &startMsg, int &status)
 {
     if (!socket_) {
@@ -172,6 +286,13 @@ void AppSpawnClient::CloseConnection()
 void AppSpawnClient::SetSocket(const std::shared_ptr<AppSpawnSocket> socket)
 {
     socket_ = socket;
+    // the requests of StartProcesses go through the socket set too
+    socketCreator_ = nullptr;
+}
+
+void AppSpawnClient::SetSocketCreator(const std::function<std::shared_ptr<AppSpawnSocket>()> &socketCreator)
+{
+    socketCreator_ = socketCreator;
 }
 }  // namespace AppExecFwk
 }  // namespace OHOS
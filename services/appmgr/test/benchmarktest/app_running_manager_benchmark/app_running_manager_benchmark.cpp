@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <memory>
+#include <regex>
+#include <string>
+
+#include "app_running_manager.h"
+
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+const std::string APP_ID_SUFFIX = "_BNtg4JBClbl92Rgc3jm/RfcAdrHXaM8F0QOiwVEhnV5ebE5jNIYnAx+weFRT3QTyUjRNdhmc2aAz=";
+const int32_t BASE_UID = 20010000;
+const pid_t BASE_PID = 3000;
+
+std::string GetBundleName(int64_t index)
+{
+    return "com.example.benchmark" + std::to_string(index);
+}
+
+BundleInfo MakeBundleInfo(int64_t index)
+{
+    BundleInfo bundleInfo;
+    bundleInfo.name = GetBundleName(index);
+    bundleInfo.appId = bundleInfo.name + APP_ID_SUFFIX;
+    return bundleInfo;
+}
+
+std::shared_ptr<AppRunningManager> MakeAppRunningManager(int64_t count)
+{
+    auto appRunningManager = std::make_shared<AppRunningManager>();
+    for (int64_t i = 0; i < count; i++) {
+        auto appInfo = std::make_shared<ApplicationInfo>();
+        appInfo->name = GetBundleName(i);
+        appInfo->bundleName = appInfo->name;
+        appInfo->uid = BASE_UID + i;
+        auto appRecord = appRunningManager->CreateAppRunningRecord(appInfo, appInfo->name, MakeBundleInfo(i));
+        HapModuleInfo hapModuleInfo;
+        hapModuleInfo.moduleName = "entry";
+        appRecord->AddModules(appInfo, { hapModuleInfo });
+        appRecord->SetUid(appInfo->uid);
+        appRecord->GetPriorityObject()->SetPid(BASE_PID + i);
+    }
+    return appRunningManager;
+}
+
+/**
+ * What CheckAppRunningRecordIsExist did before the indexes, a regex built on each call and a walk of all records.
+ */
+std::shared_ptr<AppRunningRecord> LegacyCheckAppRunningRecordIsExist(
+    const std::map<const int32_t, const std::shared_ptr<AppRunningRecord>> &appRunningRecordMap,
+    const std::string &appName, const std::string &processName, const int uid, const BundleInfo &bundleInfo)
+{
+    std::regex rule("[a-zA-Z.]+[-_#]{1}");
+    std::string signCode;
+    std::smatch basket;
+    if (std::regex_search(bundleInfo.appId, basket, rule)) {
+        signCode = basket.prefix().str() + basket.suffix().str();
+    }
+    benchmark::DoNotOptimize(signCode);
+    for (const auto &item : appRunningRecordMap) {
+        const auto &appRecord = item.second;
+        if (appRecord && appRecord->GetProcessName() == processName &&
+            !(appRecord->IsTerminating()) && !(appRecord->IsKilling())) {
+            auto appInfoList = appRecord->GetAppInfoList();
+            auto isExist = [&appName, &uid](const std::shared_ptr<ApplicationInfo> &appInfo) {
+                return appInfo->name == appName && appInfo->uid == uid;
+            };
+            if (std::find_if(appInfoList.begin(), appInfoList.end(), isExist) != appInfoList.end()) {
+                return appRecord;
+            }
+        }
+    }
+    return nullptr;
+}
+
+void BenchmarkLegacyStartResolution(benchmark::State &state)
+{
+    auto appRunningManager = MakeAppRunningManager(state.range(0));
+    const auto &appRunningRecordMap = appRunningManager->GetAppRunningRecordMap();
+    // a new process, so nothing is found and all the records are looked at
+    auto bundleInfo = MakeBundleInfo(state.range(0));
+    auto bundleName = GetBundleName(state.range(0));
+    for (auto _ : state) {
+        auto appRecord = LegacyCheckAppRunningRecordIsExist(
+            appRunningRecordMap, bundleName, bundleName, BASE_UID + state.range(0), bundleInfo);
+        benchmark::DoNotOptimize(appRecord);
+    }
+}
+
+void BenchmarkStartResolution(benchmark::State &state)
+{
+    auto appRunningManager = MakeAppRunningManager(state.range(0));
+    auto bundleInfo = MakeBundleInfo(state.range(0));
+    auto bundleName = GetBundleName(state.range(0));
+    for (auto _ : state) {
+        auto appRecord = appRunningManager->CheckAppRunningRecordIsExist(
+            bundleName, bundleName, BASE_UID + state.range(0), bundleInfo);
+        benchmark::DoNotOptimize(appRecord);
+    }
+}
+
+void BenchmarkStartResolutionExisting(benchmark::State &state)
+{
+    auto appRunningManager = MakeAppRunningManager(state.range(0));
+    int64_t index = state.range(0) - 1;
+    auto bundleInfo = MakeBundleInfo(index);
+    auto bundleName = GetBundleName(index);
+    for (auto _ : state) {
+        auto appRecord = appRunningManager->CheckAppRunningRecordIsExist(
+            bundleName, bundleName, BASE_UID + index, bundleInfo);
+        benchmark::DoNotOptimize(appRecord);
+    }
+}
+
+void BenchmarkLegacyGetRecordByPid(benchmark::State &state)
+{
+    auto appRunningManager = MakeAppRunningManager(state.range(0));
+    const auto &appRunningRecordMap = appRunningManager->GetAppRunningRecordMap();
+    pid_t pid = BASE_PID + state.range(0) - 1;
+    for (auto _ : state) {
+        auto iter = std::find_if(appRunningRecordMap.begin(), appRunningRecordMap.end(), [pid](const auto &pair) {
+            return pair.second->GetPriorityObject()->GetPid() == pid;
+        });
+        benchmark::DoNotOptimize(iter);
+    }
+}
+
+void BenchmarkGetRecordByPid(benchmark::State &state)
+{
+    auto appRunningManager = MakeAppRunningManager(state.range(0));
+    pid_t pid = BASE_PID + state.range(0) - 1;
+    for (auto _ : state) {
+        auto appRecord = appRunningManager->GetAppRunningRecordByPid(pid);
+        benchmark::DoNotOptimize(appRecord);
+    }
+}
+}  // namespace
+
+BENCHMARK(BenchmarkLegacyStartResolution)->Arg(30)->Arg(300);
+BENCHMARK(BenchmarkStartResolution)->Arg(30)->Arg(300);
+BENCHMARK(BenchmarkStartResolutionExisting)->Arg(30)->Arg(300);
+BENCHMARK(BenchmarkLegacyGetRecordByPid)->Arg(30)->Arg(300);
+BENCHMARK(BenchmarkGetRecordByPid)->Arg(30)->Arg(300);
+
+BENCHMARK_MAIN();
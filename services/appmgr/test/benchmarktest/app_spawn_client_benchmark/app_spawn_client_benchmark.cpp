@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <memory>
+#include <unistd.h>
+#include <vector>
+
+#include "app_spawn_client.h"
+#include "securec.h"
+
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+// what appspawn takes to answer a request, roughly the time of a fork
+constexpr int32_t SPAWN_LATENCY = 2 * 1000;  // 2ms
+
+/**
+ * Answers every request with a new pid after the spawn latency, without appspawn.
+ */
+class FakeAppSpawnSocket : public AppSpawnSocket {
+public:
+    FakeAppSpawnSocket() : AppSpawnSocket(false) {}
+    ~FakeAppSpawnSocket() override = default;
+
+    ErrCode OpenAppSpawnConnection() override
+    {
+        return ERR_OK;
+    }
+
+    void CloseAppSpawnConnection() override
+    {}
+
+    ErrCode WriteMessage([[maybe_unused]] const void *buf, [[maybe_unused]] const int32_t len) override
+    {
+        return ERR_OK;
+    }
+
+    ErrCode ReadMessage(void *buf, const int32_t len) override
+    {
+        usleep(SPAWN_LATENCY);
+        AppSpawnPidMsg msg;
+        msg.pid = ++nextPid_;
+        if (memcpy_s(buf, len, msg.pidBuf, sizeof(msg.pidBuf)) != EOK) {
+            return ERR_NO_MEMORY;
+        }
+        return ERR_OK;
+    }
+
+private:
+    static std::atomic<pid_t> nextPid_;
+};
+
+std::atomic<pid_t> FakeAppSpawnSocket::nextPid_(0);
+
+std::vector<AppSpawnStartMsg> MakeStartMsgs(int64_t count)
+{
+    std::vector<AppSpawnStartMsg> startMsgs;
+    for (int64_t i = 0; i < count; i++) {
+        AppSpawnStartMsg startMsg = {10001, 10001, {10001}, "com.example.benchmark" + std::to_string(i), "soPath"};
+        startMsgs.push_back(startMsg);
+    }
+    return startMsgs;
+}
+
+void BenchmarkStartProcessOneByOne(benchmark::State &state)
+{
+    AppSpawnClient appSpawnClient;
+    appSpawnClient.SetSocket(std::make_shared<FakeAppSpawnSocket>());
+    auto startMsgs = MakeStartMsgs(state.range(0));
+    for (auto _ : state) {
+        // what the resident processes did on boot, waiting for appspawn one by one
+        for (const auto &startMsg : startMsgs) {
+            pid_t pid = 0;
+            benchmark::DoNotOptimize(appSpawnClient.StartProcess(startMsg, pid));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BenchmarkStartProcesses(benchmark::State &state)
+{
+    AppSpawnClient appSpawnClient;
+    appSpawnClient.SetSocketCreator([]() { return std::make_shared<FakeAppSpawnSocket>(); });
+    auto startMsgs = MakeStartMsgs(state.range(0));
+    for (auto _ : state) {
+        std::vector<AppSpawnResult> results;
+        appSpawnClient.StartProcesses(startMsgs, results);
+        benchmark::DoNotOptimize(results);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+}  // namespace
+
+BENCHMARK(BenchmarkStartProcessOneByOne)->Arg(1)->Arg(8)->Arg(32)->UseRealTime();
+BENCHMARK(BenchmarkStartProcesses)->Arg(1)->Arg(8)->Arg(32)->UseRealTime();
+
+BENCHMARK_MAIN();
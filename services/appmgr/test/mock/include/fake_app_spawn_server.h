@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_APPMGR_TEST_UT_FAKE_APP_SPAWN_SERVER_H
+#define FOUNDATION_APPEXECFWK_SERVICES_APPMGR_TEST_UT_FAKE_APP_SPAWN_SERVER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "app_spawn_msg_wrapper.h"
+#include "app_spawn_socket.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace FakeAppSpawn {
+inline bool MakeAddress(const std::string &name, sockaddr_un &addr, socklen_t &addrLen)
+{
+    // an abstract unix socket, nothing is left on the file system
+    if (memset_s(&addr, sizeof(addr), 0, sizeof(addr)) != EOK || name.length() + 1 > sizeof(addr.sun_path)) {
+        return false;
+    }
+    addr.sun_family = AF_UNIX;
+    if (memcpy_s(addr.sun_path + 1, sizeof(addr.sun_path) - 1, name.c_str(), name.length()) != EOK) {
+        return false;
+    }
+    addrLen = static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + 1 + name.length());
+    return true;
+}
+
+inline bool ReadFully(int fd, void *buf, size_t len)
+{
+    auto data = static_cast<char *>(buf);
+    while (len > 0) {
+        ssize_t count = TEMP_FAILURE_RETRY(read(fd, data, len));
+        if (count <= 0) {
+            return false;
+        }
+        data += count;
+        len -= static_cast<size_t>(count);
+    }
+    return true;
+}
+
+inline bool WriteFully(int fd, const void *buf, size_t len)
+{
+    auto data = static_cast<const char *>(buf);
+    while (len > 0) {
+        ssize_t count = TEMP_FAILURE_RETRY(write(fd, data, len));
+        if (count <= 0) {
+            return false;
+        }
+        data += count;
+        len -= static_cast<size_t>(count);
+    }
+    return true;
+}
+}  // namespace FakeAppSpawn
+
+/**
+ * Serves appspawn requests on a unix socket like appspawn does, one request per connection, answering each with a
+ * new pid after the spawn latency. Connections are served concurrently, so that requests sent at once overlap.
+ */
+class FakeAppSpawnServer {
+public:
+    FakeAppSpawnServer(const std::string &name, std::chrono::milliseconds spawnLatency)
+        : name_(name), spawnLatency_(spawnLatency) {}
+
+    ~FakeAppSpawnServer()
+    {
+        Stop();
+    }
+
+    bool Start(pid_t basePid)
+    {
+        nextPid_ = basePid;
+        sockaddr_un addr;
+        socklen_t addrLen = 0;
+        if (!FakeAppSpawn::MakeAddress(name_, addr, addrLen)) {
+            return false;
+        }
+        listenFd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (listenFd_ < 0) {
+            return false;
+        }
+        if (bind(listenFd_, reinterpret_cast<sockaddr *>(&addr), addrLen) != 0 || listen(listenFd_, SOMAXCONN) != 0) {
+            close(listenFd_);
+            listenFd_ = -1;
+            return false;
+        }
+        acceptThread_ = std::thread([this]() { AcceptLoop(); });
+        return true;
+    }
+
+    void Stop()
+    {
+        if (listenFd_ < 0) {
+            return;
+        }
+        // wakes up accept
+        shutdown(listenFd_, SHUT_RDWR);
+        acceptThread_.join();
+        close(listenFd_);
+        listenFd_ = -1;
+        for (auto &thread : connectionThreads_) {
+            thread.join();
+        }
+        connectionThreads_.clear();
+    }
+
+    std::vector<std::string> GetProcessNames()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return processNames_;
+    }
+
+    int32_t GetMaxInFlight() const
+    {
+        return maxInFlight_;
+    }
+
+private:
+    void AcceptLoop()
+    {
+        while (true) {
+            int fd = TEMP_FAILURE_RETRY(accept4(listenFd_, nullptr, nullptr, SOCK_CLOEXEC));
+            if (fd < 0) {
+                return;
+            }
+            connectionThreads_.emplace_back([this, fd]() { Serve(fd); });
+        }
+    }
+
+    void Serve(int fd)
+    {
+        int32_t inFlight = ++inFlight_;
+        int32_t maxInFlight = maxInFlight_;
+        while (inFlight > maxInFlight && !maxInFlight_.compare_exchange_weak(maxInFlight, inFlight)) {}
+
+        AppSpawnMsg msg;
+        if (!FakeAppSpawn::ReadFully(fd, &msg, sizeof(msg))) {
+            inFlight_--;
+            close(fd);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            processNames_.emplace_back(msg.processName);
+        }
+        // not usleep, which the tests of the client mock
+        std::this_thread::sleep_for(spawnLatency_);
+        AppSpawnPidMsg pidMsg;
+        pidMsg.pid = nextPid_++;
+        // done before the answer, which lets the client send its next request
+        inFlight_--;
+        FakeAppSpawn::WriteFully(fd, pidMsg.pidBuf, LEN_PID);
+        close(fd);
+    }
+
+    std::string name_;
+    std::chrono::milliseconds spawnLatency_;
+    int listenFd_ = -1;
+    std::thread acceptThread_;
+    // only touched by the accept thread until it is joined
+    std::vector<std::thread> connectionThreads_;
+    std::atomic<pid_t> nextPid_ {0};
+    std::atomic<int32_t> inFlight_ {0};
+    std::atomic<int32_t> maxInFlight_ {0};
+    std::mutex mutex_;
+    std::vector<std::string> processNames_;
+};
+
+/**
+ * Connects to a FakeAppSpawnServer instead of the socket of appspawn.
+ */
+class FakeAppSpawnServerSocket : public AppSpawnSocket {
+public:
+    explicit FakeAppSpawnServerSocket(const std::string &name) : AppSpawnSocket(false), name_(name) {}
+
+    ~FakeAppSpawnServerSocket() override
+    {
+        CloseAppSpawnConnection();
+    }
+
+    ErrCode OpenAppSpawnConnection() override
+    {
+        sockaddr_un addr;
+        socklen_t addrLen = 0;
+        if (!FakeAppSpawn::MakeAddress(name_, addr, addrLen)) {
+            return ERR_APPEXECFWK_BAD_APPSPAWN_SOCKET;
+        }
+        fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd_ < 0) {
+            return ERR_APPEXECFWK_BAD_APPSPAWN_SOCKET;
+        }
+        if (connect(fd_, reinterpret_cast<sockaddr *>(&addr), addrLen) != 0) {
+            CloseAppSpawnConnection();
+            return ERR_APPEXECFWK_CONNECT_APPSPAWN_FAILED;
+        }
+        return ERR_OK;
+    }
+
+    void CloseAppSpawnConnection() override
+    {
+        if (fd_ >= 0) {
+            close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    ErrCode WriteMessage(const void *buf, const int32_t len) override
+    {
+        if (fd_ < 0 || buf == nullptr || len <= 0 || !FakeAppSpawn::WriteFully(fd_, buf, len)) {
+            return ERR_APPEXECFWK_SOCKET_WRITE_FAILED;
+        }
+        return ERR_OK;
+    }
+
+    ErrCode ReadMessage(void *buf, const int32_t len) override
+    {
+        if (fd_ < 0 || buf == nullptr || len <= 0 || !FakeAppSpawn::ReadFully(fd_, buf, len)) {
+            return ERR_APPEXECFWK_SOCKET_READ_FAILED;
+        }
+        return ERR_OK;
+    }
+
+private:
+    std::string name_;
+    int fd_ = -1;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_APPMGR_TEST_UT_FAKE_APP_SPAWN_SERVER_H
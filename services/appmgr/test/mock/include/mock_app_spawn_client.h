@@ -23,7 +23,10 @@ namespace AppExecFwk {
 class MockAppSpawnClient : public AppSpawnClient {
 public:
     MockAppSpawnClient()
-    {}
+    {
+        // batches of requests go through the mocked StartProcess too
+        SetSocketCreator(nullptr);
+    }
     virtual ~MockAppSpawnClient()
     {}
     MOCK_METHOD2(StartProcess, ErrCode(const AppSpawnStartMsg &startMsg, pid_t &pid));
@@ -1950,6 +1950,56 @@ HWTEST_F(AmsAppLifeCycleTest, StartResidentProcess_003, TestSize.Level1)
 
     EXPECT_TRUE(serviceInner_->appRunningManager_->GetAppRunningRecordMap().empty());
 }
+
+/*
+ * Feature: AMS
+ * Function: AppLifeCycle::StartResidentProcess
+ * SubFunction: NA
+ * FunctionPoints: start resident processes
+ * CaseDescription: start two resident processes in one batch
+ */
+HWTEST_F(AmsAppLifeCycleTest, StartResidentProcess_004, TestSize.Level1)
+{
+    pid_t pid = 123;
+    pid_t pid1 = 124;
+    std::vector<std::string> procs = { "KeepAliveApplication", "KeepAliveApplication1" };
+    std::vector<int> uids = { 2100, 2101 };
+
+    std::vector<BundleInfo> infos;
+    for (size_t i = 0; i < procs.size(); i++) {
+        BundleInfo info;
+        info.name = procs[i];
+        info.uid = uids[i];
+        ApplicationInfo appInfo;
+        appInfo.name = "KeepAliveApp";
+        appInfo.bundleName = procs[i];
+        appInfo.uid = uids[i];
+        info.applicationInfo = appInfo;
+        infos.push_back(info);
+    }
+
+    MockAppSpawnClient *mockClientPtrT = new (std::nothrow) MockAppSpawnClient();
+    EXPECT_TRUE(mockClientPtrT);
+    EXPECT_CALL(*mockClientPtrT, StartProcess(_, _))
+        .Times(2)
+        .WillOnce(DoAll(SetArgReferee<1>(pid), Return(ERR_OK)))
+        .WillOnce(DoAll(SetArgReferee<1>(pid1), Return(ERR_OK)));
+    serviceInner_->SetAppSpawnClient(std::unique_ptr<MockAppSpawnClient>(mockClientPtrT));
+
+    serviceInner_->StartResidentProcess(infos, -1);
+
+    BundleInfo bundleInfo;
+    bundleInfo.appId = "com.ohos.test.helloworld_code123";
+    auto appRecord = serviceInner_->appRunningManager_->CheckAppRunningRecordIsExist(
+        "KeepAliveApp", procs[0], uids[0], bundleInfo);
+    EXPECT_TRUE(appRecord);
+    EXPECT_EQ(pid, appRecord->GetPriorityObject()->GetPid());
+    EXPECT_TRUE(appRecord->IsKeepAliveApp());
+    auto otherRecord = serviceInner_->appRunningManager_->CheckAppRunningRecordIsExist(
+        "KeepAliveApp", procs[1], uids[1], bundleInfo);
+    EXPECT_TRUE(otherRecord);
+    EXPECT_EQ(pid1, otherRecord->GetPriorityObject()->GetPid());
+}
 /*
  * Feature: AMS
  * Function: AppLifeCycle::RestartResidentProcess
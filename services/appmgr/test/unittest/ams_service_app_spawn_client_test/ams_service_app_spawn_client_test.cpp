@@ -19,7 +19,12 @@
 #undef private
 #undef protected
 #include <gtest/gtest.h>
+#include <future>
+#include <mutex>
+#include <set>
+#include <thread>
 #include "securec.h"
+#include "fake_app_spawn_server.h"
 #include "hilog_wrapper.h"
 #include "mock_app_spawn_socket.h"
 
@@ -746,3 +751,145 @@ HWTEST_F(AmsServiceAppSpawnClientTest, ReConnectAppSpawn_006, TestSize.Level1)
     EXPECT_EQ(ERR_APPEXECFWK_SOCKET_READ_FAILED, result);
     HILOG_INFO("ams_service_reconnect_app_spawn_006 end");
 }
+
+/*
+ * Feature: AppMgrService
+ * Function: Service
+ * SubFunction: StartProcesses
+ * FunctionPoints: Test AppSpawnClient start several processes at once.
+ * EnvConditions: mobile that can run ohos test framework
+ * CaseDescription: Verify if each request of a batch is sent on a connection of its own and gets its pid.
+ */
+HWTEST_F(AmsServiceAppSpawnClientTest, StartProcesses_001, TestSize.Level1)
+{
+    HILOG_INFO("ams_service_start_processes_001 start");
+    std::shared_ptr<AppSpawnClient> appSpawnClient = std::make_shared<AppSpawnClient>();
+    std::mutex mutex;
+    std::vector<std::shared_ptr<MockAppSpawnSocket>> sockets;
+    pid_t basePid = 20000;
+    appSpawnClient->SetSocketCreator([&mutex, &sockets, basePid]() {
+        auto socketMock = std::make_shared<MockAppSpawnSocket>();
+        EXPECT_CALL(*socketMock, OpenAppSpawnConnection()).WillOnce(Return(ERR_OK));
+        EXPECT_CALL(*socketMock, WriteMessage(_, _)).WillOnce(Return(ERR_OK));
+        EXPECT_CALL(*socketMock, ReadMessage(_, _))
+            .WillOnce(Invoke(socketMock.get(), &MockAppSpawnSocket::ReadImpl));
+        EXPECT_CALL(*socketMock, CloseAppSpawnConnection()).Times(1);
+        std::lock_guard<std::mutex> lock(mutex);
+        socketMock->SetExpectPid(basePid + static_cast<pid_t>(sockets.size()));
+        sockets.push_back(socketMock);
+        return socketMock;
+    });
+
+    size_t count = 10;
+    std::vector<AppSpawnStartMsg> startMsgs(count, {10001, 10001, {10001, 10002}, "processName", "soPath"});
+    std::vector<AppSpawnResult> results;
+    appSpawnClient->StartProcesses(startMsgs, results);
+    EXPECT_EQ(count, results.size());
+    EXPECT_EQ(count, sockets.size());
+    std::set<pid_t> pids;
+    for (const auto &result : results) {
+        EXPECT_EQ(ERR_OK, result.errCode);
+        EXPECT_GE(result.pid, basePid);
+        EXPECT_LT(result.pid, basePid + static_cast<pid_t>(count));
+        pids.insert(result.pid);
+    }
+    EXPECT_EQ(count, pids.size());
+    HILOG_INFO("ams_service_start_processes_001 end");
+}
+
+/*
+ * Feature: AppMgrService
+ * Function: Service
+ * SubFunction: StartProcesses
+ * FunctionPoints: Test AppSpawnClient start several processes at once.
+ * EnvConditions: mobile that can run ohos test framework
+ * CaseDescription: Verify if the failed request of a batch is retried, and the others are not affected.
+ */
+HWTEST_F(AmsServiceAppSpawnClientTest, StartProcesses_002, TestSize.Level1)
+{
+    HILOG_INFO("ams_service_start_processes_002 start");
+    std::shared_ptr<AppSpawnClient> appSpawnClient = std::make_shared<AppSpawnClient>();
+    pid_t expectPid = 11111;
+    appSpawnClient->SetSocketCreator([expectPid]() {
+        auto socketMock = std::make_shared<MockAppSpawnSocket>();
+        EXPECT_CALL(*socketMock, OpenAppSpawnConnection()).WillRepeatedly(Return(ERR_OK));
+        EXPECT_CALL(*socketMock, CloseAppSpawnConnection()).Times(1);
+        EXPECT_CALL(*socketMock, WriteMessage(_, _))
+            .WillRepeatedly(Invoke([](const void *buf, const int32_t len) -> ErrCode {
+                // the request of "badProcess" never gets an answer
+                auto msg = static_cast<const AppSpawnMsg *>(buf);
+                return std::string(msg->processName) == "badProcess" ? ERR_APPEXECFWK_SOCKET_WRITE_FAILED : ERR_OK;
+            }));
+        EXPECT_CALL(*socketMock, ReadMessage(_, _))
+            .WillRepeatedly(Invoke(socketMock.get(), &MockAppSpawnSocket::ReadImpl));
+        socketMock->SetExpectPid(expectPid);
+        return socketMock;
+    });
+
+    std::vector<AppSpawnStartMsg> startMsgs = {
+        {10001, 10001, {10001, 10002}, "processName", "soPath"},
+        {10002, 10002, {10002}, "badProcess", "soPath"},
+        {10003, 10003, {10003}, "otherProcess", "soPath"},
+    };
+    std::vector<AppSpawnResult> results;
+    appSpawnClient->StartProcesses(startMsgs, results);
+    EXPECT_EQ(startMsgs.size(), results.size());
+    EXPECT_EQ(ERR_OK, results[0].errCode);
+    EXPECT_EQ(expectPid, results[0].pid);
+    EXPECT_EQ(ERR_APPEXECFWK_SOCKET_WRITE_FAILED, results[1].errCode);
+    EXPECT_EQ(ERR_OK, results[2].errCode);
+    EXPECT_EQ(expectPid, results[2].pid);
+    HILOG_INFO("ams_service_start_processes_002 end");
+}
+
+/*
+ * Feature: AppMgrService
+ * Function: Service
+ * SubFunction: StartProcessesAsync
+ * FunctionPoints: Test AppSpawnClient start several processes at once through a unix socket.
+ * EnvConditions: mobile that can run ohos test framework
+ * CaseDescription: Verify if a batch sent to a fake appspawn server is answered on the spawn workers, with a few
+ * requests in flight at once.
+ */
+HWTEST_F(AmsServiceAppSpawnClientTest, StartProcesses_003, TestSize.Level1)
+{
+    HILOG_INFO("ams_service_start_processes_003 start");
+    std::string serverName = "FakeAppSpawn" + std::to_string(getpid());
+    FakeAppSpawnServer server(serverName, std::chrono::milliseconds(20));
+    pid_t basePid = 30000;
+    ASSERT_TRUE(server.Start(basePid));
+
+    std::shared_ptr<AppSpawnClient> appSpawnClient = std::make_shared<AppSpawnClient>();
+    appSpawnClient->SetSocketCreator(
+        [serverName]() { return std::make_shared<FakeAppSpawnServerSocket>(serverName); });
+    size_t count = 8;
+    std::vector<AppSpawnStartMsg> startMsgs;
+    for (size_t i = 0; i < count; i++) {
+        startMsgs.push_back({10001, 10001, {10001}, "processName" + std::to_string(i), "soPath"});
+    }
+    std::promise<std::vector<AppSpawnResult>> promise;
+    auto future = promise.get_future();
+    std::thread::id callbackThread;
+    appSpawnClient->StartProcessesAsync(startMsgs,
+        [&promise, &callbackThread](const std::vector<AppSpawnResult> &results) {
+            callbackThread = std::this_thread::get_id();
+            promise.set_value(results);
+        });
+    auto results = future.get();
+    EXPECT_NE(std::this_thread::get_id(), callbackThread);
+    ASSERT_EQ(count, results.size());
+    std::set<pid_t> pids;
+    for (const auto &result : results) {
+        EXPECT_EQ(ERR_OK, result.errCode);
+        EXPECT_GE(result.pid, basePid);
+        EXPECT_LT(result.pid, basePid + static_cast<pid_t>(count));
+        pids.insert(result.pid);
+    }
+    EXPECT_EQ(count, pids.size());
+    auto processNames = server.GetProcessNames();
+    EXPECT_EQ(count, std::set<std::string>(processNames.begin(), processNames.end()).size());
+    // the spawn workers keep a few requests in flight, never more
+    EXPECT_GT(server.GetMaxInFlight(), 1);
+    EXPECT_LE(server.GetMaxInFlight(), 4);
+    HILOG_INFO("ams_service_start_processes_003 end");
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "app_running_manager.h"
+#include "mock_ability_token.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+const std::string TEST_APP_ID = "com.ohos.test.helloworld_BNtg4JBClbl92Rgc3jm/RfcAdrHXaM8F0QOiwVEhnV5ebE5j=";
+const std::string TEST_SIGN_CODE = "BNtg4JBClbl92Rgc3jm/RfcAdrHXaM8F0QOiwVEhnV5ebE5j=";
+const int32_t USER_UID = 20010001;
+const int32_t SYSTEM_UID = 1010;
+const int32_t USER_ID = 100;
+}  // namespace
+
+class AppRunningManagerTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    std::shared_ptr<AppRunningRecord> CreateRecord(const std::string &bundleName, const std::string &processName,
+        int32_t uid, const std::string &jointUserId = "");
+
+    std::shared_ptr<AppRunningManager> appRunningManager_;
+};
+
+void AppRunningManagerTest::SetUpTestCase(void)
+{}
+
+void AppRunningManagerTest::TearDownTestCase(void)
+{}
+
+void AppRunningManagerTest::SetUp(void)
+{
+    appRunningManager_ = std::make_shared<AppRunningManager>();
+}
+
+void AppRunningManagerTest::TearDown(void)
+{
+    appRunningManager_->ClearAppRunningRecordMap();
+}
+
+std::shared_ptr<AppRunningRecord> AppRunningManagerTest::CreateRecord(const std::string &bundleName,
+    const std::string &processName, int32_t uid, const std::string &jointUserId)
+{
+    auto appInfo = std::make_shared<ApplicationInfo>();
+    appInfo->name = bundleName;
+    appInfo->bundleName = bundleName;
+    appInfo->uid = uid;
+    BundleInfo bundleInfo;
+    bundleInfo.name = bundleName;
+    bundleInfo.appId = TEST_APP_ID;
+    bundleInfo.jointUserId = jointUserId;
+    auto appRecord = appRunningManager_->CreateAppRunningRecord(appInfo, processName, bundleInfo);
+    EXPECT_NE(appRecord, nullptr);
+    HapModuleInfo hapModuleInfo;
+    hapModuleInfo.moduleName = "entry";
+    appRecord->AddModules(appInfo, { hapModuleInfo });
+    appRecord->SetUid(uid);
+    return appRecord;
+}
+
+/*
+ * Feature: AppRunningManager
+ * Function: CheckAppRunningRecordIsExist
+ * SubFunction: NA
+ * FunctionPoints: The process of an app is found by process name, and by sign code for a joint user id.
+ * EnvConditions: NA
+ * CaseDescription: Create records with and without a joint user id, look them up, then remove one.
+ */
+HWTEST_F(AppRunningManagerTest, CheckAppRunningRecordIsExist_0100, TestSize.Level1)
+{
+    auto appRecord = CreateRecord("com.ohos.test.app", "com.ohos.test.app", USER_UID);
+    auto jointRecord = CreateRecord("com.ohos.test.joint", "com.ohos.test.shared", USER_UID, "shared");
+    EXPECT_EQ(jointRecord->GetSignCode(), TEST_SIGN_CODE);
+
+    BundleInfo bundleInfo;
+    bundleInfo.appId = TEST_APP_ID;
+    EXPECT_EQ(appRunningManager_->CheckAppRunningRecordIsExist(
+        "com.ohos.test.app", "com.ohos.test.app", USER_UID, bundleInfo), appRecord);
+    EXPECT_EQ(appRunningManager_->CheckAppRunningRecordIsExist(
+        "com.ohos.test.app", "com.ohos.test.app", SYSTEM_UID, bundleInfo), nullptr);
+    EXPECT_EQ(appRunningManager_->CheckAppRunningRecordIsExist(
+        "com.ohos.test.app", "com.ohos.test.other", USER_UID, bundleInfo), nullptr);
+
+    // another bundle of the same joint user id and signature runs in the shared process
+    bundleInfo.jointUserId = "shared";
+    EXPECT_EQ(appRunningManager_->CheckAppRunningRecordIsExist(
+        "com.ohos.test.other", "com.ohos.test.shared", USER_UID, bundleInfo), jointRecord);
+    bundleInfo.appId = "com.ohos.test.other_OtherSignature=";
+    EXPECT_EQ(appRunningManager_->CheckAppRunningRecordIsExist(
+        "com.ohos.test.other", "com.ohos.test.shared", USER_UID, bundleInfo), nullptr);
+
+    bundleInfo.appId = TEST_APP_ID;
+    appRunningManager_->RemoveAppRunningRecordById(jointRecord->GetRecordId());
+    EXPECT_EQ(appRunningManager_->CheckAppRunningRecordIsExist(
+        "com.ohos.test.other", "com.ohos.test.shared", USER_UID, bundleInfo), nullptr);
+}
+
+/*
+ * Feature: AppRunningManager
+ * Function: GetAppRunningRecordByPid
+ * SubFunction: NA
+ * FunctionPoints: A record is found by the pid set on it after it is created.
+ * EnvConditions: NA
+ * CaseDescription: Set the pid of a record, change it, and remove the record.
+ */
+HWTEST_F(AppRunningManagerTest, GetAppRunningRecordByPid_0100, TestSize.Level1)
+{
+    auto appRecord = CreateRecord("com.ohos.test.app", "com.ohos.test.app", USER_UID);
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByPid(1001), nullptr);
+    appRecord->GetPriorityObject()->SetPid(1001);
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByPid(1001), appRecord);
+
+    appRecord->GetPriorityObject()->SetPid(1002);
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByPid(1001), nullptr);
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByPid(1002), appRecord);
+
+    appRunningManager_->RemoveAppRunningRecordById(appRecord->GetRecordId());
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByPid(1002), nullptr);
+}
+
+/*
+ * Feature: AppRunningManager
+ * Function: GetAppRunningRecordByAbilityToken
+ * SubFunction: NA
+ * FunctionPoints: A record is found by the token of one of its abilities.
+ * EnvConditions: NA
+ * CaseDescription: Add an ability to a record, look it up twice, then remove the record.
+ */
+HWTEST_F(AppRunningManagerTest, GetAppRunningRecordByAbilityToken_0100, TestSize.Level1)
+{
+    auto appRecord = CreateRecord("com.ohos.test.app", "com.ohos.test.app", USER_UID);
+    CreateRecord("com.ohos.test.other", "com.ohos.test.other", USER_UID);
+    sptr<IRemoteObject> token = new MockAbilityToken();
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByAbilityToken(token), nullptr);
+
+    auto abilityInfo = std::make_shared<AbilityInfo>();
+    abilityInfo->name = "MainAbility";
+    HapModuleInfo hapModuleInfo;
+    hapModuleInfo.moduleName = "entry";
+    appRecord->AddModule(appRecord->GetApplicationInfo(), abilityInfo, token, hapModuleInfo, nullptr);
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByAbilityToken(token), appRecord);
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByAbilityToken(token), appRecord);
+
+    appRunningManager_->RemoveAppRunningRecordById(appRecord->GetRecordId());
+    EXPECT_EQ(appRunningManager_->GetAppRunningRecordByAbilityToken(token), nullptr);
+}
+
+/*
+ * Feature: AppRunningManager
+ * Function: ProcessExitByBundleName, GetPidsByUserId
+ * SubFunction: NA
+ * FunctionPoints: The pids of the processes of a bundle or a user are collected.
+ * EnvConditions: NA
+ * CaseDescription: Create processes of two bundles and two users, collect the pids of each.
+ */
+HWTEST_F(AppRunningManagerTest, ProcessExitByBundleName_0100, TestSize.Level1)
+{
+    auto appRecord = CreateRecord("com.ohos.test.app", "com.ohos.test.app", USER_UID);
+    appRecord->GetPriorityObject()->SetPid(1001);
+    auto otherRecord = CreateRecord("com.ohos.test.app", "com.ohos.test.app:remote", USER_UID);
+    otherRecord->GetPriorityObject()->SetPid(1002);
+    auto systemRecord = CreateRecord("com.ohos.test.system", "com.ohos.test.system", SYSTEM_UID);
+    systemRecord->GetPriorityObject()->SetPid(1003);
+
+    std::list<pid_t> pids;
+    EXPECT_TRUE(appRunningManager_->ProcessExitByBundleName("com.ohos.test.app", pids));
+    std::list<pid_t> expectPids = { 1001, 1002 };
+    EXPECT_EQ(pids, expectPids);
+
+    pids.clear();
+    EXPECT_TRUE(appRunningManager_->GetPidsByUserId(USER_ID, pids));
+    EXPECT_EQ(pids, expectPids);
+
+    pids.clear();
+    appRunningManager_->RemoveAppRunningRecordById(appRecord->GetRecordId());
+    EXPECT_TRUE(appRunningManager_->GetPidsByUserId(USER_ID, pids));
+    expectPids = { 1002 };
+    EXPECT_EQ(pids, expectPids);
+    pids.clear();
+    EXPECT_FALSE(appRunningManager_->ProcessExitByBundleName("com.ohos.test.none", pids));
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
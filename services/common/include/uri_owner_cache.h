@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_URI_OWNER_CACHE_H
+#define OHOS_AAFWK_URI_OWNER_CACHE_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "bundlemgr/bundle_mgr_interface.h"
+#include "common_event_subscriber.h"
+#include "nocopyable.h"
+#include "uri.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * The extension ability owning the uris of an authority.
+ */
+struct UriOwnerInfo {
+    AppExecFwk::ExtensionAbilityType type = AppExecFwk::ExtensionAbilityType::UNSPECIFIED;
+    uint32_t accessTokenId = 0;
+    std::string bundleName;
+};
+
+/**
+ * @class UriOwnerCache
+ * Keeps the owners the bundle manager resolved for uri authorities, until the owning bundle changes.
+ */
+class UriOwnerCache {
+public:
+    UriOwnerCache() = default;
+    ~UriOwnerCache();
+
+    /**
+     * @brief Get the owner of an uri, asking the bundle manager if its authority is not cached.
+     * @param bms The bundle manager.
+     * @param uri The uri.
+     * @param userId The user of the uri.
+     * @param info Returns the owner of the uri.
+     * @return Returns true if the uri has an owner, false otherwise.
+     */
+    bool GetOwner(const sptr<AppExecFwk::IBundleMgr> &bms, const Uri &uri, int32_t userId, UriOwnerInfo &info);
+
+    /**
+     * @brief Drop the authorities owned by a bundle.
+     * @param bundleName The bundle name.
+     */
+    void Invalidate(const std::string &bundleName);
+
+    /**
+     * @brief Drop all the authorities.
+     */
+    void Clear();
+
+    /**
+     * @brief Invalidate the cache on package change events. Called again when the common event service
+     * is (re)started, it subscribes anew and drops what was cached while the events could be missed.
+     * @return Returns true if subscribed, false otherwise.
+     */
+    bool SubscribePackageEvents();
+
+    /**
+     * @brief Stop listening to package change events.
+     */
+    void UnsubscribePackageEvents();
+
+private:
+    using PackageEventCallback = std::function<void(const EventFwk::CommonEventData &)>;
+
+    class PackageEventSubscriber : public EventFwk::CommonEventSubscriber {
+    public:
+        PackageEventSubscriber(const EventFwk::CommonEventSubscribeInfo &subscribeInfo,
+            const PackageEventCallback &callback)
+            : EventFwk::CommonEventSubscriber(subscribeInfo), callback_(callback) {}
+        ~PackageEventSubscriber() = default;
+        void OnReceiveEvent(const EventFwk::CommonEventData &eventData) override;
+
+    private:
+        PackageEventCallback callback_;
+    };
+
+    void OnPackageEvent(const EventFwk::CommonEventData &eventData);
+    static std::string GetOwnerKey(const Uri &uri, int32_t userId);
+
+    std::mutex subscriberMutex_;
+    std::shared_mutex mutex_;
+    std::unordered_map<std::string, UriOwnerInfo> owners_;
+    // bumped by every invalidation, so that a query racing with it is not cached
+    uint64_t generation_ = 0;
+    // guarded by subscriberMutex_
+    std::shared_ptr<PackageEventSubscriber> subscriber_;
+
+    DISALLOW_COPY_AND_MOVE(UriOwnerCache);
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_URI_OWNER_CACHE_H
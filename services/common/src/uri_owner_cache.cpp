@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "uri_owner_cache.h"
+
+#include <string_view>
+
+#include "common_event_manager.h"
+#include "common_event_support.h"
+#include "hilog_wrapper.h"
+#include "in_process_call_wrapper.h"
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+// the bundle manager resolves an uri by what comes before the first '/' after ":///"
+const std::string_view URI_OWNER_SEPARATOR = ":///";
+const char URI_PATH_SEPARATOR = '/';
+// uris without an authority are cached as they are, a full cache starts over rather than grow with them
+const size_t MAX_URI_OWNERS = 1024;
+}
+
+UriOwnerCache::~UriOwnerCache()
+{
+    UnsubscribePackageEvents();
+}
+
+bool UriOwnerCache::GetOwner(const sptr<AppExecFwk::IBundleMgr> &bms, const Uri &uri, int32_t userId,
+    UriOwnerInfo &info)
+{
+    std::string key = GetOwnerKey(uri, userId);
+    uint64_t generation = 0;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto iter = owners_.find(key);
+        if (iter != owners_.end()) {
+            info = iter->second;
+            return true;
+        }
+        generation = generation_;
+    }
+
+    if (bms == nullptr) {
+        HILOG_ERROR("%{public}s, bms is nullptr.", __func__);
+        return false;
+    }
+    AppExecFwk::ExtensionAbilityInfo extensionInfo;
+    if (!IN_PROCESS_CALL(bms->QueryExtensionAbilityInfoByUri(uri.ToString(), userId, extensionInfo))) {
+        HILOG_DEBUG("%{public}s, Fail to get extension info from bundle manager.", __func__);
+        return false;
+    }
+    info.type = extensionInfo.type;
+    info.accessTokenId = extensionInfo.applicationInfo.accessTokenId;
+    info.bundleName = extensionInfo.bundleName;
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (generation != generation_) {
+        return true;
+    }
+    if (owners_.size() >= MAX_URI_OWNERS) {
+        HILOG_INFO("%{public}s, %{public}zu uri owners cached, start over.", __func__, owners_.size());
+        owners_.clear();
+    }
+    owners_[key] = info;
+    return true;
+}
+
+void UriOwnerCache::Invalidate(const std::string &bundleName)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    generation_++;
+    for (auto iter = owners_.begin(); iter != owners_.end();) {
+        if (iter->second.bundleName == bundleName) {
+            iter = owners_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+void UriOwnerCache::Clear()
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    generation_++;
+    owners_.clear();
+}
+
+bool UriOwnerCache::SubscribePackageEvents()
+{
+    std::lock_guard<std::mutex> guard(subscriberMutex_);
+    if (subscriber_ != nullptr) {
+        // the common event service restarted, the old subscription went with it
+        EventFwk::CommonEventManager::UnSubscribeCommonEvent(subscriber_);
+        subscriber_ = nullptr;
+    }
+    EventFwk::MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_ADDED);
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED);
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_REMOVED);
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_USER_REMOVED);
+    EventFwk::CommonEventSubscribeInfo subscribeInfo(matchingSkills);
+    auto subscriber = std::make_shared<PackageEventSubscriber>(subscribeInfo,
+        [this](const EventFwk::CommonEventData &eventData) { OnPackageEvent(eventData); });
+    if (!EventFwk::CommonEventManager::SubscribeCommonEvent(subscriber)) {
+        HILOG_ERROR("%{public}s, subscribe package events failed.", __func__);
+        return false;
+    }
+    subscriber_ = subscriber;
+    Clear();
+    return true;
+}
+
+void UriOwnerCache::UnsubscribePackageEvents()
+{
+    std::lock_guard<std::mutex> guard(subscriberMutex_);
+    if (subscriber_ == nullptr) {
+        return;
+    }
+    EventFwk::CommonEventManager::UnSubscribeCommonEvent(subscriber_);
+    subscriber_ = nullptr;
+}
+
+void UriOwnerCache::OnPackageEvent(const EventFwk::CommonEventData &eventData)
+{
+    const AAFwk::Want &want = eventData.GetWant();
+    std::string action = want.GetAction();
+    if (action == EventFwk::CommonEventSupport::COMMON_EVENT_USER_REMOVED) {
+        Clear();
+        return;
+    }
+    std::string bundleName = want.GetElement().GetBundleName();
+    HILOG_DEBUG("%{public}s, action:%{public}s, bundleName:%{public}s", __func__, action.c_str(), bundleName.c_str());
+    Invalidate(bundleName);
+}
+
+void UriOwnerCache::PackageEventSubscriber::OnReceiveEvent(const EventFwk::CommonEventData &eventData)
+{
+    if (callback_) {
+        callback_(eventData);
+    }
+}
+
+std::string UriOwnerCache::GetOwnerKey(const Uri &uri, int32_t userId)
+{
+    // e.g. fileShare:///com.example.FileShare/person/10 is owned by fileShare:///com.example.FileShare
+    std::string_view owner = uri.ToString();
+    size_t separatorPos = owner.find(URI_OWNER_SEPARATOR);
+    if (separatorPos != std::string_view::npos) {
+        size_t cutPos = owner.find(URI_PATH_SEPARATOR, separatorPos + URI_OWNER_SEPARATOR.length());
+        if (cutPos != std::string_view::npos) {
+            owner = owner.substr(0, cutPos);
+        }
+    }
+    std::string key = std::to_string(userId);
+    key.append("#").append(owner);
+    return key;
+}
+}  // namespace AAFwk
+}  // namespace OHOS
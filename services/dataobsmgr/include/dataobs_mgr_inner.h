@@ -22,6 +22,10 @@
 #include <memory>
 #include <map>
 #include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "iremote_object.h"
 #include "refbase.h"
@@ -29,6 +33,7 @@
 #include "data_ability_observer_interface.h"
 
 #include "event_handler.h"
+#include "thread_pool.h"
 
 namespace OHOS {
 namespace AAFwk {
@@ -46,14 +51,56 @@ public:
     int HandleRegisterObserver(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver);
     int HandleUnregisterObserver(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver);
     int HandleNotifyChange(const Uri &uri);
+    int HandleRegisterObserverExt(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver, bool isDescendants);
+    int HandleUnregisterObserverExt(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver);
     bool CheckNeedLimmit();
-    bool CheckRegisteFull(const Uri &uri);
+    bool CheckRegisteFull(const Uri &uri, bool isDescendants = false);
     void AtomicAddTaskCount();
     void AtomicSubTaskCount();
     void OnCallBackDied(const wptr<IRemoteObject> &remote);
 
+    /**
+     * SetNotifyCoalesceWindow, set how long a change notification waits for repeated changes of the same uri.
+     * Changes of a uri whose notification is still queued are dropped, its observers are called once.
+     *
+     * @param windowMs the delay of a notification, in milliseconds.
+     */
+    void SetNotifyCoalesceWindow(int64_t windowMs);
+
+    /**
+     * GetNotifyQueueDepth, get the number of uris with a notification waiting to be dispatched.
+     *
+     * @return Returns the queue depth.
+     */
+    size_t GetNotifyQueueDepth();
+
+    /**
+     * GetDroppedNotifyCount, get the number of changes merged into a notification already queued.
+     *
+     * @return Returns the dropped duplicates count.
+     */
+    int64_t GetDroppedNotifyCount() const;
+
 private:
+    /**
+     * A node of the trie of the observers registered for descendants. The children of the root are keyed by
+     * "scheme://authority", the ones below by the path segments of the uri.
+     */
+    struct ObsTrieNode {
+        ObsListType obsList;
+        std::unordered_map<std::string, std::unique_ptr<ObsTrieNode>> children;
+    };
+
+    static void GetTrieKeys(const std::string &uriString, std::vector<std::string> &keys);
+    bool GetDescendantsObsList(const std::vector<std::string> &keys, ObsListType &obslist);
+    ObsTrieNode *FindTrieNode(const std::vector<std::string> &keys);
+    static bool RemoveObsFromTrie(ObsTrieNode &node, const sptr<IDataAbilityObserver> &dataObserver);
+    static bool ObsExistInTrie(const ObsTrieNode &node, const sptr<IDataAbilityObserver> &dataObserver);
     bool GetObsListFromMap(const Uri &uri, ObsListType &obslist);
+    bool GetObsListFromMap(const std::string &uriString, ObsListType &obslist);
+    void PostNotifyTask(const std::string &uriString, const std::vector<std::string> &keys);
+    void DispatchNotifyChange(const std::string &uriString, const std::vector<std::string> &keys);
+    void CreateNotifyExecutor();
     void AddObsDeathRecipient(const sptr<IDataAbilityObserver> &dataObserver);
     void RemoveObsDeathRecipient(const sptr<IDataAbilityObserver> &dataObserver);
     void HandleCallBackDiedTask(const sptr<IRemoteObject> &dataObserver);
@@ -63,10 +110,18 @@ private:
     std::atomic_int taskCount_;
     const int taskCount_max_ = 50;
     const unsigned int obs_max_ = 50;
-    static std::mutex innerMutex_;
+    // guards obsmap_, obsTrie_ and recipientMap_, notifications only read them
+    std::shared_mutex innerMutex_;
     std::shared_ptr<EventHandler> handler_ = nullptr;
     ObsMapType obsmap_;
+    ObsTrieNode obsTrie_;
     ObsRecipientMapType recipientMap_;
+
+    std::mutex notifyMutex_;
+    std::unordered_set<std::string> pendingNotify_;
+    std::unique_ptr<ThreadPool> notifyExecutor_ = nullptr;
+    std::atomic<int64_t> coalesceWindowMs_;
+    std::atomic<int64_t> droppedNotifyCount_;
 };
 
 }  // namespace AAFwk
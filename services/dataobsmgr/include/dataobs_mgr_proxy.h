@@ -64,6 +64,28 @@ public:
      */
     virtual int NotifyChange(const Uri &uri);
 
+    /**
+     * Registers an observer to DataObsMgr specified by the given Uri, and optionally for its descendants.
+     *
+     * @param uri, Indicates the path of the data to operate.
+     * @param dataObserver, Indicates the IDataAbilityObserver object.
+     * @param isDescendants, Indicates whether the changes of the descendants of the uri are notified.
+     *
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    virtual int RegisterObserverExt(
+        const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver, bool isDescendants);
+
+    /**
+     * Deregisters an observer registered for the descendants of the given Uri.
+     *
+     * @param uri, Indicates the path of the data to operate.
+     * @param dataObserver, Indicates the IDataAbilityObserver object.
+     *
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    virtual int UnregisterObserverExt(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver);
+
 private:
     bool WriteInterfaceToken(MessageParcel &data);
 
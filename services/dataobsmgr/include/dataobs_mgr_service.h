@@ -53,6 +53,9 @@ public:
     virtual int RegisterObserver(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver) override;
     virtual int UnregisterObserver(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver) override;
     virtual int NotifyChange(const Uri &uri) override;
+    virtual int RegisterObserverExt(
+        const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver, bool isDescendants) override;
+    virtual int UnregisterObserverExt(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver) override;
 
     /**
      * GetEventHandler, get the dataobs manager service's handler.
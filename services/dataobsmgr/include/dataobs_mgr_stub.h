@@ -23,6 +23,7 @@
 #include <map>
 
 #include "hilog_wrapper.h"
+#include "ipc_stub_metrics.h"
 
 namespace OHOS {
 namespace AAFwk {
@@ -41,9 +42,12 @@ private:
     int RegisterObserverInner(MessageParcel &data, MessageParcel &reply);
     int UnregisterObserverInner(MessageParcel &data, MessageParcel &reply);
     int NotifyChangeInner(MessageParcel &data, MessageParcel &reply);
+    int RegisterObserverExtInner(MessageParcel &data, MessageParcel &reply);
+    int UnregisterObserverExtInner(MessageParcel &data, MessageParcel &reply);
 
     using RequestFuncType = int (DataObsManagerStub::*)(MessageParcel &data, MessageParcel &reply);
     std::map<uint32_t, RequestFuncType> requestFuncMap_;
+    IpcDispatchTable<RequestFuncType> dispatchTable_ {"DataObsMgr"};
 };
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -103,6 +103,48 @@ ErrCode DataObsMgrClient::NotifyChange(const Uri &uri)
     return doms->NotifyChange(uri);
 }
 
+/**
+ * Registers an observer to DataObsMgr specified by the given Uri, and optionally for its descendants.
+ *
+ * @param uri, Indicates the path of the data to operate.
+ * @param dataObserver, Indicates the IDataAbilityObserver object.
+ * @param isDescendants, Indicates whether the changes of the descendants of the uri are notified.
+ *
+ * @return Returns ERR_OK on success, others on failure.
+ */
+ErrCode DataObsMgrClient::RegisterObserverExt(
+    const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver, bool isDescendants)
+{
+    if (remoteObject_ == nullptr) {
+        ErrCode err = Connect();
+        if (err != ERR_OK) {
+            return DATAOBS_SERVICE_NOT_CONNECTED;
+        }
+    }
+    sptr<IDataObsMgr> doms = iface_cast<IDataObsMgr>(remoteObject_);
+    return doms->RegisterObserverExt(uri, dataObserver, isDescendants);
+}
+
+/**
+ * Deregisters an observer registered for the descendants of the given Uri.
+ *
+ * @param uri, Indicates the path of the data to operate.
+ * @param dataObserver, Indicates the IDataAbilityObserver object.
+ *
+ * @return Returns ERR_OK on success, others on failure.
+ */
+ErrCode DataObsMgrClient::UnregisterObserverExt(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver)
+{
+    if (remoteObject_ == nullptr) {
+        ErrCode err = Connect();
+        if (err != ERR_OK) {
+            return DATAOBS_SERVICE_NOT_CONNECTED;
+        }
+    }
+    sptr<IDataObsMgr> doms = iface_cast<IDataObsMgr>(remoteObject_);
+    return doms->UnregisterObserverExt(uri, dataObserver);
+}
+
 /**
  * Connect dataobs manager service.
  *
@@ -12,25 +12,36 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+
 #include "dataobs_mgr_inner.h"
 
+#include <algorithm>
+
 #include "data_ability_observer_stub.h"
 #include "dataobs_mgr_errors.h"
 #include "hilog_wrapper.h"
 
 namespace OHOS {
 namespace AAFwk {
-
-std::mutex DataObsMgrInner::innerMutex_;
+namespace {
+const std::string NOTIFY_TASK_NAME = "DataObsNotify";
+const int NOTIFY_POOL_SIZE = 4;
+const int64_t DEFAULT_NOTIFY_COALESCE_WINDOW_MS = 10;
+}  // namespace
 
 DataObsMgrInner::DataObsMgrInner()
 {
     taskCount_.store(0);
+    coalesceWindowMs_.store(DEFAULT_NOTIFY_COALESCE_WINDOW_MS);
+    droppedNotifyCount_.store(0);
 }
 
 DataObsMgrInner::~DataObsMgrInner()
 {
     taskCount_.store(0);
+    if (notifyExecutor_ != nullptr) {
+        notifyExecutor_->Stop();
+    }
 }
 
 void DataObsMgrInner::SetHandler(const std::shared_ptr<EventHandler> &handler)
@@ -41,14 +52,12 @@ void DataObsMgrInner::SetHandler(const std::shared_ptr<EventHandler> &handler)
 int DataObsMgrInner::HandleRegisterObserver(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver)
 {
     HILOG_INFO("DataObsMgrInner::HandleRegisterObserver called start");
-    std::lock_guard<std::mutex> lock_l(innerMutex_);
+    std::unique_lock<std::shared_mutex> lock_l(innerMutex_);
 
-    ObsListType obslist;
-    bool exist = GetObsListFromMap(uri, obslist);
-
-    auto obs = obslist.begin();
-    for (; obs != obslist.end(); obs++) {
+    auto &obslist = obsmap_[uri.ToString()];
+    for (auto obs = obslist.begin(); obs != obslist.end(); obs++) {
         if ((*obs)->AsObject() == dataObserver->AsObject()) {
+            AtomicSubTaskCount();
             HILOG_ERROR("DataObsMgrInner::HandleRegisterObserver the obs exist. no need to register.");
             return OBS_EXIST;
         }
@@ -58,12 +67,6 @@ int DataObsMgrInner::HandleRegisterObserver(const Uri &uri, const sptr<IDataAbil
 
     AddObsDeathRecipient(dataObserver);
 
-    if (exist) {
-        obsmap_.erase(uri.ToString());
-    }
-
-    obsmap_.emplace(uri.ToString(), obslist);
-
     AtomicSubTaskCount();
 
     HILOG_INFO("DataObsMgrInner::HandleRegisterObserver called end");
@@ -73,15 +76,16 @@ int DataObsMgrInner::HandleRegisterObserver(const Uri &uri, const sptr<IDataAbil
 int DataObsMgrInner::HandleUnregisterObserver(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver)
 {
     HILOG_INFO("DataObsMgrInner::HandleUnregisterObserver called start");
-    std::lock_guard<std::mutex> lock_l(innerMutex_);
+    std::unique_lock<std::shared_mutex> lock_l(innerMutex_);
 
-    ObsListType obslist;
-    if (!GetObsListFromMap(uri, obslist)) {
+    auto it = obsmap_.find(uri.ToString());
+    if (it == obsmap_.end()) {
         AtomicSubTaskCount();
         HILOG_ERROR("DataObsMgrInner::HandleUnregisterObserver there is no obs in the uri.");
         return NO_OBS_FOR_URI;
     }
 
+    auto &obslist = it->second;
     HILOG_INFO("DataObsMgrInner::HandleUnregisterObserver obslist size is %{public}zu", obslist.size());
     auto obs = obslist.begin();
     for (; obs != obslist.end(); obs++) {
@@ -95,10 +99,9 @@ int DataObsMgrInner::HandleUnregisterObserver(const Uri &uri, const sptr<IDataAb
         return NO_OBS_FOR_URI;
     }
     sptr<IDataAbilityObserver> removeObs = *obs;
-    obslist.remove(removeObs);
-    obsmap_.erase(uri.ToString());
-    if (!obslist.empty()) {
-        obsmap_.emplace(uri.ToString(), obslist);
+    obslist.erase(obs);
+    if (obslist.empty()) {
+        obsmap_.erase(it);
     }
 
     if (!ObsExistInMap(removeObs)) {
@@ -110,46 +113,222 @@ int DataObsMgrInner::HandleUnregisterObserver(const Uri &uri, const sptr<IDataAb
     return NO_ERROR;
 }
 
+int DataObsMgrInner::HandleRegisterObserverExt(
+    const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver, bool isDescendants)
+{
+    if (!isDescendants) {
+        return HandleRegisterObserver(uri, dataObserver);
+    }
+
+    HILOG_INFO("DataObsMgrInner::HandleRegisterObserverExt called start");
+    std::vector<std::string> keys;
+    GetTrieKeys(uri.ToString(), keys);
+    std::unique_lock<std::shared_mutex> lock_l(innerMutex_);
+
+    ObsTrieNode *node = &obsTrie_;
+    for (const auto &key : keys) {
+        auto &child = node->children[key];
+        if (child == nullptr) {
+            child = std::make_unique<ObsTrieNode>();
+        }
+        node = child.get();
+    }
+
+    for (const auto &obs : node->obsList) {
+        if (obs->AsObject() == dataObserver->AsObject()) {
+            AtomicSubTaskCount();
+            HILOG_ERROR("DataObsMgrInner::HandleRegisterObserverExt the obs exist. no need to register.");
+            return OBS_EXIST;
+        }
+    }
+    node->obsList.push_back(dataObserver);
+
+    AddObsDeathRecipient(dataObserver);
+
+    AtomicSubTaskCount();
+    HILOG_INFO("DataObsMgrInner::HandleRegisterObserverExt called end");
+    return NO_ERROR;
+}
+
+int DataObsMgrInner::HandleUnregisterObserverExt(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver)
+{
+    HILOG_INFO("DataObsMgrInner::HandleUnregisterObserverExt called start");
+    std::vector<std::string> keys;
+    GetTrieKeys(uri.ToString(), keys);
+    std::unique_lock<std::shared_mutex> lock_l(innerMutex_);
+
+    // the nodes from the root down to the uri, to prune the ones left empty
+    std::vector<ObsTrieNode *> path = { &obsTrie_ };
+    for (const auto &key : keys) {
+        auto it = path.back()->children.find(key);
+        if (it == path.back()->children.end()) {
+            AtomicSubTaskCount();
+            HILOG_ERROR("DataObsMgrInner::HandleUnregisterObserverExt there is no obs in the uri.");
+            return NO_OBS_FOR_URI;
+        }
+        path.push_back(it->second.get());
+    }
+
+    auto &obslist = path.back()->obsList;
+    auto obs = std::find_if(obslist.begin(), obslist.end(), [&dataObserver](const sptr<IDataAbilityObserver> &item) {
+        return item->AsObject() == dataObserver->AsObject();
+    });
+    if (obs == obslist.end()) {
+        AtomicSubTaskCount();
+        HILOG_ERROR("DataObsMgrInner::HandleUnregisterObserverExt the obs is not registered to the uri.");
+        return NO_OBS_FOR_URI;
+    }
+    sptr<IDataAbilityObserver> removeObs = *obs;
+    obslist.erase(obs);
+
+    for (size_t i = keys.size(); i > 0; i--) {
+        ObsTrieNode *node = path[i];
+        if (!node->obsList.empty() || !node->children.empty()) {
+            break;
+        }
+        path[i - 1]->children.erase(keys[i - 1]);
+    }
+
+    if (!ObsExistInMap(removeObs)) {
+        RemoveObsDeathRecipient(removeObs);
+    }
+
+    AtomicSubTaskCount();
+    HILOG_INFO("DataObsMgrInner::HandleUnregisterObserverExt called end");
+    return NO_ERROR;
+}
+
 int DataObsMgrInner::HandleNotifyChange(const Uri &uri)
 {
     HILOG_INFO("DataObsMgrInner::HandleNotifyChange called start");
-    std::lock_guard<std::mutex> lock_l(innerMutex_);
+    std::string uriString = uri.ToString();
+    std::vector<std::string> keys;
+    GetTrieKeys(uriString, keys);
+    {
+        std::shared_lock<std::shared_mutex> lock_l(innerMutex_);
+        ObsListType obslist;
+        if (obsmap_.find(uriString) == obsmap_.end() && !GetDescendantsObsList(keys, obslist)) {
+            AtomicSubTaskCount();
+            HILOG_INFO("DataObsMgrInner::HandleNotifyChange there is no obs in the uri.");
+            return NO_OBS_FOR_URI;
+        }
+    }
 
-    ObsListType obslist;
-    if (!GetObsListFromMap(uri, obslist)) {
+    if (handler_ == nullptr) {
         AtomicSubTaskCount();
-        HILOG_INFO("DataObsMgrInner::HandleNotifyChange there is no obs in the uri.");
-        return NO_OBS_FOR_URI;
+        DispatchNotifyChange(uriString, keys);
+        return NO_ERROR;
     }
 
-    for (auto obs : obslist) {
-        if (obs != nullptr) {
-            obs->OnChange();
+    {
+        std::lock_guard<std::mutex> lock_n(notifyMutex_);
+        if (!pendingNotify_.insert(uriString).second) {
+            // the queued notification has not taken its observer snapshot yet, it covers this change too
+            droppedNotifyCount_.fetch_add(1);
+            AtomicSubTaskCount();
+            HILOG_DEBUG("DataObsMgrInner::HandleNotifyChange merged into the queued notification");
+            return NO_ERROR;
         }
     }
 
+    PostNotifyTask(uriString, keys);
     AtomicSubTaskCount();
-    HILOG_INFO("DataObsMgrInner::HandleNotifyChange called end %{public}zu", obslist.size());
+    HILOG_INFO("DataObsMgrInner::HandleNotifyChange called end");
     return NO_ERROR;
 }
 
-bool DataObsMgrInner::CheckNeedLimmit()
+void DataObsMgrInner::PostNotifyTask(const std::string &uriString, const std::vector<std::string> &keys)
 {
-    return (taskCount_.load() >= taskCount_max_) ? true : false;
+    std::weak_ptr<DataObsMgrInner> weakInner = shared_from_this();
+    auto task = [weakInner, uriString, keys]() {
+        auto dataObsMgrInner = weakInner.lock();
+        if (dataObsMgrInner == nullptr) {
+            return;
+        }
+        dataObsMgrInner->CreateNotifyExecutor();
+        DataObsMgrInner *inner = dataObsMgrInner.get();
+        // the executor is stopped by the destructor before the inner goes away
+        dataObsMgrInner->notifyExecutor_->AddTask(
+            [inner, uriString, keys]() { inner->DispatchNotifyChange(uriString, keys); });
+    };
+    if (!handler_->PostTask(task, NOTIFY_TASK_NAME, coalesceWindowMs_.load())) {
+        HILOG_ERROR("DataObsMgrInner::PostNotifyTask PostTask error");
+        std::lock_guard<std::mutex> lock_n(notifyMutex_);
+        pendingNotify_.erase(uriString);
+    }
 }
 
-bool DataObsMgrInner::CheckRegisteFull(const Uri &uri)
+void DataObsMgrInner::CreateNotifyExecutor()
 {
-    std::lock_guard<std::mutex> lock_l(innerMutex_);
+    // only called on the handler thread
+    if (notifyExecutor_ == nullptr) {
+        notifyExecutor_ = std::make_unique<ThreadPool>("DataObsNotify");
+        notifyExecutor_->Start(NOTIFY_POOL_SIZE);
+    }
+}
+
+void DataObsMgrInner::DispatchNotifyChange(const std::string &uriString, const std::vector<std::string> &keys)
+{
+    {
+        std::lock_guard<std::mutex> lock_n(notifyMutex_);
+        pendingNotify_.erase(uriString);
+    }
 
     ObsListType obslist;
-    if (GetObsListFromMap(uri, obslist)) {
-        // The obs size for input uri has been lager than max.
-        if (obslist.size() >= obs_max_) {
-            return true;
+    {
+        std::shared_lock<std::shared_mutex> lock_l(innerMutex_);
+        bool exist = GetObsListFromMap(uriString, obslist);
+        if (!GetDescendantsObsList(keys, obslist) && !exist) {
+            return;
         }
     }
-    return false;
+
+    // an observer registered both for the uri and for one of its ancestors is called once
+    std::unordered_set<IRemoteObject *> notified;
+    for (auto &obs : obslist) {
+        if (obs != nullptr && notified.insert(obs->AsObject().GetRefPtr()).second) {
+            obs->OnChange();
+        }
+    }
+    HILOG_INFO("DataObsMgrInner::DispatchNotifyChange called end %{public}zu", obslist.size());
+}
+
+void DataObsMgrInner::SetNotifyCoalesceWindow(int64_t windowMs)
+{
+    coalesceWindowMs_.store(windowMs < 0 ? 0 : windowMs);
+}
+
+size_t DataObsMgrInner::GetNotifyQueueDepth()
+{
+    std::lock_guard<std::mutex> lock_n(notifyMutex_);
+    return pendingNotify_.size();
+}
+
+int64_t DataObsMgrInner::GetDroppedNotifyCount() const
+{
+    return droppedNotifyCount_.load();
+}
+
+bool DataObsMgrInner::CheckNeedLimmit()
+{
+    return (taskCount_.load() >= taskCount_max_) ? true : false;
+}
+
+bool DataObsMgrInner::CheckRegisteFull(const Uri &uri, bool isDescendants)
+{
+    if (isDescendants) {
+        std::vector<std::string> keys;
+        GetTrieKeys(uri.ToString(), keys);
+        std::shared_lock<std::shared_mutex> lock_l(innerMutex_);
+        ObsTrieNode *node = FindTrieNode(keys);
+        return (node != nullptr) && (node->obsList.size() >= obs_max_);
+    }
+
+    std::shared_lock<std::shared_mutex> lock_l(innerMutex_);
+
+    auto it = obsmap_.find(uri.ToString());
+    // The obs size for input uri has been lager than max.
+    return (it != obsmap_.end()) && (it->second.size() >= obs_max_);
 }
 
 void DataObsMgrInner::AtomicAddTaskCount()
@@ -164,7 +343,12 @@ void DataObsMgrInner::AtomicSubTaskCount()
 
 bool DataObsMgrInner::GetObsListFromMap(const Uri &uri, ObsListType &obslist)
 {
-    auto it = obsmap_.find(uri.ToString());
+    return GetObsListFromMap(uri.ToString(), obslist);
+}
+
+bool DataObsMgrInner::GetObsListFromMap(const std::string &uriString, ObsListType &obslist)
+{
+    auto it = obsmap_.find(uriString);
     if (it == obsmap_.end()) {
         return false;
     }
@@ -173,6 +357,74 @@ bool DataObsMgrInner::GetObsListFromMap(const Uri &uri, ObsListType &obslist)
     return true;
 }
 
+void DataObsMgrInner::GetTrieKeys(const std::string &uriString, std::vector<std::string> &keys)
+{
+    Uri uri(uriString);
+    keys.clear();
+    keys.push_back(uri.GetScheme() + "://" + uri.GetAuthority());
+    std::vector<std::string> segments;
+    uri.GetPathSegments(segments);
+    keys.insert(keys.end(), segments.begin(), segments.end());
+}
+
+bool DataObsMgrInner::GetDescendantsObsList(const std::vector<std::string> &keys, ObsListType &obslist)
+{
+    // only the ancestors of the uri and the uri itself are visited
+    bool exist = false;
+    const ObsTrieNode *node = &obsTrie_;
+    for (const auto &key : keys) {
+        auto it = node->children.find(key);
+        if (it == node->children.end()) {
+            break;
+        }
+        node = it->second.get();
+        if (!node->obsList.empty()) {
+            obslist.insert(obslist.end(), node->obsList.begin(), node->obsList.end());
+            exist = true;
+        }
+    }
+    return exist;
+}
+
+DataObsMgrInner::ObsTrieNode *DataObsMgrInner::FindTrieNode(const std::vector<std::string> &keys)
+{
+    ObsTrieNode *node = &obsTrie_;
+    for (const auto &key : keys) {
+        auto it = node->children.find(key);
+        if (it == node->children.end()) {
+            return nullptr;
+        }
+        node = it->second.get();
+    }
+    return node;
+}
+
+bool DataObsMgrInner::RemoveObsFromTrie(ObsTrieNode &node, const sptr<IDataAbilityObserver> &dataObserver)
+{
+    node.obsList.remove(dataObserver);
+    for (auto it = node.children.begin(); it != node.children.end();) {
+        if (RemoveObsFromTrie(*it->second, dataObserver)) {
+            it = node.children.erase(it);
+        } else {
+            it++;
+        }
+    }
+    return node.obsList.empty() && node.children.empty();
+}
+
+bool DataObsMgrInner::ObsExistInTrie(const ObsTrieNode &node, const sptr<IDataAbilityObserver> &dataObserver)
+{
+    if (std::find(node.obsList.begin(), node.obsList.end(), dataObserver) != node.obsList.end()) {
+        return true;
+    }
+    for (const auto &child : node.children) {
+        if (ObsExistInTrie(*child.second, dataObserver)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void DataObsMgrInner::AddObsDeathRecipient(const sptr<IDataAbilityObserver> &dataObserver)
 {
     if ((dataObserver == nullptr) || dataObserver->AsObject() == nullptr) {
@@ -223,7 +475,7 @@ void DataObsMgrInner::OnCallBackDied(const wptr<IRemoteObject> &remote)
 void DataObsMgrInner::HandleCallBackDiedTask(const sptr<IRemoteObject> &dataObserver)
 {
     HILOG_INFO("%{public}s,called", __func__);
-    std::lock_guard<std::mutex> lock_l(innerMutex_);
+    std::unique_lock<std::shared_mutex> lock_l(innerMutex_);
 
     if (dataObserver == nullptr) {
         return;
@@ -236,17 +488,17 @@ void DataObsMgrInner::HandleCallBackDiedTask(const sptr<IRemoteObject> &dataObse
 
 void DataObsMgrInner::RemoveObsFromMap(const sptr<IDataAbilityObserver> &dataObserver)
 {
-    for (auto &obsCallback : obsmap_) {
-        auto &obsList = obsCallback.second;
-        auto obs = std::find(obsList.begin(), obsList.end(), dataObserver);
-        if (obs != obsList.end()) {
-            obsList.remove(dataObserver);
-            if (obsList.empty()) {
-                HILOG_INFO("%{public}s: remove obsList from map ", __func__);
-                obsmap_.erase(obsCallback.first);
-            }
+    for (auto it = obsmap_.begin(); it != obsmap_.end();) {
+        auto &obsList = it->second;
+        obsList.remove(dataObserver);
+        if (obsList.empty()) {
+            HILOG_INFO("%{public}s: remove obsList from map ", __func__);
+            it = obsmap_.erase(it);
+        } else {
+            it++;
         }
     }
+    RemoveObsFromTrie(obsTrie_, dataObserver);
     RemoveObsDeathRecipient(dataObserver);
 }
 
@@ -259,7 +511,7 @@ bool DataObsMgrInner::ObsExistInMap(const sptr<IDataAbilityObserver> &dataObserv
             return true;
         }
     }
-    return false;
+    return ObsExistInTrie(obsTrie_, dataObserver);
 }
 
 }  // namespace AAFwk
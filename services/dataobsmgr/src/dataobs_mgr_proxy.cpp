@@ -121,5 +121,75 @@ int DataObsManagerProxy::NotifyChange(const Uri &uri)
     return reply.ReadInt32();
 }
 
+int DataObsManagerProxy::RegisterObserverExt(
+    const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver, bool isDescendants)
+{
+    int error;
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+
+    if (!WriteInterfaceToken(data)) {
+        return DATAOBS_PROXY_INNER_ERR;
+    }
+    if (!data.WriteParcelable(&uri)) {
+        HILOG_ERROR("register observer ext fail, uri error");
+        return ERR_INVALID_VALUE;
+    }
+    if (dataObserver == nullptr) {
+        HILOG_ERROR("register observer ext fail, dataObserver is nullptr");
+        return ERR_INVALID_VALUE;
+    }
+
+    if (!data.WriteRemoteObject(dataObserver->AsObject())) {
+        HILOG_ERROR("register observer ext fail, dataObserver error");
+        return ERR_INVALID_VALUE;
+    }
+
+    if (!data.WriteBool(isDescendants)) {
+        HILOG_ERROR("register observer ext fail, isDescendants error");
+        return ERR_INVALID_VALUE;
+    }
+
+    error = Remote()->SendRequest(IDataObsMgr::REGISTER_OBSERVER_EXT, data, reply, option);
+    if (error != NO_ERROR) {
+        HILOG_ERROR("register observer ext fail, error: %d", error);
+        return error;
+    }
+    return reply.ReadInt32();
+}
+
+int DataObsManagerProxy::UnregisterObserverExt(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver)
+{
+    int error;
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+
+    if (!WriteInterfaceToken(data)) {
+        return DATAOBS_PROXY_INNER_ERR;
+    }
+    if (!data.WriteParcelable(&uri)) {
+        HILOG_ERROR("unregister observer ext fail, uri error");
+        return ERR_INVALID_VALUE;
+    }
+    if (dataObserver == nullptr) {
+        HILOG_ERROR("unregister observer ext fail, dataObserver is nullptr");
+        return ERR_INVALID_VALUE;
+    }
+
+    if (!data.WriteRemoteObject(dataObserver->AsObject())) {
+        HILOG_ERROR("unregister observer ext fail, dataObserver error");
+        return ERR_INVALID_VALUE;
+    }
+
+    error = Remote()->SendRequest(IDataObsMgr::UNREGISTER_OBSERVER_EXT, data, reply, option);
+    if (error != NO_ERROR) {
+        HILOG_ERROR("unregister observer ext fail, error: %d", error);
+        return error;
+    }
+    return reply.ReadInt32();
+}
+
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -76,6 +76,9 @@ bool DataObsMgrService::Init()
     }
 
     handler_ = std::make_shared<AppExecFwk::EventHandler>(eventLoop_);
+    if (dataObsMgrInner_ != nullptr) {
+        dataObsMgrInner_->SetHandler(handler_);
+    }
 
     HILOG_INFO("init success");
     return true;
@@ -200,6 +203,83 @@ int DataObsMgrService::NotifyChange(const Uri &uri)
     return NO_ERROR;
 }
 
+int DataObsMgrService::RegisterObserverExt(
+    const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver, bool isDescendants)
+{
+    HILOG_INFO("DataObsMgrService::RegisterObserverExt called start");
+    if (dataObserver == nullptr) {
+        HILOG_ERROR("DataObsMgrService::RegisterObserverExt failed!. dataObserver is nullptr");
+        return DATA_OBSERVER_IS_NULL;
+    }
+
+    if (handler_ == nullptr) {
+        HILOG_ERROR("DataObsMgrService::RegisterObserverExt failed!. handler is nullptr");
+        return DATAOBS_SERVICE_HANDLER_IS_NULL;
+    }
+
+    if (dataObsMgrInner_ == nullptr) {
+        HILOG_ERROR("DataObsMgrService::RegisterObserverExt failed!. dataObsMgrInner_ is nullptr");
+        return DATAOBS_SERVICE_INNER_IS_NULL;
+    }
+
+    if (dataObsMgrInner_->CheckNeedLimmit()) {
+        return DATAOBS_SERVICE_TASK_LIMMIT;
+    }
+
+    if (dataObsMgrInner_->CheckRegisteFull(uri, isDescendants)) {
+        return DATAOBS_SERVICE_OBS_LIMMIT;
+    }
+
+    std::function<void()> registerObserverFunc = std::bind(
+        &DataObsMgrInner::HandleRegisterObserverExt, dataObsMgrInner_, uri, dataObserver, isDescendants);
+
+    dataObsMgrInner_->AtomicAddTaskCount();
+    bool ret = handler_->PostTask(registerObserverFunc);
+    if (!ret) {
+        dataObsMgrInner_->AtomicSubTaskCount();
+        HILOG_ERROR("DataObsMgrService::RegisterObserverExt PostTask error");
+        return DATAOBS_SERVICE_POST_TASK_FAILED;
+    }
+    HILOG_INFO("DataObsMgrService::RegisterObserverExt called end");
+    return NO_ERROR;
+}
+
+int DataObsMgrService::UnregisterObserverExt(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver)
+{
+    HILOG_INFO("DataObsMgrService::UnregisterObserverExt called start");
+    if (dataObserver == nullptr) {
+        HILOG_ERROR("DataObsMgrService::UnregisterObserverExt failed!. dataObserver is nullptr");
+        return DATA_OBSERVER_IS_NULL;
+    }
+
+    if (handler_ == nullptr) {
+        HILOG_ERROR("DataObsMgrService::UnregisterObserverExt failed!. handler is nullptr");
+        return DATAOBS_SERVICE_HANDLER_IS_NULL;
+    }
+
+    if (dataObsMgrInner_ == nullptr) {
+        HILOG_ERROR("DataObsMgrService::UnregisterObserverExt failed!. dataObsMgrInner_ is nullptr");
+        return DATAOBS_SERVICE_INNER_IS_NULL;
+    }
+
+    if (dataObsMgrInner_->CheckNeedLimmit()) {
+        return DATAOBS_SERVICE_TASK_LIMMIT;
+    }
+
+    std::function<void()> unregisterObserverFunc =
+        std::bind(&DataObsMgrInner::HandleUnregisterObserverExt, dataObsMgrInner_, uri, dataObserver);
+
+    dataObsMgrInner_->AtomicAddTaskCount();
+    bool ret = handler_->PostSyncTask(unregisterObserverFunc);
+    if (!ret) {
+        dataObsMgrInner_->AtomicSubTaskCount();
+        HILOG_ERROR("DataObsMgrService::UnregisterObserverExt PostTask error");
+        return DATAOBS_SERVICE_POST_TASK_FAILED;
+    }
+    HILOG_INFO("DataObsMgrService::UnregisterObserverExt called end");
+    return NO_ERROR;
+}
+
 std::shared_ptr<EventHandler> DataObsMgrService::GetEventHandler()
 {
     return handler_;
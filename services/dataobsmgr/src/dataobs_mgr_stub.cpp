@@ -30,6 +30,9 @@ DataObsManagerStub::DataObsManagerStub()
     requestFuncMap_[REGISTER_OBSERVER] = &DataObsManagerStub::RegisterObserverInner;
     requestFuncMap_[UNREGISTER_OBSERVER] = &DataObsManagerStub::UnregisterObserverInner;
     requestFuncMap_[NOTIFY_CHANGE] = &DataObsManagerStub::NotifyChangeInner;
+    requestFuncMap_[REGISTER_OBSERVER_EXT] = &DataObsManagerStub::RegisterObserverExtInner;
+    requestFuncMap_[UNREGISTER_OBSERVER_EXT] = &DataObsManagerStub::UnregisterObserverExtInner;
+    dispatchTable_.Build(requestFuncMap_);
 }
 
 DataObsManagerStub::~DataObsManagerStub()
@@ -47,12 +50,9 @@ int DataObsManagerStub::OnRemoteRequest(uint32_t code, MessageParcel &data, Mess
         return ERR_INVALID_STATE;
     }
 
-    auto itFunc = requestFuncMap_.find(code);
-    if (itFunc != requestFuncMap_.end()) {
-        auto requestFunc = itFunc->second;
-        if (requestFunc != nullptr) {
-            return (this->*requestFunc)(data, reply);
-        }
+    int result = ERR_OK;
+    if (dispatchTable_.Dispatch(this, code, data, reply, result)) {
+        return result;
     }
     HILOG_WARN("DataObsManagerStub::OnRemoteRequest, default case, need check.");
     return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
@@ -108,5 +108,32 @@ int DataObsManagerStub::NotifyChangeInner(MessageParcel &data, MessageParcel &re
     return NO_ERROR;
 }
 
+int DataObsManagerStub::RegisterObserverExtInner(MessageParcel &data, MessageParcel &reply)
+{
+    std::unique_ptr<Uri> uri(data.ReadParcelable<Uri>());
+    if (uri == nullptr) {
+        HILOG_ERROR("DataObsManagerStub: uri is nullptr");
+        return ERR_INVALID_VALUE;
+    }
+
+    auto observer = iface_cast<IDataAbilityObserver>(data.ReadRemoteObject());
+    bool isDescendants = data.ReadBool();
+    reply.WriteInt32(RegisterObserverExt(*uri, observer, isDescendants));
+    return NO_ERROR;
+}
+
+int DataObsManagerStub::UnregisterObserverExtInner(MessageParcel &data, MessageParcel &reply)
+{
+    std::unique_ptr<Uri> uri(data.ReadParcelable<Uri>());
+    if (uri == nullptr) {
+        HILOG_ERROR("DataObsManagerStub: uri is nullptr");
+        return ERR_INVALID_VALUE;
+    }
+
+    auto observer = iface_cast<IDataAbilityObserver>(data.ReadRemoteObject());
+    reply.WriteInt32(UnregisterObserverExt(*uri, observer));
+    return NO_ERROR;
+}
+
 }  // namespace AAFwk
 }  // namespace OHOS
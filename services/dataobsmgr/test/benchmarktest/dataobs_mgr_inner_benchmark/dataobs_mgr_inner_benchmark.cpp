@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+
+#include "data_ability_observer_stub.h"
+#include "uri.h"
+#define private public
+#include "dataobs_mgr_inner.h"
+#undef private
+
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+const std::string PROVIDER_URI = "dataability:///com.example.contacts/";
+constexpr int64_t TABLE_COUNT = 100;
+
+class BenchmarkObserver : public DataAbilityObserverStub {
+public:
+    void OnChange() override
+    {
+        changeCount_++;
+    }
+
+    int64_t changeCount_ = 0;
+};
+
+std::string GetRowUri(int64_t row)
+{
+    return PROVIDER_URI + "table" + std::to_string(row % TABLE_COUNT) + "/" + std::to_string(row);
+}
+
+std::string GetTableUri(int64_t row)
+{
+    return PROVIDER_URI + "table" + std::to_string(row % TABLE_COUNT);
+}
+
+void BenchmarkRegisterRows(benchmark::State &state)
+{
+    // an app watching its tables had to register one observer per row
+    auto dataObsMgrInner = std::make_shared<DataObsMgrInner>();
+    sptr<IDataAbilityObserver> observer = new BenchmarkObserver();
+    for (auto _ : state) {
+        for (int64_t row = 0; row < state.range(0); row++) {
+            dataObsMgrInner->HandleRegisterObserver(Uri(GetRowUri(row)), observer);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BenchmarkRegisterTables(benchmark::State &state)
+{
+    auto dataObsMgrInner = std::make_shared<DataObsMgrInner>();
+    sptr<IDataAbilityObserver> observer = new BenchmarkObserver();
+    for (auto _ : state) {
+        for (int64_t table = 0; table < TABLE_COUNT; table++) {
+            dataObsMgrInner->HandleRegisterObserverExt(Uri(GetTableUri(table)), observer, true);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * TABLE_COUNT);
+}
+
+void BenchmarkNotifyRows(benchmark::State &state)
+{
+    auto dataObsMgrInner = std::make_shared<DataObsMgrInner>();
+    sptr<IDataAbilityObserver> observer = new BenchmarkObserver();
+    for (int64_t row = 0; row < state.range(0); row++) {
+        dataObsMgrInner->HandleRegisterObserver(Uri(GetRowUri(row)), observer);
+    }
+    Uri uri(GetRowUri(state.range(0) / 2));
+    for (auto _ : state) {
+        // without a handler the observers are called synchronously
+        dataObsMgrInner->HandleNotifyChange(uri);
+    }
+}
+
+void BenchmarkNotifyDescendants(benchmark::State &state)
+{
+    // the same number of registered uris, all of them for their descendants
+    auto dataObsMgrInner = std::make_shared<DataObsMgrInner>();
+    sptr<IDataAbilityObserver> observer = new BenchmarkObserver();
+    for (int64_t row = 0; row < state.range(0); row++) {
+        dataObsMgrInner->HandleRegisterObserverExt(Uri(GetRowUri(row)), observer, true);
+    }
+    Uri uri(GetRowUri(state.range(0) / 2) + "/detail");
+    for (auto _ : state) {
+        dataObsMgrInner->HandleNotifyChange(uri);
+    }
+}
+}  // namespace
+
+BENCHMARK(BenchmarkRegisterRows)->Arg(1000)->Arg(100000)->Iterations(1);
+BENCHMARK(BenchmarkRegisterTables)->Iterations(1);
+BENCHMARK(BenchmarkNotifyRows)->Arg(1000)->Arg(100000);
+BENCHMARK(BenchmarkNotifyDescendants)->Arg(1000)->Arg(100000);
+
+BENCHMARK_MAIN();
@@ -33,6 +33,8 @@ public:
     MOCK_METHOD2(RegisterObserverCall, int(const Uri &, const sptr<IDataAbilityObserver> &));
     MOCK_METHOD2(UnregisterObserverCall, int(const Uri &, const sptr<IDataAbilityObserver> &));
     MOCK_METHOD1(NotifyChangeCall, int(const Uri &));
+    MOCK_METHOD3(RegisterObserverExtCall, int(const Uri &, const sptr<IDataAbilityObserver> &, bool));
+    MOCK_METHOD2(UnregisterObserverExtCall, int(const Uri &, const sptr<IDataAbilityObserver> &));
 
     int RegisterObserver(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver)
     {
@@ -49,6 +51,16 @@ public:
         NotifyChangeCall(uri);
         return 1;
     }
+    int RegisterObserverExt(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver, bool isDescendants)
+    {
+        RegisterObserverExtCall(uri, dataObserver, isDescendants);
+        return 1;
+    }
+    int UnregisterObserverExt(const Uri &uri, const sptr<IDataAbilityObserver> &dataObserver)
+    {
+        UnregisterObserverExtCall(uri, dataObserver);
+        return 1;
+    }
 
     void OnStart()
     {
@@ -19,7 +19,9 @@
 #include "uri.h"
 #define private public
 #include "data_ability_observer_proxy.h"
+#include "dataobs_mgr_errors.h"
 #include "dataobs_mgr_inner.h"
+#include "event_runner.h"
 #include "mock_data_ability_observer_stub.h"
 
 using namespace OHOS;
@@ -32,6 +34,10 @@ using ObsRecipientMapType = OHOS::AAFwk::DataObsMgrInner::ObsRecipientMapType;
 
 namespace OHOS {
 namespace AAFwk {
+namespace {
+const int64_t TEST_COALESCE_WINDOW_MS = 100;
+const int TEST_NOTIFY_COUNT = 3;
+}  // namespace
 
 class DataObsMgrInnerTest : public testing::Test {
 public:
@@ -171,5 +177,131 @@ HWTEST_F(DataObsMgrInnerTest, DataObsMgrInner_AddRemove_ObsDeathRecipient_0100,
     EXPECT_EQ(false, it != dataObsMgrInner_->recipientMap_.end());
 }
 
+/*
+ * Feature: DataObsMgrInner
+ * Function: HandleRegisterObserver/HandleUnregisterObserver function test
+ * SubFunction: NA
+ * FunctionPoints: The observers of a uri are updated in place, the uri is gone with its last observer.
+ * EnvConditions: NA
+ * CaseDescription: Register two observers to a uri, and unregister them one by one.
+ */
+HWTEST_F(DataObsMgrInnerTest, DataObsMgrInner_HandleUnregisterObserver_0100, TestSize.Level1)
+{
+    auto dataObsMgrInner = std::make_shared<DataObsMgrInner>();
+    Uri uri("dataability://device_id/com.domainname.dataability.persondata/person/10");
+    sptr<MockDataAbilityObserverStub> mockDataAbilityObserverStub(new (std::nothrow) MockDataAbilityObserverStub());
+    const sptr<IDataAbilityObserver> callback(new (std::nothrow) DataAbilityObserverProxy(mockDataAbilityObserverStub));
+    sptr<MockDataAbilityObserverStub> mockDataAbilityObserverStub2(new (std::nothrow) MockDataAbilityObserverStub());
+    const sptr<IDataAbilityObserver> callback2(
+        new (std::nothrow) DataAbilityObserverProxy(mockDataAbilityObserverStub2));
+
+    EXPECT_EQ(NO_ERROR, dataObsMgrInner->HandleRegisterObserver(uri, callback));
+    EXPECT_EQ(NO_ERROR, dataObsMgrInner->HandleRegisterObserver(uri, callback2));
+    EXPECT_EQ(OBS_EXIST, dataObsMgrInner->HandleRegisterObserver(uri, callback));
+
+    EXPECT_EQ(NO_ERROR, dataObsMgrInner->HandleUnregisterObserver(uri, callback));
+    ObsListType obslist;
+    EXPECT_EQ(true, dataObsMgrInner->GetObsListFromMap(uri, obslist));
+    EXPECT_EQ((std::size_t)1, obslist.size());
+    EXPECT_EQ(NO_OBS_FOR_URI, dataObsMgrInner->HandleUnregisterObserver(uri, callback));
+
+    EXPECT_EQ(NO_ERROR, dataObsMgrInner->HandleUnregisterObserver(uri, callback2));
+    EXPECT_EQ(true, dataObsMgrInner->obsmap_.empty());
+    EXPECT_EQ(false, dataObsMgrInner->ObsExistInMap(callback2));
+}
+
+/*
+ * Feature: DataObsMgrInner
+ * Function: HandleNotifyChange function test
+ * SubFunction: OnChange
+ * FunctionPoints: Repeated changes of a uri within the coalesce window call its observers once.
+ * EnvConditions: NA
+ * CaseDescription: Notify the same uri several times with a handler set, and wait for the observer.
+ */
+HWTEST_F(DataObsMgrInnerTest, DataObsMgrInner_HandleNotifyChange_0200, TestSize.Level1)
+{
+    auto dataObsMgrInner = std::make_shared<DataObsMgrInner>();
+    auto runner = AppExecFwk::EventRunner::Create("DataObsMgrInnerTest");
+    dataObsMgrInner->SetHandler(std::make_shared<AppExecFwk::EventHandler>(runner));
+    dataObsMgrInner->SetNotifyCoalesceWindow(TEST_COALESCE_WINDOW_MS);
+
+    Uri uri("dataability://device_id/com.domainname.dataability.persondata/person/10");
+    sptr<MockDataAbilityObserverStub> mockDataAbilityObserverStub(new (std::nothrow) MockDataAbilityObserverStub());
+    EXPECT_CALL(*mockDataAbilityObserverStub, OnChange())
+        .Times(1)
+        .WillOnce(Invoke(mockDataAbilityObserverStub.GetRefPtr(), &MockDataAbilityObserverStub::PostVoid));
+    const sptr<IDataAbilityObserver> callback(new (std::nothrow) DataAbilityObserverProxy(mockDataAbilityObserverStub));
+    dataObsMgrInner->HandleRegisterObserver(uri, callback);
+
+    for (int i = 0; i < TEST_NOTIFY_COUNT; i++) {
+        EXPECT_EQ(NO_ERROR, dataObsMgrInner->HandleNotifyChange(uri));
+    }
+    EXPECT_EQ((std::size_t)1, dataObsMgrInner->GetNotifyQueueDepth());
+    EXPECT_EQ(TEST_NOTIFY_COUNT - 1, dataObsMgrInner->GetDroppedNotifyCount());
+
+    mockDataAbilityObserverStub->Wait();
+    EXPECT_EQ((std::size_t)0, dataObsMgrInner->GetNotifyQueueDepth());
+}
+
+/*
+ * Feature: DataObsMgrInner
+ * Function: HandleRegisterObserverExt function test
+ * SubFunction: OnChange
+ * FunctionPoints: An observer registered for descendants is notified of the changes of the uri and below it.
+ * EnvConditions: NA
+ * CaseDescription: Register an observer for a table, notify a row, the table and another table.
+ */
+HWTEST_F(DataObsMgrInnerTest, DataObsMgrInner_HandleRegisterObserverExt_0100, TestSize.Level1)
+{
+    auto dataObsMgrInner = std::make_shared<DataObsMgrInner>();
+    Uri tableUri("dataability://device_id/com.domainname.dataability.persondata/person");
+    Uri rowUri("dataability://device_id/com.domainname.dataability.persondata/person/10");
+    Uri otherUri("dataability://device_id/com.domainname.dataability.persondata/company/10");
+    sptr<MockDataAbilityObserverStub> mockDataAbilityObserverStub(new (std::nothrow) MockDataAbilityObserverStub());
+    const sptr<IDataAbilityObserver> callback(new (std::nothrow) DataAbilityObserverProxy(mockDataAbilityObserverStub));
+
+    EXPECT_EQ(NO_ERROR, dataObsMgrInner->HandleRegisterObserverExt(tableUri, callback, true));
+    EXPECT_EQ(OBS_EXIST, dataObsMgrInner->HandleRegisterObserverExt(tableUri, callback, true));
+    // registered for the row too, it is still called once for a change of the row
+    EXPECT_EQ(NO_ERROR, dataObsMgrInner->HandleRegisterObserverExt(rowUri, callback, false));
+
+    EXPECT_CALL(*mockDataAbilityObserverStub, OnChange()).Times(2);
+    EXPECT_EQ(NO_ERROR, dataObsMgrInner->HandleNotifyChange(rowUri));
+    EXPECT_EQ(NO_ERROR, dataObsMgrInner->HandleNotifyChange(tableUri));
+    EXPECT_EQ(NO_OBS_FOR_URI, dataObsMgrInner->HandleNotifyChange(otherUri));
+}
+
+/*
+ * Feature: DataObsMgrInner
+ * Function: HandleUnregisterObserverExt function test
+ * SubFunction: NA
+ * FunctionPoints: The nodes left without observers are removed from the trie.
+ * EnvConditions: NA
+ * CaseDescription: Register observers for descendants of a table and of a row, and unregister them.
+ */
+HWTEST_F(DataObsMgrInnerTest, DataObsMgrInner_HandleUnregisterObserverExt_0100, TestSize.Level1)
+{
+    auto dataObsMgrInner = std::make_shared<DataObsMgrInner>();
+    Uri tableUri("dataability://device_id/com.domainname.dataability.persondata/person");
+    Uri rowUri("dataability://device_id/com.domainname.dataability.persondata/person/10");
+    sptr<MockDataAbilityObserverStub> mockDataAbilityObserverStub(new (std::nothrow) MockDataAbilityObserverStub());
+    const sptr<IDataAbilityObserver> callback(new (std::nothrow) DataAbilityObserverProxy(mockDataAbilityObserverStub));
+    sptr<MockDataAbilityObserverStub> mockDataAbilityObserverStub2(new (std::nothrow) MockDataAbilityObserverStub());
+    const sptr<IDataAbilityObserver> callback2(
+        new (std::nothrow) DataAbilityObserverProxy(mockDataAbilityObserverStub2));
+
+    EXPECT_EQ(NO_ERROR, dataObsMgrInner->HandleRegisterObserverExt(tableUri, callback, true));
+    EXPECT_EQ(NO_ERROR, dataObsMgrInner->HandleRegisterObserverExt(rowUri, callback2, true));
+    EXPECT_EQ(false, dataObsMgrInner->CheckRegisteFull(tableUri, true));
+
+    EXPECT_EQ(NO_ERROR, dataObsMgrInner->HandleUnregisterObserverExt(rowUri, callback2));
+    EXPECT_EQ(NO_OBS_FOR_URI, dataObsMgrInner->HandleUnregisterObserverExt(rowUri, callback2));
+    EXPECT_EQ(false, dataObsMgrInner->ObsExistInMap(callback2));
+    EXPECT_EQ(true, dataObsMgrInner->ObsExistInMap(callback));
+
+    EXPECT_EQ(NO_ERROR, dataObsMgrInner->HandleUnregisterObserverExt(tableUri, callback));
+    EXPECT_EQ(true, dataObsMgrInner->obsTrie_.children.empty());
+}
+
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
@@ -56,7 +56,7 @@ HWTEST_F(DataObsManagerStubTest, AaFwk_DataObsManagerStubTest_OnRemoteRequest_01
     GTEST_LOG_(INFO) << "AaFwk_DataObsManagerStubTest_OnRemoteRequest_0100 start";
     std::shared_ptr<MockDataObsMgrStub> dataobs = std::make_shared<MockDataObsMgrStub>();
     const int testVal = static_cast<int>(TEST_RETVAL_ONREMOTEREQUEST);
-    uint32_t code = IDataObsMgr::NOTIFY_CHANGE + 1;
+    uint32_t code = IDataObsMgr::UNREGISTER_OBSERVER_EXT + 1;
     MessageParcel data;
     MessageParcel reply;
     MessageOption option;
@@ -210,5 +210,60 @@ HWTEST_F(DataObsManagerStubTest, AaFwk_DataObsManagerStubTest_NotifyChange_0100,
     GTEST_LOG_(INFO) << "AaFwk_DataObsManagerStubTest_NotifyChange_0100 end";
 }
 
+/*
+ * Feature: DataObsManagerStub
+ * Function: RegisterObserverExt
+ * SubFunction: NA
+ * FunctionPoints: DataObsManagerStub RegisterObserverExt
+ * EnvConditions: NA
+ * CaseDescription: Verify that the DataObsManagerStub RegisterObserverExt passes isDescendants through.
+ */
+HWTEST_F(DataObsManagerStubTest, AaFwk_DataObsManagerStubTest_RegisterObserverExt_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_DataObsManagerStubTest_RegisterObserverExt_0100 start";
+    const int testVal1 = static_cast<int>(NO_ERROR);
+    const int testVal2 = static_cast<int>(TEST_RETVAL_ONREMOTEREQUEST);
+    std::shared_ptr<MockDataObsMgrStub> dataobs = std::make_shared<MockDataObsMgrStub>();
+    sptr<AAFwk::IDataAbilityObserver> dataObserver(new (std::nothrow) MockDataAbilityObserverStub());
+    std::shared_ptr<Uri> uri =
+        std::make_shared<Uri>("dataability://device_id/com.domainname.dataability.persondata/person");
+    uint32_t code = IDataObsMgr::REGISTER_OBSERVER_EXT;
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+
+    if (!data.WriteInterfaceToken(DataObsManagerProxy::GetDescriptor())) {
+        GTEST_LOG_(ERROR) << "---------- WriteInterfaceToken(data) retval is false end";
+        return;
+    }
+    if (!data.WriteParcelable(uri.get())) {
+        GTEST_LOG_(ERROR) << "---------- data.WriteParcelable(uri) retval is false end";
+        return;
+    }
+    if (dataObserver == nullptr) {
+        return;
+    }
+
+    if (!data.WriteRemoteObject(dataObserver->AsObject())) {
+        GTEST_LOG_(ERROR) << "---------- data.WriteRemoteObject(dataObserver->AsObject()) retval is false end";
+        return;
+    }
+    if (!data.WriteBool(true)) {
+        GTEST_LOG_(ERROR) << "---------- data.WriteBool(isDescendants) retval is false end";
+        return;
+    }
+
+    EXPECT_CALL(*dataobs, RegisterObserverExt(testing::_, testing::_, true))
+        .Times(1)
+        .WillOnce(testing::Return(testVal2));
+
+    const int retval1 = dataobs->OnRemoteRequest(code, data, reply, option);
+    const int retval2 = reply.ReadInt32();
+
+    EXPECT_EQ(testVal1, retval1);
+    EXPECT_EQ(testVal2, retval2);
+    GTEST_LOG_(INFO) << "AaFwk_DataObsManagerStubTest_RegisterObserverExt_0100 end";
+}
+
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
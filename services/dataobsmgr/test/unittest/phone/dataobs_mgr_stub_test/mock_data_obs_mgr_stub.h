@@ -39,6 +39,8 @@ public:
     MOCK_METHOD2(RegisterObserver, int(const Uri &, const sptr<IDataAbilityObserver> &));
     MOCK_METHOD2(UnregisterObserver, int(const Uri &, const sptr<IDataAbilityObserver> &));
     MOCK_METHOD1(NotifyChange, int(const Uri &));
+    MOCK_METHOD3(RegisterObserverExt, int(const Uri &, const sptr<IDataAbilityObserver> &, bool));
+    MOCK_METHOD2(UnregisterObserverExt, int(const Uri &, const sptr<IDataAbilityObserver> &));
 };
 
 class MockDataAbilityObserverStub : public AAFwk::DataAbilityObserverStub {
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_CONNECTION_POOL_H
+#define FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_CONNECTION_POOL_H
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <singleton.h>
+#include <string>
+#include <vector>
+
+#include "appexecfwk_errors.h"
+#include "event_handler.h"
+#include "form_pool_connection.h"
+#include "iremote_object.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @class FormConnectionPool
+ * One connection per form provider, shared by all the requests to the provider.
+ * Requests queue up while the provider connects and run as soon as it is connected, the refreshes
+ * queued together reach the provider in one call. A connection is given back after it has been
+ * idle for a while.
+ */
+class FormConnectionPool final : public DelayedRefSingleton<FormConnectionPool> {
+    DECLARE_DELAYED_REF_SINGLETON(FormConnectionPool)
+
+public:
+    DISALLOW_COPY_AND_MOVE(FormConnectionPool);
+
+    /**
+     * A request to a provider, run with the provider proxy object and the id of the connection,
+     * which the request must give back through FormSupplyCallback::RemoveConnection once done.
+     */
+    using ProviderTask = std::function<void(const sptr<IRemoteObject> &remoteObject, long connectId)>;
+
+    /**
+     * @brief SetEventHandler.
+     * @param handler event handler
+     */
+    inline void SetEventHandler(const std::shared_ptr<AppExecFwk::EventHandler> &handler)
+    {
+        eventHandler_ = handler;
+    }
+
+    /**
+     * @brief Run a request on the connection to a provider, connecting the provider if needed.
+     * @param bundleName The bundle name of the provider.
+     * @param abilityName The ability name of the provider.
+     * @param task The request.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    ErrCode PostProviderTask(const std::string &bundleName, const std::string &abilityName,
+        const ProviderTask &task);
+
+    /**
+     * @brief Refresh a form, batched with the other refreshes queued for its provider.
+     * @param formId The Id of the form.
+     * @param bundleName The bundle name of the provider.
+     * @param abilityName The ability name of the provider.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    ErrCode PostRefresh(const int64_t formId, const std::string &bundleName, const std::string &abilityName);
+
+    /**
+     * @brief The provider is connected, run the requests queued for it.
+     * @param connection The connection to the provider.
+     * @param remoteObject The provider proxy object.
+     */
+    void OnConnected(const sptr<FormPoolConnection> &connection, const sptr<IRemoteObject> &remoteObject);
+
+    /**
+     * @brief The provider failed to connect or is disconnected, drop its connection and its requests.
+     * @param connection The connection to the provider.
+     */
+    void OnDisconnected(const sptr<FormPoolConnection> &connection);
+
+    /**
+     * @brief A request is done with its connection.
+     * @param connectId The id of the connection.
+     * @return Returns true if the connection belongs to the pool, false otherwise.
+     */
+    bool ReleaseConnection(long connectId);
+
+private:
+    struct ProviderConnection {
+        sptr<FormPoolConnection> connection = nullptr;
+        // nullptr while connecting
+        sptr<IRemoteObject> remoteObject = nullptr;
+        std::vector<ProviderTask> pendingTasks;
+        std::set<int64_t> pendingFormIds;
+        // requests sent to the provider and not given back yet
+        int32_t busyCount = 0;
+        bool isDispatchPosted = false;
+    };
+
+    ErrCode Enqueue(const std::string &bundleName, const std::string &abilityName,
+        const std::function<void(ProviderConnection &)> &enqueue);
+    void PostDispatch(const std::string &providerKey, ProviderConnection &providerConnection);
+    void Dispatch(const std::string &providerKey);
+    void ReleaseIdleConnection(const std::string &providerKey);
+    static std::string GetProviderKey(const std::string &bundleName, const std::string &abilityName);
+    static std::string GetIdleTaskName(const std::string &providerKey);
+
+    std::mutex mutex_;
+    std::map<std::string, ProviderConnection> providerConnections_;
+    std::map<long, std::string> connectIds_;
+    std::shared_ptr<AppExecFwk::EventHandler> eventHandler_ = nullptr;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif // FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_CONNECTION_POOL_H
@@ -22,6 +22,7 @@
 #include <set>
 #include <singleton.h>
 #include <string>
+#include <unordered_map>
 
 #include "form_constants.h"
 #include "form_host_record.h"
@@ -497,6 +498,38 @@ private:
     */
     ErrCode HandleUpdateHostFormFlag(const std::vector<int64_t> &formIds, bool flag, bool isOnlyEnableUpdate,
                                      FormHostRecord &formHostRecord, std::vector<int64_t> &refreshForms);
+
+    /**
+     * @brief Find the form host record of a client stub, with formHostRecordMutex_ held.
+     * @param callerToken The client stub of the form host record, only compared.
+     * @param index The index of the form host record in clientRecords_.
+     * @return Returns true if the form host record is found; returns false otherwise.
+     */
+    bool FindHostRecordNoLock(const IRemoteObject *callerToken, size_t &index) const;
+    /**
+     * @brief Find the form host records of a form, with formHostRecordMutex_ held.
+     * @param formId The id of the form.
+     * @return The indexes of the form host records in clientRecords_, in order.
+     */
+    std::vector<size_t> FindFormHostRecordsNoLock(int64_t formId) const;
+    /**
+     * @brief Add a form to a form host record and to the form index, with formHostRecordMutex_ held.
+     * @param record The form host record.
+     * @param formId The id of the form.
+     */
+    void AddHostFormNoLock(FormHostRecord &record, int64_t formId);
+    /**
+     * @brief Delete a form from a form host record and from the form index, with formHostRecordMutex_ held.
+     * @param record The form host record.
+     * @param formId The id of the form.
+     */
+    void DelHostFormNoLock(FormHostRecord &record, int64_t formId);
+    /**
+     * @brief Clean and erase a form host record, with formHostRecordMutex_ held.
+     * @param iter The form host record.
+     * @return The form host record after the erased one.
+     */
+    std::vector<FormHostRecord>::iterator EraseHostRecordNoLock(std::vector<FormHostRecord>::iterator iter);
 private:
     mutable std::mutex formRecordMutex_;
     mutable std::mutex formHostRecordMutex_;
@@ -504,6 +537,9 @@ private:
     mutable std::mutex formStateRecordMutex_;
     std::map<int64_t, FormRecord> formRecords_;
     std::vector<FormHostRecord> clientRecords_;
+    // indexes of clientRecords_ by client stub and by form, a hit is checked and a miss walks clientRecords_
+    mutable std::unordered_map<const IRemoteObject *, size_t> hostRecordIndexes_;
+    mutable std::unordered_map<int64_t, std::set<const IRemoteObject *>> formHostStubs_;
     std::vector<int64_t> tempForms_;
     std::map<std::string, FormHostRecord> formStateRecord_;
     int64_t udidHash_;
@@ -16,9 +16,11 @@
 #ifndef FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_DB_CACHE_H
 #define FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_DB_CACHE_H
 
+#include <map>
 #include <mutex>
 #include <set>
 #include <singleton.h>
+#include <unordered_map>
 #include <vector>
 
 #include "appexecfwk_errors.h"
@@ -161,9 +163,40 @@ public:
     ErrCode DeleteInvalidDBForms(int32_t userId, int32_t callingUid, std::set<int64_t> &matchedFormIds,
                                  std::map<int64_t, bool> &removedFormsMap);
 private:
+    /**
+     * @brief Add form data to the indexes of DbCache.(NoLock)
+     * @param formDBInfo Form data.
+     */
+    void AddIndexNolock(const FormDBInfo &formDBInfo);
+
+    /**
+     * @brief Remove form data from the indexes of DbCache.(NoLock)
+     * @param formDBInfo Form data.
+     */
+    void RemoveIndexNolock(const FormDBInfo &formDBInfo);
+
+    /**
+     * @brief Remove a form user uid from form data and from the uid index.(NoLock)
+     * @param formDBInfo Form data.
+     * @param uid The form user uid.
+     */
+    void RemoveUserUidNolock(FormDBInfo &formDBInfo, const int uid);
+
+    /**
+     * @brief Erase form data from DbCache.(NoLock)
+     * @param formId form data Id.
+     */
+    void EraseFormInfoNolock(int64_t formId);
+
+    static std::string GetModuleKey(const std::string &bundleName, const std::string &moduleName);
+
     std::shared_ptr<FormStorageMgr> dataStorage_;
     mutable std::mutex formDBInfosMutex_;
-    std::vector<FormDBInfo> formDBInfos_;
+    std::map<int64_t, FormDBInfo> formDBInfos_;
+    // indexes of formDBInfos_ by bundle, by bundle and module, and by form user uid
+    std::unordered_map<std::string, std::set<int64_t>> bundleFormIds_;
+    std::unordered_map<std::string, std::set<int64_t>> moduleFormIds_;
+    std::unordered_map<int, std::set<int64_t>> uidFormIds_;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -61,6 +61,11 @@ public:
      * @return formId is in forms_ or not.
      */
     bool Contains(int64_t formId) const;
+    /**
+     * @brief Get the ids of the forms in forms_.
+     * @return The ids of the forms.
+     */
+    std::vector<int64_t> GetFormIds() const;
 
     /**
      * @brief Set refresh enable flag.
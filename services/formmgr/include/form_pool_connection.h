@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -13,8 +13,8 @@
  * limitations under the License.
  */
 
-#ifndef FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_DELETE_CONNECTION_H
-#define FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_DELETE_CONNECTION_H
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_POOL_CONNECTION_H
+#define FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_POOL_CONNECTION_H
 
 #include "event_handler.h"
 #include "form_ability_connection.h"
@@ -22,13 +22,13 @@
 namespace OHOS {
 namespace AppExecFwk {
 /**
- * @class FormDeleteConnection
- * Form Delete Connection Stub.
+ * @class FormPoolConnection
+ * Form Pool Connection Stub, the connection FormConnectionPool keeps to a provider.
  */
-class FormDeleteConnection : public FormAbilityConnection {
+class FormPoolConnection : public FormAbilityConnection {
 public:
-    FormDeleteConnection(const int64_t formId, const std::string &bundleName, const std::string &abilityName);
-    virtual ~FormDeleteConnection() = default;
+    FormPoolConnection(const std::string &bundleName, const std::string &abilityName);
+    virtual ~FormPoolConnection() = default;
 
     /**
      * @brief OnAbilityConnectDone, AbilityMs notify caller ability the result of connect.
@@ -39,11 +39,17 @@ public:
     void OnAbilityConnectDone(
         const AppExecFwk::ElementName &element, const sptr<IRemoteObject> &remoteObject, int resultCode) override;
 
+    /**
+     * @brief OnAbilityDisconnectDone, AbilityMs notify caller ability the result of disconnect.
+     * @param element service ability's ElementName.
+     * @param resultCode ERR_OK on success, others on failure.
+     */
+    void OnAbilityDisconnectDone(const AppExecFwk::ElementName &element, int resultCode) override;
+
 private:
-    int64_t formId_;
-    DISALLOW_COPY_AND_MOVE(FormDeleteConnection);
+    DISALLOW_COPY_AND_MOVE(FormPoolConnection);
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
 
-#endif // FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_DELETE_CONNECTION_H
\ No newline at end of file
+#endif // FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_POOL_CONNECTION_H
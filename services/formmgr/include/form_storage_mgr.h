@@ -17,19 +17,22 @@
 #define FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_STORAGE_MGR_H
 
 #include <map>
+#include <mutex>
+#include <set>
 #include <string>
 #include <stdint.h>
 #include <iostream>
 
 #include "appexecfwk_errors.h"
 #include "distributed_kv_data_manager.h"
+#include "event_handler.h"
 #include "form_db_info.h"
 
 namespace OHOS {
 namespace AppExecFwk {
 /**
  * @class FormStorageMgr
- * Form data storage.
+ * Form data storage. Writes are queued and coalesced per form, and flushed to DB in batches on a background runner.
  */
 class FormStorageMgr {
 public:
@@ -52,34 +55,65 @@ public:
     /**
      * @brief Save or update the form data in DB.
      * @param innerFormInfo Indicates the InnerFormInfo object to be save.
-     * @return Returns ERR_OK on success, others on failure.
+     * @return Returns ERR_OK on success, others on failure, the write stays queued while the last flush failed.
      */
     ErrCode SaveStorageFormInfo(const InnerFormInfo &innerFormInfo);
 
     /**
      * @brief Modify the form data in DB.
      * @param innerFormInfo Indicates the InnerFormInfo object to be Modify.
-     * @return Returns ERR_OK on success, others on failure.
+     * @return Returns ERR_OK on success, others on failure, the write stays queued while the last flush failed.
      */
     ErrCode ModifyStorageFormInfo(const InnerFormInfo &innerFormInfo);
 
     /**
      * @brief Delete the form data in DB.
      * @param formId The form data Id.
-     * @return Returns ERR_OK on success, others on failure.
+     * @return Returns ERR_OK on success, others on failure, the write stays queued while the last flush failed.
      */
     ErrCode DeleteStorageFormInfo(const std::string &formId);
 
+    /**
+     * @brief Write the queued form data to DB now.
+     * @return Returns ERR_OK on success, others on failure, the writes not done stay queued.
+     */
+    ErrCode Flush();
+
+    /**
+     * @brief Write the queued form data to DB as the service stops, waiting a short while only for the kvStore.
+     * The owner calls it before the storage is destroyed, the destructor does not flush.
+     * @return Returns ERR_OK on success, others on failure, the writes not done stay queued.
+     */
+    ErrCode FlushOnStop();
+
     void RegisterKvStoreDeathListener();
     bool ResetKvStore();
 
+protected:
+    /**
+     * @brief Create a storage that does not connect to DB, for a store standing in for the kv store.
+     * @param flushHandler The handler the flushes run on, writes are flushed at once without it.
+     */
+    explicit FormStorageMgr(const std::shared_ptr<EventHandler> &flushHandler);
+
+    virtual bool CheckKvStore();
+    virtual DistributedKv::Status GetEntries(const DistributedKv::Key &prefix,
+        std::vector<DistributedKv::Entry> &entries);
+    virtual DistributedKv::Status PutBatch(const std::vector<DistributedKv::Entry> &entries);
+    virtual DistributedKv::Status DeleteBatch(const std::vector<DistributedKv::Key> &keys);
+
 private:
     void SaveEntries(
     const std::vector<DistributedKv::Entry> &allEntries, std::vector<InnerFormInfo> &innerFormInfos);
-    DistributedKv::Status GetEntries(std::vector<DistributedKv::Entry> &allEntries);
     void TryTwice(const std::function<DistributedKv::Status()> &func);
-    bool CheckKvStore();
     DistributedKv::Status GetKvStore();
+    ErrCode PostFlush();
+    ErrCode DoFlush(int32_t kvStoreTryTimes, bool isRetryPosted);
+    void WriteBatches(std::map<std::string, std::string> &puts, std::set<std::string> &deletes);
+    bool GetPendingFormInfo(const std::string &formId, std::string &value, bool &isDeleted);
+    // both with pendingMutex_ held
+    void PostRetry();
+    void Requeue(std::map<std::string, std::string> &puts, std::set<std::string> &deletes);
 
 private:
     const DistributedKv::AppId appId_ {"form_storage"};
@@ -88,6 +122,21 @@ private:
     std::shared_ptr<DistributedKv::SingleKvStore> kvStorePtr_;
     // std::shared_ptr<DataChangeListener> dataChangeListener_;
     mutable std::mutex kvStorePtrMutex_;
+    // how many times CheckKvStore tries to get the kvStore, fewer as the service stops
+    int32_t kvStoreTryTimes_;
+
+    // the latest write of each form not in DB yet, a form is either put or deleted
+    std::map<std::string, std::string> pendingPuts_;
+    std::set<std::string> pendingDeletes_;
+    bool isFlushPosted_ = false;
+    // the failed flushes in a row, retried later and later until one succeeds
+    int32_t failedFlushCount_ = 0;
+    int64_t retryDelay_;
+    mutable std::mutex pendingMutex_;
+    // one flush at a time, so that an older batch never lands after a newer one
+    std::mutex flushMutex_;
+    std::shared_ptr<EventRunner> flushRunner_;
+    std::shared_ptr<EventHandler> flushHandler_;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
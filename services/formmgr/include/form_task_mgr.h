@@ -85,6 +85,17 @@ public:
      */
     void PostRefreshTask(const int64_t formId, const Want &want, const sptr<IRemoteObject> &remoteObject);
 
+    /**
+     * @brief Refresh the data of forms from their form provider in one call(task).
+     *
+     * @param formIds The Id list of the forms.
+     * @param want The want of the forms.
+     * @param remoteObject Form provider proxy object.
+     * @return none.
+     */
+    void PostBatchRefreshTask(const std::vector<int64_t> &formIds, const Want &want,
+        const sptr<IRemoteObject> &remoteObject);
+
     /**
      * @brief Cast temp form data from form provider(task).
      *
@@ -196,6 +207,16 @@ private:
      */
     void NotifyFormUpdate(const int64_t formId, const Want &want, const sptr<IRemoteObject> &remoteObject);
 
+    /**
+     * @brief Notify form provider for updating forms.
+     * @param formIds The Id list of the forms.
+     * @param want The want of the forms.
+     * @param remoteObject Form provider proxy object.
+     * @return none.
+     */
+    void NotifyFormsUpdate(const std::vector<int64_t> &formIds, const Want &want,
+        const sptr<IRemoteObject> &remoteObject);
+
     /**
      * @brief Event notify to form provider.
      *
@@ -20,7 +20,6 @@
 #include <chrono>
 #include <ctime>
 #include <limits.h>
-#include <list>
 #include <map>
 #include <mutex>
 #include <singleton.h>
@@ -33,6 +32,7 @@
 #include "common_event_subscribe_info.h"
 #include "form_refresh_limiter.h"
 #include "form_timer.h"
+#include "form_timer_queue.h"
 #include "thread_pool.h"
 #include "time_service_client.h"
 #include "timer.h"
@@ -296,16 +296,19 @@ private:
      * @brief Clear interval timer resource.
      */
     void ClearIntervalTimer();
+    /**
+     * @brief Arm the interval timer at the earliest interval deadline.
+     */
+    void UpdateIntervalTimer();
+    /**
+     * @brief Get the time of the steady clock.
+     * @return Returns the time in ms.
+     */
+    int64_t GetSteadyMillisecond() const;
     /**
     * @brief Creat thread pool for timer task.
     */
     void CreatTaskThreadExecutor();
-    /**
-     * @brief Set enable flag.
-     * @param formId The Id of the form.
-     * @param flag Enable flag.
-     */
-    void SetEnableFlag(int64_t formId, bool flag);
     /**
      * @brief Get WantAgent.
      * @param updateAtTime The next update time.
@@ -347,26 +350,27 @@ private:
         virtual void OnReceiveEvent(const EventFwk::CommonEventData &eventData) override;
     };
 
-    struct {
-        bool operator()(DynamicRefreshItem a, DynamicRefreshItem b) const
-        {
-            return (a.settedTime > b.settedTime ? true : false);
-        }
-    } CompareDynamicRefreshItem;
-
     mutable std::mutex intervalMutex_;
     mutable std::mutex updateAtMutex_;
     mutable std::mutex dynamicMutex_;
-    mutable std::mutex refreshMutex_;
     FormRefreshLimiter refreshLimiter_;
+    // the tasks by form id, and their deadlines: steady ms, minute of the day and steady ms
     std::map<int64_t, FormTimer> intervalTimerTasks_;
-    std::list<UpdateAtItem> updateAtTimerTasks_;
-    std::vector<DynamicRefreshItem> dynamicRefreshTasks_;
+    std::map<int64_t, UpdateAtItem> updateAtTimerTasks_;
+    // a form refreshes dynamically once per user, so these are queued by a handle of the form and user
+    std::map<int64_t, DynamicRefreshItem> dynamicRefreshTasks_;
+    std::map<std::pair<int64_t, int32_t>, int64_t> dynamicHandles_;
+    int64_t nextDynamicHandle_ = 0;
+    FormTimerQueue intervalQueue_;
+    FormTimerQueue updateAtQueue_;
+    FormTimerQueue dynamicQueue_;
     std::shared_ptr<TimerReceiver> timerReceiver_ = nullptr;
     std::unique_ptr<ThreadPool> taskExecutor_ = nullptr;
     int32_t timeSpeed_ = 1;
 
     std::shared_ptr<Utils::Timer> intervalTimer_ = nullptr;
+    uint32_t intervalTimerId_ = 0;
+    int64_t intervalWakeUpTime_ = INT64_MAX;
     uint64_t updateAtTimerId_ = 0L;
     uint64_t dynamicAlarmTimerId_ = 0L;
     uint64_t limiterTimerId_ = 0L;
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_TIMER_QUEUE_H
+#define FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_TIMER_QUEUE_H
+
+#include <cstddef>
+#include <set>
+#include <stdint.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @class FormTimerQueue
+ * Form timer deadlines ordered by time, with the form id as the handle of each deadline.
+ * Add, remove and reschedule are O(log n). The queue is not thread safe, the owner locks it.
+ */
+class FormTimerQueue {
+public:
+    /**
+     * @brief Add the deadline of a form, or move it if the form is queued already.
+     * @param formId The Id of the form.
+     * @param deadline The deadline of the form.
+     */
+    void Push(int64_t formId, int64_t deadline);
+    /**
+     * @brief Remove the deadline of a form.
+     * @param formId The Id of the form.
+     * @return Returns true if the form was queued, false otherwise.
+     */
+    bool Remove(int64_t formId);
+    /**
+     * @brief Get the deadline of a form.
+     * @param formId The Id of the form.
+     * @param deadline The deadline of the form.
+     * @return Returns true if the form is queued, false otherwise.
+     */
+    bool GetDeadline(int64_t formId, int64_t &deadline) const;
+    /**
+     * @brief Get the earliest deadline.
+     * @param formId The Id of the form the deadline belongs to.
+     * @param deadline The earliest deadline.
+     * @return Returns true if the queue is not empty, false otherwise.
+     */
+    bool GetFirst(int64_t &formId, int64_t &deadline) const;
+    /**
+     * @brief Get the earliest deadline later than a time.
+     * @param time The time.
+     * @param formId The Id of the form the deadline belongs to.
+     * @param deadline The earliest deadline later than time.
+     * @return Returns true if there is such a deadline, false otherwise.
+     */
+    bool GetFirstAfter(int64_t time, int64_t &formId, int64_t &deadline) const;
+    /**
+     * @brief Get the forms whose deadline is in a range, earliest first.
+     * @param begin The begin of the range, included.
+     * @param end The end of the range, included.
+     * @param formIds The Ids of the forms.
+     */
+    void GetRange(int64_t begin, int64_t end, std::vector<int64_t> &formIds) const;
+    /**
+     * @brief Remove all the forms whose deadline is not later than a time, earliest first.
+     * @param time The time, which callers extend by their batching window.
+     * @param formIds The Ids of the expired forms.
+     */
+    void PopExpired(int64_t time, std::vector<int64_t> &formIds);
+    /**
+     * @brief Remove all the deadlines.
+     */
+    void Clear();
+    /**
+     * @brief Whether the queue is empty.
+     * @return Returns true if the queue is empty, false otherwise.
+     */
+    bool Empty() const;
+    /**
+     * @brief Get the count of the queued forms.
+     * @return Returns the count of the queued forms.
+     */
+    size_t Size() const;
+
+private:
+    // (deadline, formId), so forms sharing a deadline keep a stable order
+    std::set<std::pair<int64_t, int64_t>> deadlines_;
+    std::unordered_map<int64_t, int64_t> formDeadlines_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif // FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_INCLUDE_FORM_TIMER_QUEUE_H
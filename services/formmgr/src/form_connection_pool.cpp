@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "form_connection_pool.h"
+
+#include "form_ams_helper.h"
+#include "form_constants.h"
+#include "form_supply_callback.h"
+#include "form_task_mgr.h"
+#include "hilog_wrapper.h"
+#include "want.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+// how long an idle connection stays in the pool, the supply callback delays the disconnect further
+const int64_t FORM_CONNECTION_IDLE_TIME = 5000; // ms
+const std::string FORM_CONNECTION_IDLE_TASK = "FormConnectionIdle_";
+}
+
+FormConnectionPool::FormConnectionPool() {}
+FormConnectionPool::~FormConnectionPool() {}
+
+/**
+ * @brief Run a request on the connection to a provider, connecting the provider if needed.
+ * @param bundleName The bundle name of the provider.
+ * @param abilityName The ability name of the provider.
+ * @param task The request.
+ * @return Returns ERR_OK on success, others on failure.
+ */
+ErrCode FormConnectionPool::PostProviderTask(const std::string &bundleName, const std::string &abilityName,
+    const ProviderTask &task)
+{
+    return Enqueue(bundleName, abilityName, [&task](ProviderConnection &providerConnection) {
+        providerConnection.pendingTasks.emplace_back(task);
+    });
+}
+
+/**
+ * @brief Refresh a form, batched with the other refreshes queued for its provider.
+ * @param formId The Id of the form.
+ * @param bundleName The bundle name of the provider.
+ * @param abilityName The ability name of the provider.
+ * @return Returns ERR_OK on success, others on failure.
+ */
+ErrCode FormConnectionPool::PostRefresh(const int64_t formId, const std::string &bundleName,
+    const std::string &abilityName)
+{
+    return Enqueue(bundleName, abilityName, [formId](ProviderConnection &providerConnection) {
+        providerConnection.pendingFormIds.emplace(formId);
+    });
+}
+
+/**
+ * @brief The provider is connected, run the requests queued for it.
+ * @param connection The connection to the provider.
+ * @param remoteObject The provider proxy object.
+ */
+void FormConnectionPool::OnConnected(const sptr<FormPoolConnection> &connection,
+    const sptr<IRemoteObject> &remoteObject)
+{
+    std::string providerKey = connection->GetProviderKey();
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = providerConnections_.find(providerKey);
+    if (iter == providerConnections_.end() || iter->second.connection != connection) {
+        HILOG_WARN("%{public}s, connection of %{public}s is not pooled", __func__, providerKey.c_str());
+        return;
+    }
+    HILOG_INFO("%{public}s, provider:%{public}s, connectId:%{public}ld",
+        __func__, providerKey.c_str(), connection->GetConnectId());
+    iter->second.remoteObject = remoteObject;
+    connectIds_[connection->GetConnectId()] = providerKey;
+    PostDispatch(providerKey, iter->second);
+}
+
+/**
+ * @brief The provider failed to connect or is disconnected, drop its connection and its requests.
+ * @param connection The connection to the provider.
+ */
+void FormConnectionPool::OnDisconnected(const sptr<FormPoolConnection> &connection)
+{
+    std::string providerKey = connection->GetProviderKey();
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = providerConnections_.find(providerKey);
+    if (iter == providerConnections_.end() || iter->second.connection != connection) {
+        return;
+    }
+    HILOG_WARN("%{public}s, provider:%{public}s, drop %{public}zu requests",
+        __func__, providerKey.c_str(), iter->second.pendingTasks.size() + iter->second.pendingFormIds.size());
+    connectIds_.erase(connection->GetConnectId());
+    providerConnections_.erase(iter);
+    if (eventHandler_ != nullptr) {
+        eventHandler_->RemoveTask(GetIdleTaskName(providerKey));
+    }
+}
+
+/**
+ * @brief A request is done with its connection.
+ * @param connectId The id of the connection.
+ * @return Returns true if the connection belongs to the pool, false otherwise.
+ */
+bool FormConnectionPool::ReleaseConnection(long connectId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto idIter = connectIds_.find(connectId);
+    if (idIter == connectIds_.end()) {
+        return false;
+    }
+    std::string providerKey = idIter->second;
+    auto iter = providerConnections_.find(providerKey);
+    if (iter == providerConnections_.end()) {
+        connectIds_.erase(idIter);
+        return false;
+    }
+    ProviderConnection &providerConnection = iter->second;
+    if (providerConnection.busyCount > 0) {
+        providerConnection.busyCount--;
+    }
+    if (providerConnection.busyCount > 0 || providerConnection.isDispatchPosted || eventHandler_ == nullptr) {
+        return true;
+    }
+    std::function<void()> releaseFunc = std::bind(&FormConnectionPool::ReleaseIdleConnection, this, providerKey);
+    eventHandler_->RemoveTask(GetIdleTaskName(providerKey));
+    eventHandler_->PostTask(releaseFunc, GetIdleTaskName(providerKey), FORM_CONNECTION_IDLE_TIME);
+    return true;
+}
+
+ErrCode FormConnectionPool::Enqueue(const std::string &bundleName, const std::string &abilityName,
+    const std::function<void(ProviderConnection &)> &enqueue)
+{
+    if (bundleName.empty() || abilityName.empty()) {
+        HILOG_ERROR("%{public}s, bundleName or abilityName is empty.", __func__);
+        return ERR_APPEXECFWK_FORM_INVALID_PARAM;
+    }
+    std::string providerKey = GetProviderKey(bundleName, abilityName);
+    sptr<FormPoolConnection> connection = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ProviderConnection &providerConnection = providerConnections_[providerKey];
+        enqueue(providerConnection);
+        if (providerConnection.remoteObject != nullptr) {
+            PostDispatch(providerKey, providerConnection);
+            return ERR_OK;
+        }
+        if (providerConnection.connection != nullptr) {
+            // connecting, the request runs once connected
+            return ERR_OK;
+        }
+        connection = new (std::nothrow) FormPoolConnection(bundleName, abilityName);
+        if (connection == nullptr) {
+            providerConnections_.erase(providerKey);
+            return ERR_APPEXECFWK_FORM_COMMON_CODE;
+        }
+        providerConnection.connection = connection;
+    }
+
+    HILOG_INFO("%{public}s, connect provider:%{public}s", __func__, providerKey.c_str());
+    Want connectWant;
+    connectWant.AddFlags(Want::FLAG_ABILITY_FORM_ENABLED);
+    connectWant.SetElementName(bundleName, abilityName);
+    ErrCode errorCode = FormAmsHelper::GetInstance().ConnectServiceAbility(connectWant, connection);
+    if (errorCode != ERR_OK) {
+        HILOG_ERROR("%{public}s, ConnectServiceAbility failed.", __func__);
+        OnDisconnected(connection);
+        return ERR_APPEXECFWK_FORM_BIND_PROVIDER_FAILED;
+    }
+    return ERR_OK;
+}
+
+void FormConnectionPool::PostDispatch(const std::string &providerKey, ProviderConnection &providerConnection)
+{
+    if (providerConnection.isDispatchPosted) {
+        return;
+    }
+    if (eventHandler_ == nullptr) {
+        HILOG_ERROR("%{public}s fail, eventhandler invalidate.", __func__);
+        return;
+    }
+    // the requests queued until the dispatch runs go out together
+    std::function<void()> dispatchFunc = std::bind(&FormConnectionPool::Dispatch, this, providerKey);
+    eventHandler_->RemoveTask(GetIdleTaskName(providerKey));
+    providerConnection.isDispatchPosted = eventHandler_->PostTask(dispatchFunc);
+}
+
+void FormConnectionPool::Dispatch(const std::string &providerKey)
+{
+    std::vector<ProviderTask> tasks;
+    std::vector<int64_t> formIds;
+    sptr<IRemoteObject> remoteObject = nullptr;
+    long connectId = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = providerConnections_.find(providerKey);
+        if (iter == providerConnections_.end() || iter->second.remoteObject == nullptr) {
+            return;
+        }
+        ProviderConnection &providerConnection = iter->second;
+        providerConnection.isDispatchPosted = false;
+        tasks.swap(providerConnection.pendingTasks);
+        formIds.assign(providerConnection.pendingFormIds.begin(), providerConnection.pendingFormIds.end());
+        providerConnection.pendingFormIds.clear();
+        // every request, and the refresh batch as a whole, gives the connection back once
+        providerConnection.busyCount += static_cast<int32_t>(tasks.size()) + (formIds.empty() ? 0 : 1);
+        remoteObject = providerConnection.remoteObject;
+        connectId = providerConnection.connection->GetConnectId();
+    }
+
+    for (const auto &task : tasks) {
+        task(remoteObject, connectId);
+    }
+    if (formIds.empty()) {
+        return;
+    }
+    HILOG_INFO("%{public}s, provider:%{public}s, refresh %{public}zu forms",
+        __func__, providerKey.c_str(), formIds.size());
+    Want want;
+    want.SetParam(Constants::FORM_CONNECT_ID, connectId);
+    if (formIds.size() == 1) {
+        FormTaskMgr::GetInstance().PostRefreshTask(formIds.front(), want, remoteObject);
+    } else {
+        FormTaskMgr::GetInstance().PostBatchRefreshTask(formIds, want, remoteObject);
+    }
+}
+
+void FormConnectionPool::ReleaseIdleConnection(const std::string &providerKey)
+{
+    long connectId = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = providerConnections_.find(providerKey);
+        if (iter == providerConnections_.end()) {
+            return;
+        }
+        ProviderConnection &providerConnection = iter->second;
+        if (providerConnection.busyCount > 0 || providerConnection.isDispatchPosted ||
+            !providerConnection.pendingTasks.empty() || !providerConnection.pendingFormIds.empty()) {
+            return;
+        }
+        connectId = providerConnection.connection->GetConnectId();
+        connectIds_.erase(connectId);
+        providerConnections_.erase(iter);
+    }
+    HILOG_INFO("%{public}s, provider:%{public}s, connectId:%{public}ld", __func__, providerKey.c_str(), connectId);
+    FormSupplyCallback::GetInstance()->RemoveConnection(connectId);
+}
+
+std::string FormConnectionPool::GetProviderKey(const std::string &bundleName, const std::string &abilityName)
+{
+    return bundleName + "::" + abilityName;
+}
+
+std::string FormConnectionPool::GetIdleTaskName(const std::string &providerKey)
+{
+    return FORM_CONNECTION_IDLE_TASK + providerKey;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
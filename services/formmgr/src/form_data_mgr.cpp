@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cinttypes>
 
 #include "appexecfwk_errors.h"
@@ -104,18 +105,18 @@ bool FormDataMgr::AllotFormHostRecord(const FormItemInfo &info, const sptr<IRemo
 {
     HILOG_INFO("%{public}s, allot form Host info", __func__);
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    for (auto &record : clientRecords_) {
-        if (callerToken == record.GetClientStub()) {
-            record.AddForm(formId);
-            HILOG_INFO("%{public}s end", __func__);
-            return true;
-        }
+    size_t index = 0;
+    if (FindHostRecordNoLock(callerToken.GetRefPtr(), index)) {
+        AddHostFormNoLock(clientRecords_[index], formId);
+        HILOG_INFO("%{public}s end", __func__);
+        return true;
     }
     FormHostRecord hostRecord;
     bool isCreated = CreateHostRecord(info, callerToken, callingUid, hostRecord);
     if (isCreated) {
-        hostRecord.AddForm(formId);
         clientRecords_.emplace_back(hostRecord);
+        hostRecordIndexes_[callerToken.GetRefPtr()] = clientRecords_.size() - 1;
+        AddHostFormNoLock(clientRecords_.back(), formId);
         HILOG_INFO("%{public}s end", __func__);
         return true;
     }
@@ -446,11 +447,10 @@ bool FormDataMgr::GetFormHostRecord(const int64_t formId, FormHostRecord &formHo
 {
     HILOG_INFO("%{public}s, get form host record by formId", __func__);
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    for (auto &record : clientRecords_) {
-        if (record.Contains(formId)) {
-            formHostRecord = record;
-            return true;
-        }
+    std::vector<size_t> indexes = FindFormHostRecordsNoLock(formId);
+    if (!indexes.empty()) {
+        formHostRecord = clientRecords_[indexes.front()];
+        return true;
     }
 
     HILOG_ERROR("%{public}s, form host record not find", __func__);
@@ -466,15 +466,11 @@ bool FormDataMgr::DeleteHostRecord(const sptr<IRemoteObject> &callerToken, const
 {
     HILOG_INFO("%{public}s start, delete form host record", __func__);
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    std::vector<FormHostRecord>::iterator iter;
-    for (iter = clientRecords_.begin(); iter != clientRecords_.end(); ++iter) {
-        if (callerToken == iter->GetClientStub()) {
-            iter->DelForm(formId);
-            if (iter->IsEmpty()) {
-                iter->CleanResource();
-                iter = clientRecords_.erase(iter);
-            }
-            break;
+    size_t index = 0;
+    if (FindHostRecordNoLock(callerToken.GetRefPtr(), index)) {
+        DelHostFormNoLock(clientRecords_[index], formId);
+        if (clientRecords_[index].IsEmpty()) {
+            EraseHostRecordNoLock(clientRecords_.begin() + index);
         }
     }
     HILOG_INFO("%{public}s end", __func__);
@@ -487,21 +483,18 @@ bool FormDataMgr::DeleteHostRecord(const sptr<IRemoteObject> &callerToken, const
 void FormDataMgr::CleanHostRemovedForms(const std::vector<int64_t> &removedFormIds)
 {
     HILOG_INFO("%{public}s start, delete form host record by formId list", __func__);
-    std::vector<int64_t> matchedIds;
+    std::map<size_t, std::vector<int64_t>> matchedIds;
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    std::vector<FormHostRecord>::iterator itHostRecord;
-    for (itHostRecord = clientRecords_.begin(); itHostRecord != clientRecords_.end(); itHostRecord++) {
-        for (const int64_t& formId : removedFormIds) {
-            if (itHostRecord->Contains(formId)) {
-                matchedIds.emplace_back(formId);
-                itHostRecord->DelForm(formId);
-            }
-        }
-        if (!matchedIds.empty()) {
-            HILOG_INFO("%{public}s, OnFormUninstalled called", __func__);
-            itHostRecord->OnFormUninstalled(matchedIds);
+    for (const int64_t& formId : removedFormIds) {
+        for (size_t index : FindFormHostRecordsNoLock(formId)) {
+            matchedIds[index].emplace_back(formId);
+            DelHostFormNoLock(clientRecords_[index], formId);
         }
     }
+    for (auto &matched : matchedIds) {
+        HILOG_INFO("%{public}s, OnFormUninstalled called", __func__);
+        clientRecords_[matched.first].OnFormUninstalled(matched.second);
+    }
 
     HILOG_INFO("%{public}s end", __func__);
 }
@@ -514,31 +507,23 @@ void FormDataMgr::HandleHostDied(const sptr<IRemoteObject> &remoteHost)
     std::vector<int64_t> recordTempForms;
     {
         std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-        std::vector<FormHostRecord>::iterator itHostRecord;
-        for (itHostRecord = clientRecords_.begin(); itHostRecord != clientRecords_.end();) {
-            if (remoteHost == itHostRecord->GetClientStub()) {
-                HandleHostDiedForTempForms(*itHostRecord, recordTempForms);
-                HILOG_INFO("find died client, remove it");
-                itHostRecord->CleanResource();
-                itHostRecord = clientRecords_.erase(itHostRecord);
-                break;
-            } else {
-                itHostRecord++;
-            }
+        size_t index = 0;
+        if (FindHostRecordNoLock(remoteHost.GetRefPtr(), index)) {
+            HandleHostDiedForTempForms(clientRecords_[index], recordTempForms);
+            HILOG_INFO("find died client, remove it");
+            EraseHostRecordNoLock(clientRecords_.begin() + index);
         }
     }
     {
         std::lock_guard<std::mutex> lock(formRecordMutex_);
-        std::map<int64_t, FormRecord>::iterator itFormRecord;
-        for (itFormRecord = formRecords_.begin(); itFormRecord != formRecords_.end();) {
-            int64_t formId = itFormRecord->first;
+        std::sort(recordTempForms.begin(), recordTempForms.end());
+        for (const int64_t formId : recordTempForms) {
             // if temp form, remove it
-            if (std::find(recordTempForms.begin(), recordTempForms.end(), formId) != recordTempForms.end()) {
+            auto itFormRecord = formRecords_.find(formId);
+            if (itFormRecord != formRecords_.end()) {
                 FormRecord formRecord = itFormRecord->second;
-                itFormRecord = formRecords_.erase(itFormRecord);
+                formRecords_.erase(itFormRecord);
                 FormProviderMgr::GetInstance().NotifyProviderFormDelete(formId, formRecord);
-            } else {
-                itFormRecord++;
             }
         }
     }
@@ -585,8 +570,8 @@ void FormDataMgr::HandleHostDiedForTempForms(const FormHostRecord &record, std::
 bool FormDataMgr::IsEnableRefresh(int64_t formId)
 {
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    for (auto &record : clientRecords_) {
-        if (record.IsEnableRefresh(formId)) {
+    for (size_t index : FindFormHostRecordsNoLock(formId)) {
+        if (clientRecords_[index].IsEnableRefresh(formId)) {
             return true;
         }
     }
@@ -602,8 +587,8 @@ bool FormDataMgr::IsEnableRefresh(int64_t formId)
 bool FormDataMgr::IsEnableUpdate(int64_t formId)
 {
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    for (auto &record : clientRecords_) {
-        if (record.IsEnableUpdate(formId)) {
+    for (size_t index : FindFormHostRecordsNoLock(formId)) {
+        if (clientRecords_[index].IsEnableUpdate(formId)) {
             return true;
         }
     }
@@ -669,11 +654,10 @@ bool FormDataMgr::GetMatchedHostClient(const sptr<IRemoteObject> &callerToken, F
 {
     HILOG_INFO("%{public}s, get the matched form host record by client stub.", __func__);
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    for (const FormHostRecord &record : clientRecords_) {
-        if (callerToken == record.GetClientStub()) {
-            formHostRecord = record;
-            return true;
-        }
+    size_t index = 0;
+    if (FindHostRecordNoLock(callerToken.GetRefPtr(), index)) {
+        formHostRecord = clientRecords_[index];
+        return true;
     }
 
     HILOG_ERROR("%{public}s, form host record not find.", __func__);
@@ -905,11 +889,8 @@ void FormDataMgr::SetVersionUpgrade(const int64_t formId, const bool versionUpgr
 void FormDataMgr::UpdateHostNeedRefresh(const int64_t formId, const bool needRefresh)
 {
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    std::vector<FormHostRecord>::iterator itHostRecord;
-    for (itHostRecord = clientRecords_.begin(); itHostRecord != clientRecords_.end(); itHostRecord++) {
-        if (itHostRecord->Contains(formId)) {
-            itHostRecord->SetNeedRefresh(formId, needRefresh);
-        }
+    for (size_t index : FindFormHostRecordsNoLock(formId)) {
+        clientRecords_[index].SetNeedRefresh(formId, needRefresh);
     }
 }
 
@@ -923,16 +904,17 @@ bool FormDataMgr::UpdateHostForm(const int64_t formId, const FormRecord &formRec
 {
     bool isUpdated = false;
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    std::vector<FormHostRecord>::iterator itHostRecord;
-    for (itHostRecord = clientRecords_.begin(); itHostRecord != clientRecords_.end(); itHostRecord++) {
-        bool enableRefresh = formRecord.isVisible || itHostRecord->IsEnableUpdate(formId) ||
-                             itHostRecord->IsEnableRefresh(formId);
+    // a host drops the updates of forms it does not have, so only the hosts of the form are updated
+    for (size_t index : FindFormHostRecordsNoLock(formId)) {
+        FormHostRecord &hostRecord = clientRecords_[index];
+        bool enableRefresh = formRecord.isVisible || hostRecord.IsEnableUpdate(formId) ||
+                             hostRecord.IsEnableRefresh(formId);
         HILOG_INFO("formId:%{public}" PRId64 " enableRefresh:%{public}d", formId, enableRefresh);
         if (enableRefresh) {
             // update form
-            itHostRecord->OnUpdate(formId, formRecord);
+            hostRecord.OnUpdate(formId, formRecord);
             // set needRefresh
-            itHostRecord->SetNeedRefresh(formId, false);
+            hostRecord.SetNeedRefresh(formId, false);
             isUpdated = true;
         }
     }
@@ -1014,13 +996,11 @@ ErrCode FormDataMgr::UpdateHostFormFlag(const std::vector<int64_t> &formIds, con
 {
     HILOG_INFO("%{public}s start, flag: %{public}d", __func__, flag);
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    std::vector<FormHostRecord>::iterator itHostRecord;
-    for (itHostRecord = clientRecords_.begin(); itHostRecord != clientRecords_.end(); itHostRecord++) {
-        if (callerToken == itHostRecord->GetClientStub()) {
-            HandleUpdateHostFormFlag(formIds, flag, isOnlyEnableUpdate, *itHostRecord, refreshForms);
-            HILOG_INFO("%{public}s end.", __func__);
-            return ERR_OK;
-        }
+    size_t index = 0;
+    if (FindHostRecordNoLock(callerToken.GetRefPtr(), index)) {
+        HandleUpdateHostFormFlag(formIds, flag, isOnlyEnableUpdate, clientRecords_[index], refreshForms);
+        HILOG_INFO("%{public}s end.", __func__);
+        return ERR_OK;
     }
     HILOG_ERROR("%{public}s, can't find target client", __func__);
     return ERR_APPEXECFWK_FORM_OPERATION_NOT_SELF;
@@ -1058,8 +1038,7 @@ void FormDataMgr::ClearHostDataByUId(const int uId)
     std::vector<FormHostRecord>::iterator itHostRecord;
     for (itHostRecord = clientRecords_.begin(); itHostRecord != clientRecords_.end();) {
         if (itHostRecord->GetCallerUid() == uId) {
-            itHostRecord->CleanResource();
-            itHostRecord = clientRecords_.erase(itHostRecord);
+            itHostRecord = EraseHostRecordNoLock(itHostRecord);
         } else {
             itHostRecord++;
         }
@@ -1253,10 +1232,9 @@ ErrCode FormDataMgr::NotifyFormsVisible(const std::vector<int64_t> &formIds, boo
     {
         HILOG_INFO("%{public}s, get the matched form host record by client stub.", __func__);
         std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-        for (const FormHostRecord &record : clientRecords_) {
-            if (callerToken != record.GetClientStub()) {
-                continue;
-            }
+        size_t index = 0;
+        if (FindHostRecordNoLock(callerToken.GetRefPtr(), index)) {
+            const FormHostRecord &record = clientRecords_[index];
             for (int64_t formId : formIds) {
                 int64_t matchedFormId = FormDataMgr::GetInstance().FindMatchedFormId(formId);
                 if (!record.Contains(matchedFormId)) {
@@ -1266,7 +1244,6 @@ ErrCode FormDataMgr::NotifyFormsVisible(const std::vector<int64_t> &formIds, boo
                     foundFormIds.push_back(matchedFormId);
                 }
             }
-            break;
         }
     }
 
@@ -1467,20 +1444,19 @@ int32_t FormDataMgr::ClearHostDataByInvalidForms(int32_t callingUid, std::map<in
 {
     HILOG_INFO("DeleteInvalidForms host start");
     std::lock_guard<std::mutex> lock(formHostRecordMutex_);
-    std::vector<FormHostRecord>::iterator itHostRecord;
-    for (itHostRecord = clientRecords_.begin(); itHostRecord != clientRecords_.end();) {
-        if (itHostRecord->GetCallerUid() != callingUid) {
-            itHostRecord++;
-            continue;
-        }
-        for (auto &removedForm : removedFormsMap) {
-            if (itHostRecord->Contains(removedForm.first)) {
-                itHostRecord->DelForm(removedForm.first);
+    for (auto &removedForm : removedFormsMap) {
+        for (size_t index : FindFormHostRecordsNoLock(removedForm.first)) {
+            FormHostRecord &hostRecord = clientRecords_[index];
+            if (hostRecord.GetCallerUid() != callingUid) {
+                continue;
             }
+            DelHostFormNoLock(hostRecord, removedForm.first);
         }
-        if (itHostRecord->IsEmpty()) {
-            itHostRecord->CleanResource();
-            itHostRecord = clientRecords_.erase(itHostRecord);
+    }
+    std::vector<FormHostRecord>::iterator itHostRecord;
+    for (itHostRecord = clientRecords_.begin(); itHostRecord != clientRecords_.end();) {
+        if (itHostRecord->GetCallerUid() == callingUid && itHostRecord->IsEmpty()) {
+            itHostRecord = EraseHostRecordNoLock(itHostRecord);
         } else {
             itHostRecord++;
         }
@@ -1488,5 +1464,91 @@ int32_t FormDataMgr::ClearHostDataByInvalidForms(int32_t callingUid, std::map<in
     HILOG_INFO("DeleteInvalidForms host done");
     return ERR_OK;
 }
+
+bool FormDataMgr::FindHostRecordNoLock(const IRemoteObject *callerToken, size_t &index) const
+{
+    auto iter = hostRecordIndexes_.find(callerToken);
+    if (iter != hostRecordIndexes_.end() && iter->second < clientRecords_.size() &&
+        clientRecords_[iter->second].GetClientStub().GetRefPtr() == callerToken) {
+        index = iter->second;
+        return true;
+    }
+    // not indexed, or moved by an erase, find it the long way and index it again
+    for (size_t i = 0; i < clientRecords_.size(); i++) {
+        if (clientRecords_[i].GetClientStub().GetRefPtr() == callerToken) {
+            hostRecordIndexes_[callerToken] = i;
+            index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<size_t> FormDataMgr::FindFormHostRecordsNoLock(int64_t formId) const
+{
+    std::vector<size_t> indexes;
+    auto iter = formHostStubs_.find(formId);
+    if (iter != formHostStubs_.end()) {
+        for (const IRemoteObject *clientStub : iter->second) {
+            size_t index = 0;
+            if (FindHostRecordNoLock(clientStub, index) && clientRecords_[index].Contains(formId)) {
+                indexes.emplace_back(index);
+            }
+        }
+        if (indexes.empty()) {
+            formHostStubs_.erase(iter);
+        }
+    }
+    if (indexes.empty()) {
+        for (size_t i = 0; i < clientRecords_.size(); i++) {
+            if (clientRecords_[i].Contains(formId)) {
+                formHostStubs_[formId].emplace(clientRecords_[i].GetClientStub().GetRefPtr());
+                indexes.emplace_back(i);
+            }
+        }
+    }
+    // in the order of clientRecords_, as the walk would find them
+    std::sort(indexes.begin(), indexes.end());
+    return indexes;
+}
+
+void FormDataMgr::AddHostFormNoLock(FormHostRecord &record, int64_t formId)
+{
+    record.AddForm(formId);
+    formHostStubs_[formId].emplace(record.GetClientStub().GetRefPtr());
+}
+
+void FormDataMgr::DelHostFormNoLock(FormHostRecord &record, int64_t formId)
+{
+    record.DelForm(formId);
+    auto iter = formHostStubs_.find(formId);
+    if (iter == formHostStubs_.end()) {
+        return;
+    }
+    iter->second.erase(record.GetClientStub().GetRefPtr());
+    if (iter->second.empty()) {
+        formHostStubs_.erase(iter);
+    }
+}
+
+std::vector<FormHostRecord>::iterator FormDataMgr::EraseHostRecordNoLock(std::vector<FormHostRecord>::iterator iter)
+{
+    for (int64_t formId : iter->GetFormIds()) {
+        DelHostFormNoLock(*iter, formId);
+    }
+    hostRecordIndexes_.erase(iter->GetClientStub().GetRefPtr());
+    iter->CleanResource();
+    size_t erased = static_cast<size_t>(iter - clientRecords_.begin());
+    iter = clientRecords_.erase(iter);
+    // the records after the erased one move up
+    for (size_t i = erased; i < clientRecords_.size(); i++) {
+        const IRemoteObject *clientStub = clientRecords_[i].GetClientStub().GetRefPtr();
+        auto indexIter = hostRecordIndexes_.find(clientStub);
+        if (indexIter == hostRecordIndexes_.end() || indexIter->second > i) {
+            hostRecordIndexes_[clientStub] = i;
+        }
+    }
+    return iter;
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
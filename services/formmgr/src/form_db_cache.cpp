@@ -26,6 +26,21 @@
 
 namespace OHOS {
 namespace AppExecFwk {
+namespace {
+template<typename Key>
+void EraseIndexedFormId(std::unordered_map<Key, std::set<int64_t>> &index, const Key &key, int64_t formId)
+{
+    auto iter = index.find(key);
+    if (iter == index.end()) {
+        return;
+    }
+    iter->second.erase(formId);
+    if (iter->second.empty()) {
+        index.erase(iter);
+    }
+}
+}
+
 FormDbCache::FormDbCache()
 {
     HILOG_INFO("FormDbCache is created");
@@ -55,7 +70,9 @@ void FormDbCache::Start()
 
     for (unsigned int i = 0; i < innerFormInfos.size(); i++) {
         FormDBInfo formDBInfo = innerFormInfos.at(i).GetFormDBInfo();
-        formDBInfos_.emplace_back(formDBInfo);
+        EraseFormInfoNolock(formDBInfo.formId);
+        formDBInfos_.emplace(formDBInfo.formId, formDBInfo);
+        AddIndexNolock(formDBInfo);
     }
 }
 
@@ -66,24 +83,8 @@ void FormDbCache::Start()
  */
 ErrCode FormDbCache::SaveFormInfo(const FormDBInfo &formDBInfo)
 {
-    HILOG_INFO("%{public}s called, formId:%{public}" PRId64 "", __func__, formDBInfo.formId);
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    auto iter = find(formDBInfos_.begin(), formDBInfos_.end(), formDBInfo);
-    if (iter != formDBInfos_.end()) {
-        if (iter->Compare(formDBInfo) == false) {
-            HILOG_WARN("%{public}s, need update, formId[%{public}" PRId64 "].", __func__, formDBInfo.formId);
-            *iter = formDBInfo;
-            InnerFormInfo innerFormInfo(formDBInfo);
-            return dataStorage_->ModifyStorageFormInfo(innerFormInfo);
-        } else {
-            HILOG_WARN("%{public}s, already exist, formId[%{public}" PRId64 "].", __func__, formDBInfo.formId);
-            return ERR_OK;
-        }
-    } else {
-        formDBInfos_.emplace_back(formDBInfo);
-        InnerFormInfo innerFormInfo(formDBInfo);
-        return dataStorage_->SaveStorageFormInfo(innerFormInfo);
-    }
+    return SaveFormInfoNolock(formDBInfo);
 }
 
 /**
@@ -94,11 +95,13 @@ ErrCode FormDbCache::SaveFormInfo(const FormDBInfo &formDBInfo)
 ErrCode FormDbCache::SaveFormInfoNolock(const FormDBInfo &formDBInfo)
 {
     HILOG_INFO("%{public}s called, formId:%{public}" PRId64 "", __func__, formDBInfo.formId);
-    auto iter = find(formDBInfos_.begin(), formDBInfos_.end(), formDBInfo);
+    auto iter = formDBInfos_.find(formDBInfo.formId);
     if (iter != formDBInfos_.end()) {
-        if (iter->Compare(formDBInfo) == false) {
+        if (iter->second.Compare(formDBInfo) == false) {
             HILOG_WARN("%{public}s, need update, formId[%{public}" PRId64 "].", __func__, formDBInfo.formId);
-            *iter = formDBInfo;
+            RemoveIndexNolock(iter->second);
+            iter->second = formDBInfo;
+            AddIndexNolock(iter->second);
             InnerFormInfo innerFormInfo(formDBInfo);
             return dataStorage_->ModifyStorageFormInfo(innerFormInfo);
         } else {
@@ -106,7 +109,8 @@ ErrCode FormDbCache::SaveFormInfoNolock(const FormDBInfo &formDBInfo)
             return ERR_OK;
         }
     } else {
-        formDBInfos_.emplace_back(formDBInfo);
+        formDBInfos_.emplace(formDBInfo.formId, formDBInfo);
+        AddIndexNolock(formDBInfo);
         InnerFormInfo innerFormInfo(formDBInfo);
         return dataStorage_->SaveStorageFormInfo(innerFormInfo);
     }
@@ -120,13 +124,10 @@ ErrCode FormDbCache::SaveFormInfoNolock(const FormDBInfo &formDBInfo)
 ErrCode FormDbCache::DeleteFormInfo(int64_t formId)
 {
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    FormDBInfo tmpForm;
-    tmpForm.formId = formId;
-    auto iter = find(formDBInfos_.begin(), formDBInfos_.end(), tmpForm);
-    if (iter == formDBInfos_.end()) {
+    if (formDBInfos_.find(formId) == formDBInfos_.end()) {
         HILOG_WARN("%{public}s, not find formId[%{public}" PRId64 "]", __func__, formId);
     } else {
-        formDBInfos_.erase(iter);
+        EraseFormInfoNolock(formId);
     }
     if (dataStorage_->DeleteStorageFormInfo(std::to_string(formId)) == ERR_OK) {
         return ERR_OK;
@@ -143,18 +144,20 @@ ErrCode FormDbCache::DeleteFormInfo(int64_t formId)
 ErrCode FormDbCache::DeleteFormInfoByBundleName(const std::string &bundleName, std::vector<FormDBInfo> &removedDBForms)
 {
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    std::vector<FormDBInfo>::iterator itRecord;
-    for (itRecord = formDBInfos_.begin(); itRecord != formDBInfos_.end(); ) {
-        if (bundleName == itRecord->bundleName) {
-            int64_t formId = itRecord->formId;
-            if (dataStorage_->DeleteStorageFormInfo(std::to_string(formId)) == ERR_OK) {
-                removedDBForms.emplace_back(*itRecord);
-                itRecord = formDBInfos_.erase(itRecord);
-            } else {
-                itRecord++;
-            }
-        } else {
-            itRecord++;
+    auto bundleIter = bundleFormIds_.find(bundleName);
+    if (bundleIter == bundleFormIds_.end()) {
+        return ERR_OK;
+    }
+    // the forms leave the index while it is walked, so walk a copy
+    std::set<int64_t> formIds = bundleIter->second;
+    for (int64_t formId : formIds) {
+        auto iter = formDBInfos_.find(formId);
+        if (iter == formDBInfos_.end()) {
+            continue;
+        }
+        if (dataStorage_->DeleteStorageFormInfo(std::to_string(formId)) == ERR_OK) {
+            removedDBForms.emplace_back(iter->second);
+            EraseFormInfoNolock(formId);
         }
     }
     return ERR_OK;
@@ -169,7 +172,11 @@ void FormDbCache::GetAllFormInfo(std::vector<FormDBInfo> &formDBInfos)
 {
     HILOG_INFO("%{public}s called.", __func__);
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    formDBInfos = formDBInfos_;
+    formDBInfos.clear();
+    formDBInfos.reserve(formDBInfos_.size());
+    for (const auto &formDBInfo : formDBInfos_) {
+        formDBInfos.emplace_back(formDBInfo.second);
+    }
 }
 
 /**
@@ -181,19 +188,19 @@ void FormDbCache::GetAllFormInfo(std::vector<FormDBInfo> &formDBInfos)
 ErrCode FormDbCache::GetDBRecord(const int64_t formId, FormRecord &record) const
 {
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (const FormDBInfo &dbInfo : formDBInfos_) {
-        if (dbInfo.formId == formId) {
-            record.userId = dbInfo.userId;
-            record.formName = dbInfo.formName;
-            record.bundleName = dbInfo.bundleName;
-            record.moduleName = dbInfo.moduleName;
-            record.abilityName = dbInfo.abilityName;
-            record.formUserUids = dbInfo.formUserUids;
-            return ERR_OK;
-        }
+    auto iter = formDBInfos_.find(formId);
+    if (iter == formDBInfos_.end()) {
+        HILOG_ERROR("%{public}s, not find formId[%{public}" PRId64 "]", __func__, formId);
+        return ERR_APPEXECFWK_FORM_NOT_EXIST_ID;
     }
-    HILOG_ERROR("%{public}s, not find formId[%{public}" PRId64 "]", __func__, formId);
-    return ERR_APPEXECFWK_FORM_NOT_EXIST_ID;
+    const FormDBInfo &dbInfo = iter->second;
+    record.userId = dbInfo.userId;
+    record.formName = dbInfo.formName;
+    record.bundleName = dbInfo.bundleName;
+    record.moduleName = dbInfo.moduleName;
+    record.abilityName = dbInfo.abilityName;
+    record.formUserUids = dbInfo.formUserUids;
+    return ERR_OK;
 }
 /**
  * @brief Get record from DB cache with formId
@@ -204,14 +211,13 @@ ErrCode FormDbCache::GetDBRecord(const int64_t formId, FormRecord &record) const
 ErrCode FormDbCache::GetDBRecord(const int64_t formId, FormDBInfo &record) const
 {
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (const FormDBInfo &dbInfo : formDBInfos_) {
-        if (dbInfo.formId == formId) {
-            record = dbInfo;
-            return ERR_OK;
-        }
+    auto iter = formDBInfos_.find(formId);
+    if (iter == formDBInfos_.end()) {
+        HILOG_ERROR("%{public}s, not find formId[%{public}" PRId64 "]", __func__, formId);
+        return ERR_APPEXECFWK_FORM_NOT_EXIST_ID;
     }
-    HILOG_ERROR("%{public}s, not find formId[%{public}" PRId64 "]", __func__, formId);
-    return ERR_APPEXECFWK_FORM_NOT_EXIST_ID;
+    record = iter->second;
+    return ERR_OK;
 }
 /**
  * @brief Use record save or update DB data and DB cache with formId
@@ -235,24 +241,33 @@ ErrCode FormDbCache::GetNoHostDBForms(const int uid, std::map<FormIdKey,
     std::set<int64_t>> &noHostFormDBList, std::map<int64_t, bool> &foundFormsMap)
 {
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (FormDBInfo& dbInfo : formDBInfos_) {
-        if (dbInfo.Contains(uid)) {
-            dbInfo.Remove(uid);
-            if (dbInfo.formUserUids.empty()) {
-                FormIdKey formIdKey(dbInfo.bundleName, dbInfo.abilityName);
-                auto itIdsSet = noHostFormDBList.find(formIdKey);
-                if (itIdsSet == noHostFormDBList.end()) {
-                    std::set<int64_t> formIdsSet;
-                    formIdsSet.emplace(dbInfo.formId);
-                    noHostFormDBList.emplace(formIdKey, formIdsSet);
-                } else {
-                    itIdsSet->second.emplace(dbInfo.formId);
-                }
+    auto uidIter = uidFormIds_.find(uid);
+    if (uidIter == uidFormIds_.end()) {
+        return ERR_OK;
+    }
+    // the uid leaves the forms while its index is walked, so walk a copy
+    std::set<int64_t> formIds = uidIter->second;
+    for (int64_t formId : formIds) {
+        auto iter = formDBInfos_.find(formId);
+        if (iter == formDBInfos_.end()) {
+            continue;
+        }
+        FormDBInfo &dbInfo = iter->second;
+        RemoveUserUidNolock(dbInfo, uid);
+        if (dbInfo.formUserUids.empty()) {
+            FormIdKey formIdKey(dbInfo.bundleName, dbInfo.abilityName);
+            auto itIdsSet = noHostFormDBList.find(formIdKey);
+            if (itIdsSet == noHostFormDBList.end()) {
+                std::set<int64_t> formIdsSet;
+                formIdsSet.emplace(dbInfo.formId);
+                noHostFormDBList.emplace(formIdKey, formIdsSet);
             } else {
-                foundFormsMap.emplace(dbInfo.formId, false);
-                SaveFormInfoNolock(dbInfo);
-                FormBmsHelper::GetInstance().NotifyModuleNotRemovable(dbInfo.bundleName, dbInfo.moduleName);
+                itIdsSet->second.emplace(dbInfo.formId);
             }
+        } else {
+            foundFormsMap.emplace(dbInfo.formId, false);
+            SaveFormInfoNolock(dbInfo);
+            FormBmsHelper::GetInstance().NotifyModuleNotRemovable(dbInfo.bundleName, dbInfo.moduleName);
         }
     }
     return ERR_OK;
@@ -265,15 +280,12 @@ ErrCode FormDbCache::GetNoHostDBForms(const int uid, std::map<FormIdKey,
  */
 int FormDbCache::GetMatchCount(const std::string &bundleName, const std::string &moduleName)
 {
-    int32_t matchCount {0};
-    std::vector<FormDBInfo> formDBInfos;
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (FormDBInfo &dbInfo : formDBInfos_) {
-        if (dbInfo.bundleName == bundleName && dbInfo.moduleName == moduleName) {
-            ++matchCount;
-        }
+    auto iter = moduleFormIds_.find(GetModuleKey(bundleName, moduleName));
+    if (iter == moduleFormIds_.end()) {
+        return 0;
     }
-    return matchCount;
+    return static_cast<int>(iter->second.size());
 }
 /**
  * @brief delete forms bu userId.
@@ -283,11 +295,12 @@ int FormDbCache::GetMatchCount(const std::string &bundleName, const std::string
 void FormDbCache::DeleteDBFormsByUserId(const int32_t userId)
 {
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    std::vector<FormDBInfo>::iterator itRecord;
+    std::map<int64_t, FormDBInfo>::iterator itRecord;
     for (itRecord = formDBInfos_.begin(); itRecord != formDBInfos_.end();) {
-        if (userId == itRecord->userId) {
-            int64_t formId = itRecord->formId;
+        if (userId == itRecord->second.userId) {
+            int64_t formId = itRecord->first;
             if (dataStorage_->DeleteStorageFormInfo(std::to_string(formId)) == ERR_OK) {
+                RemoveIndexNolock(itRecord->second);
                 itRecord = formDBInfos_.erase(itRecord);
             } else {
                 HILOG_ERROR("%{public}s, failed to delete form, formId[%{public}" PRId64 "]", __func__, formId);
@@ -316,25 +329,30 @@ void FormDbCache::GetNoHostInvalidDBForms(int32_t userId, int32_t callingUid, st
                                           std::map<int64_t, bool> &foundFormsMap)
 {
     std::lock_guard<std::mutex> lock(formDBInfosMutex_);
-    for (auto &formRecord: formDBInfos_) {
-        int64_t formId = formRecord.formId;
+    auto uidIter = uidFormIds_.find(callingUid);
+    if (uidIter == uidFormIds_.end()) {
+        return;
+    }
+    // the uid leaves the forms while its index is walked, so walk a copy
+    std::set<int64_t> formIds = uidIter->second;
+    for (int64_t formId : formIds) {
+        auto iter = formDBInfos_.find(formId);
+        if (iter == formDBInfos_.end()) {
+            continue;
+        }
+        FormDBInfo &formRecord = iter->second;
 
         // check userID
         if (userId != formRecord.userId) {
             continue;
         }
-        // check UID
-        auto iter = std::find(formRecord.formUserUids.begin(), formRecord.formUserUids.end(), callingUid);
-        if (iter == formRecord.formUserUids.end()) {
-            continue;
-        }
         // check valid form set
         if (matchedFormIds.find(formId) != matchedFormIds.end()) {
             continue;
         }
 
         HILOG_DEBUG("found invalid form: %{public}" PRId64 "", formId);
-        formRecord.formUserUids.erase(iter);
+        RemoveUserUidNolock(formRecord, callingUid);
         if (formRecord.formUserUids.empty()) {
             FormIdKey formIdKey(formRecord.bundleName, formRecord.abilityName);
             auto itIdsSet = noHostDBFormsMap.find(formIdKey);
@@ -424,5 +442,47 @@ ErrCode FormDbCache::DeleteInvalidDBForms(int32_t userId, int32_t callingUid, st
     HILOG_INFO("DeleteInvalidDBForms done");
     return ERR_OK;
 }
+
+void FormDbCache::AddIndexNolock(const FormDBInfo &formDBInfo)
+{
+    bundleFormIds_[formDBInfo.bundleName].emplace(formDBInfo.formId);
+    moduleFormIds_[GetModuleKey(formDBInfo.bundleName, formDBInfo.moduleName)].emplace(formDBInfo.formId);
+    for (const int uid : formDBInfo.formUserUids) {
+        uidFormIds_[uid].emplace(formDBInfo.formId);
+    }
+}
+
+void FormDbCache::RemoveIndexNolock(const FormDBInfo &formDBInfo)
+{
+    EraseIndexedFormId(bundleFormIds_, formDBInfo.bundleName, formDBInfo.formId);
+    EraseIndexedFormId(moduleFormIds_, GetModuleKey(formDBInfo.bundleName, formDBInfo.moduleName), formDBInfo.formId);
+    for (const int uid : formDBInfo.formUserUids) {
+        EraseIndexedFormId(uidFormIds_, uid, formDBInfo.formId);
+    }
+}
+
+void FormDbCache::RemoveUserUidNolock(FormDBInfo &formDBInfo, const int uid)
+{
+    formDBInfo.Remove(uid);
+    // a uid may be in the list more than once
+    if (!formDBInfo.Contains(uid)) {
+        EraseIndexedFormId(uidFormIds_, uid, formDBInfo.formId);
+    }
+}
+
+void FormDbCache::EraseFormInfoNolock(int64_t formId)
+{
+    auto iter = formDBInfos_.find(formId);
+    if (iter == formDBInfos_.end()) {
+        return;
+    }
+    RemoveIndexNolock(iter->second);
+    formDBInfos_.erase(iter);
+}
+
+std::string FormDbCache::GetModuleKey(const std::string &bundleName, const std::string &moduleName)
+{
+    return bundleName + "::" + moduleName;
+}
 } // namespace AppExecFwk
 } // namespace OHOS
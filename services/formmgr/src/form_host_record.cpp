@@ -56,6 +56,19 @@ bool FormHostRecord::Contains(int64_t formId) const
 {
     return forms_.find(formId) != forms_.end();
 }
+/**
+ * @brief Get the ids of the forms in forms_.
+ * @return The ids of the forms.
+ */
+std::vector<int64_t> FormHostRecord::GetFormIds() const
+{
+    std::vector<int64_t> formIds;
+    formIds.reserve(forms_.size());
+    for (const auto &form : forms_) {
+        formIds.emplace_back(form.first);
+    }
+    return formIds;
+}
 
 /**
  * @brief Set refresh enable flag.
@@ -25,6 +25,7 @@
 #include "common_event_support.h"
 #include "form_ams_helper.h"
 #include "form_bms_helper.h"
+#include "form_connection_pool.h"
 #include "form_constants.h"
 #include "form_data_mgr.h"
 #include "form_db_cache.h"
@@ -372,6 +373,12 @@ void FormMgrService::OnStop()
 
     state_ = ServiceRunningState::STATE_NOT_START;
 
+    auto dataStorage = FormDbCache::GetInstance().GetDataStorage();
+    if (dataStorage) {
+        // the form data queued for DB is not lost with the service, nor does the service wait long for the kvStore
+        dataStorage->FlushOnStop();
+    }
+
     if (handler_) {
         handler_.reset();
     }
@@ -397,6 +404,7 @@ ErrCode FormMgrService::Init()
     }
     FormTaskMgr::GetInstance().SetEventHandler(handler_);
     FormAmsHelper::GetInstance().SetEventHandler(handler_);
+    FormConnectionPool::GetInstance().SetEventHandler(handler_);
     /* Publish service maybe failed, so we need call this function at the last,
      * so it can't affect the TDD test program */
     bool ret = Publish(DelayedSingleton<FormMgrService>::GetInstance().get());
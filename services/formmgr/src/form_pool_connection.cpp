@@ -1,6 +1,5 @@
-
 /*
- * Copyright (c) 2021-2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -14,23 +13,16 @@
  * limitations under the License.
  */
 
-#include <cinttypes>
+#include "form_pool_connection.h"
 
 #include "appexecfwk_errors.h"
-#include "form_constants.h"
-#include "form_delete_connection.h"
+#include "form_connection_pool.h"
 #include "form_supply_callback.h"
-#include "form_task_mgr.h"
 #include "hilog_wrapper.h"
-#include "ipc_types.h"
-#include "message_parcel.h"
-#include "want.h"
 
 namespace OHOS {
 namespace AppExecFwk {
-FormDeleteConnection::FormDeleteConnection(const int64_t formId, const std::string &bundleName,
-    const std::string &abilityName)
-    :formId_(formId)
+FormPoolConnection::FormPoolConnection(const std::string &bundleName, const std::string &abilityName)
 {
     SetProviderKey(bundleName, abilityName);
 }
@@ -40,21 +32,30 @@ FormDeleteConnection::FormDeleteConnection(const int64_t formId, const std::stri
  * @param remoteObject the session proxy of service ability.
  * @param resultCode ERR_OK on success, others on failure.
  */
-void FormDeleteConnection::OnAbilityConnectDone(
+void FormPoolConnection::OnAbilityConnectDone(
     const AppExecFwk::ElementName &element, const sptr<IRemoteObject> &remoteObject, int resultCode)
 {
     HILOG_INFO("%{public}s called.", __func__);
     if (resultCode != ERR_OK) {
-        HILOG_ERROR("%{public}s, abilityName:%{public}s, formId:%{public}" PRId64 ", resultCode:%{public}d",
-           __func__, element.GetAbilityName().c_str(), formId_, resultCode);
+        HILOG_ERROR("%{public}s, abilityName:%{public}s, resultCode:%{public}d",
+            __func__, element.GetAbilityName().c_str(), resultCode);
+        FormConnectionPool::GetInstance().OnDisconnected(this);
         return;
     }
     FormSupplyCallback::GetInstance()->AddConnection(this);
+    FormConnectionPool::GetInstance().OnConnected(this, remoteObject);
+}
 
-    Want want;
-    want.SetParam(Constants::FORM_CONNECT_ID, this->GetConnectId());
-    HILOG_DEBUG("%{public}s, connectId :%{public}ld", __func__, this->GetConnectId());
-    FormTaskMgr::GetInstance().PostDeleteTask(formId_, want, remoteObject);
+/**
+ * @brief OnAbilityDisconnectDone, AbilityMs notify caller ability the result of disconnect.
+ * @param element service ability's ElementName.
+ * @param resultCode ERR_OK on success, others on failure.
+ */
+void FormPoolConnection::OnAbilityDisconnectDone(const AppExecFwk::ElementName &element, int resultCode)
+{
+    // leave the pool first, so that the supply callback disconnects it like any other connection
+    FormConnectionPool::GetInstance().OnDisconnected(this);
+    FormAbilityConnection::OnAbilityDisconnectDone(element, resultCode);
 }
 }  // namespace AppExecFwk
-}  // namespace OHOS
\ No newline at end of file
+}  // namespace OHOS
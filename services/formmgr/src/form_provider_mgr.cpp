@@ -19,14 +19,13 @@
 #include "form_ams_helper.h"
 #include "form_batch_delete_connection.h"
 #include "form_cache_mgr.h"
+#include "form_connection_pool.h"
 #include "form_constants.h"
 #include "form_data_mgr.h"
-#include "form_delete_connection.h"
 #include "form_mgr_errors.h"
-#include "form_msg_event_connection.h"
 #include "form_provider_mgr.h"
 #include "form_record.h"
-#include "form_refresh_connection.h"
+#include "form_task_mgr.h"
 #include "form_timer_mgr.h"
 #include "hilog_wrapper.h"
 #include "power_mgr_client.h"
@@ -169,12 +168,6 @@ ErrCode FormProviderMgr::ConnectAmsForRefresh(const int64_t formId,
     HILOG_DEBUG("%{public}s called, bundleName:%{public}s, abilityName:%{public}s.",
         __func__, record.bundleName.c_str(), record.abilityName.c_str());
 
-    sptr<IAbilityConnection> formRefreshConnection = new FormRefreshConnection(formId, want,
-        record.bundleName, record.abilityName);
-    Want connectWant;
-    connectWant.AddFlags(Want::FLAG_ABILITY_FORM_ENABLED);
-    connectWant.SetElementName(record.bundleName, record.abilityName);
-
     if (isTimerRefresh) {
         if (!FormTimerMgr::GetInstance().IsLimiterEnableRefresh(formId)) {
             HILOG_ERROR("%{public}s, timer refresh, already limit.", __func__);
@@ -182,7 +175,28 @@ ErrCode FormProviderMgr::ConnectAmsForRefresh(const int64_t formId,
         }
     }
 
-    ErrCode errorCode = FormAmsHelper::GetInstance().ConnectServiceAbility(connectWant, formRefreshConnection);
+    ErrCode errorCode = ERR_OK;
+    if (want.HasParameter(Constants::PARAM_MESSAGE_KEY)) {
+        std::string message = want.GetStringParam(Constants::PARAM_MESSAGE_KEY);
+        errorCode = FormConnectionPool::GetInstance().PostProviderTask(record.bundleName, record.abilityName,
+            [formId, message, want](const sptr<IRemoteObject> &remoteObject, long connectId) {
+                Want msgWant = Want(want);
+                msgWant.SetParam(Constants::FORM_CONNECT_ID, connectId);
+                FormTaskMgr::GetInstance().PostFormEventTask(formId, message, msgWant, remoteObject);
+            });
+    } else if (want.HasParameter(Constants::RECREATE_FORM_KEY)) {
+        errorCode = FormConnectionPool::GetInstance().PostProviderTask(record.bundleName, record.abilityName,
+            [formId, want](const sptr<IRemoteObject> &remoteObject, long connectId) {
+                Want cloneWant = Want(want);
+                cloneWant.RemoveParam(Constants::RECREATE_FORM_KEY);
+                cloneWant.SetParam(Constants::ACQUIRE_TYPE, Constants::ACQUIRE_TYPE_RECREATE_FORM);
+                cloneWant.SetParam(Constants::FORM_CONNECT_ID, connectId);
+                FormTaskMgr::GetInstance().PostAcquireTask(formId, cloneWant, remoteObject);
+            });
+    } else {
+        // refreshes queued for the same provider reach it in one call
+        errorCode = FormConnectionPool::GetInstance().PostRefresh(formId, record.bundleName, record.abilityName);
+    }
     if (errorCode != ERR_OK) {
         HILOG_ERROR("%{public}s, ConnectServiceAbility failed.", __func__);
         return ERR_APPEXECFWK_FORM_BIND_PROVIDER_FAILED;
@@ -215,13 +229,12 @@ ErrCode FormProviderMgr::NotifyProviderFormDelete(const int64_t formId, const Fo
 
     HILOG_DEBUG("%{public}s, connectAbility,bundleName:%{public}s, abilityName:%{public}s",
         __func__, formRecord.bundleName.c_str(), formRecord.abilityName.c_str());
-    sptr<IAbilityConnection> formDeleteConnection = new FormDeleteConnection(formId,
-        formRecord.bundleName, formRecord.abilityName);
-    Want want;
-    want.SetElementName(formRecord.bundleName, formRecord.abilityName);
-    want.SetFlags(Want::FLAG_ABILITY_FORM_ENABLED);
-
-    ErrCode errorCode = FormAmsHelper::GetInstance().ConnectServiceAbility(want, formDeleteConnection);
+    ErrCode errorCode = FormConnectionPool::GetInstance().PostProviderTask(formRecord.bundleName,
+        formRecord.abilityName, [formId](const sptr<IRemoteObject> &remoteObject, long connectId) {
+            Want want;
+            want.SetParam(Constants::FORM_CONNECT_ID, connectId);
+            FormTaskMgr::GetInstance().PostDeleteTask(formId, want, remoteObject);
+        });
     if (errorCode != ERR_OK) {
         HILOG_ERROR("%{public}s, ConnectServiceAbility failed.", __func__);
         return ERR_APPEXECFWK_FORM_BIND_PROVIDER_FAILED;
@@ -353,13 +366,17 @@ int FormProviderMgr::MessageEvent(const int64_t formId, const FormRecord &record
         return ERR_APPEXECFWK_FORM_COMMON_CODE;
     }
 
-    sptr<IAbilityConnection> formMsgEventConnection = new FormMsgEventConnection(formId, want,
-        record.bundleName, record.abilityName);
-    Want connectWant;
-    connectWant.AddFlags(Want::FLAG_ABILITY_FORM_ENABLED);
-    connectWant.SetElementName(record.bundleName, record.abilityName);
-
-    ErrCode errorCode = FormAmsHelper::GetInstance().ConnectServiceAbility(connectWant, formMsgEventConnection);
+    if (!want.HasParameter(Constants::PARAM_MESSAGE_KEY)) {
+        HILOG_ERROR("%{public}s error, message info is not exist", __func__);
+        return ERR_APPEXECFWK_FORM_INVALID_PARAM;
+    }
+    std::string message = want.GetStringParam(Constants::PARAM_MESSAGE_KEY);
+    ErrCode errorCode = FormConnectionPool::GetInstance().PostProviderTask(record.bundleName, record.abilityName,
+        [formId, message, want](const sptr<IRemoteObject> &remoteObject, long connectId) {
+            Want eventWant = Want(want);
+            eventWant.SetParam(Constants::FORM_CONNECT_ID, connectId);
+            FormTaskMgr::GetInstance().PostFormEventTask(formId, message, eventWant, remoteObject);
+        });
     if (errorCode != ERR_OK) {
         HILOG_ERROR("%{public}s, ConnectServiceAbility failed.", __func__);
         return ERR_APPEXECFWK_FORM_BIND_PROVIDER_FAILED;
@@ -15,6 +15,7 @@
 
 #include "form_storage_mgr.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <dirent.h>
 #include <fstream>
@@ -36,25 +37,58 @@ namespace OHOS {
 namespace AppExecFwk {
 namespace {
 const int32_t MAX_TIMES = 600;              // 1min
+const int32_t STOP_MAX_TIMES = 10;          // 1s
 const int32_t SLEEP_INTERVAL = 100 * 1000;  // 100ms
+const std::string FORM_STORAGE_FLUSH_RUNNER = "FormStorageFlush";
+const std::string FORM_STORAGE_FLUSH_TASK = "FormStorageFlush";
+// writes are gathered for a while before a flush, and flushed at once once this many are queued
+const int64_t FORM_STORAGE_FLUSH_DELAY = 100;  // ms
+const size_t FORM_STORAGE_MAX_PENDING_WRITES = 128;
+// a failed flush is retried after this, doubled for every failure in a row up to the max
+const int64_t FORM_STORAGE_MIN_RETRY_DELAY = 1000;    // ms
+const int64_t FORM_STORAGE_MAX_RETRY_DELAY = 60000;   // ms
 }  // namespace
 
-FormStorageMgr::FormStorageMgr()
+FormStorageMgr::FormStorageMgr() : kvStoreTryTimes_(MAX_TIMES), retryDelay_(FORM_STORAGE_MIN_RETRY_DELAY)
 {
     HILOG_INFO("instance is created");
     TryTwice([this] { return GetKvStore(); });
     RegisterKvStoreDeathListener();
+    flushRunner_ = EventRunner::Create(FORM_STORAGE_FLUSH_RUNNER);
+    if (flushRunner_ == nullptr) {
+        HILOG_WARN("create flush runner failed, form data is written at once");
+        return;
+    }
+    flushHandler_ = std::make_shared<EventHandler>(flushRunner_);
+}
+
+FormStorageMgr::FormStorageMgr(const std::shared_ptr<EventHandler> &flushHandler)
+    : kvStoreTryTimes_(MAX_TIMES), retryDelay_(FORM_STORAGE_MIN_RETRY_DELAY), flushHandler_(flushHandler)
+{
+    HILOG_INFO("instance is created without kvStore");
 }
 
 FormStorageMgr::~FormStorageMgr()
 {
     HILOG_INFO("instance is destroyed");
+    if (flushHandler_ != nullptr) {
+        flushHandler_->RemoveTask(FORM_STORAGE_FLUSH_TASK);
+    }
+    // the owner flushes with FlushOnStop, a subclass store is already gone here
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        if (!pendingPuts_.empty() || !pendingDeletes_.empty()) {
+            HILOG_ERROR("%{public}zu puts and %{public}zu deletes not flushed before the storage is destroyed",
+                pendingPuts_.size(), pendingDeletes_.size());
+        }
+    }
     dataManager_.CloseKvStore(appId_, kvStorePtr_);
 }
 
 void FormStorageMgr::SaveEntries(
     const std::vector<DistributedKv::Entry> &allEntries, std::vector<InnerFormInfo> &innerFormInfos)
 {
+    std::vector<DistributedKv::Key> badKeys;
     for (const auto &item : allEntries) {
         std::string formId;
         InnerFormInfo innerFormInfo;
@@ -63,19 +97,13 @@ void FormStorageMgr::SaveEntries(
         if (jsonObject.is_discarded()) {
             HILOG_ERROR("error key: %{private}s", item.key.ToString().c_str());
             // it's an bad json, delete it
-            {
-                std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-                kvStorePtr_->Delete(item.key);
-            }
+            badKeys.emplace_back(item.key);
             continue;
         }
         if (innerFormInfo.FromJson(jsonObject) != true) {
             HILOG_ERROR("error key: %{private}s", item.key.ToString().c_str());
             // it's an error value, delete it
-            {
-                std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-                kvStorePtr_->Delete(item.key);
-            }
+            badKeys.emplace_back(item.key);
             continue;
         }
 
@@ -86,6 +114,10 @@ void FormStorageMgr::SaveEntries(
             innerFormInfos.emplace_back(innerFormInfo);
         }
     }
+    if (!badKeys.empty()) {
+        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
+        DeleteBatch(badKeys);
+    }
     HILOG_DEBUG("SaveEntries end");
 }
 
@@ -98,6 +130,8 @@ ErrCode FormStorageMgr::LoadFormData(std::vector<InnerFormInfo> &innerFormInfos)
 {
     HILOG_INFO("%{public}s called.", __func__);
     bool ret = ERR_OK;
+    // the queued writes first, so that they are loaded too
+    Flush();
     {
         std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
         if (!CheckKvStore()) {
@@ -108,7 +142,8 @@ ErrCode FormStorageMgr::LoadFormData(std::vector<InnerFormInfo> &innerFormInfos)
     DistributedKv::Status status;
     std::vector<DistributedKv::Entry> allEntries;
     TryTwice([this, &status, &allEntries] {
-        status = GetEntries(allEntries);
+        // if prefix is empty, get all entries.
+        status = GetEntries(DistributedKv::Key(""), allEntries);
         return status;
     });
 
@@ -132,6 +167,8 @@ ErrCode FormStorageMgr::GetStorageFormInfoById(const std::string &formId, InnerF
 {
     ErrCode ret = ERR_OK;
     HILOG_DEBUG("%{public}s called, formId[%{public}s]", __func__, formId.c_str());
+    // the queued writes first, so that the latest form data is read
+    Flush();
 
     {
         std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
@@ -141,13 +178,9 @@ ErrCode FormStorageMgr::GetStorageFormInfoById(const std::string &formId, InnerF
         }
     }
 
-    DistributedKv::Status status = DistributedKv::Status::ERROR;
     std::vector<DistributedKv::Entry> allEntries;
     DistributedKv::Key key(formId);
-    if (kvStorePtr_) {
-        // sync call GetEntries, the callback will be trigger at once
-        status = kvStorePtr_->GetEntries(key, allEntries);
-    }
+    DistributedKv::Status status = GetEntries(key, allEntries);
 
     if (status != DistributedKv::Status::SUCCESS) {
         HILOG_ERROR("get entries error: %{public}d", status);
@@ -180,33 +213,13 @@ ErrCode FormStorageMgr::GetStorageFormInfoById(const std::string &formId, InnerF
 ErrCode FormStorageMgr::SaveStorageFormInfo(const InnerFormInfo &innerFormInfo)
 {
     HILOG_INFO("%{public}s called, formId[%{public}" PRId64 "]", __func__, innerFormInfo.GetFormId());
-    ErrCode ret = ERR_OK;
     std::string formId = std::to_string(innerFormInfo.GetFormId());
-
     {
-        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        if (!CheckKvStore()) {
-            HILOG_ERROR("kvStore is nullptr");
-            return ERR_APPEXECFWK_FORM_COMMON_CODE;
-        }
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        pendingDeletes_.erase(formId);
+        pendingPuts_[formId] = innerFormInfo.ToString();
     }
-
-    DistributedKv::Key key(formId);
-    DistributedKv::Value value(innerFormInfo.ToString());
-    DistributedKv::Status status;
-    {
-        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Put(key, value);
-        if (status == DistributedKv::Status::IPC_ERROR) {
-            status = kvStorePtr_->Put(key, value);
-            HILOG_WARN("distribute database ipc error and try to call again, result = %{public}d", status);
-        }
-    }
-    if (status != DistributedKv::Status::SUCCESS) {
-        HILOG_ERROR("put innerFormInfo to kvStore error: %{public}d", status);
-        ret = ERR_APPEXECFWK_FORM_COMMON_CODE;
-    }
-    return ret;
+    return PostFlush();
 }
 
 /**
@@ -217,15 +230,8 @@ ErrCode FormStorageMgr::SaveStorageFormInfo(const InnerFormInfo &innerFormInfo)
 ErrCode FormStorageMgr::ModifyStorageFormInfo(const InnerFormInfo &innerFormInfo)
 {
     HILOG_INFO("%{public}s called, formId[%{public}" PRId64 "]", __func__, innerFormInfo.GetFormId());
-
-    ErrCode ret = ERR_OK;
-    std::string formId = std::to_string(innerFormInfo.GetFormId());
-    ret = DeleteStorageFormInfo(formId);
-    if (ret == ERR_OK) {
-        SaveStorageFormInfo(innerFormInfo);
-    }
-
-    return ret;
+    // a put replaces the old form data, no need to delete it first
+    return SaveStorageFormInfo(innerFormInfo);
 }
 
 /**
@@ -236,34 +242,172 @@ ErrCode FormStorageMgr::ModifyStorageFormInfo(const InnerFormInfo &innerFormInfo
 ErrCode FormStorageMgr::DeleteStorageFormInfo(const std::string &formId)
 {
     HILOG_INFO("%{public}s called, formId[%{public}s]", __func__, formId.c_str());
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        pendingPuts_.erase(formId);
+        pendingDeletes_.emplace(formId);
+    }
+    return PostFlush();
+}
+
+/**
+ * @brief Write the queued form data to DB now.
+ * @return Returns ERR_OK on success, others on failure, the writes not done stay queued.
+ */
+ErrCode FormStorageMgr::Flush()
+{
+    return DoFlush(MAX_TIMES, true);
+}
 
+/**
+ * @brief Write the queued form data to DB as the service stops, waiting a short while only for the kvStore.
+ * @return Returns ERR_OK on success, others on failure, the writes not done stay queued.
+ */
+ErrCode FormStorageMgr::FlushOnStop()
+{
+    if (flushHandler_ != nullptr) {
+        flushHandler_->RemoveTask(FORM_STORAGE_FLUSH_TASK);
+    }
+    return DoFlush(STOP_MAX_TIMES, true);
+}
+
+ErrCode FormStorageMgr::DoFlush(int32_t kvStoreTryTimes, bool isRetryPosted)
+{
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    std::map<std::string, std::string> puts;
+    std::set<std::string> deletes;
     {
-        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        if (!CheckKvStore()) {
-            HILOG_ERROR("kvStore is nullptr");
-            return ERR_APPEXECFWK_FORM_COMMON_CODE;
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        isFlushPosted_ = false;
+        puts.swap(pendingPuts_);
+        deletes.swap(pendingDeletes_);
+    }
+    if (puts.empty() && deletes.empty()) {
+        return ERR_OK;
+    }
+    HILOG_INFO("%{public}s, put %{public}zu forms, delete %{public}zu forms", __func__, puts.size(), deletes.size());
+
+    std::unique_lock<std::mutex> lock(kvStorePtrMutex_);
+    kvStoreTryTimes_ = kvStoreTryTimes;
+    bool isKvStoreReady = CheckKvStore();
+    kvStoreTryTimes_ = MAX_TIMES;
+    if (isKvStoreReady) {
+        WriteBatches(puts, deletes);
+    } else {
+        HILOG_ERROR("kvStore is nullptr");
+    }
+    lock.unlock();
+
+    std::lock_guard<std::mutex> pendingLock(pendingMutex_);
+    if (puts.empty() && deletes.empty()) {
+        if (failedFlushCount_ > 0) {
+            HILOG_INFO("%{public}s, form data written after %{public}d failed flushes", __func__, failedFlushCount_);
         }
+        failedFlushCount_ = 0;
+        retryDelay_ = FORM_STORAGE_MIN_RETRY_DELAY;
+        return ERR_OK;
     }
-    DistributedKv::Key key(formId);
-    DistributedKv::Status status;
+    failedFlushCount_++;
+    HILOG_ERROR("%{public}s failed %{public}d times in a row, %{public}zu puts and %{public}zu deletes not written",
+        __func__, failedFlushCount_, puts.size(), deletes.size());
+    // retried later, and with the next flush, at the latest once the kvStore is back
+    Requeue(puts, deletes);
+    if (isRetryPosted) {
+        PostRetry();
+    }
+    return ERR_APPEXECFWK_FORM_COMMON_CODE;
+}
+
+void FormStorageMgr::WriteBatches(std::map<std::string, std::string> &puts, std::set<std::string> &deletes)
+{
+    // a form is either put or deleted, so the two batches do not depend on each other
+    if (!puts.empty()) {
+        std::vector<DistributedKv::Entry> entries;
+        entries.reserve(puts.size());
+        for (const auto &put : puts) {
+            DistributedKv::Entry entry;
+            entry.key = put.first;
+            entry.value = put.second;
+            entries.emplace_back(entry);
+        }
+        DistributedKv::Status status;
+        TryTwice([this, &status, &entries] {
+            status = PutBatch(entries);
+            return status;
+        });
+        if (status != DistributedKv::Status::SUCCESS) {
+            HILOG_ERROR("put innerFormInfos to kvStore error: %{public}d", status);
+        } else {
+            puts.clear();
+        }
+    }
+    if (!deletes.empty()) {
+        std::vector<DistributedKv::Key> keys(deletes.begin(), deletes.end());
+        DistributedKv::Status status;
+        TryTwice([this, &status, &keys] {
+            status = DeleteBatch(keys);
+            return status;
+        });
+        if (status != DistributedKv::Status::SUCCESS) {
+            HILOG_ERROR("delete keys error: %{public}d", status);
+        } else {
+            deletes.clear();
+        }
+    }
+}
 
+ErrCode FormStorageMgr::PostFlush()
+{
+    if (flushHandler_ == nullptr) {
+        return Flush();
+    }
     {
-        std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-        status = kvStorePtr_->Delete(key);
-        if (status == DistributedKv::Status::IPC_ERROR) {
-            status = kvStorePtr_->Delete(key);
-            HILOG_WARN("distribute database ipc error and try to call again, result = %{public}d", status);
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        // while the kvStore fails, the write waits for the retry and its caller hears of the failure
+        ErrCode result = failedFlushCount_ > 0 ? ERR_APPEXECFWK_FORM_COMMON_CODE : ERR_OK;
+        size_t pendingCount = pendingPuts_.size() + pendingDeletes_.size();
+        // posted once when writes start to queue, and again, to run at once, when enough are queued
+        if (isFlushPosted_ && pendingCount != FORM_STORAGE_MAX_PENDING_WRITES) {
+            return result;
+        }
+        int64_t delayTime = pendingCount < FORM_STORAGE_MAX_PENDING_WRITES ? FORM_STORAGE_FLUSH_DELAY : 0;
+        flushHandler_->RemoveTask(FORM_STORAGE_FLUSH_TASK);
+        isFlushPosted_ = flushHandler_->PostTask([this] { Flush(); }, FORM_STORAGE_FLUSH_TASK, delayTime);
+        if (isFlushPosted_) {
+            return result;
         }
     }
+    HILOG_ERROR("%{public}s, post flush task failed, flush at once", __func__);
+    return Flush();
+}
 
-    if (status != DistributedKv::Status::SUCCESS) {
-        HILOG_ERROR("delete key error: %{public}d", status);
-        return ERR_APPEXECFWK_FORM_COMMON_CODE;
-    } else {
-        HILOG_ERROR("delete value to kvStore success");
+void FormStorageMgr::PostRetry()
+{
+    if (flushHandler_ == nullptr) {
+        return;
     }
+    int64_t delayTime = retryDelay_;
+    retryDelay_ = std::min(retryDelay_ * 2, FORM_STORAGE_MAX_RETRY_DELAY);
+    flushHandler_->RemoveTask(FORM_STORAGE_FLUSH_TASK);
+    isFlushPosted_ = flushHandler_->PostTask([this] { Flush(); }, FORM_STORAGE_FLUSH_TASK, delayTime);
+    if (!isFlushPosted_) {
+        HILOG_ERROR("%{public}s, post retry task failed", __func__);
+    }
+}
 
-    return ERR_OK;
+void FormStorageMgr::Requeue(std::map<std::string, std::string> &puts, std::set<std::string> &deletes)
+{
+    // the writes queued since are newer, they win
+    for (auto &put : puts) {
+        if (pendingPuts_.count(put.first) == 0 && pendingDeletes_.count(put.first) == 0) {
+            pendingPuts_.emplace(put.first, std::move(put.second));
+        }
+    }
+    for (const auto &formId : deletes) {
+        if (pendingPuts_.count(formId) == 0) {
+            pendingDeletes_.emplace(formId);
+        }
+    }
 }
 
 void FormStorageMgr::RegisterKvStoreDeathListener()
@@ -279,7 +423,7 @@ bool FormStorageMgr::CheckKvStore()
     if (kvStorePtr_ != nullptr) {
         return true;
     }
-    int32_t tryTimes = MAX_TIMES;
+    int32_t tryTimes = kvStoreTryTimes_;
     while (tryTimes > 0) {
         DistributedKv::Status status = GetKvStore();
         if (status == DistributedKv::Status::SUCCESS && kvStorePtr_ != nullptr) {
@@ -310,19 +454,34 @@ DistributedKv::Status FormStorageMgr::GetKvStore()
     return status;
 }
 
-DistributedKv::Status FormStorageMgr::GetEntries(std::vector<DistributedKv::Entry> &allEntries)
+DistributedKv::Status FormStorageMgr::GetEntries(const DistributedKv::Key &prefix,
+    std::vector<DistributedKv::Entry> &entries)
 {
     DistributedKv::Status status = DistributedKv::Status::ERROR;
-    // if prefix is empty, get all entries.
-    DistributedKv::Key key("");
     if (kvStorePtr_) {
         // sync call GetEntries, the callback will be trigger at once
-        status = kvStorePtr_->GetEntries(key, allEntries);
+        status = kvStorePtr_->GetEntries(prefix, entries);
     }
-    HILOG_INFO("get all entries status: %{public}d", status);
+    HILOG_INFO("get entries status: %{public}d", status);
     return status;
 }
 
+DistributedKv::Status FormStorageMgr::PutBatch(const std::vector<DistributedKv::Entry> &entries)
+{
+    if (!kvStorePtr_) {
+        return DistributedKv::Status::ERROR;
+    }
+    return kvStorePtr_->PutBatch(entries);
+}
+
+DistributedKv::Status FormStorageMgr::DeleteBatch(const std::vector<DistributedKv::Key> &keys)
+{
+    if (!kvStorePtr_) {
+        return DistributedKv::Status::ERROR;
+    }
+    return kvStorePtr_->DeleteBatch(keys);
+}
+
 void FormStorageMgr::TryTwice(const std::function<DistributedKv::Status()> &func)
 {
     DistributedKv::Status status = func();
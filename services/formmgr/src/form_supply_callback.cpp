@@ -17,6 +17,7 @@
 
 #include "appexecfwk_errors.h"
 #include "form_ams_helper.h"
+#include "form_connection_pool.h"
 #include "form_constants.h"
 #include "form_mgr_errors.h"
 #include "form_provider_mgr.h"
@@ -141,6 +142,11 @@ void FormSupplyCallback::AddConnection(sptr<FormAbilityConnection> connection)
 void FormSupplyCallback::RemoveConnection(long connectId)
 {
     HILOG_INFO("%{public}s called.", __func__);
+    if (FormConnectionPool::GetInstance().ReleaseConnection(connectId)) {
+        // pooled connections stay until they are idle
+        HILOG_INFO("%{public}s end, release pooled connection", __func__);
+        return;
+    }
     sptr<FormAbilityConnection> connection = nullptr;
     {
         std::lock_guard<std::mutex> lock_l(conMutex_);
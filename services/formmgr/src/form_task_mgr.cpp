@@ -83,6 +83,26 @@ void FormTaskMgr::PostRefreshTask(const int64_t formId, const Want &want, const
     eventHandler_->PostTask(notifyFormUpdateFunc, FORM_TASK_DELAY_TIME);
 }
 
+/**
+ * @brief Refresh the data of forms from their form provider in one call(task).
+ *
+ * @param formIds The Id list of the forms.
+ * @param want The want of the forms.
+ * @param remoteObject Form provider proxy object.
+ * @return none.
+ */
+void FormTaskMgr::PostBatchRefreshTask(const std::vector<int64_t> &formIds, const Want &want,
+    const sptr<IRemoteObject> &remoteObject)
+{
+    if (eventHandler_ == nullptr) {
+        HILOG_ERROR("%{public}s fail, eventhandler invalidate.", __func__);
+        return;
+    }
+    std::function<void()> notifyFormsUpdateFunc = std::bind(&FormTaskMgr::NotifyFormsUpdate,
+        this, formIds, want, remoteObject);
+    eventHandler_->PostTask(notifyFormsUpdateFunc, FORM_TASK_DELAY_TIME);
+}
+
 /**
  * @brief Cast temp form data from form provider(task).
  *
@@ -332,6 +352,33 @@ void FormTaskMgr::NotifyFormUpdate(const int64_t formId, const Want &want, const
     }
 }
 
+/**
+ * @brief Notify form provider for updating forms.
+ *
+ * @param formIds The Id list of the forms.
+ * @param want The want of the forms.
+ * @param remoteObject Form provider proxy object.
+ * @return none.
+ */
+void FormTaskMgr::NotifyFormsUpdate(const std::vector<int64_t> &formIds, const Want &want,
+    const sptr<IRemoteObject> &remoteObject)
+{
+    HILOG_INFO("%{public}s called, formIds size:%{public}zu.", __func__, formIds.size());
+
+    long connectId = want.GetLongParam(Constants::FORM_CONNECT_ID, 0);
+    sptr<IFormProvider> formProviderProxy = iface_cast<IFormProvider>(remoteObject);
+    if (formProviderProxy == nullptr) {
+        FormSupplyCallback::GetInstance()->RemoveConnection(connectId);
+        HILOG_ERROR("%{public}s fail, failed to get formProviderProxy", __func__);
+        return;
+    }
+    int error = formProviderProxy->NotifyFormsUpdate(formIds, want, FormSupplyCallback::GetInstance());
+    if (error != ERR_OK) {
+        FormSupplyCallback::GetInstance()->RemoveConnection(connectId);
+        HILOG_ERROR("%{public}s fail, Failed to notify forms update.", __func__);
+    }
+}
+
 /**
  * @brief Event notify to form provider.
  *
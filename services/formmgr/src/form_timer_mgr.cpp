@@ -186,6 +186,8 @@ bool FormTimerMgr::UpdateIntervalValue(const int64_t formId, const FormTimerCfg
     auto intervalTask = intervalTimerTasks_.find(formId);
     if (intervalTask != intervalTimerTasks_.end()) {
         intervalTask->second.period = timerCfg.updateDuration / timeSpeed_;
+        intervalQueue_.Push(formId, GetSteadyMillisecond() + intervalTask->second.period);
+        UpdateIntervalTimer();
         return true;
     } else {
         HILOG_ERROR("%{public}s failed, the interval timer is not exist", __func__);
@@ -207,20 +209,12 @@ bool FormTimerMgr::UpdateAtTimerValue(const int64_t formId, const FormTimerCfg &
     }
     {
         std::lock_guard<std::mutex> lock(updateAtMutex_);
-        std::list<UpdateAtItem>::iterator itItem;
-        UpdateAtItem changedItem;
-        for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-            if (itItem->refreshTask.formId == formId) {
-                changedItem = *itItem;
-                updateAtTimerTasks_.erase(itItem);
-                break;
-            }
-        }
-
-        if (changedItem.refreshTask.formId == 0) {
+        auto itItem = updateAtTimerTasks_.find(formId);
+        if (itItem == updateAtTimerTasks_.end()) {
             HILOG_ERROR("%{public}s failed, the update at timer is not exist", __func__);
             return false;
         }
+        UpdateAtItem changedItem = itItem->second;
         changedItem.refreshTask.hour = timerCfg.updateAtHour;
         changedItem.refreshTask.min = timerCfg.updateAtMin;
         changedItem.updateAtTime = changedItem.refreshTask.hour * Constants::MIN_PER_HOUR + changedItem.refreshTask.min;
@@ -253,6 +247,8 @@ bool FormTimerMgr::IntervalToAtTimer(const int64_t formId, const FormTimerCfg &t
     if (intervalTask != intervalTimerTasks_.end()) {
         timerTask = intervalTask->second;
         intervalTimerTasks_.erase(intervalTask);
+        intervalQueue_.Remove(formId);
+        UpdateIntervalTimer();
 
         timerTask.isUpdateAt = true;
         timerTask.hour = timerCfg.updateAtHour;
@@ -282,15 +278,15 @@ bool FormTimerMgr::AtTimerToIntervalTimer(const int64_t formId, const FormTimerC
     }
 
     UpdateAtItem targetItem;
+    bool isExist = false;
     {
         std::lock_guard<std::mutex> lock(updateAtMutex_);
-        std::list<UpdateAtItem>::iterator itItem;
-        for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-            if (itItem->refreshTask.formId == formId) {
-                targetItem = *itItem;
-                updateAtTimerTasks_.erase(itItem);
-                break;
-            }
+        auto itItem = updateAtTimerTasks_.find(formId);
+        if (itItem != updateAtTimerTasks_.end()) {
+            targetItem = itItem->second;
+            updateAtTimerTasks_.erase(itItem);
+            updateAtQueue_.Remove(formId);
+            isExist = true;
         }
     }
 
@@ -299,7 +295,7 @@ bool FormTimerMgr::AtTimerToIntervalTimer(const int64_t formId, const FormTimerC
         return false;
     }
 
-    if (targetItem.refreshTask.formId == 0) {
+    if (!isExist) {
         HILOG_ERROR("%{public}s failed, the update at timer is not exist", __func__);
         return false;
     }
@@ -347,48 +343,30 @@ bool FormTimerMgr::SetNextRefreshTime(const int64_t formId, const long nextGapTi
     int64_t refreshTime = timeInSec + nextGapTime * Constants::MS_PER_SECOND / timeSpeed_;
     HILOG_INFO("%{public}s currentTime:%{public}s refreshTime:%{public}s", __func__,
         std::to_string(timeInSec).c_str(), std::to_string(refreshTime).c_str());
-    std::lock_guard<std::mutex> lock(refreshMutex_);
-    bool isExist = false;
-    for (auto &refreshItem : dynamicRefreshTasks_) {
-        if ((refreshItem.formId == formId) && (refreshItem.userId == userId)) {
-            refreshItem.settedTime = refreshTime;
-            isExist = true;
-            break;
+    {
+        std::lock_guard<std::mutex> lock(dynamicMutex_);
+        auto result = dynamicHandles_.emplace(std::make_pair(formId, userId), nextDynamicHandle_);
+        if (result.second) {
+            nextDynamicHandle_++;
+        }
+        int64_t handle = result.first->second;
+        dynamicRefreshTasks_[handle] = DynamicRefreshItem(formId, refreshTime, userId);
+        dynamicQueue_.Push(handle, refreshTime);
+        if (!UpdateDynamicAlarm()) {
+            HILOG_ERROR("%{public}s, failed to UpdateDynamicAlarm", __func__);
+            return false;
         }
-    }
-    if (!isExist) {
-        DynamicRefreshItem theItem;
-        theItem.formId = formId;
-        theItem.settedTime = refreshTime;
-        theItem.userId = userId;
-        dynamicRefreshTasks_.emplace_back(theItem);
-    }
-    std::sort(dynamicRefreshTasks_.begin(), dynamicRefreshTasks_.end(), CompareDynamicRefreshItem);
-    if (!UpdateDynamicAlarm()) {
-        HILOG_ERROR("%{public}s, failed to UpdateDynamicAlarm", __func__);
-        return false;
     }
     if (!UpdateLimiterAlarm()) {
         HILOG_ERROR("%{public}s, failed to UpdateLimiterAlarm", __func__);
         return false;
     }
     refreshLimiter_.AddItem(formId);
-    SetEnableFlag(formId, false);
+    SetIntervalEnableFlag(formId, false);
 
     return true;
 }
 
-void FormTimerMgr::SetEnableFlag(int64_t formId, bool flag)
-{
-    // try interval list
-    auto iter = intervalTimerTasks_.find(formId);
-    if (iter != intervalTimerTasks_.end()) {
-        iter->second.isEnable = flag;
-        HILOG_INFO("%{public}s, formId:%{public}" PRId64 ", isEnable:%{public}d", __func__, formId, flag ? 1 : 0);
-        return;
-    }
-}
-
 /**
  * @brief Get refresh count.
  * @param formId The Id of the form.
@@ -417,12 +395,9 @@ bool FormTimerMgr::AddUpdateAtTimer(const FormTimer &task)
     HILOG_INFO("%{public}s start", __func__);
     {
         std::lock_guard<std::mutex> lock(updateAtMutex_);
-        for (auto &updateAtTimer : updateAtTimerTasks_) {
-            if (updateAtTimer.refreshTask.formId == task.formId) {
-                HILOG_WARN(
-                    "%{public}s, already exist formTimer, formId:%{public}" PRId64 " task", __func__, task.formId);
-                return true;
-            }
+        if (updateAtTimerTasks_.find(task.formId) != updateAtTimerTasks_.end()) {
+            HILOG_WARN("%{public}s, already exist formTimer, formId:%{public}" PRId64 " task", __func__, task.formId);
+            return true;
         }
 
         UpdateAtItem atItem;
@@ -453,12 +428,14 @@ bool FormTimerMgr::AddIntervalTimer(const FormTimer &task)
     HILOG_INFO("%{public}s start", __func__);
     {
         std::lock_guard<std::mutex> lock(intervalMutex_);
-        EnsureInitIntervalTimer();
         if (intervalTimerTasks_.find(task.formId) != intervalTimerTasks_.end()) {
             HILOG_WARN("%{public}s, already exist formTimer, formId:%{public}" PRId64 " task", __func__, task.formId);
             return true;
         }
         intervalTimerTasks_.emplace(task.formId, task);
+        // a new form is refreshed one base period later, as the periodic scan used to
+        intervalQueue_.Push(task.formId, GetSteadyMillisecond() + Constants::MIN_PERIOD / timeSpeed_);
+        UpdateIntervalTimer();
     }
     if (!UpdateLimiterAlarm()) {
         HILOG_ERROR("%{public}s, failed to UpdateLimiterAlarm", __func__);
@@ -472,30 +449,8 @@ bool FormTimerMgr::AddIntervalTimer(const FormTimer &task)
  */
 void FormTimerMgr::AddUpdateAtItem(const UpdateAtItem &atItem)
 {
-    if (updateAtTimerTasks_.empty()) {
-        updateAtTimerTasks_.emplace_back(atItem);
-        return;
-    }
-
-    UpdateAtItem firstItem = updateAtTimerTasks_.front();
-    if (atItem.updateAtTime < firstItem.updateAtTime) {
-        updateAtTimerTasks_.emplace_front(atItem);
-        return;
-    }
-
-    bool isInsert = false;
-    std::list<UpdateAtItem>::iterator itItem;
-    for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-        if (atItem.updateAtTime < itItem->updateAtTime) {
-            updateAtTimerTasks_.insert(itItem, atItem);
-            isInsert = true;
-            break;
-        }
-    }
-
-    if (!isInsert) {
-        updateAtTimerTasks_.emplace_back(atItem);
-    }
+    updateAtTimerTasks_[atItem.refreshTask.formId] = atItem;
+    updateAtQueue_.Push(atItem.refreshTask.formId, atItem.updateAtTime);
 }
 /**
  * @brief Handle system time changed.
@@ -543,10 +498,12 @@ bool FormTimerMgr::OnUpdateAtTrigger(long updateTime)
     std::vector<UpdateAtItem> updateList;
     {
         std::lock_guard<std::mutex> lock(updateAtMutex_);
-        std::list<UpdateAtItem>::iterator itItem;
-        for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-            if (itItem->updateAtTime == updateTime && itItem->refreshTask.isEnable) {
-                updateList.emplace_back(*itItem);
+        std::vector<int64_t> formIds;
+        updateAtQueue_.GetRange(updateTime, updateTime, formIds);
+        for (int64_t formId : formIds) {
+            auto itItem = updateAtTimerTasks_.find(formId);
+            if (itItem != updateAtTimerTasks_.end() && itItem->second.refreshTask.isEnable) {
+                updateList.emplace_back(itItem->second);
             }
         }
     }
@@ -577,28 +534,29 @@ bool FormTimerMgr::OnDynamicTimeTrigger(int64_t updateTime)
     std::vector<FormTimer> updateList;
     {
         std::lock_guard<std::mutex> lock(dynamicMutex_);
-        auto timeSinceEpoch = std::chrono::steady_clock::now().time_since_epoch();
-        auto timeInSec = std::chrono::duration_cast<std::chrono::milliseconds>(timeSinceEpoch).count();
-        int64_t markedTime = timeInSec + Constants::ABS_REFRESH_MS;
-        std::vector<DynamicRefreshItem>::iterator itItem;
-        for (itItem = dynamicRefreshTasks_.begin(); itItem != dynamicRefreshTasks_.end();) {
-            if (itItem->settedTime <= updateTime || itItem->settedTime <= markedTime) {
-                if (refreshLimiter_.IsEnableRefresh(itItem->formId)) {
-                    FormTimer timerTask(itItem->formId, true, itItem->userId);
-                    updateList.emplace_back(timerTask);
-                }
-                SetIntervalEnableFlag(itItem->formId, true);
-                itItem = dynamicRefreshTasks_.erase(itItem);
-            } else {
-                itItem++;
+        // the deadlines due within ABS_REFRESH_MS are refreshed with this alarm too
+        int64_t markedTime = GetSteadyMillisecond() + Constants::ABS_REFRESH_MS;
+        std::vector<int64_t> handles;
+        dynamicQueue_.PopExpired(std::max(updateTime, markedTime), handles);
+        for (int64_t handle : handles) {
+            auto itItem = dynamicRefreshTasks_.find(handle);
+            if (itItem == dynamicRefreshTasks_.end()) {
+                continue;
+            }
+            int64_t formId = itItem->second.formId;
+            if (refreshLimiter_.IsEnableRefresh(formId)) {
+                FormTimer timerTask(formId, true, itItem->second.userId);
+                updateList.emplace_back(timerTask);
             }
+            SetIntervalEnableFlag(formId, true);
+            dynamicHandles_.erase(std::make_pair(formId, itItem->second.userId));
+            dynamicRefreshTasks_.erase(itItem);
         }
-        std::sort(dynamicRefreshTasks_.begin(), dynamicRefreshTasks_.end(),  CompareDynamicRefreshItem);
-    }
 
-    if (!UpdateDynamicAlarm()) {
-        HILOG_ERROR("%{public}s, failed to update dynamic alarm.", __func__);
-        return false;
+        if (!UpdateDynamicAlarm()) {
+            HILOG_ERROR("%{public}s, failed to update dynamic alarm.", __func__);
+            return false;
+        }
     }
 
     if (!updateList.empty()) {
@@ -682,14 +640,12 @@ bool FormTimerMgr::GetUpdateAtTimer(const int64_t formId, UpdateAtItem &updateAt
     HILOG_INFO("%{public}s start", __func__);
     {
         std::lock_guard<std::mutex> lock(updateAtMutex_);
-        std::list<UpdateAtItem>::iterator itItem;
-        for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-            if (itItem->refreshTask.formId == formId) {
-                updateAtItem.refreshTask = itItem->refreshTask;
-                updateAtItem.updateAtTime = itItem->updateAtTime;
-                HILOG_INFO("%{public}s, get update at timer successfully", __func__);
-                return true;
-            }
+        auto itItem = updateAtTimerTasks_.find(formId);
+        if (itItem != updateAtTimerTasks_.end()) {
+            updateAtItem.refreshTask = itItem->second.refreshTask;
+            updateAtItem.updateAtTime = itItem->second.updateAtTime;
+            HILOG_INFO("%{public}s, get update at timer successfully", __func__);
+            return true;
         }
     }
     HILOG_INFO("%{public}s, update at timer not find", __func__);
@@ -704,15 +660,15 @@ bool FormTimerMgr::GetDynamicItem(const int64_t formId, DynamicRefreshItem &dyna
 {
     HILOG_INFO("%{public}s start", __func__);
     std::lock_guard<std::mutex> lock(dynamicMutex_);
-    std::vector<DynamicRefreshItem>::iterator itItem;
-    for (itItem = dynamicRefreshTasks_.begin(); itItem != dynamicRefreshTasks_.end();) {
-        if (itItem->formId == formId) {
-            dynamicItem.formId = itItem->formId;
-            dynamicItem.settedTime = itItem->settedTime;
-            dynamicItem.userId = itItem->userId;
-            HILOG_INFO("%{public}s, get dynamic item successfully", __func__);
-            return true;
-        }
+    auto itHandle = dynamicHandles_.lower_bound(std::make_pair(formId, INT32_MIN));
+    auto itItem = itHandle != dynamicHandles_.end() && itHandle->first.first == formId ?
+        dynamicRefreshTasks_.find(itHandle->second) : dynamicRefreshTasks_.end();
+    if (itItem != dynamicRefreshTasks_.end()) {
+        dynamicItem.formId = itItem->second.formId;
+        dynamicItem.settedTime = itItem->second.settedTime;
+        dynamicItem.userId = itItem->second.userId;
+        HILOG_INFO("%{public}s, get dynamic item successfully", __func__);
+        return true;
     }
     HILOG_INFO("%{public}s, dynamic item not find", __func__);
     return false;
@@ -727,6 +683,8 @@ void FormTimerMgr::SetTimeSpeed(int32_t timeSpeed)
     timeSpeed_ = timeSpeed;
     HandleResetLimiter();
     ClearIntervalTimer();
+    std::lock_guard<std::mutex> lock(intervalMutex_);
+    UpdateIntervalTimer();
 }
 /**
  * @brief Delete interval timer task.
@@ -741,12 +699,10 @@ bool FormTimerMgr::DeleteIntervalTimer(const int64_t formId)
     auto intervalTask = intervalTimerTasks_.find(formId);
     if (intervalTask != intervalTimerTasks_.end()) {
         intervalTimerTasks_.erase(intervalTask);
+        intervalQueue_.Remove(formId);
         isExist = true;
     }
-
-    if (intervalTimerTasks_.empty()) {
-        ClearIntervalTimer();
-    }
+    UpdateIntervalTimer();
     HILOG_INFO("%{public}s end", __func__);
     return isExist;
 }
@@ -760,13 +716,8 @@ bool FormTimerMgr::DeleteUpdateAtTimer(const int64_t formId)
     HILOG_INFO("%{public}s start", __func__);
     {
         std::lock_guard<std::mutex> lock(updateAtMutex_);
-        std::list<UpdateAtItem>::iterator itItem;
-        for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-            if (itItem->refreshTask.formId == formId) {
-                updateAtTimerTasks_.erase(itItem);
-                break;
-            }
-        }
+        updateAtTimerTasks_.erase(formId);
+        updateAtQueue_.Remove(formId);
     }
 
     if (!UpdateAtTimerAlarm()) {
@@ -784,17 +735,13 @@ bool FormTimerMgr::DeleteDynamicItem(const int64_t formId)
 {
     HILOG_INFO("%{public}s start", __func__);
     std::lock_guard<std::mutex> lock(dynamicMutex_);
-    std::vector<DynamicRefreshItem>::iterator itItem;
-    for (itItem = dynamicRefreshTasks_.begin(); itItem != dynamicRefreshTasks_.end();) {
-        if (itItem->formId == formId) {
-            itItem = dynamicRefreshTasks_.erase(itItem);
-            if (itItem != dynamicRefreshTasks_.end()) {
-                SetIntervalEnableFlag(itItem->formId, true);
-            }
-            break;
-        }
+    // the form goes away for every user
+    auto itHandle = dynamicHandles_.lower_bound(std::make_pair(formId, INT32_MIN));
+    while (itHandle != dynamicHandles_.end() && itHandle->first.first == formId) {
+        dynamicRefreshTasks_.erase(itHandle->second);
+        dynamicQueue_.Remove(itHandle->second);
+        itHandle = dynamicHandles_.erase(itHandle);
     }
-    std::sort(dynamicRefreshTasks_.begin(), dynamicRefreshTasks_.end(),  CompareDynamicRefreshItem);
 
     if (!UpdateDynamicAlarm()) {
         HILOG_ERROR("%{public}s, failed to UpdateDynamicAlarm", __func__);
@@ -809,17 +756,34 @@ bool FormTimerMgr::DeleteDynamicItem(const int64_t formId)
 void FormTimerMgr::OnIntervalTimeOut()
 {
     HILOG_INFO("%{public}s start", __func__);
-    std::lock_guard<std::mutex> lock(intervalMutex_);
     std::vector<FormTimer> updateList;
-    int64_t currentTime = FormUtil::GetCurrentNanosecond() / Constants::TIME_1000000;
-    for (auto &intervalPair : intervalTimerTasks_) {
-        FormTimer &intervalTask = intervalPair.second;
-        if ((intervalTask.refreshTime == INT64_MAX || (currentTime - intervalTask.refreshTime) >= intervalTask.period ||
-            std::abs((currentTime - intervalTask.refreshTime) - intervalTask.period) < Constants::ABS_TIME) &&
-            intervalTask.isEnable && refreshLimiter_.IsEnableRefresh(intervalTask.formId)) {
-            intervalTask.refreshTime = currentTime;
-            updateList.emplace_back(intervalTask);
+    {
+        std::lock_guard<std::mutex> lock(intervalMutex_);
+        // the one shot timer has fired, UpdateIntervalTimer arms the next one
+        intervalTimerId_ = 0;
+        intervalWakeUpTime_ = INT64_MAX;
+        int64_t currentTime = FormUtil::GetCurrentNanosecond() / Constants::TIME_1000000;
+        int64_t steadyTime = GetSteadyMillisecond();
+        // the deadlines due within ABS_TIME are batched into this wake up, and rescheduled in place
+        std::vector<int64_t> formIds;
+        intervalQueue_.GetRange(INT64_MIN, steadyTime + Constants::ABS_TIME, formIds);
+        for (int64_t formId : formIds) {
+            auto intervalPair = intervalTimerTasks_.find(formId);
+            if (intervalPair == intervalTimerTasks_.end()) {
+                intervalQueue_.Remove(formId);
+                continue;
+            }
+            FormTimer &intervalTask = intervalPair->second;
+            if (intervalTask.isEnable && refreshLimiter_.IsEnableRefresh(formId)) {
+                intervalTask.refreshTime = currentTime;
+                updateList.emplace_back(intervalTask);
+                intervalQueue_.Push(formId, steadyTime + intervalTask.period);
+            } else {
+                // a disabled or limited form is checked again one base period later
+                intervalQueue_.Push(formId, steadyTime + Constants::MIN_PERIOD / timeSpeed_);
+            }
         }
+        UpdateIntervalTimer();
     }
 
     if (!updateList.empty()) {
@@ -1053,30 +1017,28 @@ std::shared_ptr<WantAgent> FormTimerMgr::GetLimiterWantAgent()
 bool FormTimerMgr::UpdateDynamicAlarm()
 {
     HILOG_INFO("%{public}s start", __func__);
-    if (dynamicRefreshTasks_.empty()) {
+    int64_t handle = 0;
+    int64_t settedTime = INT64_MAX;
+    if (!dynamicQueue_.GetFirst(handle, settedTime)) {
         ClearDynamicResource();
         dynamicWakeUpTime_ = INT64_MAX;
         return true;
     }
 
-    bool needUpdate = false;
-    DynamicRefreshItem firstTask = dynamicRefreshTasks_.at(0);
-    if (dynamicWakeUpTime_ != firstTask.settedTime) {
-        dynamicWakeUpTime_ = firstTask.settedTime;
-        needUpdate = true;
-    }
-
-    if (!needUpdate) {
-        HILOG_ERROR("%{public}s failed, no need to  UpdateDynamicAlarm.", __func__);
+    if (dynamicWakeUpTime_ == settedTime) {
+        HILOG_INFO("%{public}s, no need to UpdateDynamicAlarm.", __func__);
         return true;
     }
+    dynamicWakeUpTime_ = settedTime;
+    auto firstTask = dynamicRefreshTasks_.find(handle);
+    int32_t userId = firstTask != dynamicRefreshTasks_.end() ? firstTask->second.userId : 0;
 
     auto timerOption = std::make_shared<FormTimerOption>();
     timerOption->SetType(((unsigned int)(timerOption->TIMER_TYPE_REALTIME))
      | ((unsigned int)(timerOption->TIMER_TYPE_WAKEUP)));
     timerOption->SetRepeat(false);
     timerOption->SetInterval(0);
-    std::shared_ptr<WantAgent> wantAgent = GetDynamicWantAgent(dynamicWakeUpTime_, firstTask.userId);
+    std::shared_ptr<WantAgent> wantAgent = GetDynamicWantAgent(dynamicWakeUpTime_, userId);
     if (!wantAgent) {
         HILOG_ERROR("%{public}s, failed to create wantAgent.", __func__);
         return false;
@@ -1150,23 +1112,22 @@ void FormTimerMgr::ClearDynamicResource()
 bool FormTimerMgr::FindNextAtTimerItem(const long nowTime, UpdateAtItem &updateAtItem)
 {
     HILOG_INFO("%{public}s start", __func__);
-    if (updateAtTimerTasks_.empty()) {
+    std::lock_guard<std::mutex> lock(updateAtMutex_);
+    int64_t formId = 0;
+    int64_t updateAtTime = 0;
+    // the first task later today, or the first one of tomorrow
+    if (!updateAtQueue_.GetFirstAfter(nowTime, formId, updateAtTime) &&
+        !updateAtQueue_.GetFirst(formId, updateAtTime)) {
         HILOG_WARN("%{public}s, updateAtTimerTasks_ is empty", __func__);
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(updateAtMutex_);
-    std::list<UpdateAtItem>::iterator itItem;
-    for (itItem = updateAtTimerTasks_.begin(); itItem != updateAtTimerTasks_.end(); itItem++) {
-        if (itItem->updateAtTime > nowTime) {
-            updateAtItem = *itItem;
-            break;
-        }
-    }
-
+    auto itItem = updateAtTimerTasks_.find(formId);
     if (itItem == updateAtTimerTasks_.end()) {
-        updateAtItem = updateAtTimerTasks_.front();
+        HILOG_ERROR("%{public}s, update at timer not find", __func__);
+        return false;
     }
+    updateAtItem = itItem->second;
     HILOG_INFO("%{public}s end", __func__);
     return true;
 }
@@ -1182,8 +1143,6 @@ void FormTimerMgr::EnsureInitIntervalTimer()
     }
 
     intervalTimer_ = std::make_shared<Utils::Timer>("interval timer");
-    auto timeCallback = []() { FormTimerMgr::GetInstance().OnIntervalTimeOut(); };
-    intervalTimer_->Register(timeCallback, Constants::MIN_PERIOD / timeSpeed_);
     intervalTimer_->Setup();
 
     HILOG_INFO("%{public}s end", __func__);
@@ -1194,12 +1153,57 @@ void FormTimerMgr::EnsureInitIntervalTimer()
 void FormTimerMgr::ClearIntervalTimer()
 {
     HILOG_INFO("%{public}s start", __func__);
-    if (intervalTimer_ != nullptr) {
-        intervalTimer_->Shutdown();
-        intervalTimer_.reset();
+    std::shared_ptr<Utils::Timer> intervalTimer;
+    {
+        std::lock_guard<std::mutex> lock(intervalMutex_);
+        intervalTimer.swap(intervalTimer_);
+        intervalTimerId_ = 0;
+        intervalWakeUpTime_ = INT64_MAX;
+    }
+    // Shutdown joins the timer thread, whose OnIntervalTimeOut takes intervalMutex_
+    if (intervalTimer != nullptr) {
+        intervalTimer->Shutdown();
     }
     HILOG_INFO("%{public}s end", __func__);
 }
+/**
+ * @brief Arm the interval timer at the earliest interval deadline.
+ */
+void FormTimerMgr::UpdateIntervalTimer()
+{
+    int64_t formId = 0;
+    int64_t deadline = INT64_MAX;
+    if (!intervalQueue_.GetFirst(formId, deadline)) {
+        if (intervalTimer_ != nullptr && intervalTimerId_ != 0) {
+            intervalTimer_->Unregister(intervalTimerId_);
+        }
+        intervalTimerId_ = 0;
+        intervalWakeUpTime_ = INT64_MAX;
+        return;
+    }
+    if (deadline == intervalWakeUpTime_ && intervalTimerId_ != 0) {
+        return;
+    }
+
+    EnsureInitIntervalTimer();
+    if (intervalTimerId_ != 0) {
+        intervalTimer_->Unregister(intervalTimerId_);
+    }
+    int64_t delay = std::max(deadline - GetSteadyMillisecond(), static_cast<int64_t>(1));
+    auto timeCallback = []() { FormTimerMgr::GetInstance().OnIntervalTimeOut(); };
+    intervalTimerId_ = intervalTimer_->Register(timeCallback, static_cast<uint32_t>(delay), true);
+    intervalWakeUpTime_ = deadline;
+    HILOG_INFO("%{public}s, next interval time out in %{public}" PRId64 " ms", __func__, delay);
+}
+/**
+ * @brief Get the time of the steady clock.
+ * @return Returns the time in ms.
+ */
+int64_t FormTimerMgr::GetSteadyMillisecond() const
+{
+    auto timeSinceEpoch = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(timeSinceEpoch).count();
+}
 /**
  * @brief Creat thread pool for timer task.
  */
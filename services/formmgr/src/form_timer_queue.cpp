@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "form_timer_queue.h"
+
+#include <limits>
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @brief Add the deadline of a form, or move it if the form is queued already.
+ * @param formId The Id of the form.
+ * @param deadline The deadline of the form.
+ */
+void FormTimerQueue::Push(int64_t formId, int64_t deadline)
+{
+    auto iter = formDeadlines_.find(formId);
+    if (iter != formDeadlines_.end()) {
+        if (iter->second == deadline) {
+            return;
+        }
+        // move the node, rescheduling allocates nothing
+        auto node = deadlines_.extract(std::make_pair(iter->second, formId));
+        node.value().first = deadline;
+        deadlines_.insert(std::move(node));
+        iter->second = deadline;
+        return;
+    }
+    formDeadlines_.emplace(formId, deadline);
+    deadlines_.emplace(deadline, formId);
+}
+/**
+ * @brief Remove the deadline of a form.
+ * @param formId The Id of the form.
+ * @return Returns true if the form was queued, false otherwise.
+ */
+bool FormTimerQueue::Remove(int64_t formId)
+{
+    auto iter = formDeadlines_.find(formId);
+    if (iter == formDeadlines_.end()) {
+        return false;
+    }
+    deadlines_.erase(std::make_pair(iter->second, formId));
+    formDeadlines_.erase(iter);
+    return true;
+}
+/**
+ * @brief Get the deadline of a form.
+ * @param formId The Id of the form.
+ * @param deadline The deadline of the form.
+ * @return Returns true if the form is queued, false otherwise.
+ */
+bool FormTimerQueue::GetDeadline(int64_t formId, int64_t &deadline) const
+{
+    auto iter = formDeadlines_.find(formId);
+    if (iter == formDeadlines_.end()) {
+        return false;
+    }
+    deadline = iter->second;
+    return true;
+}
+/**
+ * @brief Get the earliest deadline.
+ * @param formId The Id of the form the deadline belongs to.
+ * @param deadline The earliest deadline.
+ * @return Returns true if the queue is not empty, false otherwise.
+ */
+bool FormTimerQueue::GetFirst(int64_t &formId, int64_t &deadline) const
+{
+    if (deadlines_.empty()) {
+        return false;
+    }
+    deadline = deadlines_.begin()->first;
+    formId = deadlines_.begin()->second;
+    return true;
+}
+/**
+ * @brief Get the earliest deadline later than a time.
+ * @param time The time.
+ * @param formId The Id of the form the deadline belongs to.
+ * @param deadline The earliest deadline later than time.
+ * @return Returns true if there is such a deadline, false otherwise.
+ */
+bool FormTimerQueue::GetFirstAfter(int64_t time, int64_t &formId, int64_t &deadline) const
+{
+    auto iter = deadlines_.upper_bound(std::make_pair(time, std::numeric_limits<int64_t>::max()));
+    if (iter == deadlines_.end()) {
+        return false;
+    }
+    deadline = iter->first;
+    formId = iter->second;
+    return true;
+}
+/**
+ * @brief Get the forms whose deadline is in a range, earliest first.
+ * @param begin The begin of the range, included.
+ * @param end The end of the range, included.
+ * @param formIds The Ids of the forms.
+ */
+void FormTimerQueue::GetRange(int64_t begin, int64_t end, std::vector<int64_t> &formIds) const
+{
+    auto iter = deadlines_.lower_bound(std::make_pair(begin, std::numeric_limits<int64_t>::min()));
+    for (; iter != deadlines_.end() && iter->first <= end; ++iter) {
+        formIds.emplace_back(iter->second);
+    }
+}
+/**
+ * @brief Remove all the forms whose deadline is not later than a time, earliest first.
+ * @param time The time, which callers extend by their batching window.
+ * @param formIds The Ids of the expired forms.
+ */
+void FormTimerQueue::PopExpired(int64_t time, std::vector<int64_t> &formIds)
+{
+    auto iter = deadlines_.begin();
+    for (; iter != deadlines_.end() && iter->first <= time; ++iter) {
+        formIds.emplace_back(iter->second);
+        formDeadlines_.erase(iter->second);
+    }
+    deadlines_.erase(deadlines_.begin(), iter);
+}
+/**
+ * @brief Remove all the deadlines.
+ */
+void FormTimerQueue::Clear()
+{
+    deadlines_.clear();
+    formDeadlines_.clear();
+}
+/**
+ * @brief Whether the queue is empty.
+ * @return Returns true if the queue is empty, false otherwise.
+ */
+bool FormTimerQueue::Empty() const
+{
+    return deadlines_.empty();
+}
+/**
+ * @brief Get the count of the queued forms.
+ * @return Returns the count of the queued forms.
+ */
+size_t FormTimerQueue::Size() const
+{
+    return deadlines_.size();
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
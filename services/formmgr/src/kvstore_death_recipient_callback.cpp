@@ -57,6 +57,8 @@ void KvStoreDeathRecipientCallback::OnRemoteDied()
             if (dataStorage && dataStorage->ResetKvStore()) {
                 // register data change listener again.
                 HILOG_INFO("current times is %{public}d", times);
+                // the writes queued while the kvStore was gone
+                dataStorage->Flush();
                 break;
             }
             usleep(CHECK_INTERVAL);
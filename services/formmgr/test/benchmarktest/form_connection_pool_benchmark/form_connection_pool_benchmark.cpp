@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "form_ability_connection.h"
+#include "form_ams_helper.h"
+#include "form_constants.h"
+#include "form_provider_proxy.h"
+#include "form_provider_stub.h"
+#include "form_supply_interface.h"
+#define private public
+#include "form_connection_pool.h"
+#undef private
+#include "form_supply_callback.h"
+#include "mock_ability_manager.h"
+
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+const std::string PROVIDER_BUNDLE_NAME = "com.form.provider.benchmark";
+const std::string PROVIDER_ABILITY_NAME = "FormAbility";
+const std::string PROVIDER_KEY = PROVIDER_BUNDLE_NAME + "::" + PROVIDER_ABILITY_NAME;
+
+/**
+ * Stands in for a provider service, it updates nothing and answers every call at once.
+ */
+class StandInFormProvider : public FormProviderStub {
+public:
+    int AcquireProviderFormInfo(const int64_t formId, const Want &want,
+        const sptr<IRemoteObject> &callerToken) override
+    {
+        return Answer(want, callerToken);
+    }
+    int NotifyFormDelete(const int64_t formId, const Want &want, const sptr<IRemoteObject> &callerToken) override
+    {
+        return Answer(want, callerToken);
+    }
+    int NotifyFormsDelete(const std::vector<int64_t> &formIds, const Want &want,
+        const sptr<IRemoteObject> &callerToken) override
+    {
+        return Answer(want, callerToken);
+    }
+    int NotifyFormUpdate(const int64_t formId, const Want &want, const sptr<IRemoteObject> &callerToken) override
+    {
+        updateCount_++;
+        return Answer(want, callerToken);
+    }
+    int NotifyFormsUpdate(const std::vector<int64_t> &formIds, const Want &want,
+        const sptr<IRemoteObject> &callerToken) override
+    {
+        updateCount_ += static_cast<int64_t>(formIds.size());
+        return Answer(want, callerToken);
+    }
+    int EventNotify(const std::vector<int64_t> &formIds, const int32_t formVisibleType,
+        const Want &want, const sptr<IRemoteObject> &callerToken) override
+    {
+        return Answer(want, callerToken);
+    }
+    int NotifyFormCastTempForm(const int64_t formId, const Want &want,
+        const sptr<IRemoteObject> &callerToken) override
+    {
+        return Answer(want, callerToken);
+    }
+    int FireFormEvent(const int64_t formId, const std::string &message, const Want &want,
+        const sptr<IRemoteObject> &callerToken) override
+    {
+        return Answer(want, callerToken);
+    }
+    int AcquireState(const Want &wantArg, const std::string &provider, const Want &want,
+        const sptr<IRemoteObject> &callerToken) override
+    {
+        return Answer(want, callerToken);
+    }
+
+    int64_t updateCount_ = 0;
+
+private:
+    int Answer(const Want &want, const sptr<IRemoteObject> &callerToken)
+    {
+        // like the provider clients, which hand the connection back once done
+        sptr<IFormSupply> formSupply = iface_cast<IFormSupply>(callerToken);
+        if (formSupply == nullptr) {
+            return ERR_APPEXECFWK_FORM_COMMON_CODE;
+        }
+        return formSupply->OnEventHandle(want);
+    }
+};
+
+void SetUp()
+{
+    // connects at once, no provider process is started
+    static bool isSetUp = false;
+    if (!isSetUp) {
+        FormAmsHelper::GetInstance().SetAbilityManager(new MockAbilityMgrService());
+        isSetUp = true;
+    }
+}
+
+void BenchmarkConnectionPerRefresh(benchmark::State &state)
+{
+    SetUp();
+    sptr<StandInFormProvider> standInProvider = new StandInFormProvider();
+    // the proxy marshals every call, as it would across processes
+    sptr<IFormProvider> provider = new FormProviderProxy(standInProvider);
+    for (auto _ : state) {
+        for (int64_t formId = 1; formId <= state.range(0); formId++) {
+            // what a refresh did before the pool, connect, call the provider, and disconnect on its answer
+            sptr<FormAbilityConnection> connection = new FormAbilityConnection();
+            connection->SetProviderKey(PROVIDER_BUNDLE_NAME, PROVIDER_ABILITY_NAME);
+            Want connectWant;
+            connectWant.AddFlags(Want::FLAG_ABILITY_FORM_ENABLED);
+            connectWant.SetElementName(PROVIDER_BUNDLE_NAME, PROVIDER_ABILITY_NAME);
+            FormAmsHelper::GetInstance().ConnectServiceAbility(connectWant, connection);
+            FormSupplyCallback::GetInstance()->AddConnection(connection);
+            Want want;
+            want.SetParam(Constants::FORM_CONNECT_ID, connection->GetConnectId());
+            provider->NotifyFormUpdate(formId, want, FormSupplyCallback::GetInstance());
+        }
+    }
+    state.SetItemsProcessed(standInProvider->updateCount_);
+}
+
+void BenchmarkPooledRefresh(benchmark::State &state)
+{
+    SetUp();
+    sptr<StandInFormProvider> standInProvider = new StandInFormProvider();
+    sptr<IFormProvider> provider = new FormProviderProxy(standInProvider);
+    FormConnectionPool &pool = FormConnectionPool::GetInstance();
+    for (auto _ : state) {
+        for (int64_t formId = 1; formId <= state.range(0); formId++) {
+            pool.PostRefresh(formId, PROVIDER_BUNDLE_NAME, PROVIDER_ABILITY_NAME);
+        }
+        // what the dispatch sends to the provider, one call for all the queued refreshes
+        auto &providerConnection = pool.providerConnections_[PROVIDER_KEY];
+        std::vector<int64_t> formIds(providerConnection.pendingFormIds.begin(),
+            providerConnection.pendingFormIds.end());
+        pool.Dispatch(PROVIDER_KEY);
+        Want want;
+        want.SetParam(Constants::FORM_CONNECT_ID, providerConnection.connection->GetConnectId());
+        provider->NotifyFormsUpdate(formIds, want, FormSupplyCallback::GetInstance());
+    }
+    state.SetItemsProcessed(standInProvider->updateCount_);
+}
+}  // namespace
+
+BENCHMARK(BenchmarkConnectionPerRefresh)->Arg(1)->Arg(10)->Arg(50);
+BENCHMARK(BenchmarkPooledRefresh)->Arg(1)->Arg(10)->Arg(50);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <map>
+#include <set>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "form_id_key.h"
+#include "form_item_info.h"
+#define private public
+#include "form_data_mgr.h"
+#include "form_db_cache.h"
+#undef private
+#include "mock_form_host_client.h"
+
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+constexpr int64_t FORM_COUNT = 5000;
+constexpr int64_t HOST_COUNT = 50;
+constexpr int64_t BUNDLE_COUNT = 20;
+constexpr int64_t BASE_FORM_ID = 1000;
+constexpr int BASE_UID = 20010000;
+const std::string BUNDLE_NAME = "com.form.provider.benchmark";
+const std::string MODULE_NAME = "entry";
+const std::string ABILITY_NAME = "FormAbility";
+
+std::vector<sptr<IRemoteObject>> MakeHosts()
+{
+    std::vector<sptr<IRemoteObject>> hosts;
+    for (int64_t i = 0; i < HOST_COUNT; i++) {
+        hosts.emplace_back(new MockFormHostClient());
+    }
+    return hosts;
+}
+
+/**
+ * Gives the forms to the hosts in turn, like hosts adding widgets one after the other.
+ */
+void AddHostForms(FormDataMgr &formDataMgr, const std::vector<sptr<IRemoteObject>> &hosts)
+{
+    FormItemInfo formItemInfo;
+    for (int64_t i = 0; i < FORM_COUNT; i++) {
+        formDataMgr.AllotFormHostRecord(formItemInfo, hosts[i % HOST_COUNT], BASE_FORM_ID + i,
+            BASE_UID + static_cast<int>(i % HOST_COUNT));
+    }
+}
+
+/**
+ * Fills the DB cache without the storage, so that only the cache is measured.
+ */
+void FillDbCache(FormDbCache &formDbCache)
+{
+    std::lock_guard<std::mutex> lock(formDbCache.formDBInfosMutex_);
+    for (int64_t i = 0; i < FORM_COUNT; i++) {
+        FormDBInfo formDBInfo;
+        formDBInfo.formId = BASE_FORM_ID + i;
+        formDBInfo.bundleName = BUNDLE_NAME + std::to_string(i % BUNDLE_COUNT);
+        formDBInfo.moduleName = MODULE_NAME;
+        formDBInfo.abilityName = ABILITY_NAME;
+        formDBInfo.formUserUids.emplace_back(BASE_UID + static_cast<int>(i % HOST_COUNT));
+        formDbCache.EraseFormInfoNolock(formDBInfo.formId);
+        formDbCache.formDBInfos_.emplace(formDBInfo.formId, formDBInfo);
+        formDbCache.AddIndexNolock(formDBInfo);
+    }
+}
+
+void BenchmarkAddHostForms(benchmark::State &state)
+{
+    std::vector<sptr<IRemoteObject>> hosts = MakeHosts();
+    for (auto _ : state) {
+        FormDataMgr formDataMgr;
+        AddHostForms(formDataMgr, hosts);
+    }
+    state.SetItemsProcessed(state.iterations() * FORM_COUNT);
+}
+
+void BenchmarkUpdateHostForms(benchmark::State &state)
+{
+    std::vector<sptr<IRemoteObject>> hosts = MakeHosts();
+    FormDataMgr formDataMgr;
+    AddHostForms(formDataMgr, hosts);
+    for (auto _ : state) {
+        // what a refresh asks of the hosts of each form
+        for (int64_t i = 0; i < FORM_COUNT; i++) {
+            int64_t formId = BASE_FORM_ID + i;
+            formDataMgr.UpdateHostNeedRefresh(formId, true);
+            benchmark::DoNotOptimize(formDataMgr.IsEnableRefresh(formId));
+            benchmark::DoNotOptimize(formDataMgr.IsEnableUpdate(formId));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * FORM_COUNT);
+}
+
+void BenchmarkDeleteHostForms(benchmark::State &state)
+{
+    std::vector<sptr<IRemoteObject>> hosts = MakeHosts();
+    for (auto _ : state) {
+        state.PauseTiming();
+        FormDataMgr formDataMgr;
+        AddHostForms(formDataMgr, hosts);
+        state.ResumeTiming();
+        for (int64_t i = 0; i < FORM_COUNT; i++) {
+            formDataMgr.DeleteHostRecord(hosts[i % HOST_COUNT], BASE_FORM_ID + i);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * FORM_COUNT);
+}
+
+void BenchmarkDbCacheLookup(benchmark::State &state)
+{
+    FormDbCache &formDbCache = FormDbCache::GetInstance();
+    FillDbCache(formDbCache);
+    for (auto _ : state) {
+        // what BatchDeleteNoHostDBForms asks for each form it deletes
+        for (int64_t i = 0; i < FORM_COUNT; i++) {
+            FormDBInfo formDBInfo;
+            formDbCache.GetDBRecord(BASE_FORM_ID + i, formDBInfo);
+            benchmark::DoNotOptimize(formDbCache.GetMatchCount(formDBInfo.bundleName, formDBInfo.moduleName));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * FORM_COUNT);
+}
+
+void BenchmarkDbCacheNoHostForms(benchmark::State &state)
+{
+    FormDbCache &formDbCache = FormDbCache::GetInstance();
+    for (auto _ : state) {
+        state.PauseTiming();
+        FillDbCache(formDbCache);
+        state.ResumeTiming();
+        // every host goes away, each leaving its forms without a host
+        for (int64_t i = 0; i < HOST_COUNT; i++) {
+            std::map<FormIdKey, std::set<int64_t>> noHostFormDBList;
+            std::map<int64_t, bool> foundFormsMap;
+            formDbCache.GetNoHostDBForms(BASE_UID + static_cast<int>(i), noHostFormDBList, foundFormsMap);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * HOST_COUNT);
+}
+}  // namespace
+
+BENCHMARK(BenchmarkAddHostForms);
+BENCHMARK(BenchmarkUpdateHostForms);
+BENCHMARK(BenchmarkDeleteHostForms);
+BENCHMARK(BenchmarkDbCacheLookup);
+BENCHMARK(BenchmarkDbCacheNoHostForms);
+
+BENCHMARK_MAIN();
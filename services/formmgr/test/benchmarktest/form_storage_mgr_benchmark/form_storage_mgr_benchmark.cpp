@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "event_runner.h"
+#include "form_db_info.h"
+#include "mock_form_storage_mgr.h"
+
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+constexpr int64_t FORM_COUNT = 100;
+
+std::vector<InnerFormInfo> MakeInnerFormInfos()
+{
+    std::vector<InnerFormInfo> innerFormInfos;
+    for (int64_t formId = 1; formId <= FORM_COUNT; formId++) {
+        FormDBInfo formDBInfo;
+        formDBInfo.formId = formId;
+        formDBInfo.formName = "form" + std::to_string(formId);
+        formDBInfo.bundleName = "com.form.provider.benchmark";
+        formDBInfo.moduleName = "entry";
+        formDBInfo.abilityName = "FormAbility";
+        formDBInfo.formUserUids.emplace_back(1);
+        innerFormInfos.emplace_back(formDBInfo);
+    }
+    return innerFormInfos;
+}
+
+/**
+ * Updates every form state.range(0) times, then deletes them all, like a bundle whose forms are
+ * refreshed and which is then uninstalled.
+ */
+void WriteForms(FormStorageMgr &storageMgr, const std::vector<InnerFormInfo> &innerFormInfos, int64_t updateTimes)
+{
+    for (int64_t i = 0; i < updateTimes; i++) {
+        for (const auto &innerFormInfo : innerFormInfos) {
+            storageMgr.ModifyStorageFormInfo(innerFormInfo);
+        }
+    }
+    for (const auto &innerFormInfo : innerFormInfos) {
+        storageMgr.DeleteStorageFormInfo(std::to_string(innerFormInfo.GetFormId()));
+    }
+}
+
+void BenchmarkWriteThrough(benchmark::State &state)
+{
+    std::vector<InnerFormInfo> innerFormInfos = MakeInnerFormInfos();
+    // without a flush handler every write goes to the store at once
+    MockFormStorageMgr storageMgr;
+    for (auto _ : state) {
+        WriteForms(storageMgr, innerFormInfos, state.range(0));
+    }
+    state.SetItemsProcessed(state.iterations() * FORM_COUNT * (state.range(0) + 1));
+    state.counters["batches"] = benchmark::Counter(storageMgr.putBatchCount_ + storageMgr.deleteBatchCount_,
+        benchmark::Counter::kAvgIterations);
+}
+
+void BenchmarkWriteBehind(benchmark::State &state)
+{
+    std::vector<InnerFormInfo> innerFormInfos = MakeInnerFormInfos();
+    // the runner is not started, the flush below stands for the one the runner would do
+    auto flushHandler = std::make_shared<EventHandler>(EventRunner::Create(false));
+    MockFormStorageMgr storageMgr(flushHandler);
+    for (auto _ : state) {
+        WriteForms(storageMgr, innerFormInfos, state.range(0));
+        storageMgr.Flush();
+    }
+    state.SetItemsProcessed(state.iterations() * FORM_COUNT * (state.range(0) + 1));
+    state.counters["batches"] = benchmark::Counter(storageMgr.putBatchCount_ + storageMgr.deleteBatchCount_,
+        benchmark::Counter::kAvgIterations);
+}
+}  // namespace
+
+BENCHMARK(BenchmarkWriteThrough)->Arg(1)->Arg(10);
+BENCHMARK(BenchmarkWriteBehind)->Arg(1)->Arg(10);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdlib>
+#include <list>
+#include <map>
+#include <stdint.h>
+#include <vector>
+
+#include "form_constants.h"
+#include "form_timer.h"
+#include "form_timer_queue.h"
+
+using namespace OHOS::AppExecFwk;
+
+namespace {
+constexpr int64_t BASE_FORM_ID = 1000;
+constexpr int64_t MAX_PERIOD_COUNT = 8;
+constexpr long MIN_PER_DAY = 24 * Constants::MIN_PER_HOUR;
+
+int64_t GetPeriod(int64_t index)
+{
+    return (index % MAX_PERIOD_COUNT + 1) * Constants::MIN_PERIOD;
+}
+
+/**
+ * The interval tasks of the manager before the queue, all scanned on each base period.
+ */
+std::map<int64_t, FormTimer> MakeLegacyIntervalTasks(int64_t count)
+{
+    std::map<int64_t, FormTimer> intervalTimerTasks;
+    for (int64_t i = 0; i < count; i++) {
+        FormTimer task(BASE_FORM_ID + i, GetPeriod(i));
+        // spread the last refresh of the forms over their period
+        task.refreshTime = -(i * Constants::MIN_PERIOD / count);
+        intervalTimerTasks.emplace(task.formId, task);
+    }
+    return intervalTimerTasks;
+}
+
+FormTimerQueue MakeIntervalQueue(int64_t count)
+{
+    FormTimerQueue intervalQueue;
+    for (int64_t i = 0; i < count; i++) {
+        intervalQueue.Push(BASE_FORM_ID + i, GetPeriod(i) - i * Constants::MIN_PERIOD / count);
+    }
+    return intervalQueue;
+}
+
+void BenchmarkLegacyIntervalTimeOut(benchmark::State &state)
+{
+    auto intervalTimerTasks = MakeLegacyIntervalTasks(state.range(0));
+    int64_t currentTime = 0;
+    int64_t refreshCount = 0;
+    for (auto _ : state) {
+        // the timer fired every base period, every task was checked
+        currentTime += Constants::MIN_PERIOD;
+        for (auto &intervalPair : intervalTimerTasks) {
+            FormTimer &intervalTask = intervalPair.second;
+            if ((currentTime - intervalTask.refreshTime) >= intervalTask.period ||
+                std::abs((currentTime - intervalTask.refreshTime) - intervalTask.period) < Constants::ABS_TIME) {
+                intervalTask.refreshTime = currentTime;
+                refreshCount++;
+            }
+        }
+    }
+    state.counters["refreshed"] = benchmark::Counter(refreshCount, benchmark::Counter::kAvgIterations);
+}
+
+void BenchmarkIntervalTimeOut(benchmark::State &state)
+{
+    auto intervalQueue = MakeIntervalQueue(state.range(0));
+    int64_t refreshCount = 0;
+    std::vector<int64_t> formIds;
+    for (auto _ : state) {
+        // the timer fires at the earliest deadline, the deadlines of the window are batched
+        int64_t formId = 0;
+        int64_t currentTime = 0;
+        intervalQueue.GetFirst(formId, currentTime);
+        formIds.clear();
+        intervalQueue.GetRange(INT64_MIN, currentTime + Constants::ABS_TIME, formIds);
+        for (int64_t id : formIds) {
+            intervalQueue.Push(id, currentTime + GetPeriod(id - BASE_FORM_ID));
+        }
+        refreshCount += static_cast<int64_t>(formIds.size());
+    }
+    state.counters["refreshed"] = benchmark::Counter(refreshCount, benchmark::Counter::kAvgIterations);
+}
+
+void BenchmarkLegacyAddUpdateAtTimer(benchmark::State &state)
+{
+    std::list<UpdateAtItem> updateAtTimerTasks;
+    for (int64_t i = 0; i < state.range(0); i++) {
+        UpdateAtItem atItem;
+        atItem.refreshTask.formId = BASE_FORM_ID + i;
+        atItem.updateAtTime = i % MIN_PER_DAY;
+        auto iter = std::find_if(updateAtTimerTasks.begin(), updateAtTimerTasks.end(),
+            [&atItem](const UpdateAtItem &item) { return atItem.updateAtTime < item.updateAtTime; });
+        updateAtTimerTasks.insert(iter, atItem);
+    }
+    int64_t formId = BASE_FORM_ID + state.range(0);
+    for (auto _ : state) {
+        // the duplicate check and the insertion sort, then the removal by form id
+        UpdateAtItem atItem;
+        atItem.refreshTask.formId = formId;
+        atItem.updateAtTime = MIN_PER_DAY - 1;
+        auto exist = std::find_if(updateAtTimerTasks.begin(), updateAtTimerTasks.end(),
+            [formId](const UpdateAtItem &item) { return item.refreshTask.formId == formId; });
+        benchmark::DoNotOptimize(exist);
+        auto iter = std::find_if(updateAtTimerTasks.begin(), updateAtTimerTasks.end(),
+            [&atItem](const UpdateAtItem &item) { return atItem.updateAtTime < item.updateAtTime; });
+        iter = updateAtTimerTasks.insert(iter, atItem);
+        auto target = std::find_if(updateAtTimerTasks.begin(), updateAtTimerTasks.end(),
+            [formId](const UpdateAtItem &item) { return item.refreshTask.formId == formId; });
+        updateAtTimerTasks.erase(target);
+    }
+}
+
+void BenchmarkAddUpdateAtTimer(benchmark::State &state)
+{
+    FormTimerQueue updateAtQueue;
+    for (int64_t i = 0; i < state.range(0); i++) {
+        updateAtQueue.Push(BASE_FORM_ID + i, i % MIN_PER_DAY);
+    }
+    int64_t formId = BASE_FORM_ID + state.range(0);
+    for (auto _ : state) {
+        int64_t deadline = 0;
+        benchmark::DoNotOptimize(updateAtQueue.GetDeadline(formId, deadline));
+        updateAtQueue.Push(formId, MIN_PER_DAY - 1);
+        updateAtQueue.Remove(formId);
+    }
+}
+
+void BenchmarkLegacySetNextRefreshTime(benchmark::State &state)
+{
+    std::vector<DynamicRefreshItem> dynamicRefreshTasks;
+    for (int64_t i = 0; i < state.range(0); i++) {
+        dynamicRefreshTasks.emplace_back(BASE_FORM_ID + i, i * Constants::ABS_REFRESH_MS);
+    }
+    auto compare = [](const DynamicRefreshItem &a, const DynamicRefreshItem &b) {
+        return a.settedTime > b.settedTime;
+    };
+    std::sort(dynamicRefreshTasks.begin(), dynamicRefreshTasks.end(), compare);
+    int64_t index = 0;
+    int64_t refreshTime = state.range(0) * Constants::ABS_REFRESH_MS;
+    for (auto _ : state) {
+        // the item was looked up by id and the whole vector sorted again
+        int64_t formId = BASE_FORM_ID + index;
+        for (auto &refreshItem : dynamicRefreshTasks) {
+            if (refreshItem.formId == formId) {
+                refreshItem.settedTime = refreshTime++;
+                break;
+            }
+        }
+        std::sort(dynamicRefreshTasks.begin(), dynamicRefreshTasks.end(), compare);
+        index = (index + 1) % state.range(0);
+    }
+}
+
+void BenchmarkSetNextRefreshTime(benchmark::State &state)
+{
+    FormTimerQueue dynamicQueue;
+    for (int64_t i = 0; i < state.range(0); i++) {
+        dynamicQueue.Push(BASE_FORM_ID + i, i * Constants::ABS_REFRESH_MS);
+    }
+    int64_t index = 0;
+    int64_t refreshTime = state.range(0) * Constants::ABS_REFRESH_MS;
+    for (auto _ : state) {
+        dynamicQueue.Push(BASE_FORM_ID + index, refreshTime++);
+        index = (index + 1) % state.range(0);
+    }
+}
+}  // namespace
+
+BENCHMARK(BenchmarkLegacyIntervalTimeOut)->Arg(1000)->Arg(10000);
+BENCHMARK(BenchmarkIntervalTimeOut)->Arg(1000)->Arg(10000);
+BENCHMARK(BenchmarkLegacyAddUpdateAtTimer)->Arg(1000)->Arg(10000);
+BENCHMARK(BenchmarkAddUpdateAtTimer)->Arg(1000)->Arg(10000);
+BENCHMARK(BenchmarkLegacySetNextRefreshTime)->Arg(1000)->Arg(10000);
+BENCHMARK(BenchmarkSetNextRefreshTime)->Arg(1000)->Arg(10000);
+
+BENCHMARK_MAIN();
@@ -75,6 +75,15 @@ private:
     virtual int NotifyFormUpdate(const int64_t formId, const Want &want, 
     const sptr<IRemoteObject> &callerToken) override;
 
+    /**
+     * @brief Notify provider when the forms need update.
+     * @param formIds The id list of forms.
+     * @param want Indicates the structure containing form info.
+     * @param callerToken Caller ability token.
+     */
+    virtual int NotifyFormsUpdate(const std::vector<int64_t> &formIds, const Want &want,
+    const sptr<IRemoteObject> &callerToken) override;
+
     /**
      * @brief Event notify when change the form visible.
      * 
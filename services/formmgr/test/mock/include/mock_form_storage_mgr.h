@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_TEST_MOCK_INCLUDE_MOCK_FORM_STORAGE_MGR_H
+#define FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_TEST_MOCK_INCLUDE_MOCK_FORM_STORAGE_MGR_H
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "form_storage_mgr.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @class MockFormStorageMgr
+ * Form data storage on an in-memory map standing in for the kv store.
+ */
+class MockFormStorageMgr : public FormStorageMgr {
+public:
+    explicit MockFormStorageMgr(const std::shared_ptr<EventHandler> &flushHandler = nullptr)
+        : FormStorageMgr(flushHandler)
+    {}
+
+    virtual ~MockFormStorageMgr()
+    {
+        // while the stand-in is still there to take the writes
+        FlushOnStop();
+    }
+
+    std::map<std::string, std::string> store_;
+    std::atomic<bool> isKvStoreDead_ {false};
+    int32_t putBatchCount_ = 0;
+    int32_t deleteBatchCount_ = 0;
+
+protected:
+    bool CheckKvStore() override
+    {
+        return !isKvStoreDead_;
+    }
+
+    DistributedKv::Status GetEntries(const DistributedKv::Key &prefix,
+        std::vector<DistributedKv::Entry> &entries) override
+    {
+        if (isKvStoreDead_) {
+            return DistributedKv::Status::IPC_ERROR;
+        }
+        std::string keyPrefix = prefix.ToString();
+        for (auto iter = store_.lower_bound(keyPrefix); iter != store_.end(); ++iter) {
+            if (iter->first.compare(0, keyPrefix.size(), keyPrefix) != 0) {
+                break;
+            }
+            DistributedKv::Entry entry;
+            entry.key = iter->first;
+            entry.value = iter->second;
+            entries.emplace_back(entry);
+        }
+        return DistributedKv::Status::SUCCESS;
+    }
+
+    DistributedKv::Status PutBatch(const std::vector<DistributedKv::Entry> &entries) override
+    {
+        if (isKvStoreDead_) {
+            return DistributedKv::Status::IPC_ERROR;
+        }
+        putBatchCount_++;
+        for (const auto &entry : entries) {
+            store_[entry.key.ToString()] = entry.value.ToString();
+        }
+        return DistributedKv::Status::SUCCESS;
+    }
+
+    DistributedKv::Status DeleteBatch(const std::vector<DistributedKv::Key> &keys) override
+    {
+        if (isKvStoreDead_) {
+            return DistributedKv::Status::IPC_ERROR;
+        }
+        deleteBatchCount_++;
+        for (const auto &key : keys) {
+            store_.erase(key.ToString());
+        }
+        return DistributedKv::Status::SUCCESS;
+    }
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_SERVICES_FORMMGR_TEST_MOCK_INCLUDE_MOCK_FORM_STORAGE_MGR_H
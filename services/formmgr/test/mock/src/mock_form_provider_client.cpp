@@ -94,6 +94,19 @@ int MockFormProviderClient::NotifyFormUpdate(const int64_t formId, const Want &w
     return ERR_OK;
 }
 
+/**
+ * @brief Notify provider when the forms need update.
+ * @param formIds The id list of forms.
+ * @param want Indicates the structure containing form info.
+ * @param callerToken Caller ability token.
+ */
+int MockFormProviderClient::NotifyFormsUpdate(const std::vector<int64_t> &formIds, const Want &want,
+    const sptr<IRemoteObject> &callerToken)
+{
+    HILOG_DEBUG("Notify forms update");
+    return ERR_OK;
+}
+
 /**
  * @brief Event notify when change the form visible.
  *
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "form_ams_helper.h"
+#define private public
+#include "form_connection_pool.h"
+#include "form_supply_callback.h"
+#undef private
+#include "mock_ability_manager.h"
+
+using namespace testing::ext;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+const std::string FORM_PROVIDER_BUNDLE_NAME = "com.form.provider.service";
+const std::string FORM_PROVIDER_ABILITY_NAME = "com.form.provider.app.test.abiliy";
+const std::string FORM_PROVIDER_KEY = FORM_PROVIDER_BUNDLE_NAME + "::" + FORM_PROVIDER_ABILITY_NAME;
+
+class FmsFormConnectionPoolTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void FmsFormConnectionPoolTest::SetUpTestCase()
+{
+    // the mock connects synchronously, to a MockFormProviderClient
+    FormAmsHelper::GetInstance().SetAbilityManager(new MockAbilityMgrService());
+}
+
+void FmsFormConnectionPoolTest::TearDownTestCase()
+{}
+
+void FmsFormConnectionPoolTest::SetUp()
+{
+    // no event handler, the test dispatches by itself
+    FormConnectionPool::GetInstance().SetEventHandler(nullptr);
+}
+
+void FmsFormConnectionPoolTest::TearDown()
+{
+    FormConnectionPool &pool = FormConnectionPool::GetInstance();
+    auto iter = pool.providerConnections_.find(FORM_PROVIDER_KEY);
+    if (iter != pool.providerConnections_.end()) {
+        pool.OnDisconnected(iter->second.connection);
+    }
+}
+
+/*
+ * Feature: FormConnectionPool
+ * Function: PostRefresh
+ * SubFunction: NA
+ * FunctionPoints: The refreshes queued for a provider share its connection and go out together.
+ * EnvConditions: NA
+ * CaseDescription: Refresh forms of one provider, twice for one of them, and dispatch once.
+ */
+HWTEST_F(FmsFormConnectionPoolTest, FormConnectionPool_001, TestSize.Level1)
+{
+    FormConnectionPool &pool = FormConnectionPool::GetInstance();
+    EXPECT_EQ(ERR_OK, pool.PostRefresh(1, FORM_PROVIDER_BUNDLE_NAME, FORM_PROVIDER_ABILITY_NAME));
+    EXPECT_EQ(ERR_OK, pool.PostRefresh(2, FORM_PROVIDER_BUNDLE_NAME, FORM_PROVIDER_ABILITY_NAME));
+    EXPECT_EQ(ERR_OK, pool.PostRefresh(1, FORM_PROVIDER_BUNDLE_NAME, FORM_PROVIDER_ABILITY_NAME));
+    EXPECT_EQ(ERR_APPEXECFWK_FORM_INVALID_PARAM, pool.PostRefresh(3, "", FORM_PROVIDER_ABILITY_NAME));
+
+    ASSERT_EQ(1U, pool.providerConnections_.size());
+    auto &providerConnection = pool.providerConnections_[FORM_PROVIDER_KEY];
+    EXPECT_NE(nullptr, providerConnection.remoteObject);
+    EXPECT_EQ(2U, providerConnection.pendingFormIds.size());
+
+    pool.Dispatch(FORM_PROVIDER_KEY);
+    EXPECT_TRUE(providerConnection.pendingFormIds.empty());
+    EXPECT_EQ(1, providerConnection.busyCount);
+
+    // the provider is done, the connection stays for the next requests
+    long connectId = providerConnection.connection->GetConnectId();
+    FormSupplyCallback::GetInstance()->RemoveConnection(connectId);
+    EXPECT_EQ(0, providerConnection.busyCount);
+    EXPECT_EQ(1U, pool.connectIds_.count(connectId));
+    EXPECT_EQ(1U, FormSupplyCallback::GetInstance()->connections_.count(connectId));
+}
+
+/*
+ * Feature: FormConnectionPool
+ * Function: PostProviderTask
+ * SubFunction: NA
+ * FunctionPoints: A request runs on the pooled connection, which is given back once idle.
+ * EnvConditions: NA
+ * CaseDescription: Run two requests on one connection, then release the idle connection.
+ */
+HWTEST_F(FmsFormConnectionPoolTest, FormConnectionPool_002, TestSize.Level1)
+{
+    FormConnectionPool &pool = FormConnectionPool::GetInstance();
+    std::vector<long> connectIds;
+    auto task = [&connectIds](const sptr<IRemoteObject> &remoteObject, long connectId) {
+        EXPECT_NE(nullptr, remoteObject);
+        connectIds.push_back(connectId);
+    };
+    EXPECT_EQ(ERR_OK, pool.PostProviderTask(FORM_PROVIDER_BUNDLE_NAME, FORM_PROVIDER_ABILITY_NAME, task));
+    EXPECT_EQ(ERR_OK, pool.PostProviderTask(FORM_PROVIDER_BUNDLE_NAME, FORM_PROVIDER_ABILITY_NAME, task));
+    pool.Dispatch(FORM_PROVIDER_KEY);
+    ASSERT_EQ(2U, connectIds.size());
+    EXPECT_EQ(connectIds[0], connectIds[1]);
+
+    // not idle before both requests are done
+    pool.ReleaseIdleConnection(FORM_PROVIDER_KEY);
+    EXPECT_EQ(1U, pool.providerConnections_.count(FORM_PROVIDER_KEY));
+    FormSupplyCallback::GetInstance()->RemoveConnection(connectIds[0]);
+    FormSupplyCallback::GetInstance()->RemoveConnection(connectIds[0]);
+    pool.ReleaseIdleConnection(FORM_PROVIDER_KEY);
+    EXPECT_EQ(0U, pool.providerConnections_.count(FORM_PROVIDER_KEY));
+    EXPECT_EQ(0U, pool.connectIds_.count(connectIds[0]));
+    EXPECT_EQ(0U, FormSupplyCallback::GetInstance()->connections_.count(connectIds[0]));
+}
+
+/*
+ * Feature: FormConnectionPool
+ * Function: OnDisconnected
+ * SubFunction: NA
+ * FunctionPoints: A disconnected provider is connected again by the next request.
+ * EnvConditions: NA
+ * CaseDescription: Drop the connection of a provider and refresh one of its forms.
+ */
+HWTEST_F(FmsFormConnectionPoolTest, FormConnectionPool_003, TestSize.Level1)
+{
+    FormConnectionPool &pool = FormConnectionPool::GetInstance();
+    EXPECT_EQ(ERR_OK, pool.PostRefresh(1, FORM_PROVIDER_BUNDLE_NAME, FORM_PROVIDER_ABILITY_NAME));
+    sptr<FormPoolConnection> connection = pool.providerConnections_[FORM_PROVIDER_KEY].connection;
+    long connectId = connection->GetConnectId();
+
+    pool.OnDisconnected(connection);
+    EXPECT_EQ(0U, pool.providerConnections_.count(FORM_PROVIDER_KEY));
+    // no longer pooled, so the supply callback removes it like any other connection
+    EXPECT_FALSE(pool.ReleaseConnection(connectId));
+    FormSupplyCallback::GetInstance()->RemoveConnection(connectId);
+
+    EXPECT_EQ(ERR_OK, pool.PostRefresh(1, FORM_PROVIDER_BUNDLE_NAME, FORM_PROVIDER_ABILITY_NAME));
+    ASSERT_EQ(1U, pool.providerConnections_.count(FORM_PROVIDER_KEY));
+    EXPECT_NE(connection, pool.providerConnections_[FORM_PROVIDER_KEY].connection);
+}
+}
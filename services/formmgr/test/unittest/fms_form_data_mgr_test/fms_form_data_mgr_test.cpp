@@ -1007,6 +1007,40 @@ HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_DeleteHostRecord_001, TestSize.L
     GTEST_LOG_(INFO) << "FmsFormDataMgrTest_DeleteHostRecord_001 end";
 }
 
+/**
+ * @tc.number: FmsFormDataMgrTest_DeleteHostRecord_002
+ * @tc.name: DeleteHostRecord
+ * @tc.desc: Verify that the hosts after a deleted host are still found by client stub and by form.
+ * @tc.details:
+ *       clientRecords_ has two hosts sharing a form, the first one is deleted.
+ */
+HWTEST_F(FmsFormDataMgrTest, FmsFormDataMgrTest_DeleteHostRecord_002, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "FmsFormDataMgrTest_DeleteHostRecord_002 start";
+
+    int64_t formId = 1;
+    int64_t otherFormId = 2;
+    int callingUid = 0;
+    sptr<IRemoteObject> otherToken = new (std::nothrow) OHOS::AppExecFwk::MockFormHostClient();
+
+    FormItemInfo formItemInfo;
+    InitFormItemInfo(formId, formItemInfo);
+    EXPECT_EQ(true, formDataMgr_.AllotFormHostRecord(formItemInfo, token_, formId, callingUid));
+    EXPECT_EQ(true, formDataMgr_.AllotFormHostRecord(formItemInfo, otherToken, formId, callingUid));
+    EXPECT_EQ(true, formDataMgr_.AllotFormHostRecord(formItemInfo, otherToken, otherFormId, callingUid));
+
+    EXPECT_EQ(true, formDataMgr_.DeleteHostRecord(token_, formId));
+    ASSERT_EQ(1U, formDataMgr_.clientRecords_.size());
+
+    FormHostRecord formHostRecord;
+    EXPECT_EQ(true, formDataMgr_.GetMatchedHostClient(otherToken, formHostRecord));
+    EXPECT_EQ(false, formDataMgr_.GetMatchedHostClient(token_, formHostRecord));
+    EXPECT_EQ(true, formDataMgr_.GetFormHostRecord(formId, formHostRecord));
+    EXPECT_TRUE(otherToken == formHostRecord.GetClientStub());
+
+    GTEST_LOG_(INFO) << "FmsFormDataMgrTest_DeleteHostRecord_002 end";
+}
+
 /**
  * @tc.number: FmsFormDataMgrTest_CleanHostRemovedForms_001
  * @tc.name: CleanHostRemovedForms
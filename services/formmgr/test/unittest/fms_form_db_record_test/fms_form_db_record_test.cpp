@@ -183,4 +183,52 @@ HWTEST_F(FmsFormDbRecordTest, FmsFormDbRecordTest_008, TestSize.Level0) // Delet
     EXPECT_EQ(ERR_OK, FormDbCache::GetInstance().DeleteFormInfo(2));
     GTEST_LOG_(INFO) << "FmsFormDbRecordTest_008 end";
 }
+
+HWTEST_F(FmsFormDbRecordTest, FmsFormDbRecordTest_009, TestSize.Level0) // match count follows updates
+{
+    GTEST_LOG_(INFO) << "FmsFormDbRecordTest_009 start";
+    InitFormRecord();
+    FormDbCache::GetInstance().UpdateDBRecord(3, formRecord_);
+    FormDbCache::GetInstance().UpdateDBRecord(4, formRecord_);
+    EXPECT_EQ(2, FormDbCache::GetInstance().GetMatchCount("TestBundleName", "TestModuleName"));
+
+    // form 4 moves to another module
+    formRecord_.moduleName = "OtherModuleName";
+    FormDbCache::GetInstance().UpdateDBRecord(4, formRecord_);
+    EXPECT_EQ(1, FormDbCache::GetInstance().GetMatchCount("TestBundleName", "TestModuleName"));
+    EXPECT_EQ(1, FormDbCache::GetInstance().GetMatchCount("TestBundleName", "OtherModuleName"));
+
+    std::vector<FormDBInfo> removedDBForms;
+    FormDbCache::GetInstance().DeleteFormInfoByBundleName("TestBundleName", removedDBForms);
+    EXPECT_EQ(2U, removedDBForms.size());
+    EXPECT_EQ(0, FormDbCache::GetInstance().GetMatchCount("TestBundleName", "TestModuleName"));
+    EXPECT_EQ(0, FormDbCache::GetInstance().GetMatchCount("TestBundleName", "OtherModuleName"));
+    GTEST_LOG_(INFO) << "FmsFormDbRecordTest_009 end";
+}
+
+HWTEST_F(FmsFormDbRecordTest, FmsFormDbRecordTest_010, TestSize.Level0) // GetNoHostDBForms, callIds[1,2]
+{
+    GTEST_LOG_(INFO) << "FmsFormDbRecordTest_010 start";
+    InitFormRecord();
+    formRecord_.formUserUids.emplace_back(2);
+    FormDbCache::GetInstance().UpdateDBRecord(5, formRecord_);
+
+    std::map<FormIdKey, std::set<int64_t>> noHostFormDBList;
+    std::map<int64_t, bool> foundFormsMap;
+    FormDbCache::GetInstance().GetNoHostDBForms(1, noHostFormDBList, foundFormsMap);
+    EXPECT_EQ(true, noHostFormDBList.empty());
+    EXPECT_EQ(1U, foundFormsMap.count(5));
+
+    // the last uid leaves, the form has no host any more
+    FormDbCache::GetInstance().GetNoHostDBForms(2, noHostFormDBList, foundFormsMap);
+    FormIdKey formIdKey(formRecord_.bundleName, formRecord_.abilityName);
+    ASSERT_EQ(1U, noHostFormDBList.count(formIdKey));
+    EXPECT_EQ(1U, noHostFormDBList[formIdKey].count(5));
+
+    noHostFormDBList.clear();
+    FormDbCache::GetInstance().GetNoHostDBForms(2, noHostFormDBList, foundFormsMap);
+    EXPECT_EQ(true, noHostFormDBList.empty());
+    FormDbCache::GetInstance().DeleteFormInfo(5);
+    GTEST_LOG_(INFO) << "FmsFormDbRecordTest_010 end";
+}
 }
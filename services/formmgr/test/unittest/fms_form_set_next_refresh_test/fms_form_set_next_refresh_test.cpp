@@ -189,9 +189,14 @@ HWTEST_F(FmsFormSetNextRefreshTest, FmsFormSetNextRefreshTest_SetNextRefreshTime
     theItem.userId = userId;
     theItem.settedTime = 1;
     FormTimerMgr::GetInstance().dynamicRefreshTasks_.clear();
-    FormTimerMgr::GetInstance().dynamicRefreshTasks_.emplace_back(theItem);
+    FormTimerMgr::GetInstance().dynamicHandles_.clear();
+    FormTimerMgr::GetInstance().dynamicQueue_.Clear();
+    int64_t handle = FormTimerMgr::GetInstance().nextDynamicHandle_++;
+    FormTimerMgr::GetInstance().dynamicHandles_.emplace(std::make_pair(formId, userId), handle);
+    FormTimerMgr::GetInstance().dynamicRefreshTasks_.emplace(handle, theItem);
+    FormTimerMgr::GetInstance().dynamicQueue_.Push(handle, theItem.settedTime);
     // check dynamicRefreshTasks_
-    EXPECT_EQ(1, FormTimerMgr::GetInstance().dynamicRefreshTasks_.at(0).settedTime);
+    EXPECT_EQ(1, FormTimerMgr::GetInstance().dynamicRefreshTasks_.at(handle).settedTime);
 
     // Create IntervalTimerTasks_
     FormTimer task(formId, 3 * Constants::MIN_PERIOD, userId);
@@ -201,7 +206,11 @@ HWTEST_F(FmsFormSetNextRefreshTest, FmsFormSetNextRefreshTest_SetNextRefreshTime
 
     EXPECT_EQ(ERR_OK, formSetNextRefresh_->SetNextRefreshTime(formId, nextTime));
     // check dynamicRefreshTasks_
-    EXPECT_EQ(true, FormTimerMgr::GetInstance().dynamicRefreshTasks_.at(0).settedTime != 1);
+    EXPECT_EQ(1, FormTimerMgr::GetInstance().dynamicRefreshTasks_.size());
+    EXPECT_EQ(true, FormTimerMgr::GetInstance().dynamicRefreshTasks_.at(handle).settedTime != 1);
+    int64_t settedTime = 0;
+    EXPECT_EQ(true, FormTimerMgr::GetInstance().dynamicQueue_.GetDeadline(handle, settedTime));
+    EXPECT_EQ(settedTime, FormTimerMgr::GetInstance().dynamicRefreshTasks_.at(handle).settedTime);
 
     GTEST_LOG_(INFO) << "FmsFormSetNextRefreshTest_SetNextRefreshTime_005 end";
 }
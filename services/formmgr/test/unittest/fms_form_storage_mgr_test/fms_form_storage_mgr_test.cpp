@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "event_runner.h"
+#include "form_db_info.h"
+#include "mock_form_storage_mgr.h"
+
+using namespace testing::ext;
+using namespace OHOS;
+using namespace OHOS::AppExecFwk;
+
+namespace {
+const std::string FORM_BUNDLE_NAME = "com.form.provider.service";
+const std::string FORM_MODULE_NAME = "entry";
+const std::string FORM_ABILITY_NAME = "com.form.provider.app.test.abiliy";
+
+class FmsFormStorageMgrTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+
+    InnerFormInfo CreateInnerFormInfo(int64_t formId, const std::string &formName);
+};
+
+void FmsFormStorageMgrTest::SetUpTestCase()
+{}
+
+void FmsFormStorageMgrTest::TearDownTestCase()
+{}
+
+void FmsFormStorageMgrTest::SetUp()
+{}
+
+void FmsFormStorageMgrTest::TearDown()
+{}
+
+InnerFormInfo FmsFormStorageMgrTest::CreateInnerFormInfo(int64_t formId, const std::string &formName)
+{
+    FormDBInfo formDBInfo;
+    formDBInfo.formId = formId;
+    formDBInfo.formName = formName;
+    formDBInfo.bundleName = FORM_BUNDLE_NAME;
+    formDBInfo.moduleName = FORM_MODULE_NAME;
+    formDBInfo.abilityName = FORM_ABILITY_NAME;
+    formDBInfo.formUserUids.emplace_back(1);
+    return InnerFormInfo(formDBInfo);
+}
+
+/*
+ * Feature: FormStorageMgr
+ * Function: SaveStorageFormInfo
+ * SubFunction: NA
+ * FunctionPoints: Without a flush handler, every write reaches DB at once.
+ * EnvConditions: NA
+ * CaseDescription: Save, modify and delete a form, checking DB after each write.
+ */
+HWTEST_F(FmsFormStorageMgrTest, FormStorageMgr_001, TestSize.Level1)
+{
+    MockFormStorageMgr storageMgr;
+    EXPECT_EQ(ERR_OK, storageMgr.SaveStorageFormInfo(CreateInnerFormInfo(1, "form1")));
+    ASSERT_EQ(1U, storageMgr.store_.count("1"));
+
+    EXPECT_EQ(ERR_OK, storageMgr.ModifyStorageFormInfo(CreateInnerFormInfo(1, "form1Modified")));
+    InnerFormInfo innerFormInfo;
+    EXPECT_EQ(ERR_OK, storageMgr.GetStorageFormInfoById("1", innerFormInfo));
+    EXPECT_EQ("form1Modified", innerFormInfo.GetFormDBInfo().formName);
+    EXPECT_EQ(0, storageMgr.deleteBatchCount_);
+
+    EXPECT_EQ(ERR_OK, storageMgr.DeleteStorageFormInfo("1"));
+    EXPECT_TRUE(storageMgr.store_.empty());
+}
+
+/*
+ * Feature: FormStorageMgr
+ * Function: Flush
+ * SubFunction: NA
+ * FunctionPoints: The queued writes are coalesced per form and flushed in one batch each.
+ * EnvConditions: NA
+ * CaseDescription: Write forms with a flush handler that never runs, read one back and flush.
+ */
+HWTEST_F(FmsFormStorageMgrTest, FormStorageMgr_002, TestSize.Level1)
+{
+    // the runner is not started, so nothing is flushed unless asked for
+    auto flushHandler = std::make_shared<EventHandler>(EventRunner::Create(false));
+    MockFormStorageMgr storageMgr(flushHandler);
+    storageMgr.store_["3"] = "stale";
+    storageMgr.SaveStorageFormInfo(CreateInnerFormInfo(1, "form1"));
+    storageMgr.SaveStorageFormInfo(CreateInnerFormInfo(2, "form2"));
+    storageMgr.ModifyStorageFormInfo(CreateInnerFormInfo(1, "form1Modified"));
+    storageMgr.DeleteStorageFormInfo("2");
+    storageMgr.DeleteStorageFormInfo("3");
+    EXPECT_EQ(1U, storageMgr.store_.size());
+    EXPECT_EQ(0, storageMgr.putBatchCount_);
+
+    // a read flushes first
+    std::vector<InnerFormInfo> innerFormInfos;
+    EXPECT_EQ(ERR_OK, storageMgr.LoadFormData(innerFormInfos));
+    ASSERT_EQ(1U, innerFormInfos.size());
+    EXPECT_EQ("form1Modified", innerFormInfos[0].GetFormDBInfo().formName);
+    EXPECT_EQ(1, storageMgr.putBatchCount_);
+    EXPECT_EQ(1, storageMgr.deleteBatchCount_);
+    EXPECT_EQ(0U, storageMgr.store_.count("2"));
+    EXPECT_EQ(0U, storageMgr.store_.count("3"));
+
+    EXPECT_EQ(ERR_OK, storageMgr.Flush());
+    EXPECT_EQ(1, storageMgr.putBatchCount_);
+}
+
+/*
+ * Feature: FormStorageMgr
+ * Function: Flush
+ * SubFunction: NA
+ * FunctionPoints: The writes a failed flush did not do stay queued, behind the newer ones.
+ * EnvConditions: NA
+ * CaseDescription: Flush while the kv store is gone, write again and flush once it is back.
+ */
+HWTEST_F(FmsFormStorageMgrTest, FormStorageMgr_003, TestSize.Level1)
+{
+    auto flushHandler = std::make_shared<EventHandler>(EventRunner::Create(false));
+    MockFormStorageMgr storageMgr(flushHandler);
+    storageMgr.SaveStorageFormInfo(CreateInnerFormInfo(1, "form1"));
+    storageMgr.SaveStorageFormInfo(CreateInnerFormInfo(2, "form2"));
+    storageMgr.isKvStoreDead_ = true;
+    EXPECT_NE(ERR_OK, storageMgr.Flush());
+    EXPECT_TRUE(storageMgr.store_.empty());
+
+    storageMgr.DeleteStorageFormInfo("2");
+    storageMgr.isKvStoreDead_ = false;
+    EXPECT_EQ(ERR_OK, storageMgr.Flush());
+    EXPECT_EQ(1U, storageMgr.store_.size());
+    EXPECT_EQ(1U, storageMgr.store_.count("1"));
+}
+
+/*
+ * Feature: FormStorageMgr
+ * Function: Flush
+ * SubFunction: NA
+ * FunctionPoints: A failed flush is retried later by itself, and the writes meanwhile report the failure.
+ * EnvConditions: NA
+ * CaseDescription: Write while the kv store is gone, bring it back and wait for the retry.
+ */
+HWTEST_F(FmsFormStorageMgrTest, FormStorageMgr_004, TestSize.Level1)
+{
+    auto flushHandler = std::make_shared<EventHandler>(EventRunner::Create("FmsFormStorageMgrTest"));
+    MockFormStorageMgr storageMgr(flushHandler);
+    storageMgr.isKvStoreDead_ = true;
+    EXPECT_EQ(ERR_OK, storageMgr.SaveStorageFormInfo(CreateInnerFormInfo(1, "form1")));
+    // the flush delay passes, the flush fails
+    const int32_t flushWaitTime = 300 * 1000;
+    usleep(flushWaitTime);
+    EXPECT_NE(ERR_OK, storageMgr.SaveStorageFormInfo(CreateInnerFormInfo(2, "form2")));
+    EXPECT_TRUE(storageMgr.store_.empty());
+
+    // no other write comes, the retry writes both
+    storageMgr.isKvStoreDead_ = false;
+    const int32_t retryWaitTime = 1500 * 1000;
+    usleep(retryWaitTime);
+    EXPECT_EQ(2U, storageMgr.store_.size());
+    EXPECT_EQ(ERR_OK, storageMgr.SaveStorageFormInfo(CreateInnerFormInfo(3, "form3")));
+}
+
+/*
+ * Feature: FormStorageMgr
+ * Function: FlushOnStop
+ * SubFunction: NA
+ * FunctionPoints: The writes still queued as the service stops reach DB through the store of the subclass.
+ * EnvConditions: NA
+ * CaseDescription: Write forms with a flush handler that never runs, and flush them on stop.
+ */
+HWTEST_F(FmsFormStorageMgrTest, FormStorageMgr_005, TestSize.Level1)
+{
+    auto flushHandler = std::make_shared<EventHandler>(EventRunner::Create(false));
+    MockFormStorageMgr storageMgr(flushHandler);
+    storageMgr.SaveStorageFormInfo(CreateInnerFormInfo(1, "form1"));
+    storageMgr.SaveStorageFormInfo(CreateInnerFormInfo(2, "form2"));
+    EXPECT_TRUE(storageMgr.store_.empty());
+
+    EXPECT_EQ(ERR_OK, storageMgr.FlushOnStop());
+    EXPECT_EQ(2U, storageMgr.store_.size());
+    EXPECT_EQ(1, storageMgr.putBatchCount_);
+}
+}
@@ -21,6 +21,7 @@
 #include "form_constants.h"
 #include "form_refresh_limiter.h"
 #include "form_timer_mgr.h"
+#include "form_timer_queue.h"
 
 using namespace testing::ext;
 using namespace OHOS;
@@ -33,6 +34,7 @@ const int64_t PARAM_FORM_ID_VALUE_3 = 20210714;
 const int64_t PARAM_FORM_ID_VALUE_4 = 20210715;
 const int64_t PARAM_FORM_ID_VALUE_5 = 20210716;
 const int64_t PARAM_FORM_ID_VALUE_6 = 20210717;
+const int64_t PARAM_FORM_ID_VALUE_7 = 20210718;
 
 class FmsFormTimerMgrTest : public testing::Test {
 public:
@@ -541,4 +543,125 @@ HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0027, Function | MediumTest | Lev
     EXPECT_EQ(isAddOk4, true);
     GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0027 end";
 }
+
+/**
+ * @tc.number: Fms_FormTimerMgr_0028
+ * @tc.name: FormTimerQueue::Push.
+ * @tc.desc: The earliest deadline comes first, a pushed form is moved instead of added twice.
+ */
+HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0028, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0028 start";
+
+    FormTimerQueue timerQueue;
+    timerQueue.Push(PARAM_FORM_ID_VALUE_1, 300);
+    timerQueue.Push(PARAM_FORM_ID_VALUE_2, 100);
+    timerQueue.Push(PARAM_FORM_ID_VALUE_3, 200);
+    int64_t formId = 0;
+    int64_t deadline = 0;
+    EXPECT_EQ(timerQueue.GetFirst(formId, deadline), true);
+    EXPECT_EQ(formId, PARAM_FORM_ID_VALUE_2);
+    EXPECT_EQ(deadline, 100);
+
+    timerQueue.Push(PARAM_FORM_ID_VALUE_2, 400);
+    EXPECT_EQ(timerQueue.Size(), 3);
+    EXPECT_EQ(timerQueue.GetFirst(formId, deadline), true);
+    EXPECT_EQ(formId, PARAM_FORM_ID_VALUE_3);
+    EXPECT_EQ(timerQueue.GetDeadline(PARAM_FORM_ID_VALUE_2, deadline), true);
+    EXPECT_EQ(deadline, 400);
+
+    EXPECT_EQ(timerQueue.Remove(PARAM_FORM_ID_VALUE_3), true);
+    EXPECT_EQ(timerQueue.Remove(PARAM_FORM_ID_VALUE_3), false);
+    EXPECT_EQ(timerQueue.GetFirst(formId, deadline), true);
+    EXPECT_EQ(formId, PARAM_FORM_ID_VALUE_1);
+
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0028 end";
+}
+
+/**
+ * @tc.number: Fms_FormTimerMgr_0029
+ * @tc.name: FormTimerQueue::PopExpired.
+ * @tc.desc: All the deadlines up to the batching window are popped together, the later ones stay.
+ */
+HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0029, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0029 start";
+
+    FormTimerQueue timerQueue;
+    timerQueue.Push(PARAM_FORM_ID_VALUE_1, 1000);
+    timerQueue.Push(PARAM_FORM_ID_VALUE_2, 1000 + Constants::ABS_TIME);
+    timerQueue.Push(PARAM_FORM_ID_VALUE_3, 1000 + Constants::ABS_TIME + 1);
+    timerQueue.Push(PARAM_FORM_ID_VALUE_4, 500);
+
+    std::vector<int64_t> formIds;
+    timerQueue.PopExpired(1000 + Constants::ABS_TIME, formIds);
+    std::vector<int64_t> expectIds = { PARAM_FORM_ID_VALUE_4, PARAM_FORM_ID_VALUE_1, PARAM_FORM_ID_VALUE_2 };
+    EXPECT_EQ(formIds, expectIds);
+    EXPECT_EQ(timerQueue.Size(), 1);
+    int64_t deadline = 0;
+    EXPECT_EQ(timerQueue.GetDeadline(PARAM_FORM_ID_VALUE_1, deadline), false);
+
+    timerQueue.Push(PARAM_FORM_ID_VALUE_1, 0);
+    EXPECT_EQ(timerQueue.Size(), 2);
+    timerQueue.Clear();
+    EXPECT_EQ(timerQueue.Empty(), true);
+
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0029 end";
+}
+
+/**
+ * @tc.number: Fms_FormTimerMgr_0030
+ * @tc.name: FormTimerQueue::GetFirstAfter.
+ * @tc.desc: Find the next update at time of the day and the tasks of one update at time.
+ */
+HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0030, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0030 start";
+
+    FormTimerQueue timerQueue;
+    timerQueue.Push(PARAM_FORM_ID_VALUE_1, 10 * Constants::MIN_PER_HOUR + 30);
+    timerQueue.Push(PARAM_FORM_ID_VALUE_2, 3 * Constants::MIN_PER_HOUR);
+    timerQueue.Push(PARAM_FORM_ID_VALUE_3, 10 * Constants::MIN_PER_HOUR + 30);
+
+    int64_t formId = 0;
+    int64_t updateAtTime = 0;
+    EXPECT_EQ(timerQueue.GetFirstAfter(3 * Constants::MIN_PER_HOUR, formId, updateAtTime), true);
+    EXPECT_EQ(updateAtTime, 10 * Constants::MIN_PER_HOUR + 30);
+    EXPECT_EQ(timerQueue.GetFirstAfter(10 * Constants::MIN_PER_HOUR + 30, formId, updateAtTime), false);
+
+    std::vector<int64_t> formIds;
+    timerQueue.GetRange(10 * Constants::MIN_PER_HOUR + 30, 10 * Constants::MIN_PER_HOUR + 30, formIds);
+    std::vector<int64_t> expectIds = { PARAM_FORM_ID_VALUE_1, PARAM_FORM_ID_VALUE_3 };
+    EXPECT_EQ(formIds, expectIds);
+    EXPECT_EQ(timerQueue.Size(), 3);
+
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0030 end";
+}
+
+/**
+ * @tc.number: Fms_FormTimerMgr_0031
+ * @tc.name: SetNextRefreshTime.
+ * @tc.desc: A form refreshes dynamically once per user, and removing the form removes it for every user.
+ */
+HWTEST_F(FmsFormTimerMgrTest, Fms_FormTimerMgr_0031, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0031 start";
+
+    const int32_t userId = 100;
+    const int32_t otherUserId = 101;
+    EXPECT_EQ(FormTimerMgr::GetInstance().AddFormTimer(PARAM_FORM_ID_VALUE_7, Constants::MIN_PERIOD, userId), true);
+    EXPECT_EQ(FormTimerMgr::GetInstance().SetNextRefreshTime(PARAM_FORM_ID_VALUE_7, 300, userId), true);
+    EXPECT_EQ(FormTimerMgr::GetInstance().SetNextRefreshTime(PARAM_FORM_ID_VALUE_7, 400, otherUserId), true);
+    EXPECT_EQ(FormTimerMgr::GetInstance().SetNextRefreshTime(PARAM_FORM_ID_VALUE_7, 500, otherUserId), true);
+
+    // the item of the other user did not replace it
+    DynamicRefreshItem dynamicItem;
+    EXPECT_EQ(FormTimerMgr::GetInstance().GetDynamicItem(PARAM_FORM_ID_VALUE_7, dynamicItem), true);
+    EXPECT_EQ(dynamicItem.userId, userId);
+
+    EXPECT_EQ(FormTimerMgr::GetInstance().RemoveFormTimer(PARAM_FORM_ID_VALUE_7), true);
+    EXPECT_EQ(FormTimerMgr::GetInstance().GetDynamicItem(PARAM_FORM_ID_VALUE_7, dynamicItem), false);
+
+    GTEST_LOG_(INFO) << "Fms_FormTimerMgr_0031 end";
+}
 }
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_URI_GRANT_TABLE_H
+#define OHOS_AAFWK_URI_GRANT_TABLE_H
+
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "uri.h"
+
+namespace OHOS {
+namespace AAFwk {
+struct GrantInfo {
+    unsigned int flag;
+    const unsigned int fromTokenId;
+    const unsigned int targetTokenId;
+};
+
+/**
+ * @class UriGrantTable
+ * The uri permissions granted to applications, not thread safe.
+ * A grant either covers one uri, or with a prefix grant, every uri under a path, segment by segment.
+ * The grants of every target token are indexed, so that removing them does not walk the whole table.
+ */
+class UriGrantTable {
+public:
+    UriGrantTable() = default;
+    ~UriGrantTable() = default;
+
+    /**
+     * @brief Grant an uri, or every uri under it for a prefix grant.
+     * @param uri The uri.
+     * @param flag Want::FLAG_AUTH_READ_URI_PERMISSION or Want::FLAG_AUTH_WRITE_URI_PERMISSION.
+     * @param fromTokenId The owner of the uri.
+     * @param targetTokenId The user of the uri.
+     * @param isPrefix Whether the grant covers the uris under the uri.
+     * An uri with "." or ".." path segments, plain or percent-encoded, is not granted.
+     */
+    void Grant(const Uri &uri, unsigned int flag, unsigned int fromTokenId, unsigned int targetTokenId,
+        bool isPrefix);
+
+    /**
+     * @brief Check whether a token is granted an uri.
+     * @param uri The uri.
+     * @param flag Want::FLAG_AUTH_READ_URI_PERMISSION or Want::FLAG_AUTH_WRITE_URI_PERMISSION.
+     * @param targetTokenId The user of the uri.
+     * @return Returns true if an exact grant or a prefix grant covers the uri, false for an uri with "." or
+     * ".." path segments.
+     */
+    bool Verify(const Uri &uri, unsigned int flag, unsigned int targetTokenId) const;
+
+    /**
+     * @brief Remove all the grants of a token.
+     * @param targetTokenId The user of the uris.
+     */
+    void Remove(unsigned int targetTokenId);
+
+    /**
+     * @brief Get the number of grants.
+     * @return Returns the number of grants, exact and prefix.
+     */
+    size_t GetGrantCount() const;
+
+private:
+    struct PrefixNode {
+        std::map<std::string, std::unique_ptr<PrefixNode>, std::less<>> children;
+        std::list<GrantInfo> grants;
+    };
+
+    struct TokenGrants {
+        std::unordered_set<std::string> uris;
+        std::unordered_set<std::string> prefixUris;
+    };
+
+    static void AddGrant(std::list<GrantInfo> &grants, unsigned int flag, unsigned int fromTokenId,
+        unsigned int targetTokenId, size_t &grantCount);
+    static bool HasGrant(const std::list<GrantInfo> &grants, unsigned int flag, unsigned int targetTokenId);
+    static size_t RemoveGrants(std::list<GrantInfo> &grants, unsigned int targetTokenId);
+    // false if a path segment, once percent-decoded, is "." or "..", or has a separator or a null character
+    static bool GetPrefixSegments(const Uri &uri, std::vector<std::string_view> &segments);
+    void RemovePrefixGrants(const std::string &prefixUri, unsigned int targetTokenId);
+
+    std::unordered_map<std::string, std::list<GrantInfo>> uriGrants_;
+    PrefixNode prefixRoot_;
+    std::unordered_map<unsigned int, TokenGrants> tokenGrants_;
+    size_t grantCount_ = 0;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_URI_GRANT_TABLE_H
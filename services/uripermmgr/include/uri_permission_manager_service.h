@@ -28,6 +28,7 @@ class UriPermissionManagerService : public SystemAbility {
 public:
     void OnStart() override;
     void OnStop() override;
+    void OnAddSystemAbility(int32_t systemAbilityId, const std::string &deviceId) override;
 
     /**
      * @brief Check whether if the uri permission manager service is ready.
@@ -17,21 +17,19 @@
 #define OHOS_AAFWK_URI_PERMISSION_MANAGER_STUB_IMPL_H
 
 #include <functional>
-#include <map>
+#include <mutex>
+#include <shared_mutex>
 
 #include "bundlemgr/bundle_mgr_interface.h"
 #include "uri.h"
+#include "uri_grant_table.h"
+#include "uri_owner_cache.h"
 #include "uri_permission_manager_stub.h"
 
 namespace OHOS {
 namespace AAFwk {
 using ClearProxyCallback = std::function<void(const wptr<IRemoteObject>&)>;
 
-struct GrantInfo {
-    unsigned int flag;
-    const unsigned int fromTokenId;
-    const unsigned int targetTokenId;
-};
 class UriPermissionManagerStubImpl : public UriPermissionManagerStub,
                                      public std::enable_shared_from_this<UriPermissionManagerStubImpl> {
 public:
@@ -41,12 +39,22 @@ public:
     void GrantUriPermission(const Uri &uri, unsigned int flag, const Security::AccessToken::AccessTokenID fromTokenId,
         const Security::AccessToken::AccessTokenID targetTokenId) override;
 
+    void GrantUriPermissions(const std::vector<Uri> &uris, unsigned int flag,
+        const Security::AccessToken::AccessTokenID fromTokenId,
+        const Security::AccessToken::AccessTokenID targetTokenId) override;
+
     bool VerifyUriPermission(const Uri &uri, unsigned int flag,
         const Security::AccessToken::AccessTokenID tokenId) override;
 
     void RemoveUriPermission(const Security::AccessToken::AccessTokenID tokenId) override;
 
+    /**
+     * @brief Drop the cached uri owners when packages change.
+     */
+    void SubscribePackageEvents();
+
 private:
+    bool CheckGrantFlag(unsigned int flag, unsigned int &tmpFlag);
     sptr<AppExecFwk::IBundleMgr> ConnectBundleManager();
     int GetCurrentAccountId();
     void ClearProxy();
@@ -62,10 +70,12 @@ private:
     };
 
 private:
-    std::map<std::string, std::list<GrantInfo>> uriMap_;
-    std::mutex mutex_;
+    UriGrantTable grantTable_;
+    // verifications share the lock, grants and removals take it alone
+    std::shared_mutex mutex_;
     std::mutex bmsMutex_;
     sptr<AppExecFwk::IBundleMgr> bundleManager_ = nullptr;
+    UriOwnerCache ownerCache_;
 };
 }  // namespace AAFwk
 }  // namespace OHOS
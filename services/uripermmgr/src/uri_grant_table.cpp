@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "uri_grant_table.h"
+
+#include <cctype>
+
+#include "hilog_wrapper.h"
+#include "want.h"
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+const std::string_view SCHEME_AUTHORITY_SEPARATOR = "://";
+const std::string_view CURRENT_SEGMENT = ".";
+const std::string_view PARENT_SEGMENT = "..";
+// separators, or the end of the string, for the file servers once the path is decoded
+const std::string_view UNSAFE_CHARS("/\\\0", 3);
+const size_t ENCODED_CHAR_LENGTH = 3;
+const int HEX_BASE = 16;
+
+int GetHexValue(char c)
+{
+    if (!std::isxdigit(static_cast<unsigned char>(c))) {
+        return -1;
+    }
+    return std::isdigit(static_cast<unsigned char>(c)) ? c - '0' :
+        std::tolower(static_cast<unsigned char>(c)) - 'a' + 10;
+}
+
+// a "%" not followed by two hex digits is kept as it is
+std::string DecodeSegment(std::string_view segment)
+{
+    std::string decoded;
+    decoded.reserve(segment.length());
+    for (size_t pos = 0; pos < segment.length(); pos++) {
+        if (segment[pos] == '%' && segment.length() - pos >= ENCODED_CHAR_LENGTH) {
+            int high = GetHexValue(segment[pos + 1]);
+            int low = GetHexValue(segment[pos + 2]);
+            if (high >= 0 && low >= 0) {
+                decoded.push_back(static_cast<char>(high * HEX_BASE + low));
+                pos += ENCODED_CHAR_LENGTH - 1;
+                continue;
+            }
+        }
+        decoded.push_back(segment[pos]);
+    }
+    return decoded;
+}
+
+// checked the way the file servers read it: percent-decoded, where "%2f" or "%5c" split it in more segments
+bool IsUnsafeSegment(std::string_view segment)
+{
+    std::string decoded = DecodeSegment(segment);
+    return decoded == CURRENT_SEGMENT || decoded == PARENT_SEGMENT ||
+        decoded.find_first_of(UNSAFE_CHARS) != std::string::npos;
+}
+}
+
+void UriGrantTable::Grant(const Uri &uri, unsigned int flag, unsigned int fromTokenId, unsigned int targetTokenId,
+    bool isPrefix)
+{
+    std::vector<std::string_view> segments;
+    if (!GetPrefixSegments(uri, segments)) {
+        HILOG_WARN("The uri has dot or separator segments, not to grant.");
+        return;
+    }
+    const std::string &uriStr = uri.ToString();
+    if (!isPrefix) {
+        AddGrant(uriGrants_[uriStr], flag, fromTokenId, targetTokenId, grantCount_);
+        tokenGrants_[targetTokenId].uris.emplace(uriStr);
+        return;
+    }
+
+    PrefixNode *node = &prefixRoot_;
+    for (auto segment : segments) {
+        auto iter = node->children.find(segment);
+        if (iter == node->children.end()) {
+            iter = node->children.emplace(std::string(segment), std::make_unique<PrefixNode>()).first;
+        }
+        node = iter->second.get();
+    }
+    AddGrant(node->grants, flag, fromTokenId, targetTokenId, grantCount_);
+    tokenGrants_[targetTokenId].prefixUris.emplace(uriStr);
+}
+
+bool UriGrantTable::Verify(const Uri &uri, unsigned int flag, unsigned int targetTokenId) const
+{
+    auto tokenIter = tokenGrants_.find(targetTokenId);
+    if (tokenIter == tokenGrants_.end()) {
+        return false;
+    }
+    // no grant is made on a dot or separator segment, and under a prefix one could lead out of it
+    std::vector<std::string_view> segments;
+    if (!GetPrefixSegments(uri, segments)) {
+        return false;
+    }
+
+    auto search = uriGrants_.find(uri.ToString());
+    if (search != uriGrants_.end() && HasGrant(search->second, flag, targetTokenId)) {
+        return true;
+    }
+    if (tokenIter->second.prefixUris.empty()) {
+        return false;
+    }
+
+    // any grant on the way down to the uri covers it
+    const PrefixNode *node = &prefixRoot_;
+    for (auto segment : segments) {
+        auto iter = node->children.find(segment);
+        if (iter == node->children.end()) {
+            return false;
+        }
+        node = iter->second.get();
+        if (HasGrant(node->grants, flag, targetTokenId)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void UriGrantTable::Remove(unsigned int targetTokenId)
+{
+    auto tokenIter = tokenGrants_.find(targetTokenId);
+    if (tokenIter == tokenGrants_.end()) {
+        return;
+    }
+
+    for (const auto &uriStr : tokenIter->second.uris) {
+        auto search = uriGrants_.find(uriStr);
+        if (search == uriGrants_.end()) {
+            continue;
+        }
+        grantCount_ -= RemoveGrants(search->second, targetTokenId);
+        if (search->second.empty()) {
+            uriGrants_.erase(search);
+        }
+    }
+    for (const auto &prefixUri : tokenIter->second.prefixUris) {
+        RemovePrefixGrants(prefixUri, targetTokenId);
+    }
+    HILOG_INFO("Remove %{public}zu uris and %{public}zu prefixes of a token.",
+        tokenIter->second.uris.size(), tokenIter->second.prefixUris.size());
+    tokenGrants_.erase(tokenIter);
+}
+
+size_t UriGrantTable::GetGrantCount() const
+{
+    return grantCount_;
+}
+
+void UriGrantTable::AddGrant(std::list<GrantInfo> &grants, unsigned int flag, unsigned int fromTokenId,
+    unsigned int targetTokenId, size_t &grantCount)
+{
+    for (auto &item : grants) {
+        if (item.fromTokenId == fromTokenId && item.targetTokenId == targetTokenId) {
+            if ((flag & Want::FLAG_AUTH_WRITE_URI_PERMISSION) != 0) {
+                item.flag = flag;
+            }
+            HILOG_DEBUG("uri permission has granted, not to grant again.");
+            return;
+        }
+    }
+    grants.emplace_back(GrantInfo { flag, fromTokenId, targetTokenId });
+    grantCount++;
+}
+
+bool UriGrantTable::HasGrant(const std::list<GrantInfo> &grants, unsigned int flag, unsigned int targetTokenId)
+{
+    for (const auto &item : grants) {
+        if (item.targetTokenId == targetTokenId &&
+            (item.flag == Want::FLAG_AUTH_WRITE_URI_PERMISSION || item.flag == flag)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t UriGrantTable::RemoveGrants(std::list<GrantInfo> &grants, unsigned int targetTokenId)
+{
+    size_t count = grants.size();
+    grants.remove_if([targetTokenId](const GrantInfo &item) { return item.targetTokenId == targetTokenId; });
+    return count - grants.size();
+}
+
+bool UriGrantTable::GetPrefixSegments(const Uri &uri, std::vector<std::string_view> &segments)
+{
+    // the scheme and authority make the first segment, then the path goes segment by segment
+    std::string_view uriStr = uri.ToString();
+    size_t rootLength = uri.GetSchemeView().length() + SCHEME_AUTHORITY_SEPARATOR.length() +
+        uri.GetAuthorityView().length();
+    segments.emplace_back(uriStr.substr(0, std::min(rootLength, uriStr.length())));
+    uri.GetPathSegments(segments);
+    for (size_t i = 1; i < segments.size(); i++) {
+        if (IsUnsafeSegment(segments[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void UriGrantTable::RemovePrefixGrants(const std::string &prefixUri, unsigned int targetTokenId)
+{
+    Uri uri(prefixUri);
+    std::vector<std::string_view> segments;
+    GetPrefixSegments(uri, segments);
+    std::vector<std::pair<PrefixNode *, std::string_view>> path;
+    PrefixNode *node = &prefixRoot_;
+    for (auto segment : segments) {
+        auto iter = node->children.find(segment);
+        if (iter == node->children.end()) {
+            return;
+        }
+        path.emplace_back(node, segment);
+        node = iter->second.get();
+    }
+    grantCount_ -= RemoveGrants(node->grants, targetTokenId);
+
+    // drop the nodes left without grants or children, from the leaf up
+    for (auto iter = path.rbegin(); iter != path.rend(); ++iter) {
+        auto child = iter->first->children.find(iter->second);
+        if (!child->second->grants.empty() || !child->second->children.empty()) {
+            break;
+        }
+        iter->first->children.erase(child);
+    }
+}
+}  // namespace AAFwk
+}  // namespace OHOS
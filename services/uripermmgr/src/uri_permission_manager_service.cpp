@@ -54,6 +54,15 @@ void UriPermissionManagerService::OnStart()
     }
 }
 
+void UriPermissionManagerService::OnAddSystemAbility(int32_t systemAbilityId, const std::string &deviceId)
+{
+    if (systemAbilityId != COMMON_EVENT_SERVICE_ID || impl_ == nullptr) {
+        return;
+    }
+    HILOG_INFO("common event service added, subscribe package events.");
+    impl_->SubscribePackageEvents();
+}
+
 void UriPermissionManagerService::OnStop()
 {
     HILOG_INFO("OnStop is called.");
@@ -75,6 +84,10 @@ bool UriPermissionManagerService::Init()
     if (impl_ == nullptr) {
         impl_ = new UriPermissionManagerStubImpl();
     }
+    // the uri owners are subscribed to package events once the common event service is up, and again on restart
+    if (!AddSystemAbilityListener(COMMON_EVENT_SERVICE_ID)) {
+        HILOG_ERROR("fail to listen to the common event service.");
+    }
     ready_ = true;
     return true;
 }
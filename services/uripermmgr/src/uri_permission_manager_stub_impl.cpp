@@ -18,7 +18,6 @@
 #include "accesstoken_kit.h"
 #include "hilog_wrapper.h"
 #include "if_system_ability_manager.h"
-#include "in_process_call_wrapper.h"
 #include "ipc_skeleton.h"
 #include "iservice_registry.h"
 #include "singleton.h"
@@ -34,48 +33,53 @@ const int32_t DEFAULT_OS_ACCOUNT_ID = 0; // 0 is the default id when there is no
 
 void UriPermissionManagerStubImpl::GrantUriPermission(const Uri &uri, unsigned int flag,
     const Security::AccessToken::AccessTokenID fromTokenId, const Security::AccessToken::AccessTokenID targetTokenId)
+{
+    unsigned int tmpFlag = 0;
+    if (!CheckGrantFlag(flag, tmpFlag)) {
+        return;
+    }
+
+    bool isPrefix = (flag & Want::FLAG_AUTH_PREFIX_URI_PERMISSION) != 0;
+    std::unique_lock<std::shared_mutex> guard(mutex_);
+    grantTable_.Grant(uri, tmpFlag, fromTokenId, targetTokenId, isPrefix);
+}
+
+void UriPermissionManagerStubImpl::GrantUriPermissions(const std::vector<Uri> &uris, unsigned int flag,
+    const Security::AccessToken::AccessTokenID fromTokenId, const Security::AccessToken::AccessTokenID targetTokenId)
+{
+    unsigned int tmpFlag = 0;
+    if (!CheckGrantFlag(flag, tmpFlag)) {
+        return;
+    }
+
+    HILOG_DEBUG("Grant %{public}zu uris.", uris.size());
+    bool isPrefix = (flag & Want::FLAG_AUTH_PREFIX_URI_PERMISSION) != 0;
+    std::unique_lock<std::shared_mutex> guard(mutex_);
+    for (const auto &uri : uris) {
+        grantTable_.Grant(uri, tmpFlag, fromTokenId, targetTokenId, isPrefix);
+    }
+}
+
+bool UriPermissionManagerStubImpl::CheckGrantFlag(unsigned int flag, unsigned int &tmpFlag)
 {
     auto callerTokenId = IPCSkeleton::GetCallingTokenID();
     HILOG_DEBUG("callerTokenId : %{pulic}u", callerTokenId);
     auto tokenType = Security::AccessToken::AccessTokenKit::GetTokenTypeFlag(callerTokenId);
     if (tokenType != Security::AccessToken::ATokenTypeEnum::TOKEN_NATIVE) {
         HILOG_DEBUG("caller tokenType is not native, verify failure.");
-        return;
+        return false;
     }
 
     if ((flag & (Want::FLAG_AUTH_READ_URI_PERMISSION | Want::FLAG_AUTH_WRITE_URI_PERMISSION)) == 0) {
         HILOG_WARN("UriPermissionManagerStubImpl::GrantUriPermission: The param flag is invalid.");
-        return;
+        return false;
     }
-    unsigned int tmpFlag = 0;
     if (flag & Want::FLAG_AUTH_WRITE_URI_PERMISSION) {
         tmpFlag = Want::FLAG_AUTH_WRITE_URI_PERMISSION;
     } else {
         tmpFlag = Want::FLAG_AUTH_READ_URI_PERMISSION;
     }
-
-    auto uriStr = uri.ToString();
-    std::lock_guard<std::mutex> guard(mutex_);
-    auto search = uriMap_.find(uriStr);
-    GrantInfo info = { tmpFlag, fromTokenId, targetTokenId };
-    if (search == uriMap_.end()) {
-        HILOG_INFO("uri is not exist, add uri and GrantInfo to map.");
-        std::list<GrantInfo> infoList = { info };
-        uriMap_.emplace(uriStr, infoList);
-        return;
-    }
-    auto& infoList = search->second;
-    for (auto& item : infoList) {
-        if (item.fromTokenId == fromTokenId && item.targetTokenId == targetTokenId) {
-            if ((tmpFlag & Want::FLAG_AUTH_WRITE_URI_PERMISSION) != 0) {
-                item.flag = tmpFlag;
-            }
-            HILOG_INFO("uri permission has granted, not to grant again.");
-            return;
-        }
-    }
-    HILOG_DEBUG("uri is exist, add GrantInfo to list.");
-    infoList.emplace_back(info);
+    return true;
 }
 
 bool UriPermissionManagerStubImpl::VerifyUriPermission(const Uri &uri, unsigned int flag,
@@ -87,11 +91,9 @@ bool UriPermissionManagerStubImpl::VerifyUriPermission(const Uri &uri, unsigned
     }
 
     auto bms = ConnectBundleManager();
-    auto uriStr = uri.ToString();
     if (bms) {
-        AppExecFwk::ExtensionAbilityInfo info;
-        if (!IN_PROCESS_CALL(bms->QueryExtensionAbilityInfoByUri(uriStr, GetCurrentAccountId(), info))) {
-            HILOG_DEBUG("%{public}s, Fail to get extension info from bundle manager.", __func__);
+        UriOwnerInfo info;
+        if (!ownerCache_.GetOwner(bms, uri, GetCurrentAccountId(), info)) {
             return false;
         }
         if (info.type != AppExecFwk::ExtensionAbilityType::FILESHARE) {
@@ -99,19 +101,12 @@ bool UriPermissionManagerStubImpl::VerifyUriPermission(const Uri &uri, unsigned
             return false;
         }
 
-        if (tokenId == info.applicationInfo.accessTokenId) {
+        if (tokenId == info.accessTokenId) {
             HILOG_DEBUG("The uri belongs to this application.");
             return true;
         }
     }
 
-    std::lock_guard<std::mutex> guard(mutex_);
-    auto search = uriMap_.find(uriStr);
-    if (search == uriMap_.end()) {
-        HILOG_DEBUG("This tokenID does not have permission for this uri.");
-        return false;
-    }
-
     unsigned int tmpFlag = 0;
     if (flag & Want::FLAG_AUTH_WRITE_URI_PERMISSION) {
         tmpFlag = Want::FLAG_AUTH_WRITE_URI_PERMISSION;
@@ -119,12 +114,10 @@ bool UriPermissionManagerStubImpl::VerifyUriPermission(const Uri &uri, unsigned
         tmpFlag = Want::FLAG_AUTH_READ_URI_PERMISSION;
     }
 
-    for (auto& item : search->second) {
-        if (item.targetTokenId == tokenId &&
-            (item.flag == Want::FLAG_AUTH_WRITE_URI_PERMISSION || item.flag == tmpFlag)) {
-            HILOG_DEBUG("This tokenID have permission for this uri.");
-            return true;
-        }
+    std::shared_lock<std::shared_mutex> guard(mutex_);
+    if (grantTable_.Verify(uri, tmpFlag, tokenId)) {
+        HILOG_DEBUG("This tokenID have permission for this uri.");
+        return true;
     }
 
     HILOG_DEBUG("The application does not have permission for this URI.");
@@ -133,22 +126,13 @@ bool UriPermissionManagerStubImpl::VerifyUriPermission(const Uri &uri, unsigned
 
 void UriPermissionManagerStubImpl::RemoveUriPermission(const Security::AccessToken::AccessTokenID tokenId)
 {
-    std::lock_guard<std::mutex> guard(mutex_);
-    for (auto iter = uriMap_.begin(); iter != uriMap_.end();) {
-        auto& list = iter->second;
-        for (auto it = list.begin(); it != list.end(); it++) {
-            if (it->targetTokenId == tokenId) {
-                HILOG_INFO("Erase an info form list.");
-                list.erase(it);
-                break;
-            }
-        }
-        if (list.size() == 0) {
-            uriMap_.erase(iter++);
-        } else {
-            iter++;
-        }
-    }
+    std::unique_lock<std::shared_mutex> guard(mutex_);
+    grantTable_.Remove(tokenId);
+}
+
+void UriPermissionManagerStubImpl::SubscribePackageEvents()
+{
+    ownerCache_.SubscribePackageEvents();
 }
 
 sptr<AppExecFwk::IBundleMgr> UriPermissionManagerStubImpl::ConnectBundleManager()
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <list>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "uri_grant_table.h"
+#include "want.h"
+
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+const unsigned int OWNER_TOKEN_ID = 1001;
+const unsigned int FIRST_TARGET_TOKEN_ID = 2001;
+const int TARGET_COUNT = 200;
+const int GRANT_COUNT = 100000;
+const int GRANTS_PER_TARGET = GRANT_COUNT / TARGET_COUNT;
+const int VERIFY_THREAD_COUNT = 4;
+
+std::string GetGrantUri(int target, int index)
+{
+    return "dataability:///com.example.fileshare" + std::to_string(target) + "/files/f" + std::to_string(index);
+}
+
+std::string GetPrefixUri(int target)
+{
+    return "dataability:///com.example.fileshare" + std::to_string(target) + "/files";
+}
+
+void FillTable(UriGrantTable &table)
+{
+    for (int target = 0; target < TARGET_COUNT; target++) {
+        for (int index = 0; index < GRANTS_PER_TARGET; index++) {
+            table.Grant(Uri(GetGrantUri(target, index)), Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID,
+                FIRST_TARGET_TOKEN_ID + target, false);
+        }
+    }
+}
+
+// how the manager kept its grants before the table, every uri scanned to remove a token
+using LegacyUriMap = std::map<std::string, std::list<GrantInfo>>;
+
+void FillLegacyMap(LegacyUriMap &uriMap)
+{
+    for (int target = 0; target < TARGET_COUNT; target++) {
+        for (int index = 0; index < GRANTS_PER_TARGET; index++) {
+            uriMap[GetGrantUri(target, index)].emplace_back(GrantInfo { Want::FLAG_AUTH_READ_URI_PERMISSION,
+                OWNER_TOKEN_ID, FIRST_TARGET_TOKEN_ID + target });
+        }
+    }
+}
+
+void RemoveFromLegacyMap(LegacyUriMap &uriMap, unsigned int tokenId)
+{
+    for (auto iter = uriMap.begin(); iter != uriMap.end();) {
+        auto &list = iter->second;
+        for (auto it = list.begin(); it != list.end(); it++) {
+            if (it->targetTokenId == tokenId) {
+                list.erase(it);
+                break;
+            }
+        }
+        if (list.size() == 0) {
+            uriMap.erase(iter++);
+        } else {
+            iter++;
+        }
+    }
+}
+
+void BenchmarkRemoveLegacy(benchmark::State &state)
+{
+    LegacyUriMap uriMap;
+    FillLegacyMap(uriMap);
+    int target = 0;
+    for (auto _ : state) {
+        RemoveFromLegacyMap(uriMap, FIRST_TARGET_TOKEN_ID + target);
+        state.PauseTiming();
+        for (int index = 0; index < GRANTS_PER_TARGET; index++) {
+            uriMap[GetGrantUri(target, index)].emplace_back(GrantInfo { Want::FLAG_AUTH_READ_URI_PERMISSION,
+                OWNER_TOKEN_ID, FIRST_TARGET_TOKEN_ID + target });
+        }
+        target = (target + 1) % TARGET_COUNT;
+        state.ResumeTiming();
+    }
+}
+
+void BenchmarkRemove(benchmark::State &state)
+{
+    UriGrantTable table;
+    FillTable(table);
+    int target = 0;
+    for (auto _ : state) {
+        table.Remove(FIRST_TARGET_TOKEN_ID + target);
+        state.PauseTiming();
+        for (int index = 0; index < GRANTS_PER_TARGET; index++) {
+            table.Grant(Uri(GetGrantUri(target, index)), Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID,
+                FIRST_TARGET_TOKEN_ID + target, false);
+        }
+        target = (target + 1) % TARGET_COUNT;
+        state.ResumeTiming();
+    }
+}
+
+void BenchmarkVerifyExact(benchmark::State &state)
+{
+    UriGrantTable table;
+    FillTable(table);
+    Uri uri(GetGrantUri(TARGET_COUNT / 2, GRANTS_PER_TARGET / 2));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(table.Verify(uri, Want::FLAG_AUTH_READ_URI_PERMISSION,
+            FIRST_TARGET_TOKEN_ID + TARGET_COUNT / 2));
+    }
+}
+
+void BenchmarkVerifyPrefix(benchmark::State &state)
+{
+    UriGrantTable table;
+    FillTable(table);
+    for (int target = 0; target < TARGET_COUNT; target++) {
+        table.Grant(Uri(GetPrefixUri(target)), Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID,
+            FIRST_TARGET_TOKEN_ID + target, true);
+    }
+    // not granted one by one, only the directory covers it
+    Uri uri(GetPrefixUri(TARGET_COUNT / 2) + "/photos/2022/a.jpg");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(table.Verify(uri, Want::FLAG_AUTH_READ_URI_PERMISSION,
+            FIRST_TARGET_TOKEN_ID + TARGET_COUNT / 2));
+    }
+}
+
+template<typename Mutex, typename Lock>
+void BenchmarkConcurrentVerify(benchmark::State &state)
+{
+    // shared by the benchmark threads, filled once
+    static UriGrantTable table;
+    static Mutex mutex;
+    static std::once_flag filled;
+    std::call_once(filled, [] { FillTable(table); });
+    int target = TARGET_COUNT / 2;
+    Uri uri(GetGrantUri(target, GRANTS_PER_TARGET / 2));
+    for (auto _ : state) {
+        Lock lock(mutex);
+        benchmark::DoNotOptimize(table.Verify(uri, Want::FLAG_AUTH_READ_URI_PERMISSION,
+            FIRST_TARGET_TOKEN_ID + target));
+    }
+}
+
+void BenchmarkConcurrentVerifyExclusive(benchmark::State &state)
+{
+    BenchmarkConcurrentVerify<std::mutex, std::lock_guard<std::mutex>>(state);
+}
+
+void BenchmarkConcurrentVerifyShared(benchmark::State &state)
+{
+    BenchmarkConcurrentVerify<std::shared_mutex, std::shared_lock<std::shared_mutex>>(state);
+}
+}  // namespace
+
+BENCHMARK(BenchmarkRemoveLegacy);
+BENCHMARK(BenchmarkRemove);
+BENCHMARK(BenchmarkVerifyExact);
+BENCHMARK(BenchmarkVerifyPrefix);
+BENCHMARK(BenchmarkConcurrentVerifyExclusive)->Threads(1)->Threads(VERIFY_THREAD_COUNT);
+BENCHMARK(BenchmarkConcurrentVerifyShared)->Threads(1)->Threads(VERIFY_THREAD_COUNT);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "bundle_mgr_host.h"
+#include "bundle_mgr_proxy.h"
+#include "uri_permission_manager_proxy.h"
+#include "uri_permission_manager_stub.h"
+#include "want.h"
+#define private public
+#include "uri_owner_cache.h"
+#include "uri_permission_manager_stub_impl.h"
+#undef private
+
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+const std::string OWNER_BUNDLE_NAME = "com.example.gallery";
+const std::string OWNER_URI = "fileShare:///com.example.gallery";
+const uint32_t OWNER_TOKEN_ID = 1001;
+const uint32_t TARGET_TOKEN_ID = 1002;
+const int32_t USER_ID = 100;
+
+/**
+ * Stands in for the bundle manager, the uris of the gallery are all owned by its file share.
+ */
+class StandInBundleMgr : public AppExecFwk::BundleMgrHost {
+public:
+    bool QueryExtensionAbilityInfoByUri(const std::string &uri, int32_t userId,
+        AppExecFwk::ExtensionAbilityInfo &extensionAbilityInfo) override
+    {
+        queryCount_++;
+        extensionAbilityInfo.type = AppExecFwk::ExtensionAbilityType::FILESHARE;
+        extensionAbilityInfo.bundleName = OWNER_BUNDLE_NAME;
+        extensionAbilityInfo.applicationInfo.accessTokenId = OWNER_TOKEN_ID;
+        return true;
+    }
+
+    int64_t queryCount_ = 0;
+};
+
+/**
+ * Stands in for the uri permission manager service, it answers every request at once.
+ */
+class StandInUriPermissionManager : public UriPermissionManagerStub {
+public:
+    void GrantUriPermission(const Uri &uri, unsigned int flag, const Security::AccessToken::AccessTokenID fromTokenId,
+        const Security::AccessToken::AccessTokenID targetTokenId) override
+    {
+        requestCount_++;
+    }
+    void GrantUriPermissions(const std::vector<Uri> &uris, unsigned int flag,
+        const Security::AccessToken::AccessTokenID fromTokenId,
+        const Security::AccessToken::AccessTokenID targetTokenId) override
+    {
+        requestCount_++;
+    }
+    bool VerifyUriPermission(const Uri &uri, unsigned int flag,
+        const Security::AccessToken::AccessTokenID tokenId) override
+    {
+        return true;
+    }
+    void RemoveUriPermission(const Security::AccessToken::AccessTokenID tokenId) override
+    {}
+
+    int64_t requestCount_ = 0;
+};
+
+std::vector<std::string> MakeUriStrings(int64_t count)
+{
+    std::vector<std::string> uriStrings;
+    for (int64_t i = 0; i < count; i++) {
+        uriStrings.emplace_back(OWNER_URI + "/photos/IMG_" + std::to_string(i) + ".jpg");
+    }
+    return uriStrings;
+}
+
+void BenchmarkGrantPerUri(benchmark::State &state)
+{
+    sptr<StandInBundleMgr> standInBms = new StandInBundleMgr();
+    // the proxies marshal every call, as they would across processes
+    sptr<AppExecFwk::IBundleMgr> bms = new AppExecFwk::BundleMgrProxy(standInBms);
+    sptr<StandInUriPermissionManager> standInUpms = new StandInUriPermissionManager();
+    sptr<IUriPermissionManager> upms = new UriPermissionManagerProxy(standInUpms);
+    auto uriStrings = MakeUriStrings(state.range(0));
+    for (auto _ : state) {
+        // what AbilityManagerService::GrantUriPermission did, two requests for every uri
+        for (const auto &uriString : uriStrings) {
+            AppExecFwk::ExtensionAbilityInfo info;
+            if (!bms->QueryExtensionAbilityInfoByUri(uriString, USER_ID, info) ||
+                info.applicationInfo.accessTokenId != OWNER_TOKEN_ID) {
+                continue;
+            }
+            upms->GrantUriPermission(Uri(uriString), Want::FLAG_AUTH_READ_URI_PERMISSION,
+                OWNER_TOKEN_ID, TARGET_TOKEN_ID);
+        }
+    }
+    state.counters["requests"] = benchmark::Counter(standInBms->queryCount_ + standInUpms->requestCount_,
+        benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BenchmarkGrantBatch(benchmark::State &state)
+{
+    sptr<StandInBundleMgr> standInBms = new StandInBundleMgr();
+    sptr<AppExecFwk::IBundleMgr> bms = new AppExecFwk::BundleMgrProxy(standInBms);
+    sptr<StandInUriPermissionManager> standInUpms = new StandInUriPermissionManager();
+    sptr<IUriPermissionManager> upms = new UriPermissionManagerProxy(standInUpms);
+    auto uriStrings = MakeUriStrings(state.range(0));
+    UriOwnerCache ownerCache;
+    for (auto _ : state) {
+        std::vector<Uri> uris;
+        for (const auto &uriString : uriStrings) {
+            Uri uri(uriString);
+            UriOwnerInfo info;
+            if (!ownerCache.GetOwner(bms, uri, USER_ID, info) || info.accessTokenId != OWNER_TOKEN_ID) {
+                continue;
+            }
+            uris.emplace_back(uri);
+        }
+        upms->GrantUriPermissions(uris, Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID, TARGET_TOKEN_ID);
+    }
+    state.counters["requests"] = benchmark::Counter(standInBms->queryCount_ + standInUpms->requestCount_,
+        benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+sptr<UriPermissionManagerStubImpl> MakeGrantedUpms(const sptr<AppExecFwk::IBundleMgr> &bms,
+    const std::vector<std::string> &uriStrings)
+{
+    sptr<UriPermissionManagerStubImpl> upms = new UriPermissionManagerStubImpl();
+    upms->bundleManager_ = bms;
+    for (const auto &uriString : uriStrings) {
+        upms->grantTable_.Grant(Uri(uriString), Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID,
+            TARGET_TOKEN_ID, false);
+    }
+    return upms;
+}
+
+void BenchmarkVerifyUncached(benchmark::State &state)
+{
+    sptr<StandInBundleMgr> standInBms = new StandInBundleMgr();
+    sptr<AppExecFwk::IBundleMgr> bms = new AppExecFwk::BundleMgrProxy(standInBms);
+    auto uriStrings = MakeUriStrings(state.range(0));
+    auto upms = MakeGrantedUpms(bms, uriStrings);
+    std::vector<Uri> uris(uriStrings.begin(), uriStrings.end());
+    for (auto _ : state) {
+        // what every verification cost before the owners were cached, a bundle manager request
+        for (const auto &uri : uris) {
+            upms->ownerCache_.Clear();
+            benchmark::DoNotOptimize(upms->VerifyUriPermission(uri, Want::FLAG_AUTH_READ_URI_PERMISSION,
+                TARGET_TOKEN_ID));
+        }
+    }
+    state.counters["requests"] = benchmark::Counter(standInBms->queryCount_, benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BenchmarkVerifyCached(benchmark::State &state)
+{
+    sptr<StandInBundleMgr> standInBms = new StandInBundleMgr();
+    sptr<AppExecFwk::IBundleMgr> bms = new AppExecFwk::BundleMgrProxy(standInBms);
+    auto uriStrings = MakeUriStrings(state.range(0));
+    auto upms = MakeGrantedUpms(bms, uriStrings);
+    std::vector<Uri> uris(uriStrings.begin(), uriStrings.end());
+    for (auto _ : state) {
+        for (const auto &uri : uris) {
+            benchmark::DoNotOptimize(upms->VerifyUriPermission(uri, Want::FLAG_AUTH_READ_URI_PERMISSION,
+                TARGET_TOKEN_ID));
+        }
+    }
+    state.counters["requests"] = benchmark::Counter(standInBms->queryCount_, benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+}  // namespace
+
+BENCHMARK(BenchmarkGrantPerUri)->Arg(1)->Arg(100)->Arg(1000);
+BENCHMARK(BenchmarkGrantBatch)->Arg(1)->Arg(100)->Arg(1000);
+BENCHMARK(BenchmarkVerifyUncached)->Arg(1)->Arg(100)->Arg(1000);
+BENCHMARK(BenchmarkVerifyCached)->Arg(1)->Arg(100)->Arg(1000);
+
+BENCHMARK_MAIN();
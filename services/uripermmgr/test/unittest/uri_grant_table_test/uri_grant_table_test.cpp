@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "uri_grant_table.h"
+#undef private
+#include "want.h"
+
+using namespace testing::ext;
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+const unsigned int OWNER_TOKEN_ID = 1001;
+const unsigned int OTHER_OWNER_TOKEN_ID = 1002;
+const unsigned int TARGET_TOKEN_ID = 2001;
+const unsigned int OTHER_TARGET_TOKEN_ID = 2002;
+const std::string PHOTOS_URI = "dataability:///com.example.fileshare/files/photos";
+}
+
+class UriGrantTableTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void UriGrantTableTest::SetUpTestCase()
+{}
+
+void UriGrantTableTest::TearDownTestCase()
+{}
+
+void UriGrantTableTest::SetUp()
+{}
+
+void UriGrantTableTest::TearDown()
+{}
+
+/*
+ * Feature: UriGrantTable
+ * Function: Grant
+ * SubFunction: NA
+ * FunctionPoints: An exact grant covers its uri only, and a write grant covers reads.
+ * EnvConditions: NA
+ * CaseDescription: Grant read then write on an uri, and verify it, a file under it and another target.
+ */
+HWTEST_F(UriGrantTableTest, UriGrantTable_001, TestSize.Level1)
+{
+    UriGrantTable table;
+    Uri uri(PHOTOS_URI + "/a.jpg");
+    table.Grant(uri, Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID, TARGET_TOKEN_ID, false);
+    EXPECT_TRUE(table.Verify(uri, Want::FLAG_AUTH_READ_URI_PERMISSION, TARGET_TOKEN_ID));
+    EXPECT_FALSE(table.Verify(uri, Want::FLAG_AUTH_WRITE_URI_PERMISSION, TARGET_TOKEN_ID));
+    EXPECT_FALSE(table.Verify(uri, Want::FLAG_AUTH_READ_URI_PERMISSION, OTHER_TARGET_TOKEN_ID));
+    EXPECT_FALSE(table.Verify(Uri(PHOTOS_URI + "/a.jpg/b"), Want::FLAG_AUTH_READ_URI_PERMISSION, TARGET_TOKEN_ID));
+
+    // granted again by the same owner, the grant is upgraded and not added
+    table.Grant(uri, Want::FLAG_AUTH_WRITE_URI_PERMISSION, OWNER_TOKEN_ID, TARGET_TOKEN_ID, false);
+    table.Grant(uri, Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID, TARGET_TOKEN_ID, false);
+    EXPECT_TRUE(table.Verify(uri, Want::FLAG_AUTH_WRITE_URI_PERMISSION, TARGET_TOKEN_ID));
+    EXPECT_TRUE(table.Verify(uri, Want::FLAG_AUTH_READ_URI_PERMISSION, TARGET_TOKEN_ID));
+    EXPECT_EQ(1U, table.GetGrantCount());
+}
+
+/*
+ * Feature: UriGrantTable
+ * Function: Grant
+ * SubFunction: NA
+ * FunctionPoints: A prefix grant covers the uris under its path, segment by segment.
+ * EnvConditions: NA
+ * CaseDescription: Grant a directory, and verify it, files under it, a sibling sharing its name as prefix.
+ */
+HWTEST_F(UriGrantTableTest, UriGrantTable_002, TestSize.Level1)
+{
+    UriGrantTable table;
+    table.Grant(Uri(PHOTOS_URI), Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID, TARGET_TOKEN_ID, true);
+    EXPECT_TRUE(table.Verify(Uri(PHOTOS_URI), Want::FLAG_AUTH_READ_URI_PERMISSION, TARGET_TOKEN_ID));
+    EXPECT_TRUE(table.Verify(Uri(PHOTOS_URI + "/a.jpg"), Want::FLAG_AUTH_READ_URI_PERMISSION, TARGET_TOKEN_ID));
+    EXPECT_TRUE(table.Verify(Uri(PHOTOS_URI + "/2022/b.jpg?size=small"), Want::FLAG_AUTH_READ_URI_PERMISSION,
+        TARGET_TOKEN_ID));
+    EXPECT_FALSE(table.Verify(Uri(PHOTOS_URI + "2/a.jpg"), Want::FLAG_AUTH_READ_URI_PERMISSION, TARGET_TOKEN_ID));
+    EXPECT_FALSE(table.Verify(Uri("dataability:///com.example.fileshare/files"), Want::FLAG_AUTH_READ_URI_PERMISSION,
+        TARGET_TOKEN_ID));
+    EXPECT_FALSE(table.Verify(Uri("datashare:///com.example.fileshare/files/photos/a.jpg"),
+        Want::FLAG_AUTH_READ_URI_PERMISSION, TARGET_TOKEN_ID));
+    EXPECT_FALSE(table.Verify(Uri(PHOTOS_URI + "/a.jpg"), Want::FLAG_AUTH_WRITE_URI_PERMISSION, TARGET_TOKEN_ID));
+    EXPECT_FALSE(table.Verify(Uri(PHOTOS_URI + "/a.jpg"), Want::FLAG_AUTH_READ_URI_PERMISSION,
+        OTHER_TARGET_TOKEN_ID));
+
+    // a write grant deeper down covers its own files only
+    table.Grant(Uri(PHOTOS_URI + "/2022"), Want::FLAG_AUTH_WRITE_URI_PERMISSION, OWNER_TOKEN_ID, TARGET_TOKEN_ID,
+        true);
+    EXPECT_TRUE(table.Verify(Uri(PHOTOS_URI + "/2022/b.jpg"), Want::FLAG_AUTH_WRITE_URI_PERMISSION,
+        TARGET_TOKEN_ID));
+    EXPECT_FALSE(table.Verify(Uri(PHOTOS_URI + "/2021/b.jpg"), Want::FLAG_AUTH_WRITE_URI_PERMISSION,
+        TARGET_TOKEN_ID));
+    EXPECT_EQ(2U, table.GetGrantCount());
+}
+
+/*
+ * Feature: UriGrantTable
+ * Function: Remove
+ * SubFunction: NA
+ * FunctionPoints: Removing a token drops all its grants, and leaves the other tokens alone.
+ * EnvConditions: NA
+ * CaseDescription: Grant an uri by two owners and a directory to two targets, then remove one target.
+ */
+HWTEST_F(UriGrantTableTest, UriGrantTable_003, TestSize.Level1)
+{
+    UriGrantTable table;
+    Uri uri(PHOTOS_URI + "/a.jpg");
+    table.Grant(uri, Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID, TARGET_TOKEN_ID, false);
+    table.Grant(uri, Want::FLAG_AUTH_READ_URI_PERMISSION, OTHER_OWNER_TOKEN_ID, TARGET_TOKEN_ID, false);
+    table.Grant(uri, Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID, OTHER_TARGET_TOKEN_ID, false);
+    table.Grant(Uri(PHOTOS_URI + "/2022"), Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID, TARGET_TOKEN_ID,
+        true);
+    table.Grant(Uri(PHOTOS_URI), Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID, OTHER_TARGET_TOKEN_ID, true);
+    EXPECT_EQ(5U, table.GetGrantCount());
+
+    table.Remove(TARGET_TOKEN_ID);
+    EXPECT_EQ(2U, table.GetGrantCount());
+    EXPECT_FALSE(table.Verify(uri, Want::FLAG_AUTH_READ_URI_PERMISSION, TARGET_TOKEN_ID));
+    EXPECT_FALSE(table.Verify(Uri(PHOTOS_URI + "/2022/b.jpg"), Want::FLAG_AUTH_READ_URI_PERMISSION,
+        TARGET_TOKEN_ID));
+    EXPECT_TRUE(table.Verify(uri, Want::FLAG_AUTH_READ_URI_PERMISSION, OTHER_TARGET_TOKEN_ID));
+    EXPECT_TRUE(table.Verify(Uri(PHOTOS_URI + "/2022/b.jpg"), Want::FLAG_AUTH_READ_URI_PERMISSION,
+        OTHER_TARGET_TOKEN_ID));
+    EXPECT_EQ(0U, table.tokenGrants_.count(TARGET_TOKEN_ID));
+
+    // the nodes left without grants are gone, up to the granted directory
+    table.Remove(OTHER_TARGET_TOKEN_ID);
+    EXPECT_EQ(0U, table.GetGrantCount());
+    EXPECT_TRUE(table.uriGrants_.empty());
+    EXPECT_TRUE(table.prefixRoot_.children.empty());
+    EXPECT_TRUE(table.tokenGrants_.empty());
+}
+
+/*
+ * Feature: UriGrantTable
+ * Function: Grant Verify
+ * SubFunction: NA
+ * FunctionPoints: An uri with dot segments is neither granted nor verified, so it cannot lead out of a prefix.
+ * EnvConditions: NA
+ * CaseDescription: Grant a directory, and verify uris leaving it through "..", "." and "%2e%2e" segments.
+ */
+HWTEST_F(UriGrantTableTest, UriGrantTable_004, TestSize.Level1)
+{
+    UriGrantTable table;
+    table.Grant(Uri(PHOTOS_URI), Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID, TARGET_TOKEN_ID, true);
+    EXPECT_FALSE(table.Verify(Uri(PHOTOS_URI + "/../secrets/key"), Want::FLAG_AUTH_READ_URI_PERMISSION,
+        TARGET_TOKEN_ID));
+    EXPECT_FALSE(table.Verify(Uri(PHOTOS_URI + "/2022/../../secrets/key"), Want::FLAG_AUTH_READ_URI_PERMISSION,
+        TARGET_TOKEN_ID));
+    EXPECT_FALSE(table.Verify(Uri(PHOTOS_URI + "/./a.jpg"), Want::FLAG_AUTH_READ_URI_PERMISSION, TARGET_TOKEN_ID));
+    EXPECT_FALSE(table.Verify(Uri(PHOTOS_URI + "/%2e%2e/secrets/key"), Want::FLAG_AUTH_READ_URI_PERMISSION,
+        TARGET_TOKEN_ID));
+    EXPECT_FALSE(table.Verify(Uri(PHOTOS_URI + "/.%2E/secrets/key"), Want::FLAG_AUTH_READ_URI_PERMISSION,
+        TARGET_TOKEN_ID));
+    // dots inside a name are no dot segment
+    EXPECT_TRUE(table.Verify(Uri(PHOTOS_URI + "/...jpg"), Want::FLAG_AUTH_READ_URI_PERMISSION, TARGET_TOKEN_ID));
+    EXPECT_TRUE(table.Verify(Uri(PHOTOS_URI + "/..."), Want::FLAG_AUTH_READ_URI_PERMISSION, TARGET_TOKEN_ID));
+
+    // nor are they granted, exact or prefix
+    table.Grant(Uri(PHOTOS_URI + "/.."), Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID, TARGET_TOKEN_ID, true);
+    table.Grant(Uri(PHOTOS_URI + "/%2E"), Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID, TARGET_TOKEN_ID,
+        false);
+    EXPECT_EQ(1U, table.GetGrantCount());
+    EXPECT_FALSE(table.Verify(Uri(PHOTOS_URI + "/%2E"), Want::FLAG_AUTH_READ_URI_PERMISSION, TARGET_TOKEN_ID));
+}
+
+/*
+ * Feature: UriGrantTable
+ * Function: Grant Verify
+ * SubFunction: NA
+ * FunctionPoints: A path segment is checked percent-decoded, so an encoded separator cannot hide a dot segment.
+ * EnvConditions: NA
+ * CaseDescription: Grant a directory, and verify uris leaving it through "%2f", "%5c" and "\\" in a segment.
+ */
+HWTEST_F(UriGrantTableTest, UriGrantTable_005, TestSize.Level1)
+{
+    UriGrantTable table;
+    table.Grant(Uri(PHOTOS_URI), Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID, TARGET_TOKEN_ID, true);
+    EXPECT_FALSE(table.Verify(Uri(PHOTOS_URI + "/..%2fsecrets"), Want::FLAG_AUTH_READ_URI_PERMISSION,
+        TARGET_TOKEN_ID));
+    EXPECT_FALSE(table.Verify(Uri(PHOTOS_URI + "/%2e%2e%2Fsecrets/key"), Want::FLAG_AUTH_READ_URI_PERMISSION,
+        TARGET_TOKEN_ID));
+    EXPECT_FALSE(table.Verify(Uri(PHOTOS_URI + "/..%5csecrets"), Want::FLAG_AUTH_READ_URI_PERMISSION,
+        TARGET_TOKEN_ID));
+    EXPECT_FALSE(table.Verify(Uri(PHOTOS_URI + "/..\\secrets"), Want::FLAG_AUTH_READ_URI_PERMISSION,
+        TARGET_TOKEN_ID));
+    EXPECT_FALSE(table.Verify(Uri(PHOTOS_URI + "/a.jpg%00.png"), Want::FLAG_AUTH_READ_URI_PERMISSION,
+        TARGET_TOKEN_ID));
+    // other escapes, and a "%" not starting one, are fine
+    EXPECT_TRUE(table.Verify(Uri(PHOTOS_URI + "/my%20photo.jpg"), Want::FLAG_AUTH_READ_URI_PERMISSION,
+        TARGET_TOKEN_ID));
+    EXPECT_TRUE(table.Verify(Uri(PHOTOS_URI + "/100%.jpg"), Want::FLAG_AUTH_READ_URI_PERMISSION, TARGET_TOKEN_ID));
+
+    table.Grant(Uri(PHOTOS_URI + "/..%2f"), Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID, TARGET_TOKEN_ID,
+        true);
+    EXPECT_EQ(1U, table.GetGrantCount());
+}
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "bundle_mgr_host.h"
+#include "common_event_support.h"
+#include "uri_permission_manager_proxy.h"
+#include "uri_permission_manager_stub.h"
+#include "want.h"
+#define private public
+#include "uri_owner_cache.h"
+#include "uri_permission_manager_stub_impl.h"
+#undef private
+
+using namespace testing::ext;
+using namespace OHOS;
+using namespace OHOS::AAFwk;
+
+namespace {
+const std::string OWNER_BUNDLE_NAME = "com.example.fileshare";
+const std::string OWNER_URI = "fileShare:///com.example.fileshare";
+const uint32_t OWNER_TOKEN_ID = 1001;
+const uint32_t TARGET_TOKEN_ID = 1002;
+const int32_t USER_ID = 100;
+
+/**
+ * Stands in for the bundle manager, only the uris of one bundle have an owner.
+ */
+class StandInBundleMgr : public AppExecFwk::BundleMgrHost {
+public:
+    bool QueryExtensionAbilityInfoByUri(const std::string &uri, int32_t userId,
+        AppExecFwk::ExtensionAbilityInfo &extensionAbilityInfo) override
+    {
+        queryCount_++;
+        if (uri.compare(0, OWNER_URI.length(), OWNER_URI) != 0) {
+            return false;
+        }
+        extensionAbilityInfo.type = AppExecFwk::ExtensionAbilityType::FILESHARE;
+        extensionAbilityInfo.bundleName = OWNER_BUNDLE_NAME;
+        extensionAbilityInfo.applicationInfo.accessTokenId = OWNER_TOKEN_ID;
+        return true;
+    }
+
+    int32_t queryCount_ = 0;
+};
+
+/**
+ * Stands in for the uri permission manager service, it counts the requests and the uris granted.
+ */
+class StandInUriPermissionManager : public UriPermissionManagerStub {
+public:
+    void GrantUriPermission(const Uri &uri, unsigned int flag, const Security::AccessToken::AccessTokenID fromTokenId,
+        const Security::AccessToken::AccessTokenID targetTokenId) override
+    {
+        requestCount_++;
+        uriCount_++;
+    }
+    void GrantUriPermissions(const std::vector<Uri> &uris, unsigned int flag,
+        const Security::AccessToken::AccessTokenID fromTokenId,
+        const Security::AccessToken::AccessTokenID targetTokenId) override
+    {
+        requestCount_++;
+        uriCount_ += static_cast<int32_t>(uris.size());
+        lastUris_ = uris;
+    }
+    bool VerifyUriPermission(const Uri &uri, unsigned int flag,
+        const Security::AccessToken::AccessTokenID tokenId) override
+    {
+        return true;
+    }
+    void RemoveUriPermission(const Security::AccessToken::AccessTokenID tokenId) override
+    {}
+
+    int32_t requestCount_ = 0;
+    int32_t uriCount_ = 0;
+    std::vector<Uri> lastUris_;
+};
+
+Uri GetOwnerUri(int32_t index)
+{
+    return Uri(OWNER_URI + "/photos/" + std::to_string(index) + ".jpg");
+}
+}  // namespace
+
+class UriPermissionManagerTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void UriPermissionManagerTest::SetUpTestCase()
+{}
+
+void UriPermissionManagerTest::TearDownTestCase()
+{}
+
+void UriPermissionManagerTest::SetUp()
+{}
+
+void UriPermissionManagerTest::TearDown()
+{}
+
+/*
+ * Feature: UriOwnerCache
+ * Function: GetOwner
+ * SubFunction: NA
+ * FunctionPoints: The bundle manager is asked once per authority and user.
+ * EnvConditions: NA
+ * CaseDescription: Get the owner of uris of one authority, then of an unknown one.
+ */
+HWTEST_F(UriPermissionManagerTest, UriOwnerCache_001, TestSize.Level1)
+{
+    sptr<StandInBundleMgr> bms = new StandInBundleMgr();
+    UriOwnerCache cache;
+    UriOwnerInfo info;
+    EXPECT_TRUE(cache.GetOwner(bms, GetOwnerUri(1), USER_ID, info));
+    EXPECT_EQ(AppExecFwk::ExtensionAbilityType::FILESHARE, info.type);
+    EXPECT_EQ(OWNER_TOKEN_ID, info.accessTokenId);
+    EXPECT_EQ(OWNER_BUNDLE_NAME, info.bundleName);
+    EXPECT_TRUE(cache.GetOwner(bms, GetOwnerUri(2), USER_ID, info));
+    EXPECT_EQ(1, bms->queryCount_);
+
+    // another user resolves on its own
+    EXPECT_TRUE(cache.GetOwner(bms, GetOwnerUri(1), USER_ID + 1, info));
+    EXPECT_EQ(2, bms->queryCount_);
+
+    // an uri without owner is not cached
+    Uri unknownUri("fileShare:///com.example.unknown/a.jpg");
+    EXPECT_FALSE(cache.GetOwner(bms, unknownUri, USER_ID, info));
+    EXPECT_FALSE(cache.GetOwner(bms, unknownUri, USER_ID, info));
+    EXPECT_EQ(4, bms->queryCount_);
+    EXPECT_FALSE(cache.GetOwner(nullptr, unknownUri, USER_ID, info));
+}
+
+/*
+ * Feature: UriOwnerCache
+ * Function: Invalidate
+ * SubFunction: NA
+ * FunctionPoints: The authorities of a changed bundle are resolved again.
+ * EnvConditions: NA
+ * CaseDescription: Invalidate the owner bundle, by name and by package event.
+ */
+HWTEST_F(UriPermissionManagerTest, UriOwnerCache_002, TestSize.Level1)
+{
+    sptr<StandInBundleMgr> bms = new StandInBundleMgr();
+    UriOwnerCache cache;
+    UriOwnerInfo info;
+    EXPECT_TRUE(cache.GetOwner(bms, GetOwnerUri(1), USER_ID, info));
+    cache.Invalidate("com.example.other");
+    EXPECT_TRUE(cache.GetOwner(bms, GetOwnerUri(1), USER_ID, info));
+    EXPECT_EQ(1, bms->queryCount_);
+
+    cache.Invalidate(OWNER_BUNDLE_NAME);
+    EXPECT_TRUE(cache.GetOwner(bms, GetOwnerUri(1), USER_ID, info));
+    EXPECT_EQ(2, bms->queryCount_);
+
+    Want want;
+    want.SetAction(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED);
+    want.SetElementName(OWNER_BUNDLE_NAME, "");
+    EventFwk::CommonEventData eventData(want);
+    cache.OnPackageEvent(eventData);
+    EXPECT_EQ(0U, cache.owners_.size());
+    EXPECT_TRUE(cache.GetOwner(bms, GetOwnerUri(1), USER_ID, info));
+    EXPECT_EQ(3, bms->queryCount_);
+
+    cache.Clear();
+    EXPECT_EQ(0U, cache.owners_.size());
+}
+
+/*
+ * Feature: UriPermissionManagerStubImpl
+ * Function: VerifyUriPermission
+ * SubFunction: NA
+ * FunctionPoints: Verification resolves the owner once, and finds the granted uris.
+ * EnvConditions: NA
+ * CaseDescription: Verify the owner, a granted target and a stranger.
+ */
+HWTEST_F(UriPermissionManagerTest, UriPermissionManager_001, TestSize.Level1)
+{
+    sptr<StandInBundleMgr> bms = new StandInBundleMgr();
+    sptr<UriPermissionManagerStubImpl> upms = new UriPermissionManagerStubImpl();
+    upms->bundleManager_ = bms;
+    upms->grantTable_.Grant(GetOwnerUri(1), Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID, TARGET_TOKEN_ID,
+        false);
+    EXPECT_TRUE(upms->VerifyUriPermission(GetOwnerUri(1), Want::FLAG_AUTH_WRITE_URI_PERMISSION, OWNER_TOKEN_ID));
+    EXPECT_TRUE(upms->VerifyUriPermission(GetOwnerUri(1), Want::FLAG_AUTH_READ_URI_PERMISSION, TARGET_TOKEN_ID));
+    EXPECT_FALSE(upms->VerifyUriPermission(GetOwnerUri(1), Want::FLAG_AUTH_WRITE_URI_PERMISSION, TARGET_TOKEN_ID));
+    EXPECT_FALSE(upms->VerifyUriPermission(GetOwnerUri(2), Want::FLAG_AUTH_READ_URI_PERMISSION, TARGET_TOKEN_ID));
+    EXPECT_EQ(1, bms->queryCount_);
+}
+
+/*
+ * Feature: UriPermissionManagerProxy
+ * Function: GrantUriPermissions
+ * SubFunction: NA
+ * FunctionPoints: The uris go out in as few requests as a parcel holds.
+ * EnvConditions: NA
+ * CaseDescription: Grant one uri, then more uris than a request carries.
+ */
+HWTEST_F(UriPermissionManagerTest, UriPermissionManager_002, TestSize.Level1)
+{
+    sptr<StandInUriPermissionManager> standIn = new StandInUriPermissionManager();
+    sptr<IUriPermissionManager> proxy = new UriPermissionManagerProxy(standIn);
+    std::vector<Uri> uris = { GetOwnerUri(0) };
+    proxy->GrantUriPermissions(uris, Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID, TARGET_TOKEN_ID);
+    EXPECT_EQ(1, standIn->requestCount_);
+    ASSERT_EQ(1U, standIn->lastUris_.size());
+    EXPECT_TRUE(standIn->lastUris_[0] == uris[0]);
+
+    uris.clear();
+    size_t count = IUriPermissionManager::MAX_URI_COUNT * 2 + 1;
+    for (size_t i = 0; i < count; i++) {
+        uris.emplace_back(GetOwnerUri(static_cast<int32_t>(i)));
+    }
+    proxy->GrantUriPermissions(uris, Want::FLAG_AUTH_READ_URI_PERMISSION, OWNER_TOKEN_ID, TARGET_TOKEN_ID);
+    EXPECT_EQ(4, standIn->requestCount_);
+    EXPECT_EQ(static_cast<int32_t>(count + 1), standIn->uriCount_);
+    ASSERT_EQ(1U, standIn->lastUris_.size());
+    EXPECT_TRUE(standIn->lastUris_[0] == uris.back());
+}
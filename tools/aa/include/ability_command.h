@@ -72,6 +72,9 @@ const std::string HELP_MSG_DUMPSYS = "usage: aa dump <options>\n"
                                   "  -p, --pending                dump pendingWantRecordId\n"
                                   "  -r, --process                dump process\n"
                                   "  -d, --data                   dump the data abilities\n"
+                                  "  -R, --resolve-cache          dump the hit rates of the ability resolve cache\n"
+                                  "  -P, --perf                   dump the lifecycle latencies of abilities by bundle\n"
+                                  "  -I, --ipc                    dump the calls, latencies and sizes of ipc codes\n"
                                   "  -u, --userId                 userId\n"
                                   "  -c, --client                 client\n"
                                   "  -c, -u are auxiliary parameters and cannot be used alone\n"
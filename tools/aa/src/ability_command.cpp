@@ -52,7 +52,7 @@ constexpr struct option LONG_OPTIONS_ApplicationNotRespondin[] = {
     {nullptr, 0, nullptr, 0},
 };
 #endif
-const std::string SHORT_OPTIONS_DUMPSYS = "hal::i:e::p::r::d::u:c";
+const std::string SHORT_OPTIONS_DUMPSYS = "hal::i:e::p::r::d::RPIu:c";
 constexpr struct option LONG_OPTIONS_DUMPSYS[] = {
     {"help", no_argument, nullptr, 'h'},
     {"all", no_argument, nullptr, 'a'},
@@ -62,6 +62,9 @@ constexpr struct option LONG_OPTIONS_DUMPSYS[] = {
     {"pending", no_argument, nullptr, 'p'},
     {"process", no_argument, nullptr, 'r'},
     {"data", no_argument, nullptr, 'd'},
+    {"resolve-cache", no_argument, nullptr, 'R'},
+    {"perf", no_argument, nullptr, 'P'},
+    {"ipc", no_argument, nullptr, 'I'},
     {"userId", required_argument, nullptr, 'u'},
     {"client", no_argument, nullptr, 'c'},
     {nullptr, 0, nullptr, 0},
@@ -575,6 +578,42 @@ ErrCode AbilityManagerShellCommand::RunAsDumpsysCommand()
                 // 'aa dumpsys --data'
                 break;
             }
+            case 'R': {
+                if (isfirstCommand == false) {
+                    isfirstCommand = true;
+                } else {
+                    result = OHOS::ERR_INVALID_VALUE;
+                    resultReceiver_.append(HELP_MSG_DUMPSYS);
+                    return result;
+                }
+                // 'aa dumpsys -R'
+                // 'aa dumpsys --resolve-cache'
+                break;
+            }
+            case 'P': {
+                if (isfirstCommand == false) {
+                    isfirstCommand = true;
+                } else {
+                    result = OHOS::ERR_INVALID_VALUE;
+                    resultReceiver_.append(HELP_MSG_DUMPSYS);
+                    return result;
+                }
+                // 'aa dumpsys -P'
+                // 'aa dumpsys --perf'
+                break;
+            }
+            case 'I': {
+                if (isfirstCommand == false) {
+                    isfirstCommand = true;
+                } else {
+                    result = OHOS::ERR_INVALID_VALUE;
+                    resultReceiver_.append(HELP_MSG_DUMPSYS);
+                    return result;
+                }
+                // 'aa dumpsys -I'
+                // 'aa dumpsys --ipc'
+                break;
+            }
             case 'u': {
                 // 'aa dumpsys -u'
                 // 'aa dumpsys --userId'